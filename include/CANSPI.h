@@ -52,6 +52,11 @@ void CANSPI_ENRx_IRQ(void);
 void CANSPI_CLR_IRQ(void);
 uint8_t CANSPI_Transmit(uCAN_MSG *tempCanMsg);
 uint8_t CANSPI_receive(uCAN_MSG *tempCanMsg);
+// Non blocking variants on SpiDma, see CANSPI.cpp
+uint8_t CANSPI_TransmitDma(uCAN_MSG *tempCanMsg, void (*sent)(void));
+uint8_t CANSPI_isTxDmaBusy(void);
+uint8_t CANSPI_ReceiveDma(void (*received)(uCAN_MSG *tempCanMsg));
+uint32_t CANSPI_GetTxDmaDropped(void);
 uint8_t CANSPI_messagesInBuffer(void);
 uint8_t CANSPI_isBussOff(void);
 uint8_t CANSPI_isRxErrorPassive(void);
@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "digio.h"
+#include "spi_dma.h"
 #include <libopencm3/stm32/spi.h>
 
 // MCP2515 SPI Instruction Set
@@ -254,4 +255,12 @@ uint8_t MCP2515_Get_RxStatus (void);
 
 void MCP2515_Bit_Modify (uint8_t regAddress, uint8_t maskByte, uint8_t dataByte);
 
+// Non blocking variants, queued on SpiDma. done runs in the DMA interrupt and
+// must not call the blocking functions above. false if the queue is full.
+bool MCP2515_Read_RxbSequence_Dma(uint8_t readRxBuffInst, uint8_t rxLength, SpiDma::Callback done, void* ctx);
+bool MCP2515_Load_TxSequence_Dma(uint8_t loadtxBnSidhInst, uint8_t* idReg, uint8_t dlc, uint8_t* txData,
+                                 uint8_t rtsTxBuffInst, SpiDma::Callback done, void* ctx);
+bool MCP2515_Read_Status_Dma(SpiDma::Callback done, void* ctx);
+bool MCP2515_Get_RxStatus_Dma(SpiDma::Callback done, void* ctx);
+
 #endif	/* MCP2515_H */
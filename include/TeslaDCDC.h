@@ -29,10 +29,11 @@
  class TeslaDCDC : public DCDC
  {
  public:
-     void DecodeCAN(int id, uint8_t *data);
+     void DecodeCAN(const CanFrame& frame);
      void DeInit() {}
      void Task100Ms();
      void SetCanInterface(CanHardware* c);
+     void FreshnessChanged(bool fresh);
  
  protected:
      CanHardware* can;
@@ -40,7 +41,7 @@
  private:
      void UpdateInputPowerOffConfirmed(bool monitorOffCondition);
      uint8_t timer500 = 0;
-     uint8_t timeoutCounter = 0;
+     int rxHandle = -1;
      uint8_t dcdcOffCounter = 0;
  };
  
@@ -21,6 +21,7 @@
 #define BMS_H
 #include <stdint.h>
 #include "canhardware.h"
+#include "can_frame.h"
 #include "params.h"
 
 /* This is an interface for a BMS to provide minimal data required
@@ -38,7 +39,7 @@
 class BMS
 {
    public:
-      virtual void DecodeCAN(int, uint8_t *) {};
+      virtual void DecodeCAN(const CanFrame&) {};
       virtual void DeInit() {};
       virtual float MaxChargeCurrent() { return 9999.0; };
       virtual void Task100Ms() {
@@ -48,6 +49,7 @@ class BMS
             Param::SetFloat(Param::BMS_Tmin, 0);
             Param::SetFloat(Param::BMS_Tmax, 0);
       };
+      virtual void Task10Ms() {};
       virtual void SetCanInterface(CanHardware* c) { can = c; }
    protected:
       CanHardware* can;
@@ -0,0 +1,61 @@
+#ifndef CAN_BUS_LOAD_H
+#define CAN_BUS_LOAD_H
+
+#include <stdint.h>
+#include "can_frame.h"
+
+#define CAN_BUS_LOAD_CAN1 0
+#define CAN_BUS_LOAD_CAN2 1
+#define CAN_BUS_LOAD_CAN3 2 // MCP2515
+#define CAN_BUS_LOAD_IFACES 3
+#define CAN_BUS_LOAD_WINDOWS 10 // 100 ms windows per 1 s average
+
+// Bus load estimate per interface from the frames this node sends and
+// receives. Record() adds the worst case length of a frame, stuff bits and
+// interframe space included, to a running bit count, so the receive and
+// transmit paths pay one table lookup and one add. Update() turns the bits
+// of the last 100 ms into loads.
+// Frames dropped by the acceptance filters are not seen, on a bus with a lot
+// of foreign traffic the estimate is a lower bound.
+class CanBusLoad
+{
+public:
+    static void SetBitrate(int iface, uint32_t bitsPerSecond) { bitrate[iface] = bitsPerSecond; }
+
+    static void Record(int iface, bool extended, uint8_t dlc)
+    {
+        bits[iface] = bits[iface] + frameBits[extended][dlc > 8 ? 8 : dlc];
+    }
+    static void Record(int iface, uint32_t id, uint8_t dlc)
+    {
+        Record(iface, (id & CAN_FRAME_EXT_FLAG) != 0 || (id & CAN_FRAME_ID_MASK) > CAN_FRAME_STD_MAX, dlc);
+    }
+
+    // Called every 100 ms
+    static void Update();
+    static void ResetPeak();
+
+    // [0.1 %]
+    static uint32_t GetLoad(int iface) { return load[iface]; }
+    static uint32_t GetLoad1s(int iface) { return load1s[iface]; }
+    static uint32_t GetPeak(int iface) { return peak[iface]; }
+
+    // Worst case: g + 8n + 13 + (g + 8n - 1) / 4 with g = 34 (standard) or 54 (extended)
+    static constexpr uint16_t FrameBits(bool extended, uint8_t dlc)
+    {
+        return (extended ? 54 : 34) + 8 * dlc + 13 + ((extended ? 54 : 34) + 8 * dlc - 1) / 4;
+    }
+
+private:
+    static const uint16_t frameBits[2][9];
+    static volatile uint32_t bits[CAN_BUS_LOAD_IFACES]; // running count, wraps
+    static uint32_t bitrate[CAN_BUS_LOAD_IFACES];
+    static uint32_t lastBits[CAN_BUS_LOAD_IFACES];
+    static uint32_t windows[CAN_BUS_LOAD_IFACES][CAN_BUS_LOAD_WINDOWS];
+    static int window;
+    static uint32_t load[CAN_BUS_LOAD_IFACES];
+    static uint32_t load1s[CAN_BUS_LOAD_IFACES];
+    static uint32_t peak[CAN_BUS_LOAD_IFACES];
+};
+
+#endif // CAN_BUS_LOAD_H
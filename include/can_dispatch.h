@@ -0,0 +1,50 @@
+#ifndef CAN_DISPATCH_H
+#define CAN_DISPATCH_H
+
+#include <stdint.h>
+#include "can_frame.h"
+
+#define CAN_DISPATCH_MAX_ENTRIES 32
+
+typedef void (*CanRxHandler)(void* ctx, const CanFrame& frame);
+
+// Routes received CAN frames to the module that registered the ID.
+// Modules register (ID, handler, context) from SetCanInterface(), the table is
+// kept sorted by ID so every frame costs one binary search.
+// Entries are keyed by the 29 bit ID and the IDE bit, so the legacy
+// flag-encoded extended IDs and the raw ones end up on the same entry.
+// A standard and an extended ID with the same number are only told apart
+// when the driver flags the extended one, which the MCP2515 (CAN3) does.
+// Stm32Can (CAN1, CAN2) drops the IDE bit, an extended frame up to 0x7FF is
+// keyed and dispatched as the standard ID. Handlers get a CanFrame view on
+// the driver's buffer, the payload is not copied.
+class CanDispatch
+{
+public:
+    static void BeginUpdate();
+    static void EndUpdate();
+    static bool Register(uint32_t id, CanRxHandler handler, void* ctx);
+    static int Dispatch(uint32_t id, const uint32_t data[2], uint8_t dlc, uint32_t timeUs = 0);
+    // Same for a caller that already looked the ID up with Find()
+    static int DispatchSlot(int slot, uint32_t id, const uint32_t data[2], uint8_t dlc, uint32_t timeUs);
+    static int Find(uint32_t id);
+    static int GetNumEntries() { return numEntries; }
+    static uint32_t GetId(int slot) { return ids[slot] & CAN_FRAME_ID_MASK; }
+    static bool IsExtended(int slot) { return (ids[slot] & CAN_FRAME_EXT_FLAG) != 0; }
+    static uint32_t GetUnmatched() { return unmatched; }
+
+private:
+    struct Target
+    {
+        CanRxHandler handler;
+        void* ctx;
+    };
+
+    static uint32_t ids[CAN_DISPATCH_MAX_ENTRIES];
+    static Target targets[CAN_DISPATCH_MAX_ENTRIES];
+    static volatile int numEntries;
+    static volatile bool ready;
+    static volatile uint32_t unmatched;
+};
+
+#endif // CAN_DISPATCH_H
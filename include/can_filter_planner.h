@@ -0,0 +1,100 @@
+#ifndef CAN_FILTER_PLANNER_H
+#define CAN_FILTER_PLANNER_H
+
+#include <stdint.h>
+
+#define CAN_FILTER_BANKS 28
+#define CAN_FILTER_MAX_IFACES 2
+#define CAN_FILTER_MAX_IDS 48
+// Room for one accept-all group per ID format on top of the IDs
+#define CAN_FILTER_MAX_GROUPS (CAN_FILTER_MAX_IDS + 2)
+#define CAN_FILTER_UNUSED 0xFF
+
+// Packs the registered receive IDs of all interfaces into the shared bxCAN
+// filter banks of the STM32F107 (CAN1 uses the banks below the CAN2 start
+// bank, CAN2 the rest).
+// Duplicates are removed first, the legacy flag-encoded extended IDs end up on
+// the same entry as the raw ones. Every ID gets an exact list entry (4 standard
+// or 2 extended IDs per bank) as long as the banks suffice. Aligned blocks like
+// 0x418..0x41F are folded into one mask entry when that saves a bank without
+// admitting anything else. Only when the banks run out, neighbouring IDs are
+// merged into masks that admit the fewest unregistered IDs, those have to be
+// rejected in software (CanDispatch unmatched counter).
+class CanFilterPlanner
+{
+public:
+    enum Mode
+    {
+        LIST16, // 4 standard IDs
+        MASK16, // 2 standard ID/mask pairs
+        LIST32, // 2 extended IDs
+        MASK32  // 1 extended ID/mask pair
+    };
+
+    // One bank in the register format of CAN_FiRx, iface is CAN_FILTER_UNUSED
+    // for a bank that is left disabled
+    struct Bank
+    {
+        uint8_t mode;
+        uint8_t iface;
+        uint32_t fr1;
+        uint32_t fr2;
+    };
+
+    static void Begin();
+    // Returns false when the ID table of the interface is full. The plan then
+    // accepts every ID of that format on the interface.
+    static bool Add(int iface, uint32_t id);
+    // Returns the number of banks used or -1 if even accepting everything does not fit
+    static int Plan(int totalBanks = CAN_FILTER_BANKS);
+
+    // Number of hardware banks spanned by the plan, including disabled ones
+    static int GetNumBanks() { return numBanks; }
+    static const Bank& GetBank(int bank) { return banks[bank]; }
+    static int GetFirstBank(int iface) { return firstBank[iface]; }
+    static int GetBanks(int iface) { return ifaces[iface].banks; }
+    static int GetIds(int iface) { return ifaces[iface].numIds; }
+    // Number of unregistered IDs the masks let through
+    static uint32_t GetExtra(int iface);
+    static uint32_t GetExtra();
+    static bool IsOverflowed(int iface);
+
+private:
+    struct Group
+    {
+        uint32_t id;   // base ID, bits outside mask are 0
+        uint32_t mask; // bits that have to match
+        uint8_t ext;
+        uint8_t members;
+    };
+
+    struct Iface
+    {
+        uint32_t ids[CAN_FILTER_MAX_IDS]; // 29-bit ID, bit 31 set for extended
+        Group groups[CAN_FILTER_MAX_GROUPS];
+        int numIds;
+        int numGroups;
+        int banks;
+        uint8_t overflow;
+    };
+
+    static int Need();
+    static int CountBanks(const Group* groups, int count);
+    static uint32_t Covered(const Group& g);
+    static bool Contains(const Group& outer, const Group& inner);
+    static Group Merge(const Group& a, const Group& b);
+    static int MergeInto(const Iface& src, int a, int b, Group* dst, uint32_t& added);
+    static void OpenOverflowed(Iface& f);
+    static void Emit(int iface);
+    static void AddBank(int iface, uint8_t mode, uint32_t fr1, uint32_t fr2);
+
+    static Iface ifaces[CAN_FILTER_MAX_IFACES];
+    static Bank banks[CAN_FILTER_BANKS];
+    static int numBanks;
+    static int firstBank[CAN_FILTER_MAX_IFACES];
+    // Candidate and best merge result of Plan()
+    static Group candidate[CAN_FILTER_MAX_GROUPS];
+    static Group best[CAN_FILTER_MAX_GROUPS];
+};
+
+#endif // CAN_FILTER_PLANNER_H
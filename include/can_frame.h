@@ -0,0 +1,55 @@
+#ifndef CAN_FRAME_H
+#define CAN_FRAME_H
+
+#include <stdint.h>
+
+#define CAN_FRAME_STD_MAX 0x7FFU
+#define CAN_FRAME_ID_MASK 0x1FFFFFFFU
+#define CAN_FRAME_EXT_FLAG 0x80000000U // legacy flag-encoded extended ID
+
+// View on a received frame as the CAN driver hands it over. The payload stays
+// in the driver's word aligned uint32_t[2], decoders and CRC checks read it
+// in place, nothing is copied between the receive interrupt and the decode.
+// Payload byte n is bits 8n..8n+7 of the little endian 64 bit value, the
+// getters work on the words and therefore do not depend on the host byte
+// order. Bytes() aliases the words and matches on little endian machines
+// only (Cortex-M3 and the host tests).
+// The receive time (Timebase, us) travels with the frame, so decoders can
+// timestamp events better than the scheduler tick.
+class CanFrame
+{
+public:
+    constexpr CanFrame(uint32_t canId, const uint32_t* data, uint8_t length, uint32_t rxTimeUs = 0)
+        : id(canId & CAN_FRAME_ID_MASK),
+          ext((canId & CAN_FRAME_EXT_FLAG) != 0 || (canId & CAN_FRAME_ID_MASK) > CAN_FRAME_STD_MAX),
+          dlc(length > 8 ? 8 : length), timeUs(rxTimeUs), words(data)
+    {
+    }
+
+    constexpr uint32_t GetId() const { return id; }
+    constexpr bool IsExtended() const { return ext; }
+    constexpr uint8_t GetDlc() const { return dlc; }
+    constexpr uint32_t GetTimeUs() const { return timeUs; }
+
+    constexpr uint32_t Word(int index) const { return words[index]; }
+    constexpr uint8_t Byte(int index) const { return words[index >> 2] >> ((index & 3) * 8); }
+    const uint32_t* Words() const { return words; }
+    const uint8_t* Bytes() const { return reinterpret_cast<const uint8_t*>(words); }
+
+    // Little endian (Intel) signal of up to 32 bits
+    constexpr uint32_t Field(unsigned start, unsigned length) const
+    {
+        return static_cast<uint32_t>(Raw() >> start) & (length >= 32 ? 0xFFFFFFFFU : (1U << length) - 1);
+    }
+    constexpr uint16_t Le16(unsigned byteOffset) const { return Field(byteOffset * 8, 16); }
+    constexpr uint64_t Raw() const { return (static_cast<uint64_t>(words[1]) << 32) | words[0]; }
+
+private:
+    uint32_t id;
+    bool ext;
+    uint8_t dlc;
+    uint32_t timeUs;
+    const uint32_t* words;
+};
+
+#endif // CAN_FRAME_H
@@ -0,0 +1,65 @@
+#ifndef CAN_GATEWAY_H
+#define CAN_GATEWAY_H
+
+#include <stdint.h>
+#include "canhardware.h"
+
+#define CAN_GATEWAY_IFACES 3 // CAN1, CAN2, CAN3 (MCP2515)
+#define CAN_GATEWAY_CAN3 2   // the only interface that flags extended IDs up to 0x7FF
+#define CAN_GATEWAY_MAX_ROUTES 4
+#define CAN_GATEWAY_MAX_OPEN_BITS 4 // per route, every matching ID is registered
+
+// Forwards frames between the CAN interfaces straight from the receive
+// callback into the TX queue of the destination, without going through
+// params and the 100 ms tasks of the modules.
+// A route matches the IDs that equal its ID in all bits not set in the
+// ignore mask and have the same format (IDE bit). The optional new ID
+// replaces the bits that are not ignored, so a masked range is moved as a
+// block. Frames go out in the format of the route.
+// Stm32Can hands CAN1 and CAN2 frames over without the IDE bit, an extended
+// ID up to 0x7FF looks like a standard one. Extended routes from these
+// interfaces therefore need IDs above 0x7FF, and a standard route also
+// forwards extended frames with the same number. The routed IDs are registered as
+// user messages of the source interface, which lets them pass the filters.
+// Forward() hands the driver's payload buffer to Send() unchanged.
+class CanGateway
+{
+public:
+    struct Route
+    {
+        uint32_t id;
+        uint32_t ignore;    // don't care bits of the ID
+        uint32_t newId;     // 0 keeps the ID
+        uint8_t src;
+        uint8_t dst;
+        bool ext;           // 29 bit IDs
+        uint32_t forwarded;
+        uint32_t dropped;   // destination interface missing
+    };
+
+    // The interface array of main.cpp, indexed like the routes
+    static void SetInterfaces(CanHardware** interfaces) { canInterface = interfaces; }
+
+    static void BeginUpdate();
+    static bool AddRoute(int src, uint32_t id, uint32_t ignore, int dst, uint32_t newId, bool ext);
+    static void EndUpdate();
+    static void RegisterIds();
+
+    // Called by CanRx for every frame of interface src that passed CanRateLimit
+    static void Forward(int src, uint32_t id, uint32_t data[2], uint8_t dlc);
+
+    static int GetNumRoutes() { return numRoutes; }
+    static const Route& GetRoute(int index) { return routes[index]; }
+    static uint32_t GetForwarded();
+    static uint32_t GetDropped();
+    static uint32_t GetMaxCycles() { return maxCycles; }
+
+private:
+    static CanHardware** canInterface;
+    static Route routes[CAN_GATEWAY_MAX_ROUTES];
+    static volatile int numRoutes;
+    static volatile bool ready;
+    static uint32_t maxCycles;
+};
+
+#endif // CAN_GATEWAY_H
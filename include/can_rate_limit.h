@@ -0,0 +1,45 @@
+#ifndef CAN_RATE_LIMIT_H
+#define CAN_RATE_LIMIT_H
+
+#include <stdint.h>
+#include "can_dispatch.h"
+
+// Token bucket per registered CAN ID, indexed by the CanDispatch slot like
+// CanRxStats. CanRx asks Admit() in the receive interrupt before the frame is
+// queued or decoded, so a node babbling one ID at the full bus rate costs a
+// lookup and a few adds per frame instead of a decode.
+// The bucket holds credit in us: it fills with the elapsed time up to
+// burst periods and every frame takes one period (1 / rate), there is no
+// divide per frame. A rate of 0 turns the limiter off.
+class CanRateLimit
+{
+public:
+    static void SetBudget(uint32_t framesPerSecond, uint32_t burst);
+    // Called whenever the dispatch slots are reassigned
+    static void Reset();
+    static bool Admit(int slot, uint32_t timeUs);
+    // Called periodically, remembers the ID with the most drops since the last call
+    static void Update();
+
+    static uint32_t GetDropped() { return dropped; }
+    static uint32_t GetDropped(int slot) { return entries[slot].dropped; }
+    // Last ID that was limited, 0 if none since Reset()
+    static uint32_t GetOffender() { return offender; }
+
+private:
+    struct Entry
+    {
+        uint32_t lastUs;
+        uint32_t credit;   // [us]
+        uint32_t dropped;
+        uint32_t reported; // dropped at the last Update()
+    };
+
+    static Entry entries[CAN_DISPATCH_MAX_ENTRIES];
+    static uint32_t periodUs;
+    static uint32_t maxCredit;
+    static volatile uint32_t dropped;
+    static uint32_t offender;
+};
+
+#endif // CAN_RATE_LIMIT_H
@@ -0,0 +1,30 @@
+#ifndef CAN_RX_H
+#define CAN_RX_H
+
+#include <stdint.h>
+
+// Receive path of all user messages, from the CAN callback to the gateway
+// and the module decoders. In immediate mode Receive() dispatches right away, in deferred
+// mode (can_rx_deferred) it only queues the frame and ProcessQueue() decodes
+// it from the 10 ms task.
+// Every frame is stamped with Timebase on arrival, decoders find the stamp
+// in CanFrame::GetTimeUs() in both modes.
+// CanRateLimit drops the frames of an ID that exceeds its budget before
+// they are forwarded, queued or decoded.
+// Kept out of main.cpp so the host load test runs the same code.
+class CanRx
+{
+public:
+    // iface indexes canInterface in main.cpp, the source of the gateway routes
+    static void Receive(int iface, uint32_t id, uint32_t data[2], uint8_t dlc, uint32_t time);
+    static void ProcessQueue();
+    // Worst case cost of the receive statistics per frame [cycles]
+    static uint32_t GetStatsCycles() { return statsCycles; }
+
+private:
+    static void Record(int slot, uint32_t timestamp);
+
+    static volatile uint32_t statsCycles;
+};
+
+#endif // CAN_RX_H
@@ -0,0 +1,38 @@
+#ifndef CAN_RX_QUEUE_H
+#define CAN_RX_QUEUE_H
+
+#include <stdint.h>
+
+#define CAN_RX_QUEUE_SIZE 32 // must be a power of 2
+
+struct CanRxFrame
+{
+    uint32_t id;
+    uint32_t data[2];
+    uint32_t timestamp; // ms
+    uint32_t timeUs;    // Timebase
+    uint8_t dlc;
+};
+
+// Single producer/single consumer ring between the CAN receive interrupt
+// and the 10 ms task. The RX interrupts of CAN1 and CAN2 share one priority,
+// so they never preempt each other and count as a single producer.
+// Push() only copies the frame, decoding happens in the task that drains the ring.
+class CanRxQueue
+{
+public:
+    static bool Push(uint32_t id, const uint32_t data[2], uint8_t dlc, uint32_t timestamp, uint32_t timeUs = 0);
+    static bool Pop(CanRxFrame& frame);
+    static int Count() { return head - tail; }
+    static int GetHighWaterMark() { return highWaterMark; }
+    static uint32_t GetOverflows() { return overflows; }
+
+private:
+    static CanRxFrame frames[CAN_RX_QUEUE_SIZE];
+    static volatile uint32_t head; // written by the producer only
+    static volatile uint32_t tail; // written by the consumer only
+    static volatile int highWaterMark;
+    static volatile uint32_t overflows;
+};
+
+#endif // CAN_RX_QUEUE_H
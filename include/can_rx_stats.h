@@ -0,0 +1,49 @@
+#ifndef CAN_RX_STATS_H
+#define CAN_RX_STATS_H
+
+#include <stdint.h>
+#include "can_dispatch.h"
+
+// Receive statistics per registered CAN ID, indexed by the CanDispatch slot.
+// Record() is called for every dispatched frame and costs a handful of
+// compares and adds; the divide for lost frames only runs when a gap is
+// found. The nominal period of each ID is learned from the traffic itself
+// (running average of the gaps that are not losses), so no configuration
+// is needed per message.
+class CanRxStats
+{
+public:
+    struct Entry
+    {
+        uint32_t count;    // frames received
+        uint32_t lastSeen; // timestamp of the last frame [ms]
+        uint32_t sumGap;   // sum of all inter-arrival times [ms]
+        uint32_t missed;   // frames missing according to the learned period
+        uint32_t minGap;   // [ms]
+        uint32_t maxGap;   // [ms]
+        uint32_t period;   // learned period [1/16 ms], 0 until the second frame
+    };
+
+    static void Reset();
+    static void Record(int slot, uint32_t timestamp);
+    // Called periodically with the current time, computes the aggregates
+    static void Update(uint32_t time);
+
+    static const Entry& Get(int slot) { return entries[slot]; }
+    static uint32_t GetMeanGap(int slot);
+    static uint32_t GetAge(int slot) { return now - entries[slot].lastSeen; }
+    static bool IsStale(int slot);
+
+    static int GetActive() { return active; } // IDs received at least once
+    static int GetStale() { return stale; }
+    static uint32_t GetMissed() { return missed; }
+
+private:
+    static Entry entries[CAN_DISPATCH_MAX_ENTRIES];
+    static uint32_t now;
+    static int active;
+    static int stale;
+    static uint32_t missed;
+};
+
+#endif // CAN_RX_STATS_H
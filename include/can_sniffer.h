@@ -0,0 +1,84 @@
+#ifndef CAN_SNIFFER_H
+#define CAN_SNIFFER_H
+
+#include <stdint.h>
+
+#define CAN_SNIFFER_BUFFER 1024 // power of 2
+#define CAN_SNIFFER_MAX_FILTERS 4
+#define CAN_SNIFFER_MAGIC "ZSNF"
+#define CAN_SNIFFER_VERSION 2
+#define CAN_SNIFFER_SYNC 0xA5
+#define CAN_SNIFFER_OVERFLOW 0x0F // DLC code of the overflow record
+
+// Binary CAN log streamed over the terminal UART. Captured frames are encoded
+// into a ring buffer right in the receive and transmit paths, the main loop
+// hands the buffer to the UART TX DMA in contiguous chunks. The terminal is
+// muted while the capture runs, any received character stops it.
+// A frame that does not fit is counted and dropped, the writer never waits.
+//
+// Stream: "ZSNF", version, then one record per frame
+//   sync     CAN_SNIFFER_SYNC
+//   length   number of bytes that follow in this record
+//   header   bit 7..6 interface, bit 5 TX, bit 4 extended ID, bit 3..0 DLC
+//   delta    us since the previous record, LEB128 (7 bits per byte, LSB first)
+//   id       2 bytes (standard) or 4 bytes (extended), little endian
+//   payload  DLC bytes
+// DLC code CAN_SNIFFER_OVERFLOW marks lost frames, the delta is followed by
+// the number of frames lost (LEB128) instead of ID and payload.
+// Sync and length let a reader skip anything that is not a valid record.
+// Timestamps are Timebase microseconds.
+// tools/sniff2candump.cpp turns a capture into candump log format.
+class CanSniffer
+{
+public:
+    // Interface bit mask and directions, no filter passes all IDs
+    static void Select(uint8_t ifaces, bool rx, bool tx);
+    static bool AddFilter(uint32_t id, uint32_t mask);
+    static void Start(uint32_t timeUs);
+    static void Stop() { active = false; }
+    static bool IsActive() { return active; }
+
+    static void Capture(int iface, bool tx, uint32_t id, const uint8_t* data, uint8_t dlc, uint32_t timeUs)
+    {
+        if (active)
+            Record(iface, tx, id, data, dlc, timeUs);
+    }
+
+    // Consumer side: the oldest contiguous block of encoded bytes, it stays
+    // in the buffer until Consume() is called after the transfer
+    static int Peek(const uint8_t*& data);
+    static void Consume();
+    static bool IsSending() { return inFlight > 0; }
+
+    static uint32_t GetOverflows() { return overflows; }
+
+private:
+    struct Filter
+    {
+        uint32_t id;
+        uint32_t mask;
+    };
+
+    static void Record(int iface, bool tx, uint32_t id, const uint8_t* data, uint8_t dlc, uint32_t timeUs);
+    static bool Passes(uint32_t id);
+    static int Free();
+    static void Put(uint8_t b);
+    static void PutVarint(uint32_t value);
+    static uint32_t BeginRecord();
+    static void EndRecord(uint32_t start);
+
+    static volatile bool active;
+    static uint8_t ifaceMask;
+    static uint8_t dirMask;
+    static Filter filters[CAN_SNIFFER_MAX_FILTERS];
+    static int numFilters;
+    static uint8_t buffer[CAN_SNIFFER_BUFFER];
+    static volatile uint32_t head; // written by Record()
+    static volatile uint32_t tail; // written by Consume()
+    static uint32_t inFlight;
+    static uint32_t lastUs;
+    static uint32_t lost;          // not yet reported in the stream
+    static volatile uint32_t overflows;
+};
+
+#endif // CAN_SNIFFER_H
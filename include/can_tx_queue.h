@@ -0,0 +1,48 @@
+#ifndef CAN_TX_QUEUE_H
+#define CAN_TX_QUEUE_H
+
+#include <stdint.h>
+
+#define CAN_TX_QUEUE_DEPTH 16
+#define CAN_TX_MAX_URGENT 8
+
+struct CanTxFrame
+{
+    uint32_t id;
+    uint32_t data[2];
+    uint32_t key;      // lower goes first
+    uint32_t enqueued; // time of Push()
+    uint8_t len;
+};
+
+// Bounded software TX queue of one CAN interface, ordered like the bus
+// arbitration: the lowest ID goes first, frames with the same ID keep their
+// order. IDs registered with SetUrgent() go ahead of all others, so safety
+// frames are never held back by bulk traffic with lower IDs.
+// When the queue is full a frame of higher priority evicts the lowest one.
+// Not interrupt safe by itself, the caller has to serialize access.
+class CanTxQueue
+{
+public:
+    bool Push(uint32_t id, const uint32_t data[2], uint8_t len, uint32_t time);
+    bool Pop(CanTxFrame& frame, uint32_t time);
+    int Count() const { return count; }
+    int GetMaxDepth() const { return maxDepth; }
+    uint32_t GetFailures() const { return failures; }
+    uint32_t GetMaxLatency() const { return maxLatency; }
+
+    static bool SetUrgent(uint32_t id);
+    static bool IsUrgent(uint32_t id);
+
+private:
+    CanTxFrame frames[CAN_TX_QUEUE_DEPTH]; // sorted by descending key
+    int count = 0;
+    int maxDepth = 0;
+    uint32_t failures = 0; // frames rejected or evicted
+    uint32_t maxLatency = 0;
+
+    static uint32_t urgentIds[CAN_TX_MAX_URGENT];
+    static int numUrgent;
+};
+
+#endif // CAN_TX_QUEUE_H
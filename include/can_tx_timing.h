@@ -0,0 +1,57 @@
+#ifndef CAN_TX_TIMING_H
+#define CAN_TX_TIMING_H
+
+#include <stdint.h>
+
+#define CAN_TX_TIMING_MAX_IDS 40
+
+// Transmit period statistics per CAN ID, taken when a frame is handed to a
+// mailbox rather than when a module calls Send(), so queueing delays and
+// task jitter show up in the numbers. Senders declare the period of their
+// messages (GenMsgCycleTime of the DBC), IDs sent without a declaration are
+// tracked too and only have no reference to be checked against.
+// A pause of more than CAN_TX_TIMING_PAUSE_PERIODS periods (TX switched off)
+// ends a measurement instead of being counted as one long period.
+class CanTxTiming
+{
+public:
+    struct Entry
+    {
+        uint32_t id;
+        uint32_t lastTx;   // timestamp of the last hand-over [ticks]
+        uint32_t count;    // periods measured
+        uint32_t pauses;
+        uint64_t sumUs;
+        uint32_t minUs;
+        uint32_t maxUs;
+        uint16_t periodMs; // declared, 0 if unknown
+        bool running;      // lastTx is valid
+    };
+
+    static void SetTicksPerUs(uint32_t ticks) { ticksPerUs = ticks; }
+    static bool Declare(uint32_t id, uint16_t periodMs);
+    static void Record(uint32_t id, uint32_t ticks);
+    // Called periodically with the current time, must run more often than the timestamps wrap
+    static void Update(uint32_t ticks, int tolerancePct);
+    // Clears the measurements, the declared periods are kept
+    static void Reset();
+
+    static int GetNumEntries() { return numEntries; }
+    static const Entry& Get(int index) { return entries[index]; }
+    static uint32_t GetMeanUs(const Entry& e);
+    static uint32_t GetJitterUs(const Entry& e) { return e.count ? e.maxUs - e.minUs : 0; }
+    static bool IsViolation(const Entry& e, int tolerancePct);
+    static int GetViolations() { return violations; }
+
+private:
+    static Entry* Find(uint32_t id);
+    static Entry* Add(uint32_t id);
+    static uint32_t PauseUs(const Entry& e);
+
+    static Entry entries[CAN_TX_TIMING_MAX_IDS];
+    static int numEntries;
+    static uint32_t ticksPerUs;
+    static int violations;
+};
+
+#endif // CAN_TX_TIMING_H
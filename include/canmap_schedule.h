@@ -0,0 +1,46 @@
+#ifndef CANMAP_SCHEDULE_H
+#define CANMAP_SCHEDULE_H
+
+#include <stdint.h>
+
+#define CANMAP_SCHEDULE_MAX 10 // TX messages of CanMap (MAX_MESSAGES)
+#define CANMAP_SCHEDULE_TICK_MS 10
+
+// Period and phase per CanMap TX message. CanMap only knows SendAll(), so the
+// 10 ms task calls it whenever at least one message is due and Pass() is
+// installed as TX gate of the interface meanwhile. The gate drops the mapped
+// messages that are not due in this tick and lets everything else through
+// (SDO replies sent from the receive interrupt, other modules).
+// Messages sharing a period get consecutive phases, so e.g. four 100 ms
+// messages go out in four different ticks instead of the same one.
+class CanMapSchedule
+{
+public:
+    struct Entry
+    {
+        uint32_t id;
+        uint16_t periodMs;
+        uint16_t phaseMs;
+        uint32_t sent;
+    };
+
+    // Rebuilds the table, messages are added in CanMap order
+    static void Begin();
+    static bool Add(uint32_t id, uint16_t periodMs);
+
+    // Called every CANMAP_SCHEDULE_TICK_MS, true if a message is due
+    static bool Advance();
+    static bool Pass(uint32_t canId);
+
+    static int GetNumEntries() { return numEntries; }
+    static const Entry& Get(int index) { return entries[index]; }
+
+private:
+    static bool IsDue(const Entry& e);
+
+    static Entry entries[CANMAP_SCHEDULE_MAX];
+    static int numEntries;
+    static uint32_t tick;
+};
+
+#endif // CANMAP_SCHEDULE_H
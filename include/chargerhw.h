@@ -21,6 +21,7 @@
 #define CHARGERHW_H_INCLUDED
 
 #include "canhardware.h"
+#include "can_frame.h"
 
 class Chargerhw
 {
@@ -30,7 +31,7 @@ public:
    virtual void Off() {} //Default does nothing
    virtual void Task100Ms() {} //Default does nothing
    virtual void Task200Ms() {} //Default does nothing
-   virtual void DecodeCAN(int, uint32_t*) {};
+   virtual void DecodeCAN(const CanFrame&) {};
    virtual bool ControlCharge(bool, bool) {return false;};
    virtual void DeInit() {} //called when switching to another charger, similar to a destructor
    virtual void SetCanInterface(CanHardware* c) { can = c; }
@@ -0,0 +1,30 @@
+#ifndef CRC_SERVICE_H
+#define CRC_SERVICE_H
+
+#include <stdint.h>
+
+#define CRC_SERVICE_MAX_TRIES 2
+
+// Arbitrates the STM32 CRC peripheral between the CAN receive interrupt and
+// the scheduler tasks without disabling interrupts.
+// Every user bumps a generation counter before resetting the peripheral and
+// checks it again after reading the result. If it changed, a higher priority
+// context used the unit in between and the calculation is repeated. After
+// CRC_SERVICE_MAX_TRIES attempts the table driven software CRC is used,
+// it produces identical results (poly 0x04C11DB7, init 0xFFFFFFFF, MSB first,
+// no final xor).
+class CrcService
+{
+public:
+    static uint32_t Calculate(const uint32_t* words, uint32_t count);
+    static uint32_t CalculateSoftware(const uint32_t* words, uint32_t count);
+    static uint32_t GetRetries() { return retries; }
+    static uint32_t GetFallbacks() { return fallbacks; }
+
+private:
+    static volatile uint32_t generation;
+    static volatile uint32_t retries;
+    static volatile uint32_t fallbacks;
+};
+
+#endif // CRC_SERVICE_H
@@ -21,12 +21,13 @@
 #define DCDC_H
 #include <stdint.h>
 #include "canhardware.h"
+#include "can_frame.h"
 #include "params.h"
 
 class DCDC
 {
    public:
-      virtual void DecodeCAN(int, uint8_t *) {};
+      virtual void DecodeCAN(const CanFrame&) {};
       virtual void DeInit() {};
       virtual void Task1Ms() {};
       virtual void Task10Ms() {};
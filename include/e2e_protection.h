@@ -0,0 +1,85 @@
+#ifndef E2E_PROTECTION_H
+#define E2E_PROTECTION_H
+
+#include <stdint.h>
+#include "can_frame.h"
+
+// End-to-end protection (rolling counter + CRC) of a single CAN message.
+// One instance is bound to one TX or RX message ID. Protect() fills in the
+// counter and CRC of an outgoing frame in place, Check() verifies an incoming
+// frame in place and keeps link quality statistics. Received frames are
+// checked on their CanFrame view, the CRC32 profile then works on the words
+// as the driver delivered them.
+// All instances chain themselves into a list so they can be reported from the terminal.
+class E2EProtection
+{
+public:
+    enum Profile
+    {
+        // VAG: CRC8 (poly 0x2F + magic byte) in byte 0, 4 bit counter in the low nibble of byte 1
+        PROFILE_VAG,
+        // TeensyBMS/mVCU: low byte of the STM32 CRC32 over bytes 0..6 in byte 7, 4 bit counter in byte 6
+        PROFILE_CRC32_BYTE7
+    };
+
+    enum Direction
+    {
+        DIR_TX,
+        DIR_RX
+    };
+
+    struct Stats
+    {
+        uint32_t ok;           // frames with valid CRC and expected counter
+        uint32_t crcErrors;    // frames dropped because of a CRC mismatch
+        uint32_t counterJumps; // frames whose counter was not the expected successor
+        uint32_t lost;         // frames skipped according to the counter
+    };
+
+    // strictCounter: Check() fails on counter jumps (otherwise they are only counted)
+    E2EProtection(Profile p, Direction d, uint32_t id, bool strictCounter = false);
+    ~E2EProtection();
+
+    void Protect(uint8_t* data, uint8_t length);
+    // Protect() in two steps, for frames signed ahead of time: Sign() fills in
+    // the given counter and the CRC, NextCounter() hands out the counter of
+    // the next frame sent.
+    void Sign(uint8_t* data, uint8_t length, uint8_t counterValue) const;
+    uint8_t NextCounter();
+    bool Check(const uint8_t* data, uint8_t length);
+    bool Check(const CanFrame& frame);
+    void Reset();
+
+    uint32_t GetId() const { return id; }
+    Profile GetProfile() const { return profile; }
+    Direction GetDirection() const { return direction; }
+    uint8_t GetCounter() const { return counter; }
+    const Stats& GetStats() const { return stats; }
+
+    static E2EProtection* First() { return first; }
+    E2EProtection* GetNext() const { return next; }
+
+    static uint8_t Crc32Byte7(const uint8_t* data);
+    static uint8_t Crc32Byte7(uint32_t word0, uint32_t word1);
+
+private:
+    E2EProtection(const E2EProtection&) = delete;
+    E2EProtection& operator=(const E2EProtection&) = delete;
+
+    uint8_t CounterOf(const uint8_t* data) const;
+    bool CrcValid(const uint8_t* data, uint8_t length) const;
+    bool Accept(uint8_t rxCounter);
+
+    const Profile profile;
+    const Direction direction;
+    const uint32_t id;
+    const bool strictCounter;
+    uint8_t counter;
+    bool haveCounter;
+    Stats stats;
+
+    E2EProtection* next;
+    static E2EProtection* first;
+};
+
+#endif // E2E_PROTECTION_H
@@ -30,9 +30,11 @@
   ERROR_MESSAGE_ENTRY(DCDC_THERMAL_LIMIT, ERROR_DISPLAY) \
   ERROR_MESSAGE_ENTRY(DCDC_VOLTAGE_REG_FAULT, ERROR_DISPLAY) \
   ERROR_MESSAGE_ENTRY(DCDC_CALIBRATION_FAULT, ERROR_DISPLAY) \
+  ERROR_MESSAGE_ENTRY(CHARGER_TIMEOUT, ERROR_DISPLAY) \
   ERROR_MESSAGE_ENTRY(HV_CONTACTOR_TIMEOUT_CLOSING, ERROR_DISPLAY) \
   ERROR_MESSAGE_ENTRY(HV_CONTACTOR_TIMEOUT_OPENING, ERROR_DISPLAY) \
-  ERROR_MESSAGE_ENTRY(HV_CONTACTOR_TIMEOUT_STOP_CONSUMERS, ERROR_DISPLAY)
+  ERROR_MESSAGE_ENTRY(HV_CONTACTOR_TIMEOUT_STOP_CONSUMERS, ERROR_DISPLAY) \
+  ERROR_MESSAGE_ENTRY(CAN_FILTER_OVERFLOW, ERROR_DISPLAY)
 
 
 #endif // ERRORMESSAGE_PRJ_H_INCLUDED
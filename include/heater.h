@@ -6,6 +6,8 @@
 #include "digio.h"
 #include "lvdu.h"
 #include "errormessage.h"
+#include "latency_probe.h"
+#include "timebase.h"
 
 /*
     Heater Control Function – Logic Overview
@@ -150,6 +152,8 @@ public:
 
                 if (contactor_on_delay_timer >= Param::GetInt(Param::heater_contactor_on_delay) / 10)
                 {
+                    if (!heater_active)
+                        LatencyProbe::Signal(LatencyProbe::EVT_HEATER_CONTACTOR_ON, Timebase::Now());
                     DigIo::heater_contactor_out.Set(); //on
                     heater_active = true;
                 }
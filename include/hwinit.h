@@ -30,6 +30,7 @@ void clock_setup(void);
 void nvic_setup(void);
 void rtc_setup(void);
 void tim_setup(void);
+void spi2_setup(void);
 void write_bootloader_pininit();
 
 #ifdef __cplusplus
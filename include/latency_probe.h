@@ -0,0 +1,72 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <stdint.h>
+
+#define LATENCY_PROBE_BUCKETS 13
+
+// End-to-end response times between two events, e.g. from the HV request
+// leaving in 0x437 to the BMS reporting the contactors closed in 0x41C.
+// Modules signal events with a Timebase stamp: the receive time of the
+// frame that carried it, or the mailbox hand-over of a frame via SignalOnTx().
+// A probe is armed by its start event and records the time to its stop
+// event in a histogram. A start event while armed restarts the measurement
+// and is counted as aborted.
+class LatencyProbe
+{
+public:
+    enum Event
+    {
+        EVT_HV_REQUEST_ON,      // 0x437 with HV request set handed to the mailbox
+        EVT_HV_REQUEST_OFF,
+        EVT_CONTACTOR_CLOSED,   // 0x41C contactor state CLOSED received
+        EVT_CONTACTOR_OPEN,
+        EVT_HEATER_REQUEST_ON,  // 0x43A heater contactor request received
+        EVT_HEATER_CONTACTOR_ON,// heater_contactor_out set
+        EVT_LAST
+    };
+
+    struct Definition
+    {
+        const char* name;
+        Event start;
+        Event stop;
+    };
+
+    struct Probe
+    {
+        bool armed;
+        uint32_t startUs;
+        uint32_t count;
+        uint32_t aborted;
+        uint32_t minUs;
+        uint32_t maxUs;
+        uint32_t lastUs;
+        uint64_t sumUs;
+        uint32_t histogram[LATENCY_PROBE_BUCKETS];
+    };
+
+    static void Signal(Event event, uint32_t timeUs);
+    // The event happens when the next frame with this ID reaches a mailbox
+    static void SignalOnTx(Event event, uint32_t canId);
+    static bool TxPending() { return txPending != 0; }
+    static void OnTx(uint32_t canId, uint32_t timeUs);
+    static void Reset();
+
+    static int GetNumProbes();
+    static const Probe& Get(int index);
+    static const char* GetName(int index) { return definitions[index].name; }
+    static uint32_t GetMeanUs(const Probe& p) { return p.count ? p.sumUs / p.count : 0; }
+    // Upper bound of a bucket [ms], 0 for the last one (open ended)
+    static uint32_t GetBucketLimitMs(int bucket);
+
+private:
+    static void Record(Probe& p, uint32_t us);
+
+    static const Definition definitions[];
+    static Probe probes[];
+    static uint32_t txIds[EVT_LAST];
+    static volatile uint32_t txPending; // bit mask of events
+};
+
+#endif // LATENCY_PROBE_H
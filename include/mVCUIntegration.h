@@ -3,24 +3,30 @@
 
 #include <stdint.h>
 #include "canhardware.h"
+#include "can_frame.h"
+#include "e2e_protection.h"
+#include "tx_on_change.h"
 
 class mVCUIntegration
 {
 public:
     void SetCanInterface(CanHardware* c);
-    void DecodeCAN(int id, uint8_t* data, uint8_t dlc);
+    void DecodeCAN(const CanFrame& frame);
     void Task100Ms();
+    void Task10Ms();
+    void FreshnessChanged(bool fresh);
 
 private:
-    bool CheckCrc(const uint8_t* data) const;
-    bool ValidateCounter(uint8_t counter);
+    void SendStatus(uint32_t elapsedMs);
 
     CanHardware* can = nullptr;
-    uint8_t txCounter = 0;
     bool heaterCanCloseRequest = false;
-    bool haveSeenValidCounter = false;
-    uint8_t lastRxCounter = 0;
-    uint8_t rxTimeoutTicks = 0;
+    int rxHandle = -1;
+    // Heater control must arrive with the expected counter, everything else is dropped
+    E2EProtection rxE2E { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x43A, true };
+    E2EProtection txE2E { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x439 };
+    TxOnChange chargePowerTx;
+    TxOnChange heaterStatusTx;
 };
 
 #endif // MVCUINTEGRATION_H
@@ -0,0 +1,43 @@
+#ifndef MCP2515_CAN_H
+#define MCP2515_CAN_H
+
+#include <stdint.h>
+#include "canhardware.h"
+#include "can_tx_queue.h"
+#include "CANSPI.h"
+
+// CAN3: CanHardware on the MCP2515 behind SPI2. All transfers run on SpiDma,
+// neither Send() nor the reception waits for the SPI bus.
+// The interrupt output of the controller is not wired. Poll() from the 1 ms
+// task reads the RX status, every received frame starts the next read right
+// away until both RX buffers are empty. Received frames are handed to the
+// callbacks from the SPI2 RX DMA interrupt.
+// The acceptance filters of the MCP2515 pass all frames (CANSPI_Initialize),
+// the user messages are not written to the controller.
+// Frames wait in a CanTxQueue, one at a time is loaded into a free TX buffer.
+class Mcp2515Can : public CanHardware
+{
+public:
+    // SPI2 has to be set up by spi2_setup(), the bit rate is CAN3Speed
+    Mcp2515Can();
+
+    // CAN3Speed also offers the low rates of body CAN buses, see CAN3SPEEDS
+    void SetBaudrate(enum baudrates baudrate) override;
+
+    using CanHardware::Send;
+    void Send(uint32_t canId, uint32_t data[2], uint8_t len) override;
+
+    static void Poll();
+    const CanTxQueue& GetTxQueue() const { return txQueue; }
+
+private:
+    void ConfigureFilters() override {}
+    static void Received(uCAN_MSG* msg);
+    static void StartTx();
+
+    CanTxQueue txQueue;
+
+    static Mcp2515Can* instance;
+};
+
+#endif // MCP2515_CAN_H
@@ -0,0 +1,8215 @@
+// Generated by tools/dbc_codegen from MLBevo_Gen2_MLBevo_HCAN_KMatrix_V8.18.01F_20190718_SE.dbc
+// Do not edit, change the message list in the Makefile and run "make dbc"
+#ifndef MLB_DBC_H
+#define MLB_DBC_H
+
+#include <stdint.h>
+
+#define PNC_TRIGGER_OBC_CGW_ENUM "0=PnC_Init, 1=PnC_NoNeeds, 2=PnC_ReportUnknownRootCert, 3=PnC_CreateVehicleCert, 4=PnC_DP_RootCertContainer, 5=PnC_DP_CapabilityIsoTpInfo, 6=PnC_DP_Contract, 7=PnC_DP_VehicleCert, 15=PnC_Error"
+enum PnC_Trigger_OBC_cGW_Enum
+{
+    PNC_TRIGGER_OBC_CGW_PNC_INIT = 0,
+    PNC_TRIGGER_OBC_CGW_PNC_NONEEDS = 1,
+    PNC_TRIGGER_OBC_CGW_PNC_REPORTUNKNOWNROOTCERT = 2,
+    PNC_TRIGGER_OBC_CGW_PNC_CREATEVEHICLECERT = 3,
+    PNC_TRIGGER_OBC_CGW_PNC_DP_ROOTCERTCONTAINER = 4,
+    PNC_TRIGGER_OBC_CGW_PNC_DP_CAPABILITYISOTPINFO = 5,
+    PNC_TRIGGER_OBC_CGW_PNC_DP_CONTRACT = 6,
+    PNC_TRIGGER_OBC_CGW_PNC_DP_VEHICLECERT = 7,
+    PNC_TRIGGER_OBC_CGW_PNC_ERROR = 15
+};
+
+#define ZV_FT_VERRIEGELN_ENUM "0=FT_nicht_verriegeln, 1=FT_verriegeln"
+enum ZV_FT_verriegeln_Enum
+{
+    ZV_FT_VERRIEGELN_FT_NICHT_VERRIEGELN = 0,
+    ZV_FT_VERRIEGELN_FT_VERRIEGELN = 1
+};
+
+#define ZV_FT_ENTRIEGELN_ENUM "0=FT_nicht_entriegeln, 1=FT_entriegeln"
+enum ZV_FT_entriegeln_Enum
+{
+    ZV_FT_ENTRIEGELN_FT_NICHT_ENTRIEGELN = 0,
+    ZV_FT_ENTRIEGELN_FT_ENTRIEGELN = 1
+};
+
+#define ZV_BT_VERRIEGELN_ENUM "0=BT_nicht_verriegeln, 1=BT_verriegeln"
+enum ZV_BT_verriegeln_Enum
+{
+    ZV_BT_VERRIEGELN_BT_NICHT_VERRIEGELN = 0,
+    ZV_BT_VERRIEGELN_BT_VERRIEGELN = 1
+};
+
+#define ZV_BT_ENTRIEGELN_ENUM "0=BT_nicht_entriegeln, 1=BT_ist_zu_entriegeln"
+enum ZV_BT_entriegeln_Enum
+{
+    ZV_BT_ENTRIEGELN_BT_NICHT_ENTRIEGELN = 0,
+    ZV_BT_ENTRIEGELN_BT_IST_ZU_ENTRIEGELN = 1
+};
+
+#define ZV_HFS_VERRIEGELN_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_HFS_verriegeln_Enum
+{
+    ZV_HFS_VERRIEGELN_INAKTIV = 0,
+    ZV_HFS_VERRIEGELN_AKTIV = 1
+};
+
+#define ZV_HFS_ENTRIEGELN_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_HFS_entriegeln_Enum
+{
+    ZV_HFS_ENTRIEGELN_INAKTIV = 0,
+    ZV_HFS_ENTRIEGELN_AKTIV = 1
+};
+
+#define ZV_HBFS_VERRIEGELN_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_HBFS_verriegeln_Enum
+{
+    ZV_HBFS_VERRIEGELN_INAKTIV = 0,
+    ZV_HBFS_VERRIEGELN_AKTIV = 1
+};
+
+#define ZV_HBFS_ENTRIEGELN_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_HBFS_entriegeln_Enum
+{
+    ZV_HBFS_ENTRIEGELN_INAKTIV = 0,
+    ZV_HBFS_ENTRIEGELN_AKTIV = 1
+};
+
+#define ZV_ZENTRAL_SAFEN_ENUM "0=nicht_safen, 1=Befehl_zentral_safen"
+enum ZV_zentral_safen_Enum
+{
+    ZV_ZENTRAL_SAFEN_NICHT_SAFEN = 0,
+    ZV_ZENTRAL_SAFEN_BEFEHL_ZENTRAL_SAFEN = 1
+};
+
+#define ZV_ZENTRAL_ENTSAFEN_ENUM "1=Befehl_zentral_entsafen"
+enum ZV_zentral_entsafen_Enum
+{
+    ZV_ZENTRAL_ENTSAFEN_BEFEHL_ZENTRAL_ENTSAFEN = 1
+};
+
+#define ZV_SPG_ANKLAPPEN_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_Spg_Anklappen_Enum
+{
+    ZV_SPG_ANKLAPPEN_INAKTIV = 0,
+    ZV_SPG_ANKLAPPEN_AKTIV = 1
+};
+
+#define ZV_SOFTTOUCH_BETAETIGT_ENUM "0=Softtouch_nicht_betaetigt, 1=Softtouch_betaetigt"
+enum ZV_Softtouch_betaetigt_Enum
+{
+    ZV_SOFTTOUCH_BETAETIGT_SOFTTOUCH_NICHT_BETAETIGT = 0,
+    ZV_SOFTTOUCH_BETAETIGT_SOFTTOUCH_BETAETIGT = 1
+};
+
+#define ZV_LED_STEUERUNG_ENUM "0=LED_aus, 1=LED_ein"
+enum ZV_LED_Steuerung_Enum
+{
+    ZV_LED_STEUERUNG_LED_AUS = 0,
+    ZV_LED_STEUERUNG_LED_EIN = 1
+};
+
+#define ZV_LED_UEBERNAHME_ENUM "1=TSG_uebernimmt_LED_Steuerung"
+enum ZV_LED_Uebernahme_Enum
+{
+    ZV_LED_UEBERNAHME_TSG_UEBERNIMMT_LED_STEUERUNG = 1
+};
+
+#define ZV_AUF_FT_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_auf_FT_Enum
+{
+    ZV_AUF_FT_NICHT_BETAETIGT = 0,
+    ZV_AUF_FT_BETAETIGT = 1
+};
+
+#define ZV_ZU_FT_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_zu_FT_Enum
+{
+    ZV_ZU_FT_NICHT_BETAETIGT = 0,
+    ZV_ZU_FT_BETAETIGT = 1
+};
+
+#define ZV_AUF_BT_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_auf_BT_Enum
+{
+    ZV_AUF_BT_NICHT_BETAETIGT = 0,
+    ZV_AUF_BT_BETAETIGT = 1
+};
+
+#define ZV_ZU_BT_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_zu_BT_Enum
+{
+    ZV_ZU_BT_NICHT_BETAETIGT = 0,
+    ZV_ZU_BT_BETAETIGT = 1
+};
+
+#define ZV_AUF_FUNK_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_auf_Funk_Enum
+{
+    ZV_AUF_FUNK_NICHT_BETAETIGT = 0,
+    ZV_AUF_FUNK_BETAETIGT = 1
+};
+
+#define ZV_ZU_FUNK_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_zu_Funk_Enum
+{
+    ZV_ZU_FUNK_NICHT_BETAETIGT = 0,
+    ZV_ZU_FUNK_BETAETIGT = 1
+};
+
+#define VIP_SENSOR_BETAETIGT_ENUM "0=keine_Heckentriegelung_durch_VIP_Sensor_angefordert, 1=Heckentriegelung_durch_VIP_Sensor_angefordert"
+enum VIP_Sensor_betaetigt_Enum
+{
+    VIP_SENSOR_BETAETIGT_KEINE_HECKENTRIEGELUNG_DURCH_VIP_SENSOR_ANGEFORDERT = 0,
+    VIP_SENSOR_BETAETIGT_HECKENTRIEGELUNG_DURCH_VIP_SENSOR_ANGEFORDERT = 1
+};
+
+#define VIP_FREIGABE_ENUM "0=keine_Freigabe, 1=Freigabe"
+enum VIP_Freigabe_Enum
+{
+    VIP_FREIGABE_KEINE_FREIGABE = 0,
+    VIP_FREIGABE_FREIGABE = 1
+};
+
+#define ZV_ZU_ZEITL_NACHVERR_ENUM "1=Nachverriegeln"
+enum ZV_zu_Zeitl_Nachverr_Enum
+{
+    ZV_ZU_ZEITL_NACHVERR_NACHVERRIEGELN = 1
+};
+
+#define ZV_HSK_ENTRIEGELN_ENUM "0=Handschuhkasten_nicht_entriegeln, 1=Handschuhkasten_entriegeln"
+enum ZV_HSK_entriegeln_Enum
+{
+    ZV_HSK_ENTRIEGELN_HANDSCHUHKASTEN_NICHT_ENTRIEGELN = 0,
+    ZV_HSK_ENTRIEGELN_HANDSCHUHKASTEN_ENTRIEGELN = 1
+};
+
+#define ZV_HSK_VERRIEGELN_ENUM "0=Handschuhkasten_nicht_verriegeln, 1=Handschuhkasten_verriegelt"
+enum ZV_HSK_verriegeln_Enum
+{
+    ZV_HSK_VERRIEGELN_HANDSCHUHKASTEN_NICHT_VERRIEGELN = 0,
+    ZV_HSK_VERRIEGELN_HANDSCHUHKASTEN_VERRIEGELT = 1
+};
+
+#define ZV_VERDECK_ZU_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_Verdeck_zu_Enum
+{
+    ZV_VERDECK_ZU_INAKTIV = 0,
+    ZV_VERDECK_ZU_AKTIV = 1
+};
+
+#define ZV_VERDECK_AUF_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_Verdeck_auf_Enum
+{
+    ZV_VERDECK_AUF_INAKTIV = 0,
+    ZV_VERDECK_AUF_AKTIV = 1
+};
+
+#define FH_FT_HOCH_ENUM "0=keine_Anforderung, 1=FT_hoch"
+enum FH_FT_hoch_Enum
+{
+    FH_FT_HOCH_KEINE_ANFORDERUNG = 0,
+    FH_FT_HOCH_FT_HOCH = 1
+};
+
+#define FH_FT_TIEF_ENUM "0=keine_Anforderung, 1=FT_tief"
+enum FH_FT_tief_Enum
+{
+    FH_FT_TIEF_KEINE_ANFORDERUNG = 0,
+    FH_FT_TIEF_FT_TIEF = 1
+};
+
+#define FH_BT_HOCH_ENUM "0=keine_Anforderung, 1=BT_hoch"
+enum FH_BT_hoch_Enum
+{
+    FH_BT_HOCH_KEINE_ANFORDERUNG = 0,
+    FH_BT_HOCH_BT_HOCH = 1
+};
+
+#define FH_BT_TIEF_ENUM "0=keine_Anforderung, 1=BT_tief"
+enum FH_BT_tief_Enum
+{
+    FH_BT_TIEF_KEINE_ANFORDERUNG = 0,
+    FH_BT_TIEF_BT_TIEF = 1
+};
+
+#define FH_HFS_HOCH_ENUM "0=inaktiv, 1=aktiv"
+enum FH_HFS_hoch_Enum
+{
+    FH_HFS_HOCH_INAKTIV = 0,
+    FH_HFS_HOCH_AKTIV = 1
+};
+
+#define FH_HFS_TIEF_ENUM "0=inaktiv, 1=aktiv"
+enum FH_HFS_tief_Enum
+{
+    FH_HFS_TIEF_INAKTIV = 0,
+    FH_HFS_TIEF_AKTIV = 1
+};
+
+#define FH_HBFS_HOCH_ENUM "0=inaktiv, 1=aktiv"
+enum FH_HBFS_hoch_Enum
+{
+    FH_HBFS_HOCH_INAKTIV = 0,
+    FH_HBFS_HOCH_AKTIV = 1
+};
+
+#define FH_HBFS_TIEF_ENUM "0=inaktiv, 1=aktiv"
+enum FH_HBFS_tief_Enum
+{
+    FH_HBFS_TIEF_INAKTIV = 0,
+    FH_HBFS_TIEF_AKTIV = 1
+};
+
+#define BCM_SPG_SYNCHRON_ENUM "0=inaktiv, 1=aktiv"
+enum BCM_Spg_Synchron_Enum
+{
+    BCM_SPG_SYNCHRON_INAKTIV = 0,
+    BCM_SPG_SYNCHRON_AKTIV = 1
+};
+
+#define BCM_BF_SPG_ABSENKUNG_ENUM "0=inaktiv, 1=aktiv"
+enum BCM_BF_Spg_Absenkung_Enum
+{
+    BCM_BF_SPG_ABSENKUNG_INAKTIV = 0,
+    BCM_BF_SPG_ABSENKUNG_AKTIV = 1
+};
+
+#define ZV_ENTRIEGELN_ANF_ENUM "0=nicht_betaetigt, 1=betaetigt"
+enum ZV_entriegeln_Anf_Enum
+{
+    ZV_ENTRIEGELN_ANF_NICHT_BETAETIGT = 0,
+    ZV_ENTRIEGELN_ANF_BETAETIGT = 1
+};
+
+#define ZV_AUTO_ANSTEUERUNG_ENUM "0=Kein_Autolock_Unlock, 1=Autolock_Unlock"
+enum ZV_auto_Ansteuerung_Enum
+{
+    ZV_AUTO_ANSTEUERUNG_KEIN_AUTOLOCK_UNLOCK = 0,
+    ZV_AUTO_ANSTEUERUNG_AUTOLOCK_UNLOCK = 1
+};
+
+#define BMS_ISTSTROM_02_ENUM "4094=Init, 4095=Fehler"
+enum BMS_IstStrom_02_Enum
+{
+    BMS_ISTSTROM_02_INIT = 4094,
+    BMS_ISTSTROM_02_FEHLER = 4095
+};
+
+#define BMS_ISTSPANNUNG_ENUM "4094=Init, 4095=Fehler"
+enum BMS_IstSpannung_Enum
+{
+    BMS_ISTSPANNUNG_INIT = 4094,
+    BMS_ISTSPANNUNG_FEHLER = 4095
+};
+
+#define BMS_SPANNUNG_ZWKR_ENUM "2046=Init, 2047=Fehler"
+enum BMS_Spannung_ZwKr_Enum
+{
+    BMS_SPANNUNG_ZWKR_INIT = 2046,
+    BMS_SPANNUNG_ZWKR_FEHLER = 2047
+};
+
+#define BMS_SOC_HIRES_ENUM "2046=Init, 2047=Fehler"
+enum BMS_SOC_HiRes_Enum
+{
+    BMS_SOC_HIRES_INIT = 2046,
+    BMS_SOC_HIRES_FEHLER = 2047
+};
+
+#define BMS_ISTSTROM_02_OFFSETVZ_ENUM "0=Minus, 1=Plus"
+enum BMS_IstStrom_02_OffsetVZ_Enum
+{
+    BMS_ISTSTROM_02_OFFSETVZ_MINUS = 0,
+    BMS_ISTSTROM_02_OFFSETVZ_PLUS = 1
+};
+
+#define RST_FAHRERHINWEISE_ENUM "0=Init, 1=Fahreruebernahme_Hinweis_ZAT_Automat_ohne_Gong, 2=Fahreruebernahme_Hinweis_ZAT_Automat_mit_Gong, 3=Fahreruebernahme_Hinweis_ZAT_Handschalter_ohne_Gong, 4=Fahreruebernahme_Hinweis_ZAT_Handschalter_mit_Gong, 5=Fahreruebernahme_Hinweis_ZAS_Automat_ohne_Gong, 6=Fahreruebernahme_Hinweis_ZAS_Automat_mit_Gong, 7=Fahreruebernahme_Hinweis_ZAS_Handschalter_ohne_Gong, 8=Fahreruebernahme_Hinweis_ZAS_Handschalter_mit_Gong, 9=RemoteStart_aktiv_ohne_Gong, 10=RemoteStart_aktiv_mit_Gong, 11=void, 12=void, 13=void, 14=void, 15=void"
+enum RSt_Fahrerhinweise_Enum
+{
+    RST_FAHRERHINWEISE_INIT = 0,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAT_AUTOMAT_OHNE_GONG = 1,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAT_AUTOMAT_MIT_GONG = 2,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAT_HANDSCHALTER_OHNE_GONG = 3,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAT_HANDSCHALTER_MIT_GONG = 4,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAS_AUTOMAT_OHNE_GONG = 5,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAS_AUTOMAT_MIT_GONG = 6,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAS_HANDSCHALTER_OHNE_GONG = 7,
+    RST_FAHRERHINWEISE_FAHRERUEBERNAHME_HINWEIS_ZAS_HANDSCHALTER_MIT_GONG = 8,
+    RST_FAHRERHINWEISE_REMOTESTART_AKTIV_OHNE_GONG = 9,
+    RST_FAHRERHINWEISE_REMOTESTART_AKTIV_MIT_GONG = 10,
+    RST_FAHRERHINWEISE_VOID = 11,
+    RST_FAHRERHINWEISE_VOID_12 = 12,
+    RST_FAHRERHINWEISE_VOID_13 = 13,
+    RST_FAHRERHINWEISE_VOID_14 = 14,
+    RST_FAHRERHINWEISE_VOID_15 = 15
+};
+
+#define ZAS_KL_S_ENUM "0=aus, 1=S_Kontakt_ein"
+enum ZAS_Kl_S_Enum
+{
+    ZAS_KL_S_AUS = 0,
+    ZAS_KL_S_S_KONTAKT_EIN = 1
+};
+
+#define ZAS_KL_15_ENUM "0=aus, 1=ein"
+enum ZAS_Kl_15_Enum
+{
+    ZAS_KL_15_AUS = 0,
+    ZAS_KL_15_EIN = 1
+};
+
+#define ZAS_KL_X_ENUM "0=aus, 1=ein"
+enum ZAS_Kl_X_Enum
+{
+    ZAS_KL_X_AUS = 0,
+    ZAS_KL_X_EIN = 1
+};
+
+#define ZAS_KL_50_STARTANFORDERUNG_ENUM "0=aus, 1=KL50_ein_Startwunsch_Fahrer"
+enum ZAS_Kl_50_Startanforderung_Enum
+{
+    ZAS_KL_50_STARTANFORDERUNG_AUS = 0,
+    ZAS_KL_50_STARTANFORDERUNG_KL50_EIN_STARTWUNSCH_FAHRER = 1
+};
+
+#define BCM_REMOTESTART_BETRIEB_ENUM "0=kein_RS_Betrieb, 1=RS_Betrieb"
+enum BCM_Remotestart_Betrieb_Enum
+{
+    BCM_REMOTESTART_BETRIEB_KEIN_RS_BETRIEB = 0,
+    BCM_REMOTESTART_BETRIEB_RS_BETRIEB = 1
+};
+
+#define ZAS_KL_INFOTAINMENT_ENUM "0=inaktiv, 1=aktiv"
+enum ZAS_Kl_Infotainment_Enum
+{
+    ZAS_KL_INFOTAINMENT_INAKTIV = 0,
+    ZAS_KL_INFOTAINMENT_AKTIV = 1
+};
+
+#define BCM_REMOTESTART_KL15_ANF_ENUM "0=inaktiv, 1=aktiv"
+enum BCM_Remotestart_KL15_Anf_Enum
+{
+    BCM_REMOTESTART_KL15_ANF_INAKTIV = 0,
+    BCM_REMOTESTART_KL15_ANF_AKTIV = 1
+};
+
+#define BCM_REMOTESTART_MO_START_ENUM "0=nicht_angefordert, 1=angefordert"
+enum BCM_Remotestart_MO_Start_Enum
+{
+    BCM_REMOTESTART_MO_START_NICHT_ANGEFORDERT = 0,
+    BCM_REMOTESTART_MO_START_ANGEFORDERT = 1
+};
+
+#define KST_WARN_P1_ZST_DEF_ENUM "0=nicht_defekt, 1=defekt"
+enum KST_Warn_P1_ZST_def_Enum
+{
+    KST_WARN_P1_ZST_DEF_NICHT_DEFEKT = 0,
+    KST_WARN_P1_ZST_DEF_DEFEKT = 1
+};
+
+#define KST_WARN_P2_ZST_DEF_ENUM "0=nicht_defekt, 1=defekt"
+enum KST_Warn_P2_ZST_def_Enum
+{
+    KST_WARN_P2_ZST_DEF_NICHT_DEFEKT = 0,
+    KST_WARN_P2_ZST_DEF_DEFEKT = 1
+};
+
+#define KST_FAHRERHINWEIS_1_ENUM "0=inaktiv, 1=aktiv"
+enum KST_Fahrerhinweis_1_Enum
+{
+    KST_FAHRERHINWEIS_1_INAKTIV = 0,
+    KST_FAHRERHINWEIS_1_AKTIV = 1
+};
+
+#define KST_FAHRERHINWEIS_2_ENUM "0=inaktiv, 1=aktiv"
+enum KST_Fahrerhinweis_2_Enum
+{
+    KST_FAHRERHINWEIS_2_INAKTIV = 0,
+    KST_FAHRERHINWEIS_2_AKTIV = 1
+};
+
+#define BCM_AUSPARKEN_BETRIEB_ENUM "0=kein_Betrieb, 1=Ausparkvorgang_aktiv"
+enum BCM_Ausparken_Betrieb_Enum
+{
+    BCM_AUSPARKEN_BETRIEB_KEIN_BETRIEB = 0,
+    BCM_AUSPARKEN_BETRIEB_AUSPARKVORGANG_AKTIV = 1
+};
+
+#define KST_FAHRERHINWEIS_4_ENUM "0=inaktiv, 1=aktiv"
+enum KST_Fahrerhinweis_4_Enum
+{
+    KST_FAHRERHINWEIS_4_INAKTIV = 0,
+    KST_FAHRERHINWEIS_4_AKTIV = 1
+};
+
+#define KST_FAHRERHINWEIS_5_ENUM "0=inaktiv, 1=aktiv"
+enum KST_Fahrerhinweis_5_Enum
+{
+    KST_FAHRERHINWEIS_5_INAKTIV = 0,
+    KST_FAHRERHINWEIS_5_AKTIV = 1
+};
+
+#define KST_FAHRERHINWEIS_6_ENUM "0=inaktiv, 1=aktiv"
+enum KST_Fahrerhinweis_6_Enum
+{
+    KST_FAHRERHINWEIS_6_INAKTIV = 0,
+    KST_FAHRERHINWEIS_6_AKTIV = 1
+};
+
+#define HMS_P_BEIBEHALTEN_GE_ENUM "0=P_nicht_beibehalten, 1=P_beibehalten, 2=Init, 3=Fehler"
+enum HMS_P_beibehalten_GE_Enum
+{
+    HMS_P_BEIBEHALTEN_GE_P_NICHT_BEIBEHALTEN = 0,
+    HMS_P_BEIBEHALTEN_GE_P_BEIBEHALTEN = 1,
+    HMS_P_BEIBEHALTEN_GE_INIT = 2,
+    HMS_P_BEIBEHALTEN_GE_FEHLER = 3
+};
+
+#define HMS_KONSISTENZ_GE_ENUM "0=kein_Fehler_erkannt, 1=Fehler_erkannt"
+enum HMS_Konsistenz_GE_Enum
+{
+    HMS_KONSISTENZ_GE_KEIN_FEHLER_ERKANNT = 0,
+    HMS_KONSISTENZ_GE_FEHLER_ERKANNT = 1
+};
+
+#define HMS_KONSISTENZ_IPA_ENUM "0=kein_Fehler_erkannt, 1=Fehler_erkannt"
+enum HMS_Konsistenz_IPA_Enum
+{
+    HMS_KONSISTENZ_IPA_KEIN_FEHLER_ERKANNT = 0,
+    HMS_KONSISTENZ_IPA_FEHLER_ERKANNT = 1
+};
+
+#define HMS_KONSISTENZ_STA_ENUM "0=kein_Fehler_erkannt, 1=Fehler_erkannt"
+enum HMS_Konsistenz_STA_Enum
+{
+    HMS_KONSISTENZ_STA_KEIN_FEHLER_ERKANNT = 0,
+    HMS_KONSISTENZ_STA_FEHLER_ERKANNT = 1
+};
+
+#define HMS_KONSISTENZ_MO_ENUM "0=kein_Fehler_erkannt, 1=Fehler_erkannt"
+enum HMS_Konsistenz_MO_Enum
+{
+    HMS_KONSISTENZ_MO_KEIN_FEHLER_ERKANNT = 0,
+    HMS_KONSISTENZ_MO_FEHLER_ERKANNT = 1
+};
+
+#define HMS_HALTEN_NICHT_VERFUEGBAR_ENUM "0=verfuegbar, 1=nicht_verfuegbar"
+enum HMS_halten_nicht_verfuegbar_Enum
+{
+    HMS_HALTEN_NICHT_VERFUEGBAR_VERFUEGBAR = 0,
+    HMS_HALTEN_NICHT_VERFUEGBAR_NICHT_VERFUEGBAR = 1
+};
+
+#define NL_PRIM_STP_01_STATUS_ENUM "0=Notlauf_inaktiv, 1=Notlauf_bereit, 2=Notlauf_aktiv, 3=Notlauf_nicht_verfuegbar, 4=Notlauf_aktivierbar"
+enum NL_PRIM_STP_01_Status_Enum
+{
+    NL_PRIM_STP_01_STATUS_NOTLAUF_INAKTIV = 0,
+    NL_PRIM_STP_01_STATUS_NOTLAUF_BEREIT = 1,
+    NL_PRIM_STP_01_STATUS_NOTLAUF_AKTIV = 2,
+    NL_PRIM_STP_01_STATUS_NOTLAUF_NICHT_VERFUEGBAR = 3,
+    NL_PRIM_STP_01_STATUS_NOTLAUF_AKTIVIERBAR = 4
+};
+
+#define VMM_WARNBLINKEN_ENUM "0=Aus, 1=An"
+enum VMM_Warnblinken_Enum
+{
+    VMM_WARNBLINKEN_AUS = 0,
+    VMM_WARNBLINKEN_AN = 1
+};
+
+#define VZM_STATUS_ENUM "0=Initialisierung, 1=Verfuegbar, 2=Verfuegbar_mit_eingeschraenkter_Performance, 3=Nicht_Verfuegbar, 4=Fehler"
+enum VZM_Status_Enum
+{
+    VZM_STATUS_INITIALISIERUNG = 0,
+    VZM_STATUS_VERFUEGBAR = 1,
+    VZM_STATUS_VERFUEGBAR_MIT_EINGESCHRAENKTER_PERFORMANCE = 2,
+    VZM_STATUS_NICHT_VERFUEGBAR = 3,
+    VZM_STATUS_FEHLER = 4
+};
+
+#define HMS_NOTSTOPP_STATUS_ENUM "0=Off_Init, 1=Inaktiv, 2=Ready, 3=Aktiv, 4=Pending, 7=nicht_Verfuegbar"
+enum HMS_Notstopp_Status_Enum
+{
+    HMS_NOTSTOPP_STATUS_OFF_INIT = 0,
+    HMS_NOTSTOPP_STATUS_INAKTIV = 1,
+    HMS_NOTSTOPP_STATUS_READY = 2,
+    HMS_NOTSTOPP_STATUS_AKTIV = 3,
+    HMS_NOTSTOPP_STATUS_PENDING = 4,
+    HMS_NOTSTOPP_STATUS_NICHT_VERFUEGBAR = 7
+};
+
+#define HMS_PARKEN_NICHT_VERFUEGBAR_ENUM "0=verfuegbar, 1=nicht_verfuegbar"
+enum HMS_parken_nicht_verfuegbar_Enum
+{
+    HMS_PARKEN_NICHT_VERFUEGBAR_VERFUEGBAR = 0,
+    HMS_PARKEN_NICHT_VERFUEGBAR_NICHT_VERFUEGBAR = 1
+};
+
+#define HMS_ANFORDERUNG_GE_ENUM "0=keine_Anforderung, 1=P_einlegen"
+enum HMS_Anforderung_GE_Enum
+{
+    HMS_ANFORDERUNG_GE_KEINE_ANFORDERUNG = 0,
+    HMS_ANFORDERUNG_GE_P_EINLEGEN = 1
+};
+
+#define HMS_SYSTEMSTATUS_ENUM "0=keine_Funktion_aktiv, 1=Halten_aktiv, 2=Parken_angefordert, 3=Parken_aktiv, 4=Parken_beibehalten_aktiv, 5=Anfahren_aktiv, 6=Loeseanforderung_aktiv, 7=Loeseanforderung_durch_Fahrer, 8=Abrutschen_erkannt, 9=Halten_Standby_aktiv, 10=Anfahren_Standby_aktiv, 14=Init, 15=Fehler"
+enum HMS_Systemstatus_Enum
+{
+    HMS_SYSTEMSTATUS_KEINE_FUNKTION_AKTIV = 0,
+    HMS_SYSTEMSTATUS_HALTEN_AKTIV = 1,
+    HMS_SYSTEMSTATUS_PARKEN_ANGEFORDERT = 2,
+    HMS_SYSTEMSTATUS_PARKEN_AKTIV = 3,
+    HMS_SYSTEMSTATUS_PARKEN_BEIBEHALTEN_AKTIV = 4,
+    HMS_SYSTEMSTATUS_ANFAHREN_AKTIV = 5,
+    HMS_SYSTEMSTATUS_LOESEANFORDERUNG_AKTIV = 6,
+    HMS_SYSTEMSTATUS_LOESEANFORDERUNG_DURCH_FAHRER = 7,
+    HMS_SYSTEMSTATUS_ABRUTSCHEN_ERKANNT = 8,
+    HMS_SYSTEMSTATUS_HALTEN_STANDBY_AKTIV = 9,
+    HMS_SYSTEMSTATUS_ANFAHREN_STANDBY_AKTIV = 10,
+    HMS_SYSTEMSTATUS_INIT = 14,
+    HMS_SYSTEMSTATUS_FEHLER = 15
+};
+
+#define HMS_STILLSTAND_ENUM "0=kein_Stillstand, 1=Stillstand_frueh, 2=Stillstand, 6=Init, 7=Fehler"
+enum HMS_Stillstand_Enum
+{
+    HMS_STILLSTAND_KEIN_STILLSTAND = 0,
+    HMS_STILLSTAND_STILLSTAND_FRUEH = 1,
+    HMS_STILLSTAND_STILLSTAND = 2,
+    HMS_STILLSTAND_INIT = 6,
+    HMS_STILLSTAND_FEHLER = 7
+};
+
+#define HMS_AKTIVES_SYSTEM_ENUM "0=kein_System_Init_Fehler, 1=Fahreranforderung_aktiv, 2=HMS_intern_aktiv, 3=ACC_aktiv, 4=Autohold_aktiv, 5=HHC_aktiv, 6=HVLM_aktiv, 7=Getriebe_aktiv, 8=EBKV_aktiv, 9=ParkAssist_aktiv, 10=ARA_aktiv, 12=autonomous_Hold_aktiv, 13=STA_aktiv, 14=Motor_aktiv, 15=EA_aktiv, 16=VLK_aktiv"
+enum HMS_aktives_System_Enum
+{
+    HMS_AKTIVES_SYSTEM_KEIN_SYSTEM_INIT_FEHLER = 0,
+    HMS_AKTIVES_SYSTEM_FAHRERANFORDERUNG_AKTIV = 1,
+    HMS_AKTIVES_SYSTEM_HMS_INTERN_AKTIV = 2,
+    HMS_AKTIVES_SYSTEM_ACC_AKTIV = 3,
+    HMS_AKTIVES_SYSTEM_AUTOHOLD_AKTIV = 4,
+    HMS_AKTIVES_SYSTEM_HHC_AKTIV = 5,
+    HMS_AKTIVES_SYSTEM_HVLM_AKTIV = 6,
+    HMS_AKTIVES_SYSTEM_GETRIEBE_AKTIV = 7,
+    HMS_AKTIVES_SYSTEM_EBKV_AKTIV = 8,
+    HMS_AKTIVES_SYSTEM_PARKASSIST_AKTIV = 9,
+    HMS_AKTIVES_SYSTEM_ARA_AKTIV = 10,
+    HMS_AKTIVES_SYSTEM_AUTONOMOUS_HOLD_AKTIV = 12,
+    HMS_AKTIVES_SYSTEM_STA_AKTIV = 13,
+    HMS_AKTIVES_SYSTEM_MOTOR_AKTIV = 14,
+    HMS_AKTIVES_SYSTEM_EA_AKTIV = 15,
+    HMS_AKTIVES_SYSTEM_VLK_AKTIV = 16
+};
+
+#define HMS_KONSISTENZ_HVLM_ENUM "0=kein_Fehler_erkannt, 1=Fehler_erkannt"
+enum HMS_Konsistenz_HVLM_Enum
+{
+    HMS_KONSISTENZ_HVLM_KEIN_FEHLER_ERKANNT = 0,
+    HMS_KONSISTENZ_HVLM_FEHLER_ERKANNT = 1
+};
+
+#define HMS_KONSISTENZ_ACC_ENUM "0=kein_Fehler_erkannt, 1=Fehler_erkannt"
+enum HMS_Konsistenz_ACC_Enum
+{
+    HMS_KONSISTENZ_ACC_KEIN_FEHLER_ERKANNT = 0,
+    HMS_KONSISTENZ_ACC_FEHLER_ERKANNT = 1
+};
+
+#define HMS_FEHLERSTATUS_ENUM "0=kein_Fehler, 1=Halten_nicht_moeglich, 2=Sonderbetriebsmodus_aktiv, 3=Systemeinschraenkung, 4=Systemstoerung"
+enum HMS_Fehlerstatus_Enum
+{
+    HMS_FEHLERSTATUS_KEIN_FEHLER = 0,
+    HMS_FEHLERSTATUS_HALTEN_NICHT_MOEGLICH = 1,
+    HMS_FEHLERSTATUS_SONDERBETRIEBSMODUS_AKTIV = 2,
+    HMS_FEHLERSTATUS_SYSTEMEINSCHRAENKUNG = 3,
+    HMS_FEHLERSTATUS_SYSTEMSTOERUNG = 4
+};
+
+#define ESP_INDEX_HALTEMOMENT_ENUM "0=Bremsmoment, 1=Antriebsmoment"
+enum ESP_Index_Haltemoment_Enum
+{
+    ESP_INDEX_HALTEMOMENT_BREMSMOMENT = 0,
+    ESP_INDEX_HALTEMOMENT_ANTRIEBSMOMENT = 1
+};
+
+#define ESP_HALTEMOMENT_ENUM "1022=Init, 1023=Fehler"
+enum ESP_Haltemoment_Enum
+{
+    ESP_HALTEMOMENT_INIT = 1022,
+    ESP_HALTEMOMENT_FEHLER = 1023
+};
+
+#define DC_ISTSPANNUNG_HV_ENUM "4094=Init, 4095=Fehler"
+enum DC_IstSpannung_HV_Enum
+{
+    DC_ISTSPANNUNG_HV_INIT = 4094,
+    DC_ISTSPANNUNG_HV_FEHLER = 4095
+};
+
+#define DC_ISTSTROM_HV_02_ENUM "1022=Init, 1023=Fehler"
+enum DC_IstStrom_HV_02_Enum
+{
+    DC_ISTSTROM_HV_02_INIT = 1022,
+    DC_ISTSTROM_HV_02_FEHLER = 1023
+};
+
+#define DC_ISTSTROM_NV_ENUM "1022=Init, 1023=Fehler"
+enum DC_IstStrom_NV_Enum
+{
+    DC_ISTSTROM_NV_INIT = 1022,
+    DC_ISTSTROM_NV_FEHLER = 1023
+};
+
+#define DC_ISTSPANNUNG_NV_ENUM "254=Init, 255=Fehler"
+enum DC_IstSpannung_NV_Enum
+{
+    DC_ISTSPANNUNG_NV_INIT = 254,
+    DC_ISTSPANNUNG_NV_FEHLER = 255
+};
+
+#define HVK_ISTMODUS_ANF_ENUM "0=nicht_angefordert, 1=angefordert"
+enum HVK_Istmodus_Anf_Enum
+{
+    HVK_ISTMODUS_ANF_NICHT_ANGEFORDERT = 0,
+    HVK_ISTMODUS_ANF_ANGEFORDERT = 1
+};
+
+#define HVK_TN1_SOLLMODUS_ENUM "0=HV_Off, 1=HV_On, 2=reserviert, 3=Initialisierung"
+enum HVK_TN1_Sollmodus_Enum
+{
+    HVK_TN1_SOLLMODUS_HV_OFF = 0,
+    HVK_TN1_SOLLMODUS_HV_ON = 1,
+    HVK_TN1_SOLLMODUS_RESERVIERT = 2,
+    HVK_TN1_SOLLMODUS_INITIALISIERUNG = 3
+};
+
+#define HVK_MO_EMSOLLZUSTAND_ENUM "0=HvOff, 1=HvStbyReq, 2=HvStbyWait, 3=HvBattOnReq, 4=HvBattOnWait, 10=HvOnIdle, 18=HvOnDrvReq, 19=HvOnDrvWait, 20=HvOnDrvRdy, 28=HvStepUpReq, 29=HvStepUpWait, 30=HvStepUp, 38=HvStepDownReq, 39=HvStepDownWait, 40=HvStepDown, 46=HvAcChPreReq, 47=HvAcChPreWait, 48=HvAcChReq, 49=HvAcChWait, 50=HvAcCh, 56=HvDcChPreReq, 57=HvDcChPreWait, 58=HvDcChReq, 59=HvDcChWait, 60=HvDcCh, 67=HvChOffReq, 68=HvChOffWait, 69=HvOnIdleReq, 70=HvOnIdleWait, 96=HvCpntOffReq, 97=HvCpntOffWait, 98=HvBattOffReq, 99=HvBattOffWait, 109=HvDcDcFailOffReq, 110=HvDcDcFail, 119=HvElmOffReq, 120=HvElmOff, 126=HvFailCpntOffReq, 127=HvFailCpntOffWait, 128=HvFailBattOffReq, 129=HvFailBattOffWait, 130=HvFailBattOff, 138=HvFailUCtlReq, 139=HvFailUCtlWait, 140=HvFailUCtl, 150=HvEmgcyOff, 255=Init"
+enum HVK_MO_EmSollzustand_Enum
+{
+    HVK_MO_EMSOLLZUSTAND_HVOFF = 0,
+    HVK_MO_EMSOLLZUSTAND_HVSTBYREQ = 1,
+    HVK_MO_EMSOLLZUSTAND_HVSTBYWAIT = 2,
+    HVK_MO_EMSOLLZUSTAND_HVBATTONREQ = 3,
+    HVK_MO_EMSOLLZUSTAND_HVBATTONWAIT = 4,
+    HVK_MO_EMSOLLZUSTAND_HVONIDLE = 10,
+    HVK_MO_EMSOLLZUSTAND_HVONDRVREQ = 18,
+    HVK_MO_EMSOLLZUSTAND_HVONDRVWAIT = 19,
+    HVK_MO_EMSOLLZUSTAND_HVONDRVRDY = 20,
+    HVK_MO_EMSOLLZUSTAND_HVSTEPUPREQ = 28,
+    HVK_MO_EMSOLLZUSTAND_HVSTEPUPWAIT = 29,
+    HVK_MO_EMSOLLZUSTAND_HVSTEPUP = 30,
+    HVK_MO_EMSOLLZUSTAND_HVSTEPDOWNREQ = 38,
+    HVK_MO_EMSOLLZUSTAND_HVSTEPDOWNWAIT = 39,
+    HVK_MO_EMSOLLZUSTAND_HVSTEPDOWN = 40,
+    HVK_MO_EMSOLLZUSTAND_HVACCHPREREQ = 46,
+    HVK_MO_EMSOLLZUSTAND_HVACCHPREWAIT = 47,
+    HVK_MO_EMSOLLZUSTAND_HVACCHREQ = 48,
+    HVK_MO_EMSOLLZUSTAND_HVACCHWAIT = 49,
+    HVK_MO_EMSOLLZUSTAND_HVACCH = 50,
+    HVK_MO_EMSOLLZUSTAND_HVDCCHPREREQ = 56,
+    HVK_MO_EMSOLLZUSTAND_HVDCCHPREWAIT = 57,
+    HVK_MO_EMSOLLZUSTAND_HVDCCHREQ = 58,
+    HVK_MO_EMSOLLZUSTAND_HVDCCHWAIT = 59,
+    HVK_MO_EMSOLLZUSTAND_HVDCCH = 60,
+    HVK_MO_EMSOLLZUSTAND_HVCHOFFREQ = 67,
+    HVK_MO_EMSOLLZUSTAND_HVCHOFFWAIT = 68,
+    HVK_MO_EMSOLLZUSTAND_HVONIDLEREQ = 69,
+    HVK_MO_EMSOLLZUSTAND_HVONIDLEWAIT = 70,
+    HVK_MO_EMSOLLZUSTAND_HVCPNTOFFREQ = 96,
+    HVK_MO_EMSOLLZUSTAND_HVCPNTOFFWAIT = 97,
+    HVK_MO_EMSOLLZUSTAND_HVBATTOFFREQ = 98,
+    HVK_MO_EMSOLLZUSTAND_HVBATTOFFWAIT = 99,
+    HVK_MO_EMSOLLZUSTAND_HVDCDCFAILOFFREQ = 109,
+    HVK_MO_EMSOLLZUSTAND_HVDCDCFAIL = 110,
+    HVK_MO_EMSOLLZUSTAND_HVELMOFFREQ = 119,
+    HVK_MO_EMSOLLZUSTAND_HVELMOFF = 120,
+    HVK_MO_EMSOLLZUSTAND_HVFAILCPNTOFFREQ = 126,
+    HVK_MO_EMSOLLZUSTAND_HVFAILCPNTOFFWAIT = 127,
+    HVK_MO_EMSOLLZUSTAND_HVFAILBATTOFFREQ = 128,
+    HVK_MO_EMSOLLZUSTAND_HVFAILBATTOFFWAIT = 129,
+    HVK_MO_EMSOLLZUSTAND_HVFAILBATTOFF = 130,
+    HVK_MO_EMSOLLZUSTAND_HVFAILUCTLREQ = 138,
+    HVK_MO_EMSOLLZUSTAND_HVFAILUCTLWAIT = 139,
+    HVK_MO_EMSOLLZUSTAND_HVFAILUCTL = 140,
+    HVK_MO_EMSOLLZUSTAND_HVEMGCYOFF = 150,
+    HVK_MO_EMSOLLZUSTAND_INIT = 255
+};
+
+#define HVK_BMS_SOLLMODUS_ENUM "0=HV_Off, 1=HV_On, 3=AC_Laden_erw, 4=AC_Laden, 6=DC_Laden, 7=Init"
+enum HVK_BMS_Sollmodus_Enum
+{
+    HVK_BMS_SOLLMODUS_HV_OFF = 0,
+    HVK_BMS_SOLLMODUS_HV_ON = 1,
+    HVK_BMS_SOLLMODUS_AC_LADEN_ERW = 3,
+    HVK_BMS_SOLLMODUS_AC_LADEN = 4,
+    HVK_BMS_SOLLMODUS_DC_LADEN = 6,
+    HVK_BMS_SOLLMODUS_INIT = 7
+};
+
+#define HVK_DCDC_SOLLMODUS_ENUM "0=Standby, 1=HV_On_Vorladen, 2=Tiefsetzen, 3=Hochsetzen, 4=Pruefpuls_12V, 7=Initialisierung"
+enum HVK_DCDC_Sollmodus_Enum
+{
+    HVK_DCDC_SOLLMODUS_STANDBY = 0,
+    HVK_DCDC_SOLLMODUS_HV_ON_VORLADEN = 1,
+    HVK_DCDC_SOLLMODUS_TIEFSETZEN = 2,
+    HVK_DCDC_SOLLMODUS_HOCHSETZEN = 3,
+    HVK_DCDC_SOLLMODUS_PRUEFPULS_12V = 4,
+    HVK_DCDC_SOLLMODUS_INITIALISIERUNG = 7
+};
+
+#define HVK_EKK_SOLLMODUS_ENUM "0=Keine_Freigabe, 1=Freigabe, 2=Freigabe_ausgesetzt, 7=Init"
+enum HVK_EKK_Sollmodus_Enum
+{
+    HVK_EKK_SOLLMODUS_KEINE_FREIGABE = 0,
+    HVK_EKK_SOLLMODUS_FREIGABE = 1,
+    HVK_EKK_SOLLMODUS_FREIGABE_AUSGESETZT = 2,
+    HVK_EKK_SOLLMODUS_INIT = 7
+};
+
+#define HVK_HVPTC_SOLLMODUS_ENUM "0=Keine_Freigabe, 1=Freigabe, 2=Freigabe_ausgesetzt, 7=Init"
+enum HVK_HVPTC_Sollmodus_Enum
+{
+    HVK_HVPTC_SOLLMODUS_KEINE_FREIGABE = 0,
+    HVK_HVPTC_SOLLMODUS_FREIGABE = 1,
+    HVK_HVPTC_SOLLMODUS_FREIGABE_AUSGESETZT = 2,
+    HVK_HVPTC_SOLLMODUS_INIT = 7
+};
+
+#define HVK_HVLM_SOLLMODUS_ENUM "0=keine_Freigabe, 1=Freigabe_Lademanager, 7=Init"
+enum HVK_HVLM_Sollmodus_Enum
+{
+    HVK_HVLM_SOLLMODUS_KEINE_FREIGABE = 0,
+    HVK_HVLM_SOLLMODUS_FREIGABE_LADEMANAGER = 1,
+    HVK_HVLM_SOLLMODUS_INIT = 7
+};
+
+#define HVK_HV_NETZ_WARNUNGEN_ENUM "0=Keine_Warnung, 1=Warntext_HV_Netz_Anf, 2=Fehlertext_HV_Netz_Anf, 3=Warnung_Kein_Wiederstart_moeglich"
+enum HVK_HV_Netz_Warnungen_Enum
+{
+    HVK_HV_NETZ_WARNUNGEN_KEINE_WARNUNG = 0,
+    HVK_HV_NETZ_WARNUNGEN_WARNTEXT_HV_NETZ_ANF = 1,
+    HVK_HV_NETZ_WARNUNGEN_FEHLERTEXT_HV_NETZ_ANF = 2,
+    HVK_HV_NETZ_WARNUNGEN_WARNUNG_KEIN_WIEDERSTART_MOEGLICH = 3
+};
+
+#define HV_BORDNETZ_AKTIV_ENUM "0=inaktiv, 1=aktiv"
+enum HV_Bordnetz_aktiv_Enum
+{
+    HV_BORDNETZ_AKTIV_INAKTIV = 0,
+    HV_BORDNETZ_AKTIV_AKTIV = 1
+};
+
+#define HV_BORDNETZ_FEHLER_ENUM "0=kein_Fehler, 1=Fehler"
+enum HV_Bordnetz_Fehler_Enum
+{
+    HV_BORDNETZ_FEHLER_KEIN_FEHLER = 0,
+    HV_BORDNETZ_FEHLER_FEHLER = 1
+};
+
+#define HVK_GESAMTST_SPGFREIHEIT_ENUM "0=Funktion_Init_ohne_Funktion, 1=HV_System_spannungsfrei, 2=HV_System_nicht_spannungsfrei, 3=Fehler"
+enum HVK_Gesamtst_Spgfreiheit_Enum
+{
+    HVK_GESAMTST_SPGFREIHEIT_FUNKTION_INIT_OHNE_FUNKTION = 0,
+    HVK_GESAMTST_SPGFREIHEIT_HV_SYSTEM_SPANNUNGSFREI = 1,
+    HVK_GESAMTST_SPGFREIHEIT_HV_SYSTEM_NICHT_SPANNUNGSFREI = 2,
+    HVK_GESAMTST_SPGFREIHEIT_FEHLER = 3
+};
+
+#define HVK_AKTIVEENTLADUNG_ANF_ENUM "0=nicht_angefordert, 1=angefordert"
+enum HVK_AktiveEntladung_Anf_Enum
+{
+    HVK_AKTIVEENTLADUNG_ANF_NICHT_ANGEFORDERT = 0,
+    HVK_AKTIVEENTLADUNG_ANF_ANGEFORDERT = 1
+};
+
+#define HVK_ISO_MESSUNG_START_ENUM "0=keine_Messung, 1=Messung_HV_Netz_1, 2=Messung_HV_Netz_2, 4=deaktiviert"
+enum HVK_Iso_Messung_Start_Enum
+{
+    HVK_ISO_MESSUNG_START_KEINE_MESSUNG = 0,
+    HVK_ISO_MESSUNG_START_MESSUNG_HV_NETZ_1 = 1,
+    HVK_ISO_MESSUNG_START_MESSUNG_HV_NETZ_2 = 2,
+    HVK_ISO_MESSUNG_START_DEAKTIVIERT = 4
+};
+
+#define HVK_DCDC_EKK_SOLLMODUS_ENUM "0=aus, 1=ein, 2=reserviert, 3=Init"
+enum HVK_DCDC_EKK_Sollmodus_Enum
+{
+    HVK_DCDC_EKK_SOLLMODUS_AUS = 0,
+    HVK_DCDC_EKK_SOLLMODUS_EIN = 1,
+    HVK_DCDC_EKK_SOLLMODUS_RESERVIERT = 2,
+    HVK_DCDC_EKK_SOLLMODUS_INIT = 3
+};
+
+#define BMS_STATUS_SERVICEDISCONNECT_ENUM "0=gesteckt, 1=gezogen"
+enum BMS_Status_ServiceDisconnect_Enum
+{
+    BMS_STATUS_SERVICEDISCONNECT_GESTECKT = 0,
+    BMS_STATUS_SERVICEDISCONNECT_GEZOGEN = 1
+};
+
+#define BMS_STATUS_SPGFREIHEIT_ENUM "0=Init, 1=HV_Komponente_spannungsfrei, 2=HV_Komp_nicht_spannungsfrei, 3=Fehler_nicht_spannungsfrei"
+enum BMS_Status_Spgfreiheit_Enum
+{
+    BMS_STATUS_SPGFREIHEIT_INIT = 0,
+    BMS_STATUS_SPGFREIHEIT_HV_KOMPONENTE_SPANNUNGSFREI = 1,
+    BMS_STATUS_SPGFREIHEIT_HV_KOMP_NICHT_SPANNUNGSFREI = 2,
+    BMS_STATUS_SPGFREIHEIT_FEHLER_NICHT_SPANNUNGSFREI = 3
+};
+
+#define BMS_OBD_LAMPE_ANF_ENUM "0=kein_MIL_Request, 1=MIL_Request"
+enum BMS_OBD_Lampe_Anf_Enum
+{
+    BMS_OBD_LAMPE_ANF_KEIN_MIL_REQUEST = 0,
+    BMS_OBD_LAMPE_ANF_MIL_REQUEST = 1
+};
+
+#define BMS_ISTMODUS_ENUM "0=HV_inaktiv, 1=Fahren_HV_aktiv, 2=stBalancing, 3=externes_Laden, 4=AC_Laden, 5=Error_Batt, 6=DC_Laden, 7=Init"
+enum BMS_IstModus_Enum
+{
+    BMS_ISTMODUS_HV_INAKTIV = 0,
+    BMS_ISTMODUS_FAHREN_HV_AKTIV = 1,
+    BMS_ISTMODUS_STBALANCING = 2,
+    BMS_ISTMODUS_EXTERNES_LADEN = 3,
+    BMS_ISTMODUS_AC_LADEN = 4,
+    BMS_ISTMODUS_ERROR_BATT = 5,
+    BMS_ISTMODUS_DC_LADEN = 6,
+    BMS_ISTMODUS_INIT = 7
+};
+
+#define BMS_FEHLERSTATUS_ENUM "0=Komponente_IO, 1=Eingeschr_KompFkt_Isofehler_I, 2=Eingeschr_KompFkt_Isofehler_II, 3=Eingeschr_KompFkt_Interlock, 4=Eingeschr_KompFkt_SD, 5=Eingeschr_KompFkt_Leistungsred, 6=Keine_Komponentenfunktion, 7=Init"
+enum BMS_Fehlerstatus_Enum
+{
+    BMS_FEHLERSTATUS_KOMPONENTE_IO = 0,
+    BMS_FEHLERSTATUS_EINGESCHR_KOMPFKT_ISOFEHLER_I = 1,
+    BMS_FEHLERSTATUS_EINGESCHR_KOMPFKT_ISOFEHLER_II = 2,
+    BMS_FEHLERSTATUS_EINGESCHR_KOMPFKT_INTERLOCK = 3,
+    BMS_FEHLERSTATUS_EINGESCHR_KOMPFKT_SD = 4,
+    BMS_FEHLERSTATUS_EINGESCHR_KOMPFKT_LEISTUNGSRED = 5,
+    BMS_FEHLERSTATUS_KEINE_KOMPONENTENFUNKTION = 6,
+    BMS_FEHLERSTATUS_INIT = 7
+};
+
+#define BMS_KAPAZITAET_02_ENUM "2047=Init"
+enum BMS_Kapazitaet_02_Enum
+{
+    BMS_KAPAZITAET_02_INIT = 2047
+};
+
+#define BMS_SOLL_SOC_HIRES_ENUM "2046=Init, 2047=Fehler"
+enum BMS_Soll_SOC_HiRes_Enum
+{
+    BMS_SOLL_SOC_HIRES_INIT = 2046,
+    BMS_SOLL_SOC_HIRES_FEHLER = 2047
+};
+
+#define BMS_ENERGIEINHALT_ENUM "2046=Init, 2047=Fehler"
+enum BMS_Energieinhalt_Enum
+{
+    BMS_ENERGIEINHALT_INIT = 2046,
+    BMS_ENERGIEINHALT_FEHLER = 2047
+};
+
+#define BMS_LADEVORGANG_AKTIV_ENUM "0=inaktiv, 1=aktiv"
+enum BMS_Ladevorgang_aktiv_Enum
+{
+    BMS_LADEVORGANG_AKTIV_INAKTIV = 0,
+    BMS_LADEVORGANG_AKTIV_AKTIV = 1
+};
+
+#define BMS_BATTERIEDIAGNOSE_ENUM "1=Anzeige_Batterie, 4=Anzeige_Batterie_OK, 5=Anzeige_Batterie_Laden, 6=Anzeige_Batterie_Pruefen, 7=Fehler"
+enum BMS_Batteriediagnose_Enum
+{
+    BMS_BATTERIEDIAGNOSE_ANZEIGE_BATTERIE = 1,
+    BMS_BATTERIEDIAGNOSE_ANZEIGE_BATTERIE_OK = 4,
+    BMS_BATTERIEDIAGNOSE_ANZEIGE_BATTERIE_LADEN = 5,
+    BMS_BATTERIEDIAGNOSE_ANZEIGE_BATTERIE_PRUEFEN = 6,
+    BMS_BATTERIEDIAGNOSE_FEHLER = 7
+};
+
+#define BMS_FREIG_MAX_PERFORMANZ_ENUM "0=Init, 1=verfuegbar, 2=nicht_verfuegbar, 3=eingeschraenkt_verfuegbar"
+enum BMS_Freig_max_Performanz_Enum
+{
+    BMS_FREIG_MAX_PERFORMANZ_INIT = 0,
+    BMS_FREIG_MAX_PERFORMANZ_VERFUEGBAR = 1,
+    BMS_FREIG_MAX_PERFORMANZ_NICHT_VERFUEGBAR = 2,
+    BMS_FREIG_MAX_PERFORMANZ_EINGESCHRAENKT_VERFUEGBAR = 3
+};
+
+#define BMS_BALANCING_AKTIV_ENUM "0=Init, 1=aktiv, 2=nicht_aktiv"
+enum BMS_Balancing_Aktiv_Enum
+{
+    BMS_BALANCING_AKTIV_INIT = 0,
+    BMS_BALANCING_AKTIV_AKTIV = 1,
+    BMS_BALANCING_AKTIV_NICHT_AKTIV = 2
+};
+
+#define BMS_MAXENERGIEINHALT_ENUM "2046=Init, 2047=Fehler"
+enum BMS_MaxEnergieinhalt_Enum
+{
+    BMS_MAXENERGIEINHALT_INIT = 2046,
+    BMS_MAXENERGIEINHALT_FEHLER = 2047
+};
+
+#define BMS_AUSGLEICHSLADUNG_ANF_ENUM "1=Balancing_Request"
+enum BMS_Ausgleichsladung_Anf_Enum
+{
+    BMS_AUSGLEICHSLADUNG_ANF_BALANCING_REQUEST = 1
+};
+
+#define BMS_GESAMTST_SPGFREIHEIT_ENUM "0=Funktion_nicht_aktiviert, 1=HV_System_spannungsfrei, 2=HV_System_nicht_spannungsfrei, 3=Fehler_nicht_spannungsfrei"
+enum BMS_Gesamtst_Spgfreiheit_Enum
+{
+    BMS_GESAMTST_SPGFREIHEIT_FUNKTION_NICHT_AKTIVIERT = 0,
+    BMS_GESAMTST_SPGFREIHEIT_HV_SYSTEM_SPANNUNGSFREI = 1,
+    BMS_GESAMTST_SPGFREIHEIT_HV_SYSTEM_NICHT_SPANNUNGSFREI = 2,
+    BMS_GESAMTST_SPGFREIHEIT_FEHLER_NICHT_SPANNUNGSFREI = 3
+};
+
+#define BMS_RISO_EXT_ENUM "4094=Init, 4095=Fehler"
+enum BMS_RIso_Ext_Enum
+{
+    BMS_RISO_EXT_INIT = 4094,
+    BMS_RISO_EXT_FEHLER = 4095
+};
+
+#define BMS_KUNDENWARNUNG_ENUM "0=keine_Warnung, 1=Warnung_Temperatur_Level1, 2=Warnung_Temperatur_Level2"
+enum BMS_KundenWarnung_Enum
+{
+    BMS_KUNDENWARNUNG_KEINE_WARNUNG = 0,
+    BMS_KUNDENWARNUNG_WARNUNG_TEMPERATUR_LEVEL1 = 1,
+    BMS_KUNDENWARNUNG_WARNUNG_TEMPERATUR_LEVEL2 = 2
+};
+
+#define BMS_FEHLER_KUEHLKREISLAUFLECKAGE_ENUM "0=kein_Fehler, 1=Fehler_KuehlkreislaufLeckage"
+enum BMS_Fehler_KuehlkreislaufLeckage_Enum
+{
+    BMS_FEHLER_KUEHLKREISLAUFLECKAGE_KEIN_FEHLER = 0,
+    BMS_FEHLER_KUEHLKREISLAUFLECKAGE_FEHLER_KUEHLKREISLAUFLECKAGE = 1
+};
+
+#define DC_FEHLERSTATUS_ENUM "0=Komponente_IO, 1=Eingeschr_KompFkt_Entlad_defekt, 3=Eingeschr_KompFkt_Interlock, 6=Keine_Komponentenfunktion, 7=Init"
+enum DC_Fehlerstatus_Enum
+{
+    DC_FEHLERSTATUS_KOMPONENTE_IO = 0,
+    DC_FEHLERSTATUS_EINGESCHR_KOMPFKT_ENTLAD_DEFEKT = 1,
+    DC_FEHLERSTATUS_EINGESCHR_KOMPFKT_INTERLOCK = 3,
+    DC_FEHLERSTATUS_KEINE_KOMPONENTENFUNKTION = 6,
+    DC_FEHLERSTATUS_INIT = 7
+};
+
+#define DC_PEAKSTROM_VERFUEGBAR_ENUM "0=Peakstrom_nicht_verfuegbar, 1=Peakstrom_verfuegbar"
+enum DC_Peakstrom_verfuegbar_Enum
+{
+    DC_PEAKSTROM_VERFUEGBAR_PEAKSTROM_NICHT_VERFUEGBAR = 0,
+    DC_PEAKSTROM_VERFUEGBAR_PEAKSTROM_VERFUEGBAR = 1
+};
+
+#define DC_ABREGELUNG_TEMPERATUR_ENUM "0=keine_Abregelung, 1=Abregelung_Temp"
+enum DC_Abregelung_Temperatur_Enum
+{
+    DC_ABREGELUNG_TEMPERATUR_KEINE_ABREGELUNG = 0,
+    DC_ABREGELUNG_TEMPERATUR_ABREGELUNG_TEMP = 1
+};
+
+#define DC_ISTMODUS_02_ENUM "0=Standby, 1=HV_On_Vorladen, 2=Tiefsetzen, 3=Hochsetzen, 4=Pruefimpuls_12V, 5=Fehler, 7=Initialisierung"
+enum DC_IstModus_02_Enum
+{
+    DC_ISTMODUS_02_STANDBY = 0,
+    DC_ISTMODUS_02_HV_ON_VORLADEN = 1,
+    DC_ISTMODUS_02_TIEFSETZEN = 2,
+    DC_ISTMODUS_02_HOCHSETZEN = 3,
+    DC_ISTMODUS_02_PRUEFIMPULS_12V = 4,
+    DC_ISTMODUS_02_FEHLER = 5,
+    DC_ISTMODUS_02_INITIALISIERUNG = 7
+};
+
+#define DC_HV_EKK_ISTMODUS_ENUM "0=Standby, 2=Tiefsetzen, 3=Hochsetzen, 5=Fehler, 7=Initialisierung"
+enum DC_HV_EKK_IstModus_Enum
+{
+    DC_HV_EKK_ISTMODUS_STANDBY = 0,
+    DC_HV_EKK_ISTMODUS_TIEFSETZEN = 2,
+    DC_HV_EKK_ISTMODUS_HOCHSETZEN = 3,
+    DC_HV_EKK_ISTMODUS_FEHLER = 5,
+    DC_HV_EKK_ISTMODUS_INITIALISIERUNG = 7
+};
+
+#define DC_STATUS_SPGFREIHEIT_HV_ENUM "0=Init, 1=HV_Komponente_spannungsfrei, 2=HV_Komp_nicht_spannungsfrei, 3=Fehler_nicht_spannungsfrei"
+enum DC_Status_Spgfreiheit_HV_Enum
+{
+    DC_STATUS_SPGFREIHEIT_HV_INIT = 0,
+    DC_STATUS_SPGFREIHEIT_HV_HV_KOMPONENTE_SPANNUNGSFREI = 1,
+    DC_STATUS_SPGFREIHEIT_HV_HV_KOMP_NICHT_SPANNUNGSFREI = 2,
+    DC_STATUS_SPGFREIHEIT_HV_FEHLER_NICHT_SPANNUNGSFREI = 3
+};
+
+#define DC_ISTSPANNUNG_EKK_HV_ENUM "255=Init"
+enum DC_IstSpannung_EKK_HV_Enum
+{
+    DC_ISTSPANNUNG_EKK_HV_INIT = 255
+};
+
+#define DC_TEMPERATUR_ENUM "254=Init, 255=Fehler"
+enum DC_Temperatur_Enum
+{
+    DC_TEMPERATUR_INIT = 254,
+    DC_TEMPERATUR_FEHLER = 255
+};
+
+#define BMS_MAXDYN_ENTLADESTROM_02_ENUM "2046=Init, 2047=Fehler"
+enum BMS_MaxDyn_EntladeStrom_02_Enum
+{
+    BMS_MAXDYN_ENTLADESTROM_02_INIT = 2046,
+    BMS_MAXDYN_ENTLADESTROM_02_FEHLER = 2047
+};
+
+#define BMS_MAXDYN_LADESTROM_02_ENUM "2046=Init, 2047=Fehler"
+enum BMS_MaxDyn_LadeStrom_02_Enum
+{
+    BMS_MAXDYN_LADESTROM_02_INIT = 2046,
+    BMS_MAXDYN_LADESTROM_02_FEHLER = 2047
+};
+
+#define BMS_MIN_ENTLADESPANNUNG_ENUM "1022=Init, 1023=Fehler"
+enum BMS_Min_EntladeSpannung_Enum
+{
+    BMS_MIN_ENTLADESPANNUNG_INIT = 1022,
+    BMS_MIN_ENTLADESPANNUNG_FEHLER = 1023
+};
+
+#define BMS_MINDYN_ENTLADESPANNUNG_ENUM "1023=Init"
+enum BMS_MinDyn_EntladeSpannung_Enum
+{
+    BMS_MINDYN_ENTLADESPANNUNG_INIT = 1023
+};
+
+#define BMS_MINDYN_LADESPANNUNG_ENUM "1023=Init"
+enum BMS_MinDyn_LadeSpannung_Enum
+{
+    BMS_MINDYN_LADESPANNUNG_INIT = 1023
+};
+
+#define BMS_LEERLAUFSPANNUNG_ENUM "1023=Init"
+enum BMS_Leerlaufspannung_Enum
+{
+    BMS_LEERLAUFSPANNUNG_INIT = 1023
+};
+
+#define BMS_MAX_LADESPANNUNG_ENUM "1022=Init, 1023=Fehler"
+enum BMS_Max_LadeSpannung_Enum
+{
+    BMS_MAX_LADESPANNUNG_INIT = 1022,
+    BMS_MAX_LADESPANNUNG_FEHLER = 1023
+};
+
+#define BMS_MAXPRED_ENTLADESTROM_02_ENUM "2046=Init, 2047=Fehler"
+enum BMS_MaxPred_EntladeStrom_02_Enum
+{
+    BMS_MAXPRED_ENTLADESTROM_02_INIT = 2046,
+    BMS_MAXPRED_ENTLADESTROM_02_FEHLER = 2047
+};
+
+#define BMS_MAXPRED_LADESTROM_02_ENUM "2046=Init, 2047=Fehler"
+enum BMS_MaxPred_LadeStrom_02_Enum
+{
+    BMS_MAXPRED_LADESTROM_02_INIT = 2046,
+    BMS_MAXPRED_LADESTROM_02_FEHLER = 2047
+};
+
+#define BMS_MINPRED_ENTLADESPANNUNG_ENUM "1023=Init"
+enum BMS_MinPred_EntladeSpannung_Enum
+{
+    BMS_MINPRED_ENTLADESPANNUNG_INIT = 1023
+};
+
+#define BMS_MINPRED_LADESPANNUNG_ENUM "1023=Init"
+enum BMS_MinPred_LadeSpannung_Enum
+{
+    BMS_MINPRED_LADESPANNUNG_INIT = 1023
+};
+
+#define BMS_ENERGIEINHALT_HIRES_ENUM "32766=Init, 32767=Fehler"
+enum BMS_Energieinhalt_HiRes_Enum
+{
+    BMS_ENERGIEINHALT_HIRES_INIT = 32766,
+    BMS_ENERGIEINHALT_HIRES_FEHLER = 32767
+};
+
+#define BMS_MAXENERGIEINHALT_HIRES_ENUM "32766=Init, 32767=Fehler"
+enum BMS_MaxEnergieinhalt_HiRes_Enum
+{
+    BMS_MAXENERGIEINHALT_HIRES_INIT = 32766,
+    BMS_MAXENERGIEINHALT_HIRES_FEHLER = 32767
+};
+
+#define BMS_NUTZBARERSOC_ENUM "254=Init, 255=Fehler"
+enum BMS_NutzbarerSOC_Enum
+{
+    BMS_NUTZBARERSOC_INIT = 254,
+    BMS_NUTZBARERSOC_FEHLER = 255
+};
+
+#define BMS_NUTZBARERENERGIEINHALT_ENUM "4094=Init, 4095=Fehler"
+enum BMS_NutzbarerEnergieinhalt_Enum
+{
+    BMS_NUTZBARERENERGIEINHALT_INIT = 4094,
+    BMS_NUTZBARERENERGIEINHALT_FEHLER = 4095
+};
+
+#define BMS_PRED_ENTLADEPERFORMANCE_ENUM "126=Init, 127=Fehler"
+enum BMS_Pred_Entladeperformance_Enum
+{
+    BMS_PRED_ENTLADEPERFORMANCE_INIT = 126,
+    BMS_PRED_ENTLADEPERFORMANCE_FEHLER = 127
+};
+
+#define BMS_PRED_LADEPERFORMANCE_ENUM "126=Init, 127=Fehler"
+enum BMS_Pred_Ladeperformance_Enum
+{
+    BMS_PRED_LADEPERFORMANCE_INIT = 126,
+    BMS_PRED_LADEPERFORMANCE_FEHLER = 127
+};
+
+#define HVEM_NVNACHLADEN_ENERGIE_ENUM "254=Init, 255=Fehler"
+enum HVEM_NVNachladen_Energie_Enum
+{
+    HVEM_NVNACHLADEN_ENERGIE_INIT = 254,
+    HVEM_NVNACHLADEN_ENERGIE_FEHLER = 255
+};
+
+#define HVEM_MAX_VK_BETRIEBSDAUER_ENUM "62=Init, 63=Fehler"
+enum HVEM_Max_VK_Betriebsdauer_Enum
+{
+    HVEM_MAX_VK_BETRIEBSDAUER_INIT = 62,
+    HVEM_MAX_VK_BETRIEBSDAUER_FEHLER = 63
+};
+
+#define HVEM_NACHLADEN_ANF_ENUM "0=keine_Anforderung, 1=Nachladen_angefordert"
+enum HVEM_Nachladen_Anf_Enum
+{
+    HVEM_NACHLADEN_ANF_KEINE_ANFORDERUNG = 0,
+    HVEM_NACHLADEN_ANF_NACHLADEN_ANGEFORDERT = 1
+};
+
+#define HVEM_SOLLSTROM_HV_ENUM "2046=Init, 2047=Fehler"
+enum HVEM_SollStrom_HV_Enum
+{
+    HVEM_SOLLSTROM_HV_INIT = 2046,
+    HVEM_SOLLSTROM_HV_FEHLER = 2047
+};
+
+#define HVEM_MAXSPANNUNG_HV_ENUM "1022=Init, 1023=Fehler"
+enum HVEM_MaxSpannung_HV_Enum
+{
+    HVEM_MAXSPANNUNG_HV_INIT = 1022,
+    HVEM_MAXSPANNUNG_HV_FEHLER = 1023
+};
+
+#define HVEM_ABSCHALTSTATUS_ENUM "0=100, 1=75, 2=50, 3=25, 7=Init"
+enum HVEM_Abschaltstatus_Enum
+{
+    HVEM_ABSCHALTSTATUS_V100 = 0,
+    HVEM_ABSCHALTSTATUS_V75 = 1,
+    HVEM_ABSCHALTSTATUS_V50 = 2,
+    HVEM_ABSCHALTSTATUS_V25 = 3,
+    HVEM_ABSCHALTSTATUS_INIT = 7
+};
+
+#define HVEM_DCDC_FREIGABE_ENUM "0=keine_Freigabe, 1=Freigabe"
+enum HVEM_DCDC_Freigabe_Enum
+{
+    HVEM_DCDC_FREIGABE_KEINE_FREIGABE = 0,
+    HVEM_DCDC_FREIGABE_FREIGABE = 1
+};
+
+#define HVEM_FREIGABEKLIMATISIERUNG_ENUM "0=keine_Freigabe, 1=Freigabe, 2=Init, 3=Fehler"
+enum HVEM_FreigabeKlimatisierung_Enum
+{
+    HVEM_FREIGABEKLIMATISIERUNG_KEINE_FREIGABE = 0,
+    HVEM_FREIGABEKLIMATISIERUNG_FREIGABE = 1,
+    HVEM_FREIGABEKLIMATISIERUNG_INIT = 2,
+    HVEM_FREIGABEKLIMATISIERUNG_FEHLER = 3
+};
+
+#define HVEM_ISTSTROM_HVVERBRAUCHER_ENUM "4094=Init, 4095=Fehler"
+enum HVEM_IstStrom_HVVerbraucher_Enum
+{
+    HVEM_ISTSTROM_HVVERBRAUCHER_INIT = 4094,
+    HVEM_ISTSTROM_HVVERBRAUCHER_FEHLER = 4095
+};
+
+#define HVEM_ENERGIE_KLIMA_VORGABE_HIGHR_ENUM "6=Init, 7=Fehler"
+enum HVEM_Energie_Klima_Vorgabe_HighR_Enum
+{
+    HVEM_ENERGIE_KLIMA_VORGABE_HIGHR_INIT = 6,
+    HVEM_ENERGIE_KLIMA_VORGABE_HIGHR_FEHLER = 7
+};
+
+#define HVEM_ISTLEISTUNGNA_ENUM "510=Init, 511=Fehler"
+enum HVEM_IstLeistungNA_Enum
+{
+    HVEM_ISTLEISTUNGNA_INIT = 510,
+    HVEM_ISTLEISTUNGNA_FEHLER = 511
+};
+
+#define HVEM_LEISTUNG_KLIMA_VORGABE_ENUM "254=Init, 255=Fehler"
+enum HVEM_Leistung_Klima_Vorgabe_Enum
+{
+    HVEM_LEISTUNG_KLIMA_VORGABE_INIT = 254,
+    HVEM_LEISTUNG_KLIMA_VORGABE_FEHLER = 255
+};
+
+#define HVEM_NUTZBARE_ENERGIE_ENUM "2045=Max, 2046=Init, 2047=Fehler"
+enum HVEM_Nutzbare_Energie_Enum
+{
+    HVEM_NUTZBARE_ENERGIE_MAX = 2045,
+    HVEM_NUTZBARE_ENERGIE_INIT = 2046,
+    HVEM_NUTZBARE_ENERGIE_FEHLER = 2047
+};
+
+#define HVEM_ENERGIE_KLIMA_VORGABE_ENUM "254=Init, 255=Fehler"
+enum HVEM_Energie_Klima_Vorgabe_Enum
+{
+    HVEM_ENERGIE_KLIMA_VORGABE_INIT = 254,
+    HVEM_ENERGIE_KLIMA_VORGABE_FEHLER = 255
+};
+
+#define HVEM_MO_MAXLEISTUNGIGNORIERT_ENUM "0=Max_Leistung_nicht_ignoriert, 1=Max_Leistung_ignoriert"
+enum HVEM_MO_MaxLeistungIgnoriert_Enum
+{
+    HVEM_MO_MAXLEISTUNGIGNORIERT_MAX_LEISTUNG_NICHT_IGNORIERT = 0,
+    HVEM_MO_MAXLEISTUNGIGNORIERT_MAX_LEISTUNG_IGNORIERT = 1
+};
+
+#define BCM_FH_FREIGABE_ENUM "1=Funktionsfreigabe_Fensterheber"
+enum BCM_FH_Freigabe_Enum
+{
+    BCM_FH_FREIGABE_FUNKTIONSFREIGABE_FENSTERHEBER = 1
+};
+
+#define BCM_KOMFORTFKT_FREIGABE_ENUM "0=Komfortfunktion_gesperrt, 1=globale_Freigabe_der_Komfortfunktion_erteilt"
+enum BCM_Komfortfkt_Freigabe_Enum
+{
+    BCM_KOMFORTFKT_FREIGABE_KOMFORTFUNKTION_GESPERRT = 0,
+    BCM_KOMFORTFKT_FREIGABE_GLOBALE_FREIGABE_DER_KOMFORTFUNKTION_ERTEILT = 1
+};
+
+#define BCM_HSK_FREIGABE_ENUM "0=erlauben, 1=sperren"
+enum BCM_HSK_Freigabe_Enum
+{
+    BCM_HSK_FREIGABE_ERLAUBEN = 0,
+    BCM_HSK_FREIGABE_SPERREN = 1
+};
+
+#define BCM_VERDECK_FREIGABE_ENUM "0=Verdeckbetrieb_nicht_erlaubt, 1=Verdeckbetrieb_erlaubt"
+enum BCM_Verdeck_Freigabe_Enum
+{
+    BCM_VERDECK_FREIGABE_VERDECKBETRIEB_NICHT_ERLAUBT = 0,
+    BCM_VERDECK_FREIGABE_VERDECKBETRIEB_ERLAUBT = 1
+};
+
+#define ZV_VERRIEGELT_INTERN_IST_ENUM "1=Fahrzeug_innen_verriegelt;_Istzustand"
+enum ZV_verriegelt_intern_ist_Enum
+{
+    ZV_VERRIEGELT_INTERN_IST_FAHRZEUG_INNEN_VERRIEGELT_ISTZUSTAND = 1
+};
+
+#define ZV_VERRIEGELT_EXTERN_IST_ENUM "1=Fahrzeug_aussen_verriegelt_Istzustand"
+enum ZV_verriegelt_extern_ist_Enum
+{
+    ZV_VERRIEGELT_EXTERN_IST_FAHRZEUG_AUSSEN_VERRIEGELT_ISTZUSTAND = 1
+};
+
+#define ZV_VERRIEGELT_INTERN_SOLL_ENUM "1=Fahrzeug_verriegelt_intern;_Sollzusstand"
+enum ZV_verriegelt_intern_soll_Enum
+{
+    ZV_VERRIEGELT_INTERN_SOLL_FAHRZEUG_VERRIEGELT_INTERN_SOLLZUSSTAND = 1
+};
+
+#define ZV_VERRIEGELT_EXTERN_SOLL_ENUM "1=Fahrzeug_verriegelt_extern;_Sollzusstand"
+enum ZV_verriegelt_extern_soll_Enum
+{
+    ZV_VERRIEGELT_EXTERN_SOLL_FAHRZEUG_VERRIEGELT_EXTERN_SOLLZUSSTAND = 1
+};
+
+#define ZV_GESAFET_EXTERN_IST_ENUM "1=Fahrzeug_aussen_gesafet;_Istzustand"
+enum ZV_gesafet_extern_ist_Enum
+{
+    ZV_GESAFET_EXTERN_IST_FAHRZEUG_AUSSEN_GESAFET_ISTZUSTAND = 1
+};
+
+#define ZV_GESAFET_EXTERN_SOLL_ENUM "1=Fahrzeug_aussen_gesafet_Sollzustand"
+enum ZV_gesafet_extern_soll_Enum
+{
+    ZV_GESAFET_EXTERN_SOLL_FAHRZEUG_AUSSEN_GESAFET_SOLLZUSTAND = 1
+};
+
+#define ZV_EINZELTUERENTRIEGELUNG_ENUM "1=Fahrzeug_an_Einzeltuer_entriegelt"
+enum ZV_Einzeltuerentriegelung_Enum
+{
+    ZV_EINZELTUERENTRIEGELUNG_FAHRZEUG_AN_EINZELTUER_ENTRIEGELT = 1
+};
+
+#define ZV_HECKEINZELENTRIEGELUNG_ENUM "1=Heckdeckeleinzelentriegelung"
+enum ZV_Heckeinzelentriegelung_Enum
+{
+    ZV_HECKEINZELENTRIEGELUNG_HECKDECKELEINZELENTRIEGELUNG = 1
+};
+
+#define ZV_FT_OFFEN_ENUM "1=FT_geoeffnet"
+enum ZV_FT_offen_Enum
+{
+    ZV_FT_OFFEN_FT_GEOEFFNET = 1
+};
+
+#define ZV_BT_OFFEN_ENUM "1=BT_geoeffnet"
+enum ZV_BT_offen_Enum
+{
+    ZV_BT_OFFEN_BT_GEOEFFNET = 1
+};
+
+#define ZV_HFS_OFFEN_ENUM "0=geschlossen, 1=offen"
+enum ZV_HFS_offen_Enum
+{
+    ZV_HFS_OFFEN_GESCHLOSSEN = 0,
+    ZV_HFS_OFFEN_OFFEN = 1
+};
+
+#define ZV_HBFS_OFFEN_ENUM "0=geschlossen, 1=offen"
+enum ZV_HBFS_offen_Enum
+{
+    ZV_HBFS_OFFEN_GESCHLOSSEN = 0,
+    ZV_HBFS_OFFEN_OFFEN = 1
+};
+
+#define ZV_HD_OFFEN_ENUM "1=Heckdeckel_auf"
+enum ZV_HD_offen_Enum
+{
+    ZV_HD_OFFEN_HECKDECKEL_AUF = 1
+};
+
+#define ZV_HS_OFFEN_ENUM "0=Heckscheibe_geschlossen, 1=Heckscheibe_auf"
+enum ZV_HS_offen_Enum
+{
+    ZV_HS_OFFEN_HECKSCHEIBE_GESCHLOSSEN = 0,
+    ZV_HS_OFFEN_HECKSCHEIBE_AUF = 1
+};
+
+#define IRUE_AKTIV_ENUM "0=unscharf, 1=scharf"
+enum IRUE_aktiv_Enum
+{
+    IRUE_AKTIV_UNSCHARF = 0,
+    IRUE_AKTIV_SCHARF = 1
+};
+
+#define DWA_AKTIV_ENUM "0=unscharf, 1=scharf"
+enum DWA_aktiv_Enum
+{
+    DWA_AKTIV_UNSCHARF = 0,
+    DWA_AKTIV_SCHARF = 1
+};
+
+#define HD_HAUPTRASTE_ENUM "0=geschlossen, 1=offen"
+enum HD_Hauptraste_Enum
+{
+    HD_HAUPTRASTE_GESCHLOSSEN = 0,
+    HD_HAUPTRASTE_OFFEN = 1
+};
+
+#define HD_VORRASTE_ENUM "0=geschlossen, 1=offen"
+enum HD_Vorraste_Enum
+{
+    HD_VORRASTE_GESCHLOSSEN = 0,
+    HD_VORRASTE_OFFEN = 1
+};
+
+#define FFB_CARFINDER_ENUM "0=nicht_aktiv, 1=aktiv"
+enum FFB_CarFinder_Enum
+{
+    FFB_CARFINDER_NICHT_AKTIV = 0,
+    FFB_CARFINDER_AKTIV = 1
+};
+
+#define FFB_KOMFORTOEFFNEN_ENUM "0=kein_Komfortoeffnen_empfangen, 1=Komfortoeffnen_ueber_Funk_empfangen"
+enum FFB_Komfortoeffnen_Enum
+{
+    FFB_KOMFORTOEFFNEN_KEIN_KOMFORTOEFFNEN_EMPFANGEN = 0,
+    FFB_KOMFORTOEFFNEN_KOMFORTOEFFNEN_UEBER_FUNK_EMPFANGEN = 1
+};
+
+#define FFB_KOMFORTSCHLIESSEN_ENUM "0=kein_Komfortschliessen_empfangen, 1=Komfortschliessen_ueber_Funk_empfangen"
+enum FFB_Komfortschliessen_Enum
+{
+    FFB_KOMFORTSCHLIESSEN_KEIN_KOMFORTSCHLIESSEN_EMPFANGEN = 0,
+    FFB_KOMFORTSCHLIESSEN_KOMFORTSCHLIESSEN_UEBER_FUNK_EMPFANGEN = 1
+};
+
+#define ZV_SCHLUESSEL_ZUGANG_ENUM "0=kein_authorisierter_Schluessel_erkannt, 1=aktive_Funkschluessel_Nr_01, 2=aktive_Funkschluessel_Nr_02, 3=aktive_Funkschluessel_Nr_03, 4=aktive_Funkschluessel_Nr_04, 5=aktive_Funkschluessel_Nr_05, 6=aktive_Funkschluessel_Nr_06, 7=aktive_Funkschluessel_Nr_07, 8=aktive_Funkschluessel_Nr_08, 9=ungueltig_09, 10=ungueltig_10, 11=ungueltig_11, 12=ungueltig_12, 13=ungueltig_13, 14=ungueltig_14, 15=ungueltig_15"
+enum ZV_Schluessel_Zugang_Enum
+{
+    ZV_SCHLUESSEL_ZUGANG_KEIN_AUTHORISIERTER_SCHLUESSEL_ERKANNT = 0,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_01 = 1,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_02 = 2,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_03 = 3,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_04 = 4,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_05 = 5,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_06 = 6,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_07 = 7,
+    ZV_SCHLUESSEL_ZUGANG_AKTIVE_FUNKSCHLUESSEL_NR_08 = 8,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_09 = 9,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_10 = 10,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_11 = 11,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_12 = 12,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_13 = 13,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_14 = 14,
+    ZV_SCHLUESSEL_ZUGANG_UNGUELTIG_15 = 15
+};
+
+#define ZV_SAFEFUNKTION_AKTIV_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_SafeFunktion_aktiv_Enum
+{
+    ZV_SAFEFUNKTION_AKTIV_INAKTIV = 0,
+    ZV_SAFEFUNKTION_AKTIV_AKTIV = 1
+};
+
+#define FBS_WARN_SCHLUESSEL_BATT_ENUM "0=i.O., 1=defekt"
+enum FBS_Warn_Schluessel_Batt_Enum
+{
+    FBS_WARN_SCHLUESSEL_BATT_I_O = 0,
+    FBS_WARN_SCHLUESSEL_BATT_DEFEKT = 1
+};
+
+#define ZV_OEFFNUNGSMODUS_ENUM "0=globale_Oeffnung, 1=ZV_mit_Einzeltuerentr, 2=ZV_individuell_selektiv, 3=ZV_seitenselektiv"
+enum ZV_Oeffnungsmodus_Enum
+{
+    ZV_OEFFNUNGSMODUS_GLOBALE_OEFFNUNG = 0,
+    ZV_OEFFNUNGSMODUS_ZV_MIT_EINZELTUERENTR = 1,
+    ZV_OEFFNUNGSMODUS_ZV_INDIVIDUELL_SELEKTIV = 2,
+    ZV_OEFFNUNGSMODUS_ZV_SEITENSELEKTIV = 3
+};
+
+#define HFS_VERRIEGELT_ENUM "0=nicht_verriegelt, 1=verriegelt"
+enum HFS_verriegelt_Enum
+{
+    HFS_VERRIEGELT_NICHT_VERRIEGELT = 0,
+    HFS_VERRIEGELT_VERRIEGELT = 1
+};
+
+#define HFS_GESAFET_ENUM "0=nicht_gesafet, 1=gesafet"
+enum HFS_gesafet_Enum
+{
+    HFS_GESAFET_NICHT_GESAFET = 0,
+    HFS_GESAFET_GESAFET = 1
+};
+
+#define HBFS_VERRIEGELT_ENUM "0=nicht_verriegelt, 1=verriegelt"
+enum HBFS_verriegelt_Enum
+{
+    HBFS_VERRIEGELT_NICHT_VERRIEGELT = 0,
+    HBFS_VERRIEGELT_VERRIEGELT = 1
+};
+
+#define HBFS_GESAFET_ENUM "0=nicht_gesafet, 1=gesafet"
+enum HBFS_gesafet_Enum
+{
+    HBFS_GESAFET_NICHT_GESAFET = 0,
+    HBFS_GESAFET_GESAFET = 1
+};
+
+#define ZV_IST_ZUSTAND_VERFUEGBAR_ENUM "0=nicht_verfuegbar, 1=verfuegbar_alle_TSGs_am_Bus"
+enum ZV_ist_Zustand_verfuegbar_Enum
+{
+    ZV_IST_ZUSTAND_VERFUEGBAR_NICHT_VERFUEGBAR = 0,
+    ZV_IST_ZUSTAND_VERFUEGBAR_VERFUEGBAR_ALLE_TSGS_AM_BUS = 1
+};
+
+#define IRUE_TASTER_FKTS_LED_ENUM "0=LED_aus, 1=LED_ein"
+enum IRUE_Taster_Fkts_LED_Enum
+{
+    IRUE_TASTER_FKTS_LED_LED_AUS = 0,
+    IRUE_TASTER_FKTS_LED_LED_EIN = 1
+};
+
+#define ZV_TANKKLAPPE_OFFEN_ENUM "0=Tankklappe_geschlossen, 1=Tankklappe_offen"
+enum ZV_Tankklappe_offen_Enum
+{
+    ZV_TANKKLAPPE_OFFEN_TANKKLAPPE_GESCHLOSSEN = 0,
+    ZV_TANKKLAPPE_OFFEN_TANKKLAPPE_OFFEN = 1
+};
+
+#define ZV_ROLLO_AUF_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_Rollo_auf_Enum
+{
+    ZV_ROLLO_AUF_INAKTIV = 0,
+    ZV_ROLLO_AUF_AKTIV = 1
+};
+
+#define ZV_ROLLO_ZU_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_Rollo_zu_Enum
+{
+    ZV_ROLLO_ZU_INAKTIV = 0,
+    ZV_ROLLO_ZU_AKTIV = 1
+};
+
+#define ZV_SAD_AUF_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_SAD_auf_Enum
+{
+    ZV_SAD_AUF_INAKTIV = 0,
+    ZV_SAD_AUF_AKTIV = 1
+};
+
+#define ZV_SAD_ZU_ENUM "0=inaktiv, 1=aktiv"
+enum ZV_SAD_zu_Enum
+{
+    ZV_SAD_ZU_INAKTIV = 0,
+    ZV_SAD_ZU_AKTIV = 1
+};
+
+#define BCM_TANKKLAPPENSTELLER_FEHLER_ENUM "0=kein_Fehler, 1=Fehler"
+enum BCM_Tankklappensteller_Fehler_Enum
+{
+    BCM_TANKKLAPPENSTELLER_FEHLER_KEIN_FEHLER = 0,
+    BCM_TANKKLAPPENSTELLER_FEHLER_FEHLER = 1
+};
+
+#define ZV_VERRIEGELT_SOLL_ENUM "0=Init, 1=nicht_verriegelt, 2=verriegelt"
+enum ZV_verriegelt_soll_Enum
+{
+    ZV_VERRIEGELT_SOLL_INIT = 0,
+    ZV_VERRIEGELT_SOLL_NICHT_VERRIEGELT = 1,
+    ZV_VERRIEGELT_SOLL_VERRIEGELT = 2
+};
+
+#define FCU_WARN_H2_KONZENTRAT_MOTORRAUM_ENUM "0=Init, 1=H2_Konzentration_Hoch, 2=H2_Konzentration_Warnschnwelle, 3=Drei_Prozent_H2, 4=Vier_Prozent_H2, 5=Leak_Check_Shut_Down_failed, 6=Leak_Check_Start_Up_failed, 7=reserviert"
+enum FCU_Warn_H2_Konzentrat_Motorraum_Enum
+{
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_INIT = 0,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_H2_KONZENTRATION_HOCH = 1,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_H2_KONZENTRATION_WARNSCHNWELLE = 2,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_DREI_PROZENT_H2 = 3,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_VIER_PROZENT_H2 = 4,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_LEAK_CHECK_SHUT_DOWN_FAILED = 5,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_LEAK_CHECK_START_UP_FAILED = 6,
+    FCU_WARN_H2_KONZENTRAT_MOTORRAUM_RESERVIERT = 7
+};
+
+#define FCU_NICHT_VERFUEGBAR_ENUM "0=verfuegbar, 1=nicht_verfuegbar"
+enum FCU_nicht_verfuegbar_Enum
+{
+    FCU_NICHT_VERFUEGBAR_VERFUEGBAR = 0,
+    FCU_NICHT_VERFUEGBAR_NICHT_VERFUEGBAR = 1
+};
+
+#define FCU_STARTSTOPP_ANFORDERUNG_ENUM "0=keine_Anforderung, 1=Stoppverbot, 2=Startanforderung, 3=Stoppanforderung, 4=Startverbot, 5=Stoppverbot_weich, 6=Startwunsch_weich, 7=Stoppwunsch_weich, 8=Startverbot_weich"
+enum FCU_Startstopp_Anforderung_Enum
+{
+    FCU_STARTSTOPP_ANFORDERUNG_KEINE_ANFORDERUNG = 0,
+    FCU_STARTSTOPP_ANFORDERUNG_STOPPVERBOT = 1,
+    FCU_STARTSTOPP_ANFORDERUNG_STARTANFORDERUNG = 2,
+    FCU_STARTSTOPP_ANFORDERUNG_STOPPANFORDERUNG = 3,
+    FCU_STARTSTOPP_ANFORDERUNG_STARTVERBOT = 4,
+    FCU_STARTSTOPP_ANFORDERUNG_STOPPVERBOT_WEICH = 5,
+    FCU_STARTSTOPP_ANFORDERUNG_STARTWUNSCH_WEICH = 6,
+    FCU_STARTSTOPP_ANFORDERUNG_STOPPWUNSCH_WEICH = 7,
+    FCU_STARTSTOPP_ANFORDERUNG_STARTVERBOT_WEICH = 8
+};
+
+#define FCU_HV_ANF_ENUM "0=Init, 1=HV_Netz_nicht_angefordert, 2=HV_Netz_angefordert, 3=Fehler"
+enum FCU_HV_Anf_Enum
+{
+    FCU_HV_ANF_INIT = 0,
+    FCU_HV_ANF_HV_NETZ_NICHT_ANGEFORDERT = 1,
+    FCU_HV_ANF_HV_NETZ_ANGEFORDERT = 2,
+    FCU_HV_ANF_FEHLER = 3
+};
+
+#define FCU_KLIMA_EINGR_ENUM "0=kein_Eingriff, 1=Klimakompressor_ausschalten, 2=Klimakomp_Leistungsreduzierung, 3=Klimakomp_wegen_Heissleuchte_aus"
+enum FCU_Klima_Eingr_Enum
+{
+    FCU_KLIMA_EINGR_KEIN_EINGRIFF = 0,
+    FCU_KLIMA_EINGR_KLIMAKOMPRESSOR_AUSSCHALTEN = 1,
+    FCU_KLIMA_EINGR_KLIMAKOMP_LEISTUNGSREDUZIERUNG = 2,
+    FCU_KLIMA_EINGR_KLIMAKOMP_WEGEN_HEISSLEUCHTE_AUS = 3
+};
+
+#define FCU_ISTMODUS_ENUM "0=Off, 1=Standby, 2=Run, 3=Sleep, 4=Blowby, 5=Fehler_Notabschaltung, 31=Init"
+enum FCU_IstModus_Enum
+{
+    FCU_ISTMODUS_OFF = 0,
+    FCU_ISTMODUS_STANDBY = 1,
+    FCU_ISTMODUS_RUN = 2,
+    FCU_ISTMODUS_SLEEP = 3,
+    FCU_ISTMODUS_BLOWBY = 4,
+    FCU_ISTMODUS_FEHLER_NOTABSCHALTUNG = 5,
+    FCU_ISTMODUS_INIT = 31
+};
+
+#define FCU_STATUS_SPGFREIHEIT_ENUM "0=Init, 1=HV_Komponente_spannungsfrei, 2=HV_Komp_nicht_spannungsfrei, 3=Fehler_nicht_spannungsfrei"
+enum FCU_Status_Spgfreiheit_Enum
+{
+    FCU_STATUS_SPGFREIHEIT_INIT = 0,
+    FCU_STATUS_SPGFREIHEIT_HV_KOMPONENTE_SPANNUNGSFREI = 1,
+    FCU_STATUS_SPGFREIHEIT_HV_KOMP_NICHT_SPANNUNGSFREI = 2,
+    FCU_STATUS_SPGFREIHEIT_FEHLER_NICHT_SPANNUNGSFREI = 3
+};
+
+#define FCU_FEHLER_LEISTUNGSREDUZIERUNG_ENUM "0=kein_Fehler, 1=Fehler"
+enum FCU_Fehler_Leistungsreduzierung_Enum
+{
+    FCU_FEHLER_LEISTUNGSREDUZIERUNG_KEIN_FEHLER = 0,
+    FCU_FEHLER_LEISTUNGSREDUZIERUNG_FEHLER = 1
+};
+
+#define FCU_FEHLER_ABSCHALTANFORDERUNG_ENUM "0=kein_Fehler, 1=Fehler"
+enum FCU_Fehler_Abschaltanforderung_Enum
+{
+    FCU_FEHLER_ABSCHALTANFORDERUNG_KEIN_FEHLER = 0,
+    FCU_FEHLER_ABSCHALTANFORDERUNG_FEHLER = 1
+};
+
+#define FCU_FEHLER_NOTABSCHALTUNG_ENUM "0=kein_Fehler, 1=Fehler"
+enum FCU_Fehler_Notabschaltung_Enum
+{
+    FCU_FEHLER_NOTABSCHALTUNG_KEIN_FEHLER = 0,
+    FCU_FEHLER_NOTABSCHALTUNG_FEHLER = 1
+};
+
+#define FCU_FEHLER_ENTLADUNG_DEFEKT_ENUM "0=nicht_aktiv, 1=Fehler, 2=Reserve, 3=Init"
+enum FCU_Fehler_Entladung_defekt_Enum
+{
+    FCU_FEHLER_ENTLADUNG_DEFEKT_NICHT_AKTIV = 0,
+    FCU_FEHLER_ENTLADUNG_DEFEKT_FEHLER = 1,
+    FCU_FEHLER_ENTLADUNG_DEFEKT_RESERVE = 2,
+    FCU_FEHLER_ENTLADUNG_DEFEKT_INIT = 3
+};
+
+#define FCU_FEHLER_ISOFEHLER_I_ENUM "0=nicht_aktiv, 1=aktiv, 2=Reserve, 3=Init"
+enum FCU_Fehler_Isofehler_I_Enum
+{
+    FCU_FEHLER_ISOFEHLER_I_NICHT_AKTIV = 0,
+    FCU_FEHLER_ISOFEHLER_I_AKTIV = 1,
+    FCU_FEHLER_ISOFEHLER_I_RESERVE = 2,
+    FCU_FEHLER_ISOFEHLER_I_INIT = 3
+};
+
+#define FCU_FEHLER_ISOFEHLER_II_ENUM "0=nicht_aktiv, 1=aktiv, 2=Reserve, 3=Init"
+enum FCU_Fehler_Isofehler_II_Enum
+{
+    FCU_FEHLER_ISOFEHLER_II_NICHT_AKTIV = 0,
+    FCU_FEHLER_ISOFEHLER_II_AKTIV = 1,
+    FCU_FEHLER_ISOFEHLER_II_RESERVE = 2,
+    FCU_FEHLER_ISOFEHLER_II_INIT = 3
+};
+
+#define FCU_OBD_LAMPE_ANF_ENUM "0=kein_MIL_Request, 1=MIL_Request"
+enum FCU_OBD_Lampe_Anf_Enum
+{
+    FCU_OBD_LAMPE_ANF_KEIN_MIL_REQUEST = 0,
+    FCU_OBD_LAMPE_ANF_MIL_REQUEST = 1
+};
+
+#define FCU_ABSPERRVENTIL_SCHLIESSEN_ENUM "0=nicht_verfuegbar, 1=Ansteuerung_Ventil_zulaessig, 2=Ventil_oeffnen_oder_geoeffnet, 3=Ventil_schliessen_o_geschlossen"
+enum FCU_Absperrventil_schliessen_Enum
+{
+    FCU_ABSPERRVENTIL_SCHLIESSEN_NICHT_VERFUEGBAR = 0,
+    FCU_ABSPERRVENTIL_SCHLIESSEN_ANSTEUERUNG_VENTIL_ZULAESSIG = 1,
+    FCU_ABSPERRVENTIL_SCHLIESSEN_VENTIL_OEFFNEN_ODER_GEOEFFNET = 2,
+    FCU_ABSPERRVENTIL_SCHLIESSEN_VENTIL_SCHLIESSEN_O_GESCHLOSSEN = 3
+};
+
+#define FCU_TK_BETANKUNG_ANFORDERUNG_ENUM "0=inaktiv, 1=aktiv"
+enum FCU_TK_Betankung_Anforderung_Enum
+{
+    FCU_TK_BETANKUNG_ANFORDERUNG_INAKTIV = 0,
+    FCU_TK_BETANKUNG_ANFORDERUNG_AKTIV = 1
+};
+
+#define FCU_MINABS_LEISTUNG_ENUM "1023=Init"
+enum FCU_MinAbs_Leistung_Enum
+{
+    FCU_MINABS_LEISTUNG_INIT = 1023
+};
+
+#define FCU_IONENSPUELUNG_AKTIV_ENUM "0=keine_Spuelung, 1=Spuelung_zwingend_notwendig, 2=Spuelung_Anforderung"
+enum FCU_Ionenspuelung_aktiv_Enum
+{
+    FCU_IONENSPUELUNG_AKTIV_KEINE_SPUELUNG = 0,
+    FCU_IONENSPUELUNG_AKTIV_SPUELUNG_ZWINGEND_NOTWENDIG = 1,
+    FCU_IONENSPUELUNG_AKTIV_SPUELUNG_ANFORDERUNG = 2
+};
+
+#define FCU_TK_FREIGABE_TANKKLAPPE_ENUM "0=keineFreigabe, 1=Freigabe, 2=Init, 3=Fehler"
+enum FCU_TK_Freigabe_Tankklappe_Enum
+{
+    FCU_TK_FREIGABE_TANKKLAPPE_KEINEFREIGABE = 0,
+    FCU_TK_FREIGABE_TANKKLAPPE_FREIGABE = 1,
+    FCU_TK_FREIGABE_TANKKLAPPE_INIT = 2,
+    FCU_TK_FREIGABE_TANKKLAPPE_FEHLER = 3
+};
+
+#define BMS_TEMPERIERUNG_ANF_ENUM "0=hoher_Kuehlbedarf, 1=mittlerer_Kuehlbedarf, 2=niedriger_Kuehlbedarf, 3=kein_Temperierungsbedarf_Init, 4=niedriger_Heizbedarf, 5=mittlerer_Heizbedarf, 6=hoher_Heizbedarf, 7=Umwaelzungsbedarf"
+enum BMS_Temperierung_Anf_Enum
+{
+    BMS_TEMPERIERUNG_ANF_HOHER_KUEHLBEDARF = 0,
+    BMS_TEMPERIERUNG_ANF_MITTLERER_KUEHLBEDARF = 1,
+    BMS_TEMPERIERUNG_ANF_NIEDRIGER_KUEHLBEDARF = 2,
+    BMS_TEMPERIERUNG_ANF_KEIN_TEMPERIERUNGSBEDARF_INIT = 3,
+    BMS_TEMPERIERUNG_ANF_NIEDRIGER_HEIZBEDARF = 4,
+    BMS_TEMPERIERUNG_ANF_MITTLERER_HEIZBEDARF = 5,
+    BMS_TEMPERIERUNG_ANF_HOHER_HEIZBEDARF = 6,
+    BMS_TEMPERIERUNG_ANF_UMWAELZUNGSBEDARF = 7
+};
+
+#define BMS_STATUS_VENTIL_ENUM "0=Ventil_nicht_angesteuert, 1=Ventil_angesteuert, 2=reserviert, 3=reserviert, 4=reserviert, 5=Ventil_nicht_verbaut, 6=Init, 7=Fehler"
+enum BMS_Status_Ventil_Enum
+{
+    BMS_STATUS_VENTIL_VENTIL_NICHT_ANGESTEUERT = 0,
+    BMS_STATUS_VENTIL_VENTIL_ANGESTEUERT = 1,
+    BMS_STATUS_VENTIL_RESERVIERT = 2,
+    BMS_STATUS_VENTIL_RESERVIERT_3 = 3,
+    BMS_STATUS_VENTIL_RESERVIERT_4 = 4,
+    BMS_STATUS_VENTIL_VENTIL_NICHT_VERBAUT = 5,
+    BMS_STATUS_VENTIL_INIT = 6,
+    BMS_STATUS_VENTIL_FEHLER = 7
+};
+
+#define BMS_SOLL_PWM_PUMPE_ENUM "14=Fehler, 15=Init"
+enum BMS_Soll_PWM_Pumpe_Enum
+{
+    BMS_SOLL_PWM_PUMPE_FEHLER = 14,
+    BMS_SOLL_PWM_PUMPE_INIT = 15
+};
+
+#define BMS_TEMPERATUR_ENUM "254=Init, 255=Fehler"
+enum BMS_Temperatur_Enum
+{
+    BMS_TEMPERATUR_INIT = 254,
+    BMS_TEMPERATUR_FEHLER = 255
+};
+
+#define BMS_ISTVORLAUFTEMPERATUR_ENUM "254=Init, 255=Fehler"
+enum BMS_IstVorlaufTemperatur_Enum
+{
+    BMS_ISTVORLAUFTEMPERATUR_INIT = 254,
+    BMS_ISTVORLAUFTEMPERATUR_FEHLER = 255
+};
+
+#define BMS_FEHLER_NTKREIS_ENUM "0=kein_Fehler, 1=Fehler"
+enum BMS_Fehler_NTKreis_Enum
+{
+    BMS_FEHLER_NTKREIS_KEIN_FEHLER = 0,
+    BMS_FEHLER_NTKREIS_FEHLER = 1
+};
+
+#define BMS_FEHLERSTATUS_EWP_02_ENUM "0=Diagnose_nicht_durchgefuehrt, 1=Pumpe_iO, 2=Diagnose_laeuft, 3=Pumpe_iO_Diagnose_laeuft, 4=Blockade_Trockenlauf, 6=Blockade_Trockenlauf_Diag_laeuft"
+enum BMS_Fehlerstatus_EWP_02_Enum
+{
+    BMS_FEHLERSTATUS_EWP_02_DIAGNOSE_NICHT_DURCHGEFUEHRT = 0,
+    BMS_FEHLERSTATUS_EWP_02_PUMPE_IO = 1,
+    BMS_FEHLERSTATUS_EWP_02_DIAGNOSE_LAEUFT = 2,
+    BMS_FEHLERSTATUS_EWP_02_PUMPE_IO_DIAGNOSE_LAEUFT = 3,
+    BMS_FEHLERSTATUS_EWP_02_BLOCKADE_TROCKENLAUF = 4,
+    BMS_FEHLERSTATUS_EWP_02_BLOCKADE_TROCKENLAUF_DIAG_LAEUFT = 6
+};
+
+#define BMS_SOLLVOLUMENSTROM_ENUM "62=Init, 63=Fehler"
+enum BMS_SollVolumenstrom_Enum
+{
+    BMS_SOLLVOLUMENSTROM_INIT = 62,
+    BMS_SOLLVOLUMENSTROM_FEHLER = 63
+};
+
+#define BMS_BATTERIE_VOKO_ANF_ENUM "0=keine_Voko_angefordert, 1=Voko_angefordert"
+enum BMS_Batterie_Voko_Anf_Enum
+{
+    BMS_BATTERIE_VOKO_ANF_KEINE_VOKO_ANGEFORDERT = 0,
+    BMS_BATTERIE_VOKO_ANF_VOKO_ANGEFORDERT = 1
+};
+
+#define BMS_SOLLVORLAUFTEMPERATUR_ENUM "254=Init, 255=Fehler"
+enum BMS_SollVorlauftemperatur_Enum
+{
+    BMS_SOLLVORLAUFTEMPERATUR_INIT = 254,
+    BMS_SOLLVORLAUFTEMPERATUR_FEHLER = 255
+};
+
+#define BMS_ISTRUECKLAUFTEMPERATUR_02_ENUM "254=Init, 255=Fehler"
+enum BMS_IstRuecklaufTemperatur_02_Enum
+{
+    BMS_ISTRUECKLAUFTEMPERATUR_02_INIT = 254,
+    BMS_ISTRUECKLAUFTEMPERATUR_02_FEHLER = 255
+};
+
+#define ND_SATINUSE_ENUM "30=Init, 31=Fehler"
+enum ND_SatInUse_Enum
+{
+    ND_SATINUSE_INIT = 30,
+    ND_SATINUSE_FEHLER = 31
+};
+
+#define POS_GUETE_HORIZONTAL_VERFUEGBAR_ENUM "0=nicht_verfuegbar, 1=verfuegbar"
+enum POS_Guete_horizontal_verfuegbar_Enum
+{
+    POS_GUETE_HORIZONTAL_VERFUEGBAR_NICHT_VERFUEGBAR = 0,
+    POS_GUETE_HORIZONTAL_VERFUEGBAR_VERFUEGBAR = 1
+};
+
+#define ND_SATINVIEW_ENUM "30=Init, 31=Fehler"
+enum ND_SatInView_Enum
+{
+    ND_SATINVIEW_INIT = 30,
+    ND_SATINVIEW_FEHLER = 31
+};
+
+#define POS_GUETE_HORIZONTAL_ENUM "124=von_248m_bis_400m, 125=mehr_als_400m, 126=Init, 127=Fehler"
+enum POS_Guete_horizontal_Enum
+{
+    POS_GUETE_HORIZONTAL_VON_248M_BIS_400M = 124,
+    POS_GUETE_HORIZONTAL_MEHR_ALS_400M = 125,
+    POS_GUETE_HORIZONTAL_INIT = 126,
+    POS_GUETE_HORIZONTAL_FEHLER = 127
+};
+
+#define NP_ALTITUDE_ENUM "4094=Init, 4095=Fehler"
+enum NP_Altitude_Enum
+{
+    NP_ALTITUDE_INIT = 4094,
+    NP_ALTITUDE_FEHLER = 4095
+};
+
+#define AT_VALID_TIME_ENUM "0=Init"
+enum AT_VALID_TIME_Enum
+{
+    AT_VALID_TIME_INIT = 0
+};
+
+#define BMS_HV_AUSZEIT_STATUS_ENUM "0=Abstellzeit_nicht_berechnet, 1=Abstellzeit_berechnet, 2=Abstellzeit_Minimalwert, 3=Abstellzeit_ungueltig"
+enum BMS_HV_Auszeit_Status_Enum
+{
+    BMS_HV_AUSZEIT_STATUS_ABSTELLZEIT_NICHT_BERECHNET = 0,
+    BMS_HV_AUSZEIT_STATUS_ABSTELLZEIT_BERECHNET = 1,
+    BMS_HV_AUSZEIT_STATUS_ABSTELLZEIT_MINIMALWERT = 2,
+    BMS_HV_AUSZEIT_STATUS_ABSTELLZEIT_UNGUELTIG = 3
+};
+
+#define BMS_HV_AUSZEIT_ENUM "510=Init, 511=Fehler"
+enum BMS_HV_Auszeit_Enum
+{
+    BMS_HV_AUSZEIT_INIT = 510,
+    BMS_HV_AUSZEIT_FEHLER = 511
+};
+
+#define BMS_KAPAZITAET_ENUM "2047=Init"
+enum BMS_Kapazitaet_Enum
+{
+    BMS_KAPAZITAET_INIT = 2047
+};
+
+#define BMS_SOC_KALTSTART_ENUM "2046=Init, 2047=Fehler"
+enum BMS_SOC_Kaltstart_Enum
+{
+    BMS_SOC_KALTSTART_INIT = 2046,
+    BMS_SOC_KALTSTART_FEHLER = 2047
+};
+
+#define BMS_MAX_GRENZ_SOC_ENUM "31=Init"
+enum BMS_max_Grenz_SOC_Enum
+{
+    BMS_MAX_GRENZ_SOC_INIT = 31
+};
+
+#define BMS_MIN_GRENZ_SOC_ENUM "31=Init"
+enum BMS_min_Grenz_SOC_Enum
+{
+    BMS_MIN_GRENZ_SOC_INIT = 31
+};
+
+#define BMS_ISOZUSTAND_ENUM "0=Init, 1=groesser_Schwelle_1, 2=kleiner_Schwelle_1_gesamt, 3=kleiner_Schwelle_1_intern, 4=kleiner_Schwelle_2_gesamt, 5=kleiner_Schwelle_2_intern, 6=kein_Messwert, 7=Messung_aktiv"
+enum BMS_IsoZustand_Enum
+{
+    BMS_ISOZUSTAND_INIT = 0,
+    BMS_ISOZUSTAND_GROESSER_SCHWELLE_1 = 1,
+    BMS_ISOZUSTAND_KLEINER_SCHWELLE_1_GESAMT = 2,
+    BMS_ISOZUSTAND_KLEINER_SCHWELLE_1_INTERN = 3,
+    BMS_ISOZUSTAND_KLEINER_SCHWELLE_2_GESAMT = 4,
+    BMS_ISOZUSTAND_KLEINER_SCHWELLE_2_INTERN = 5,
+    BMS_ISOZUSTAND_KEIN_MESSWERT = 6,
+    BMS_ISOZUSTAND_MESSUNG_AKTIV = 7
+};
+
+#define BMS_ISOFEHLER_ENUM "0=Init, 1=kein_IsoFehler, 2=IsoFehler_Schwelle_1, 3=IsoFehler_Schwelle_2, 4=IWU_defekt, 5=reserviert, 6=reserviert, 7=reserviert"
+enum BMS_IsoFehler_Enum
+{
+    BMS_ISOFEHLER_INIT = 0,
+    BMS_ISOFEHLER_KEIN_ISOFEHLER = 1,
+    BMS_ISOFEHLER_ISOFEHLER_SCHWELLE_1 = 2,
+    BMS_ISOFEHLER_ISOFEHLER_SCHWELLE_2 = 3,
+    BMS_ISOFEHLER_IWU_DEFEKT = 4,
+    BMS_ISOFEHLER_RESERVIERT = 5,
+    BMS_ISOFEHLER_RESERVIERT_6 = 6,
+    BMS_ISOFEHLER_RESERVIERT_7 = 7
+};
+
+#define BMS_ISTTEMPERATUR_HOECHSTE_ENUM "253=reserviert, 254=Init, 255=Fehler"
+enum BMS_IstTemperatur_hoechste_Enum
+{
+    BMS_ISTTEMPERATUR_HOECHSTE_RESERVIERT = 253,
+    BMS_ISTTEMPERATUR_HOECHSTE_INIT = 254,
+    BMS_ISTTEMPERATUR_HOECHSTE_FEHLER = 255
+};
+
+#define BMS_ISTTEMPERATUR_NIEDRIGSTE_ENUM "253=reserviert, 254=Init, 255=Fehler"
+enum BMS_IstTemperatur_niedrigste_Enum
+{
+    BMS_ISTTEMPERATUR_NIEDRIGSTE_RESERVIERT = 253,
+    BMS_ISTTEMPERATUR_NIEDRIGSTE_INIT = 254,
+    BMS_ISTTEMPERATUR_NIEDRIGSTE_FEHLER = 255
+};
+
+#define BMS_ISTZELLSPANNUNG_HOECHSTE_ENUM "4092=reserviert, 4093=reserviert, 4094=Init, 4095=Fehler"
+enum BMS_IstZellspannung_hoechste_Enum
+{
+    BMS_ISTZELLSPANNUNG_HOECHSTE_RESERVIERT = 4092,
+    BMS_ISTZELLSPANNUNG_HOECHSTE_RESERVIERT_4093 = 4093,
+    BMS_ISTZELLSPANNUNG_HOECHSTE_INIT = 4094,
+    BMS_ISTZELLSPANNUNG_HOECHSTE_FEHLER = 4095
+};
+
+#define BMS_ISTZELLSPANNUNG_NIEDRIGSTE_ENUM "4092=reserviert, 4093=reserviert, 4094=Init, 4095=Fehler"
+enum BMS_IstZellspannung_niedrigste_Enum
+{
+    BMS_ISTZELLSPANNUNG_NIEDRIGSTE_RESERVIERT = 4092,
+    BMS_ISTZELLSPANNUNG_NIEDRIGSTE_RESERVIERT_4093 = 4093,
+    BMS_ISTZELLSPANNUNG_NIEDRIGSTE_INIT = 4094,
+    BMS_ISTZELLSPANNUNG_NIEDRIGSTE_FEHLER = 4095
+};
+
+#define BMS_LADEGRENZEANTW_SOC_ENUM "126=Init, 127=Fehler"
+enum BMS_LadegrenzeAntw_SOC_Enum
+{
+    BMS_LADEGRENZEANTW_SOC_INIT = 126,
+    BMS_LADEGRENZEANTW_SOC_FEHLER = 127
+};
+
+#define BMS_ENERGIEANTW_ZAEHLER_ENUM "14=Init, 15=Fehler"
+enum BMS_EnergieAntw_Zaehler_Enum
+{
+    BMS_ENERGIEANTW_ZAEHLER_INIT = 14,
+    BMS_ENERGIEANTW_ZAEHLER_FEHLER = 15
+};
+
+#define BMS_ENERGIEANTW_ENERGIE_ENUM "2046=Init, 2047=Fehler"
+enum BMS_EnergieAntw_Energie_Enum
+{
+    BMS_ENERGIEANTW_ENERGIE_INIT = 2046,
+    BMS_ENERGIEANTW_ENERGIE_FEHLER = 2047
+};
+
+#define BMS_LADEGRENZEANTW_LEISTUNG_ENUM "4094=Init, 4095=Fehler"
+enum BMS_LadegrenzeAntw_Leistung_Enum
+{
+    BMS_LADEGRENZEANTW_LEISTUNG_INIT = 4094,
+    BMS_LADEGRENZEANTW_LEISTUNG_FEHLER = 4095
+};
+
+#define BMS_LADEGRENZEANTW_ZAEHLER_ENUM "14=Init, 15=Fehler"
+enum BMS_LadegrenzeAntw_Zaehler_Enum
+{
+    BMS_LADEGRENZEANTW_ZAEHLER_INIT = 14,
+    BMS_LADEGRENZEANTW_ZAEHLER_FEHLER = 15
+};
+
+namespace mlb_dbc
+{
+
+// HVLM_06 Sender: Ladegeraet_Konzern
+struct HVLM_06
+{
+    enum : uint32_t
+    {
+        ID = 0x488,
+        DLC = 8
+    };
+
+    // maximale DC Ladeleistung
+    // 12|10@1+ (250,0) [0|150000] "Unit_Watt" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t HVLM_MaxLadeLeistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2] & 0x3F) << 4);
+    }
+    static constexpr int32_t HVLM_MaxLadeLeistung(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVLM_MaxLadeLeistung_Raw(d)) * 250;
+    }
+    static inline void HVLM_MaxLadeLeistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((d[2] & 0xC0) | ((raw >> 4) & 0x3F));
+    }
+
+    // maximale DC Ladespannung
+    // 22|10@1+ (1,0) [0|600] "Unit_Volt" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_MaxSpannung_DCLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 6) |
+               (static_cast<uint32_t>(d[3]) << 2);
+    }
+    static constexpr uint32_t HVLM_MaxSpannung_DCLS(const uint8_t* d)
+    {
+        return HVLM_MaxSpannung_DCLS_Raw(d);
+    }
+    static inline void HVLM_MaxSpannung_DCLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x3F) | ((raw << 6) & 0xC0));
+        d[3] = static_cast<uint8_t>((raw >> 2));
+    }
+
+    // aktueller DC Ladestrom
+    // 32|9@1+ (1,0) [0|400] "Unit_Amper" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_IstStrom_DCLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]) |
+               (static_cast<uint32_t>(d[5] & 0x1) << 8);
+    }
+    static constexpr uint32_t HVLM_IstStrom_DCLS(const uint8_t* d)
+    {
+        return HVLM_IstStrom_DCLS_Raw(d);
+    }
+    static inline void HVLM_IstStrom_DCLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+        d[5] = static_cast<uint8_t>((d[5] & 0xFE) | ((raw >> 8) & 0x1));
+    }
+
+    // maximaler DC Ladestrom
+    // 41|9@1+ (1,0) [0|400] "Unit_Amper" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_MaxStrom_DCLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 1) |
+               (static_cast<uint32_t>(d[6] & 0x3) << 7);
+    }
+    static constexpr uint32_t HVLM_MaxStrom_DCLS(const uint8_t* d)
+    {
+        return HVLM_MaxStrom_DCLS_Raw(d);
+    }
+    static inline void HVLM_MaxStrom_DCLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x1) | ((raw << 1) & 0xFE));
+        d[6] = static_cast<uint8_t>((d[6] & 0xFC) | ((raw >> 7) & 0x3));
+    }
+
+    // minimale DC Ladespannung
+    // 50|9@1+ (1,0) [0|400] "Unit_Volt" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_MinSpannung_DCLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 2) |
+               (static_cast<uint32_t>(d[7] & 0x7) << 6);
+    }
+    static constexpr uint32_t HVLM_MinSpannung_DCLS(const uint8_t* d)
+    {
+        return HVLM_MinSpannung_DCLS_Raw(d);
+    }
+    static inline void HVLM_MinSpannung_DCLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3) | ((raw << 2) & 0xFC));
+        d[7] = static_cast<uint8_t>((d[7] & 0xF8) | ((raw >> 6) & 0x7));
+    }
+
+    // minimaler DC Ladestrom
+    // 59|5@1+ (1,0) [0|29] "Unit_Amper" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_MinStrom_DCLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 3);
+    }
+    static constexpr uint32_t HVLM_MinStrom_DCLS(const uint8_t* d)
+    {
+        return HVLM_MinStrom_DCLS_Raw(d);
+    }
+    static inline void HVLM_MinStrom_DCLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x7) | ((raw << 3) & 0xF8));
+    }
+};
+
+// HVLM_04 Sender: Ladegeraet_Konzern
+struct HVLM_04
+{
+    enum : uint32_t
+    {
+        ID = 0x53C,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: AWC,BMC_MLBevo,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_04_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t HVLM_04_CRC(const uint8_t* d)
+    {
+        return HVLM_04_CRC_Raw(d);
+    }
+    static inline void HVLM_04_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // Fortlaufender Botschaftszaehler
+    // 8|4@1+ (1,0) [0|15] "" Receiver: AWC,BMC_MLBevo,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_04_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t HVLM_04_BZ(const uint8_t* d)
+    {
+        return HVLM_04_BZ_Raw(d);
+    }
+    static inline void HVLM_04_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Betriebsmodus der Standheizung fuer Vorkonditionierung und Timerklimatisierung
+    // 12|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_STH_Betriebsmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x7);
+    }
+    static constexpr uint32_t HVLM_STH_Betriebsmodus(const uint8_t* d)
+    {
+        return HVLM_STH_Betriebsmodus_Raw(d);
+    }
+    static inline void HVLM_STH_Betriebsmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // Signalisierung an das KBT ob mind. ein Timer zur Standklimatisierung programmiert ist
+    // 15|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Standklima_Timer_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7);
+    }
+    static constexpr uint32_t HVLM_Standklima_Timer_Status(const uint8_t* d)
+    {
+        return HVLM_Standklima_Timer_Status_Raw(d);
+    }
+    static inline void HVLM_Standklima_Timer_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Maximal zulaessige Leistung, die das HVEM vom Lader nutzen darf. Wenn das Fzg nicht ueber einen Lader mit dem AC Netz verbunden ist ist dieser Wert 0.
+    // 16|9@1+ (50,0) [0|25450] "Unit_Watt" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_HVEM_MaxLeistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2]) |
+               (static_cast<uint32_t>(d[3] & 0x1) << 8);
+    }
+    static constexpr int32_t HVLM_HVEM_MaxLeistung(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVLM_HVEM_MaxLeistung_Raw(d)) * 50;
+    }
+    static inline void HVLM_HVEM_MaxLeistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>(raw);
+        d[3] = static_cast<uint8_t>((d[3] & 0xFE) | ((raw >> 8) & 0x1));
+    }
+
+    // Information, ob das Fahrzeug mit einem Stromnetz verbunden ist.
+    // 25|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_Status_Netz_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 1) & 0x1);
+    }
+    static constexpr uint32_t HVLM_Status_Netz(const uint8_t* d)
+    {
+        return HVLM_Status_Netz_Raw(d);
+    }
+    static inline void HVLM_Status_Netz_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Anforderung fuer Ladescreen (BEV)
+    // 26|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Anf_Ladescreen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 2) & 0x1);
+    }
+    static constexpr uint32_t HVLM_Anf_Ladescreen(const uint8_t* d)
+    {
+        return HVLM_Anf_Ladescreen_Raw(d);
+    }
+    static inline void HVLM_Anf_Ladescreen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Anzeige, ob Strom in das Fzg. fliesst und wofuer er verwendet wird.
+    // 27|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Ladeart_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 3) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Ladeart(const uint8_t* d)
+    {
+        return HVLM_Ladeart_Raw(d);
+    }
+    static inline void HVLM_Ladeart_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xE7) | ((raw << 3) & 0x18));
+    }
+
+    // Auswahl der PHEV Standheizung
+    // 29|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_VK_STH_Einsatz_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 5);
+    }
+    static constexpr uint32_t HVLM_VK_STH_Einsatz(const uint8_t* d)
+    {
+        return HVLM_VK_STH_Einsatz_Raw(d);
+    }
+    static inline void HVLM_VK_STH_Einsatz_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // Uebermittlung des aktuellen Konditionierungs-Status fuer HMI, Mobile Online Dienste
+    // 32|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_VK_Modus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x3);
+    }
+    static constexpr uint32_t HVLM_VK_Modus(const uint8_t* d)
+    {
+        return HVLM_VK_Modus_Raw(d);
+    }
+    static inline void HVLM_VK_Modus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | (raw & 0x3));
+    }
+
+    // aktueller Modus
+    // 34|2@1+ (1,0) [0|3] "" Receiver: DCDC_800V_PAG,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_IstModus_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 2) & 0x3);
+    }
+    static constexpr uint32_t HVLM_IstModus_02(const uint8_t* d)
+    {
+        return HVLM_IstModus_02_Raw(d);
+    }
+    static inline void HVLM_IstModus_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF3) | ((raw << 2) & 0xC));
+    }
+
+    // HV-Aktivierung Anforderung und Grund der Anforderung
+    // 36|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_HV_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x3);
+    }
+    static constexpr uint32_t HVLM_HV_Anf(const uint8_t* d)
+    {
+        return HVLM_HV_Anf_Raw(d);
+    }
+    static inline void HVLM_HV_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // aktueller Fehlerstatus des Ladegeraetes
+    // 38|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Fehlerstatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 6) |
+               (static_cast<uint32_t>(d[5] & 0x1) << 2);
+    }
+    static constexpr uint32_t HVLM_Fehlerstatus(const uint8_t* d)
+    {
+        return HVLM_Fehlerstatus_Raw(d);
+    }
+    static inline void HVLM_Fehlerstatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3F) | ((raw << 6) & 0xC0));
+        d[5] = static_cast<uint8_t>((d[5] & 0xFE) | ((raw >> 2) & 0x1));
+    }
+
+    // Anforderung zur Verriegelung des Triebstrangs
+    // 41|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Anforderung_HMS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 1) & 0x7);
+    }
+    static constexpr uint32_t HVLM_Anforderung_HMS(const uint8_t* d)
+    {
+        return HVLM_Anforderung_HMS_Raw(d);
+    }
+    static inline void HVLM_Anforderung_HMS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF1) | ((raw << 1) & 0xE));
+    }
+
+    // Anforderung den Triebstrang verriegelt zu halten
+    // 44|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Parken_beibehalten_HMS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 4) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Parken_beibehalten_HMS(const uint8_t* d)
+    {
+        return HVLM_Parken_beibehalten_HMS_Raw(d);
+    }
+    static inline void HVLM_Parken_beibehalten_HMS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Sollmodus AWC Ladegeraet
+    // 48|3@1+ (1,0) [0|7] "" Receiver: AWC,Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_AWC_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] & 0x7);
+    }
+    static constexpr uint32_t HVLM_AWC_Sollmodus(const uint8_t* d)
+    {
+        return HVLM_AWC_Sollmodus_Raw(d);
+    }
+    static inline void HVLM_AWC_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xF8) | (raw & 0x7));
+    }
+
+    // Status der Steckererkennung unabhaengig vom Lademodus (AC oder DC)
+    // 51|2@1+ (1,0) [0|3] "" Receiver: BMC_MLBevo,Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_Stecker_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 3) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Stecker_Status(const uint8_t* d)
+    {
+        return HVLM_Stecker_Status_Raw(d);
+    }
+    static inline void HVLM_Stecker_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xE7) | ((raw << 3) & 0x18));
+    }
+
+    // Mitteilung des Lademanagements an das MSG ob Stecker erkannt wurde, Laden gestartet, ein autonomer Betriebszustand aktiviert, eine Relaxing Phase fuer die Batterie angefordert werden soll
+    // 53|3@1+ (1,0) [0|7] "" Receiver: AWC,Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t HVLM_LadeAnforderung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 5);
+    }
+    static constexpr uint32_t HVLM_LadeAnforderung(const uint8_t* d)
+    {
+        return HVLM_LadeAnforderung_Raw(d);
+    }
+    static inline void HVLM_LadeAnforderung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // Empfohlener HV Batterieladestrom bei einer geplanten Ladung
+    // 56|8@1+ (1,0) [0|253] "Unit_Amper" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_MaxBatLadestromHV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7]);
+    }
+    static constexpr uint32_t HVLM_MaxBatLadestromHV(const uint8_t* d)
+    {
+        return HVLM_MaxBatLadestromHV_Raw(d);
+    }
+    static inline void HVLM_MaxBatLadestromHV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>(raw);
+    }
+};
+
+// LAD_01 Sender: Ladegeraet_Konzern
+struct LAD_01
+{
+    enum : uint32_t
+    {
+        ID = 0x564,
+        DLC = 8
+    };
+
+    // Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LAD_01_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t LAD_01_CRC(const uint8_t* d)
+    {
+        return LAD_01_CRC_Raw(d);
+    }
+    static inline void LAD_01_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // freilaufender Botschaftszaehler
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LAD_01_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t LAD_01_BZ(const uint8_t* d)
+    {
+        return LAD_01_BZ_Raw(d);
+    }
+    static inline void LAD_01_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Betriebsmodus des Ladegeraetes
+    // 12|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Ladegeraet_2,TME
+    static constexpr uint32_t LAD_IstModus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x7);
+    }
+    static constexpr uint32_t LAD_IstModus(const uint8_t* d)
+    {
+        return LAD_IstModus_Raw(d);
+    }
+    static inline void LAD_IstModus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // Istwert AC-Netzspannung (RMS)
+    // 15|9@1+ (1,0) [0|509] "Unit_Volt" Receiver: Gateway_PAG
+    static constexpr uint32_t LAD_AC_Istspannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7) |
+               (static_cast<uint32_t>(d[2]) << 1);
+    }
+    static constexpr uint32_t LAD_AC_Istspannung(const uint8_t* d)
+    {
+        return LAD_AC_Istspannung_Raw(d);
+    }
+    static inline void LAD_AC_Istspannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+        d[2] = static_cast<uint8_t>((raw >> 1));
+    }
+
+    // Ausgangsspannung Lader
+    // 24|10@1+ (1,0) [0|1021] "Unit_Volt" Receiver: Gateway_PAG
+    static constexpr uint32_t LAD_IstSpannung_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]) |
+               (static_cast<uint32_t>(d[4] & 0x3) << 8);
+    }
+    static constexpr uint32_t LAD_IstSpannung_HV(const uint8_t* d)
+    {
+        return LAD_IstSpannung_HV_Raw(d);
+    }
+    static inline void LAD_IstSpannung_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | ((raw >> 8) & 0x3));
+    }
+
+    // Ausgangsstrom Lader
+    // 34|10@1+ (0.2,-102) [-102|102.2] "Unit_Amper" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LAD_IstStrom_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 2) |
+               (static_cast<uint32_t>(d[5] & 0xF) << 6);
+    }
+    static constexpr float LAD_IstStrom_HV(const uint8_t* d)
+    {
+        return LAD_IstStrom_HV_Raw(d) * 0.2f + -102.0f;
+    }
+    static inline void LAD_IstStrom_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3) | ((raw << 2) & 0xFC));
+        d[5] = static_cast<uint8_t>((d[5] & 0xF0) | ((raw >> 6) & 0xF));
+    }
+
+    // 0 = Init (ohne Funktion) 1 = Ladegeraet HV-Komponenten spannungsfrei (U_Zwkr < 20V) 2 = Ladegeraet HV_Komponenten nicht spannungsfrei (U_Zwkr >= 20V) 3 = Fehler (z. B. Fehler in der Sensorik)
+    // 44|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LAD_Status_Spgfreiheit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 4) & 0x3);
+    }
+    static constexpr uint32_t LAD_Status_Spgfreiheit(const uint8_t* d)
+    {
+        return LAD_Status_Spgfreiheit_Raw(d);
+    }
+    static inline void LAD_Status_Spgfreiheit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Momentanwert: Temperatur Ladegeraet
+    // 48|8@1+ (1,-40) [-40|213] "Unit_DegreCelsi" Receiver: Gateway_PAG,TME
+    static constexpr uint32_t LAD_Temperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6]);
+    }
+    static constexpr int32_t LAD_Temperatur(const uint8_t* d)
+    {
+        return static_cast<int32_t>(LAD_Temperatur_Raw(d)) + -40;
+    }
+    static inline void LAD_Temperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>(raw);
+    }
+
+    // Momentanwert: Verlustleistung Ladegeraet
+    // 56|8@1+ (20,0) [0|5060] "Unit_Watt" Receiver: Gateway_PAG,TME
+    static constexpr uint32_t LAD_Verlustleistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7]);
+    }
+    static constexpr int32_t LAD_Verlustleistung(const uint8_t* d)
+    {
+        return static_cast<int32_t>(LAD_Verlustleistung_Raw(d)) * 20;
+    }
+    static inline void LAD_Verlustleistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>(raw);
+    }
+};
+
+// HVLM_03 Sender: Ladegeraet_Konzern
+struct HVLM_03
+{
+    enum : uint32_t
+    {
+        ID = 0x565,
+        DLC = 8
+    };
+
+    // Zeitraum zwischen HV-Deaktiviert und HV-Aktiviert
+    // 0|8@1+ (4,0) [0|1012] "Unit_Minut" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_HV_Abstellzeit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr int32_t HVLM_HV_Abstellzeit(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVLM_HV_Abstellzeit_Raw(d)) * 4;
+    }
+    static inline void HVLM_HV_Abstellzeit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // Anzeigen von Hinweisen zum Ladesystem. Anzeigen, dass das Ladesystem defekt ist.
+    // 8|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Ladesystemhinweise_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0x3);
+    }
+    static constexpr uint32_t HVLM_Ladesystemhinweise(const uint8_t* d)
+    {
+        return HVLM_Ladesystemhinweise_Raw(d);
+    }
+    static inline void HVLM_Ladesystemhinweise_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xFC) | (raw & 0x3));
+    }
+
+    // Anforderung HVLM an BCM fuer Schluesselsuche ueber Kessy
+    // 10|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Schluessel_Anfrage_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 2) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Schluessel_Anfrage(const uint8_t* d)
+    {
+        return HVLM_Schluessel_Anfrage_Raw(d);
+    }
+    static inline void HVLM_Schluessel_Anfrage_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF3) | ((raw << 2) & 0xC));
+    }
+
+    // Zustand der Lade-LED im Kombi und Dosenbeleuchtung
+    // 12|4@1+ (1,0) [0|15] "" Receiver: AWC,Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Zustand_LED_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4);
+    }
+    static constexpr uint32_t HVLM_Zustand_LED(const uint8_t* d)
+    {
+        return HVLM_Zustand_LED_Raw(d);
+    }
+    static inline void HVLM_Zustand_LED_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+    }
+
+    // maximal zulaessiger Strom auf Primaerseite (AC) des Ladegeraetes Minima aus Vorgabe z.B. ueber - intelligente Kommunikation - Control Pilot Duty Cycle - Widerstandskodierung Kabel (Proximity) - Vorgabe MMI, o.ae.
+    // 24|7@1+ (0.5,0) [0|62.5] "Unit_Amper" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_MaxStrom_Netz_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x7F);
+    }
+    static constexpr float HVLM_MaxStrom_Netz(const uint8_t* d)
+    {
+        return HVLM_MaxStrom_Netz_Raw(d) * 0.5f;
+    }
+    static inline void HVLM_MaxStrom_Netz_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x80) | (raw & 0x7F));
+    }
+
+    // Sollmodus AC Ladegeraet
+    // 31|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_LG_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 7);
+    }
+    static constexpr uint32_t HVLM_LG_Sollmodus(const uint8_t* d)
+    {
+        return HVLM_LG_Sollmodus_Raw(d);
+    }
+    static inline void HVLM_LG_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Tankdeckelfreigabe
+    // 32|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_FreigabeTankdeckel_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x3);
+    }
+    static constexpr uint32_t HVLM_FreigabeTankdeckel(const uint8_t* d)
+    {
+        return HVLM_FreigabeTankdeckel_Raw(d);
+    }
+    static inline void HVLM_FreigabeTankdeckel_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | (raw & 0x3));
+    }
+
+    // Anforderung Steckerverriegelung
+    // 34|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Stecker_Verriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 2) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Stecker_Verriegeln(const uint8_t* d)
+    {
+        return HVLM_Stecker_Verriegeln_Raw(d);
+    }
+    static inline void HVLM_Stecker_Verriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF3) | ((raw << 2) & 0xC));
+    }
+
+    // Meldung an das BMS, dass an der DC-Ladesaeule eine Messspannung aufgeschaltet wird.
+    // 36|2@1+ (1,0) [0|3] "" Receiver: BMC_MLBevo,Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Start_Spannungsmessung_DCLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Start_Spannungsmessung_DCLS(const uint8_t* d)
+    {
+        return HVLM_Start_Spannungsmessung_DCLS_Raw(d);
+    }
+    static inline void HVLM_Start_Spannungsmessung_DCLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Trigger-Signal fuer die UDS-Kommunikation zwischen cGW und OBC fuer die Funktion Plug & Charge Online
+    // 38|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t PnC_Trigger_OBC_cGW_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 6) |
+               (static_cast<uint32_t>(d[5] & 0x3) << 2);
+    }
+    static constexpr uint32_t PnC_Trigger_OBC_cGW(const uint8_t* d)
+    {
+        return PnC_Trigger_OBC_cGW_Raw(d);
+    }
+    static inline void PnC_Trigger_OBC_cGW_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3F) | ((raw << 6) & 0xC0));
+        d[5] = static_cast<uint8_t>((d[5] & 0xFC) | ((raw >> 2) & 0x3));
+    }
+
+    // Klimatisierung freigeben
+    // 42|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t HVLM_FreigabeKlimatisierung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 2) & 0x3);
+    }
+    static constexpr uint32_t HVLM_FreigabeKlimatisierung(const uint8_t* d)
+    {
+        return HVLM_FreigabeKlimatisierung_Raw(d);
+    }
+    static inline void HVLM_FreigabeKlimatisierung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF3) | ((raw << 2) & 0xC));
+    }
+
+    // Anzeige, ob AC- oder DC-Laden nicht moeglich ist
+    // 49|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Ladetexte_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 1) & 0x7);
+    }
+    static constexpr uint32_t HVLM_Ladetexte(const uint8_t* d)
+    {
+        return HVLM_Ladetexte_Raw(d);
+    }
+    static inline void HVLM_Ladetexte_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xF1) | ((raw << 1) & 0xE));
+    }
+
+    // Signalisierung an den HVK, ob waehrend des Ladens eine Iso-Messung durchgefuehrt werden muss. 0 = Laden mit Isomessung 1 = Laden ohne Isomessung
+    // 53|1@1+ (1,0) [0|1] "" Receiver: BMC_MLBevo,DCDC_HV_02,Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_IsoMessung_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 5) & 0x1);
+    }
+    static constexpr uint32_t HVLM_IsoMessung_Anf(const uint8_t* d)
+    {
+        return HVLM_IsoMessung_Anf_Raw(d);
+    }
+    static inline void HVLM_IsoMessung_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Ausgangsspannung des Ladegeraetes und DC-Spannung der Ladesaeule. Messung zwischen den DC HV-Leitungen.
+    // 54|10@1+ (1,0) [0|1021] "Unit_Volt" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_IstSpannung_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6) |
+               (static_cast<uint32_t>(d[7]) << 2);
+    }
+    static constexpr uint32_t HVLM_IstSpannung_HV(const uint8_t* d)
+    {
+        return HVLM_IstSpannung_HV_Raw(d);
+    }
+    static inline void HVLM_IstSpannung_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+        d[7] = static_cast<uint8_t>((raw >> 2));
+    }
+};
+
+// LAD_02 Sender: Ladegeraet_Konzern
+struct LAD_02
+{
+    enum : uint32_t
+    {
+        ID = 0x67E,
+        DLC = 8
+    };
+
+    // Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LAD_02_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t LAD_02_CRC(const uint8_t* d)
+    {
+        return LAD_02_CRC_Raw(d);
+    }
+    static inline void LAD_02_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // freilaufender Botschaftszaehler
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LAD_02_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t LAD_02_BZ(const uint8_t* d)
+    {
+        return LAD_02_BZ_Raw(d);
+    }
+    static inline void LAD_02_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Abregelung aufgrund interner Uebertemperatur im Ladegeraet
+    // 12|1@1+ (1,0) [0|1] "" Receiver: TME
+    static constexpr uint32_t LAD_Abregelung_Temperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x1);
+    }
+    static constexpr uint32_t LAD_Abregelung_Temperatur(const uint8_t* d)
+    {
+        return LAD_Abregelung_Temperatur_Raw(d);
+    }
+    static inline void LAD_Abregelung_Temperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Abregelung aufgrund Strom oder Spannung am Eingang oder Ausgang
+    // 13|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_Abregelung_IU_Ein_Aus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 5) & 0x1);
+    }
+    static constexpr uint32_t LAD_Abregelung_IU_Ein_Aus(const uint8_t* d)
+    {
+        return LAD_Abregelung_IU_Ein_Aus_Raw(d);
+    }
+    static inline void LAD_Abregelung_IU_Ein_Aus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Reduzierung aufgrund zu hoher Temperatur der Ladebuchse
+    // 14|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_Abregelung_BuchseTemp_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 6) & 0x1);
+    }
+    static constexpr uint32_t LAD_Abregelung_BuchseTemp(const uint8_t* d)
+    {
+        return LAD_Abregelung_BuchseTemp_Raw(d);
+    }
+    static inline void LAD_Abregelung_BuchseTemp_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Maximale Leistung Ladegeraet bezogen auf die maximale Leistung Infrastruktur (Kabel, Ladestation) und Beruecksichtigung des Ladegeraet-Wirkungsgrades
+    // 16|9@1+ (100,0) [0|50900] "Unit_Watt" Receiver: TME
+    static constexpr uint32_t LAD_MaxLadLeistung_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2]) |
+               (static_cast<uint32_t>(d[3] & 0x1) << 8);
+    }
+    static constexpr int32_t LAD_MaxLadLeistung_HV(const uint8_t* d)
+    {
+        return static_cast<int32_t>(LAD_MaxLadLeistung_HV_Raw(d)) * 100;
+    }
+    static inline void LAD_MaxLadLeistung_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>(raw);
+        d[3] = static_cast<uint8_t>((d[3] & 0xFE) | ((raw >> 8) & 0x1));
+    }
+
+    // AC-Stromlimit aufgrund der PRX Kabelkodierung
+    // 32|3@1+ (1,0) [0|7] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_PRX_Stromlimit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x7);
+    }
+    static constexpr uint32_t LAD_PRX_Stromlimit(const uint8_t* d)
+    {
+        return LAD_PRX_Stromlimit_Raw(d);
+    }
+    static inline void LAD_PRX_Stromlimit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF8) | (raw & 0x7));
+    }
+
+    // Status Control Pilot Ueberwachung (Erkennung des Control Pilot Duty-Cycles)
+    // 35|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_CP_Erkennung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 3) & 0x1);
+    }
+    static constexpr uint32_t LAD_CP_Erkennung(const uint8_t* d)
+    {
+        return LAD_CP_Erkennung_Raw(d);
+    }
+    static inline void LAD_CP_Erkennung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Status Steckerverriegelung (Ruecklesekontakt des Verrieglungsaktors)
+    // 36|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_Stecker_Verriegelt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x1);
+    }
+    static constexpr uint32_t LAD_Stecker_Verriegelt(const uint8_t* d)
+    {
+        return LAD_Stecker_Verriegelt_Raw(d);
+    }
+    static inline void LAD_Stecker_Verriegelt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Kuehlbedarf des Ladegeraetes
+    // 38|2@1+ (1,0) [0|3] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_Kuehlbedarf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 6);
+    }
+    static constexpr uint32_t LAD_Kuehlbedarf(const uint8_t* d)
+    {
+        return LAD_Kuehlbedarf_Raw(d);
+    }
+    static inline void LAD_Kuehlbedarf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // Signal kann in Ergaenzung zu LAD_MaxLadLeistung_HV (100W Skalierung) genutzt werden, um die Aufloesegenauigkeit auf 25W zu erweitern.
+    // 57|2@1+ (1,0) [0|3] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_MaxLadLeistung_HV_Offset_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 1) & 0x3);
+    }
+    static constexpr uint32_t LAD_MaxLadLeistung_HV_Offset(const uint8_t* d)
+    {
+        return LAD_MaxLadLeistung_HV_Offset_Raw(d);
+    }
+    static inline void LAD_MaxLadLeistung_HV_Offset_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF9) | ((raw << 1) & 0x6));
+    }
+
+    // Sammelwarnung Ladegeraet 0 keine Warnbedingung aktiv 1 Warnbedingung aktiv, evtl. eingeschraenkte Leistungsfaehigkeit
+    // 62|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_Warnzustand_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 6) & 0x1);
+    }
+    static constexpr uint32_t LAD_Warnzustand(const uint8_t* d)
+    {
+        return LAD_Warnzustand_Raw(d);
+    }
+    static inline void LAD_Warnzustand_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Sammelfehler Ladegeraet - kein Laden moeglich
+    // 63|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LAD_Fehlerzustand_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 7);
+    }
+    static constexpr uint32_t LAD_Fehlerzustand(const uint8_t* d)
+    {
+        return LAD_Fehlerzustand_Raw(d);
+    }
+    static inline void LAD_Fehlerzustand_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x7F) | ((raw << 7) & 0x80));
+    }
+};
+
+// HVLM_08 Sender: Ladegeraet_Konzern
+struct HVLM_08
+{
+    enum : uint32_t
+    {
+        ID = 0x1A55549D,
+        DLC = 8
+    };
+
+    // Funktion Dauerkonditionierung HV-Batterie.
+    // 54|1@1+ (1,0) [0|1] "" Receiver: BMC_MLBevo,Gateway,Gateway_PAG
+    static constexpr uint32_t HVLM_Funktion_Dauer_BattKond_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 6) & 0x1);
+    }
+    static constexpr uint32_t HVLM_Funktion_Dauer_BattKond(const uint8_t* d)
+    {
+        return HVLM_Funktion_Dauer_BattKond_Raw(d);
+    }
+    static inline void HVLM_Funktion_Dauer_BattKond_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Anforderung Batteriekonditionierung
+    // 55|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t HVLM_BattKond_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 7) |
+               (static_cast<uint32_t>(d[7] & 0x3) << 1);
+    }
+    static constexpr uint32_t HVLM_BattKond_Anf(const uint8_t* d)
+    {
+        return HVLM_BattKond_Anf_Raw(d);
+    }
+    static inline void HVLM_BattKond_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x7F) | ((raw << 7) & 0x80));
+        d[7] = static_cast<uint8_t>((d[7] & 0xFC) | ((raw >> 1) & 0x3));
+    }
+
+    // Dauer der Innenraumklimatisierung.
+    // 58|6@1+ (1,0) [0|60] "Unit_Minut" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t HVLM_Dauer_Klima_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 2);
+    }
+    static constexpr uint32_t HVLM_Dauer_Klima_02(const uint8_t* d)
+    {
+        return HVLM_Dauer_Klima_02_Raw(d);
+    }
+    static inline void HVLM_Dauer_Klima_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x3) | ((raw << 2) & 0xFC));
+    }
+};
+
+// HVLM_09 Sender: Ladegeraet_Konzern
+struct HVLM_09
+{
+    enum : uint32_t
+    {
+        ID = 0x1A555515,
+        DLC = 8
+    };
+
+    // Angeforderter Sollstrom fuer AWC Laden
+    // 55|9@1+ (0.1,0) [0|50.9] "Unit_Amper" Receiver: AWC
+    static constexpr uint32_t HVLM_AWC_Sollstrom_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 7) |
+               (static_cast<uint32_t>(d[7]) << 1);
+    }
+    static constexpr float HVLM_AWC_Sollstrom(const uint8_t* d)
+    {
+        return HVLM_AWC_Sollstrom_Raw(d) * 0.1f;
+    }
+    static inline void HVLM_AWC_Sollstrom_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x7F) | ((raw << 7) & 0x80));
+        d[7] = static_cast<uint8_t>((raw >> 1));
+    }
+};
+
+// HVLM_10 Sender: Ladegeraet_Konzern
+struct HVLM_10
+{
+    enum : uint32_t
+    {
+        ID = 0x12DD5472,
+        DLC = 8
+    };
+
+    // RTM Charging connection fault
+    // 31|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_RtmWarnLadeverbindung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 7) |
+               (static_cast<uint32_t>(d[4] & 0x3) << 1);
+    }
+    static constexpr uint32_t HVLM_RtmWarnLadeverbindung(const uint8_t* d)
+    {
+        return HVLM_RtmWarnLadeverbindung_Raw(d);
+    }
+    static inline void HVLM_RtmWarnLadeverbindung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x7F) | ((raw << 7) & 0x80));
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | ((raw >> 1) & 0x3));
+    }
+
+    // RTM Electrical machine CAN communication fault
+    // 34|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_RtmWarnLadesystem_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 2) & 0x7);
+    }
+    static constexpr uint32_t HVLM_RtmWarnLadesystem(const uint8_t* d)
+    {
+        return HVLM_RtmWarnLadesystem_Raw(d);
+    }
+    static inline void HVLM_RtmWarnLadesystem_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xE3) | ((raw << 2) & 0x1C));
+    }
+
+    // RTM Warning of charging status fault
+    // 37|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_RtmWarnLadestatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 5);
+    }
+    static constexpr uint32_t HVLM_RtmWarnLadestatus(const uint8_t* d)
+    {
+        return HVLM_RtmWarnLadestatus_Raw(d);
+    }
+    static inline void HVLM_RtmWarnLadestatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // RTM Warning of charging communction fault
+    // 40|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_RtmWarnLadeKommunikation_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] & 0x7);
+    }
+    static constexpr uint32_t HVLM_RtmWarnLadeKommunikation(const uint8_t* d)
+    {
+        return HVLM_RtmWarnLadeKommunikation_Raw(d);
+    }
+    static inline void HVLM_RtmWarnLadeKommunikation_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF8) | (raw & 0x7));
+    }
+
+    // Lichtmuster fuer Charge Check Sendeart = On Change, Zykluszeit = 500ms, Inhibitzeit = 10ms anlog des Signals im MQB (HVLM_10) auf dem A CAN
+    // 43|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Ladeanzeige_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 3) & 0x1);
+    }
+    static constexpr uint32_t HVLM_Ladeanzeige_Anf(const uint8_t* d)
+    {
+        return HVLM_Ladeanzeige_Anf_Raw(d);
+    }
+    static inline void HVLM_Ladeanzeige_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Funktionsstatus ChargeCheck Sendeart = On Change, Zykluszeit = 500ms, Inhibitzeit = 10ms anlog des Signals im MQB (HVLM_10) auf dem A CAN
+    // 44|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Ladeanzeige_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 4) & 0x3);
+    }
+    static constexpr uint32_t HVLM_Ladeanzeige_Status(const uint8_t* d)
+    {
+        return HVLM_Ladeanzeige_Status_Raw(d);
+    }
+    static inline void HVLM_Ladeanzeige_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Zeit innerhalb der die gesendet Intensitaet fuer die Ladeanzeige erreicht werden soll
+    // 46|4@1+ (50,0) [0|750] "Unit_MilliSecon" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Ladeanzeige_Rampzeit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 6) |
+               (static_cast<uint32_t>(d[6] & 0x3) << 2);
+    }
+    static constexpr int32_t HVLM_Ladeanzeige_Rampzeit(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVLM_Ladeanzeige_Rampzeit_Raw(d)) * 50;
+    }
+    static inline void HVLM_Ladeanzeige_Rampzeit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x3F) | ((raw << 6) & 0xC0));
+        d[6] = static_cast<uint8_t>((d[6] & 0xFC) | ((raw >> 2) & 0x3));
+    }
+
+    // aktuelle Helligkeit fuer die Anzeige des Ladestatus ueber Heck-Fahrzeug-Lichtelemente
+    // 50|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Ladeanzeige_Intens_Heck_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 2) |
+               (static_cast<uint32_t>(d[7] & 0x1) << 6);
+    }
+    static constexpr uint32_t HVLM_Ladeanzeige_Intens_Heck(const uint8_t* d)
+    {
+        return HVLM_Ladeanzeige_Intens_Heck_Raw(d);
+    }
+    static inline void HVLM_Ladeanzeige_Intens_Heck_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3) | ((raw << 2) & 0xFC));
+        d[7] = static_cast<uint8_t>((d[7] & 0xFE) | ((raw >> 6) & 0x1));
+    }
+
+    // aktuelle Helligkeit fuer die Anzeige des Ladestatus ueber Front-Fahrzeug-Lichtelemente
+    // 57|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t HVLM_Ladeanzeige_Intens_Front_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 1);
+    }
+    static constexpr uint32_t HVLM_Ladeanzeige_Intens_Front(const uint8_t* d)
+    {
+        return HVLM_Ladeanzeige_Intens_Front_Raw(d);
+    }
+    static inline void HVLM_Ladeanzeige_Intens_Front_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x1) | ((raw << 1) & 0xFE));
+    }
+};
+
+// HVLM_11 Sender: Ladegeraet_Konzern
+struct HVLM_11
+{
+    enum : uint32_t
+    {
+        ID = 0x12DD5491,
+        DLC = 8
+    };
+
+    // Fuer MLB: Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN' Ab MQB und MLBevo: Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: DCDC_HV_02
+    static constexpr uint32_t HVLM_11_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t HVLM_11_CRC(const uint8_t* d)
+    {
+        return HVLM_11_CRC_Raw(d);
+    }
+    static inline void HVLM_11_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 4bit Botschaftszaehler, wird mit jeder Sendebotschaft inkrementiert
+    // 8|4@1+ (1,0) [0|15] "" Receiver: DCDC_HV_02
+    static constexpr uint32_t HVLM_11_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t HVLM_11_BZ(const uint8_t* d)
+    {
+        return HVLM_11_BZ_Raw(d);
+    }
+    static inline void HVLM_11_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Vorgabe SollSpannung Eingangsseite vom HVLM an HVLB
+    // 12|12@1+ (0.25,0) [0|1023.25] "Unit_Volt" Receiver: DCDC_HV_02
+    static constexpr uint32_t HVLM_HVLB_SollSpannung_HVLS_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2]) << 4);
+    }
+    static constexpr float HVLM_HVLB_SollSpannung_HVLS(const uint8_t* d)
+    {
+        return HVLM_HVLB_SollSpannung_HVLS_Raw(d) * 0.25f;
+    }
+    static inline void HVLM_HVLB_SollSpannung_HVLS_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((raw >> 4));
+    }
+
+    // Statusuebermittlung von Ladesaeulenspezifika
+    // 24|12@1+ (1,0) [0|4095] "" Receiver: DCDC_HV_02
+    static constexpr uint32_t HVLM_HVLB_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]) |
+               (static_cast<uint32_t>(d[4] & 0xF) << 8);
+    }
+    static constexpr uint32_t HVLM_HVLB_Status(const uint8_t* d)
+    {
+        return HVLM_HVLB_Status_Raw(d);
+    }
+    static inline void HVLM_HVLB_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+        d[4] = static_cast<uint8_t>((d[4] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // Vorgabe SollModus vom HVLM an HVLB
+    // 36|3@1+ (1,0) [0|7] "" Receiver: DCDC_HV_02
+    static constexpr uint32_t HVLM_HVLB_SollModus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x7);
+    }
+    static constexpr uint32_t HVLM_HVLB_SollModus(const uint8_t* d)
+    {
+        return HVLM_HVLB_SollModus_Raw(d);
+    }
+    static inline void HVLM_HVLB_SollModus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x8F) | ((raw << 4) & 0x70));
+    }
+};
+
+// HVLM_15 Sender: Ladegeraet_Konzern
+struct HVLM_15
+{
+    enum : uint32_t
+    {
+        ID = 0x1A55554D,
+        DLC = 8
+    };
+
+    // Ladeplan-Anfrage fuer die Ladeplanung: Leistung
+    // 0|12@1+ (200,0) [0|818600] "Unit_Watt" Receiver: AWC,DCDC_HV_02,TME
+    static constexpr uint32_t HVLM_PlanAnfr_Leistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]) |
+               (static_cast<uint32_t>(d[1] & 0xF) << 8);
+    }
+    static constexpr int32_t HVLM_PlanAnfr_Leistung(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVLM_PlanAnfr_Leistung_Raw(d)) * 200;
+    }
+    static inline void HVLM_PlanAnfr_Leistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // Ladeplan-Anfrage fuer die Ladeplanung: Zaehler
+    // 12|4@1+ (1,0) [0|13] "Unit_None" Receiver: AWC,DCDC_HV_02,TME
+    static constexpr uint32_t HVLM_PlanAnfr_Zaehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4);
+    }
+    static constexpr uint32_t HVLM_PlanAnfr_Zaehler(const uint8_t* d)
+    {
+        return HVLM_PlanAnfr_Zaehler_Raw(d);
+    }
+    static inline void HVLM_PlanAnfr_Zaehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+    }
+
+    // Ladeplan-Anfrage fuer die Ladeplanung: Dauer
+    // 16|10@1+ (1,0) [0|1021] "Unit_Minut" Receiver: AWC,DCDC_HV_02,TME
+    static constexpr uint32_t HVLM_PlanAnfr_Dauer_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2]) |
+               (static_cast<uint32_t>(d[3] & 0x3) << 8);
+    }
+    static constexpr uint32_t HVLM_PlanAnfr_Dauer(const uint8_t* d)
+    {
+        return HVLM_PlanAnfr_Dauer_Raw(d);
+    }
+    static inline void HVLM_PlanAnfr_Dauer_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>(raw);
+        d[3] = static_cast<uint8_t>((d[3] & 0xFC) | ((raw >> 8) & 0x3));
+    }
+
+    // Anfrage Ladeart fuer Ladeplanerstellung
+    // 26|3@1+ (1,0) [0|7] "" Receiver: AWC,DCDC_HV_02,TME
+    static constexpr uint32_t HVLM_PlanAnfr_Ladeart_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 2) & 0x7);
+    }
+    static constexpr uint32_t HVLM_PlanAnfr_Ladeart(const uint8_t* d)
+    {
+        return HVLM_PlanAnfr_Ladeart_Raw(d);
+    }
+    static inline void HVLM_PlanAnfr_Ladeart_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xE3) | ((raw << 2) & 0x1C));
+    }
+
+    // Energieanfrage fuer die Ladeplanung: Start-SoC
+    // 29|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: BMC_MLBevo
+    static constexpr uint32_t HVLM_EnergieAnfr_SocStart_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 5) |
+               (static_cast<uint32_t>(d[4] & 0xF) << 3);
+    }
+    static constexpr uint32_t HVLM_EnergieAnfr_SocStart(const uint8_t* d)
+    {
+        return HVLM_EnergieAnfr_SocStart_Raw(d);
+    }
+    static inline void HVLM_EnergieAnfr_SocStart_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x1F) | ((raw << 5) & 0xE0));
+        d[4] = static_cast<uint8_t>((d[4] & 0xF0) | ((raw >> 3) & 0xF));
+    }
+
+    // Energieanfrage fuer die Ladeplanung: Ziel-SOC
+    // 36|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: BMC_MLBevo
+    static constexpr uint32_t HVLM_EnergieAnfr_SocZiel_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 4) |
+               (static_cast<uint32_t>(d[5] & 0x7) << 4);
+    }
+    static constexpr uint32_t HVLM_EnergieAnfr_SocZiel(const uint8_t* d)
+    {
+        return HVLM_EnergieAnfr_SocZiel_Raw(d);
+    }
+    static inline void HVLM_EnergieAnfr_SocZiel_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF) | ((raw << 4) & 0xF0));
+        d[5] = static_cast<uint8_t>((d[5] & 0xF8) | ((raw >> 4) & 0x7));
+    }
+
+    // Fortlaufender Zaehler fuer die Anfrage Energie
+    // 43|4@1+ (1,0) [0|13] "Unit_None" Receiver: BMC_MLBevo
+    static constexpr uint32_t HVLM_EnergieAnfr_Zaehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 3) & 0xF);
+    }
+    static constexpr uint32_t HVLM_EnergieAnfr_Zaehler(const uint8_t* d)
+    {
+        return HVLM_EnergieAnfr_Zaehler_Raw(d);
+    }
+    static inline void HVLM_EnergieAnfr_Zaehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x87) | ((raw << 3) & 0x78));
+    }
+
+    // Anfrage Ladeleistung mit welcher bis zu SOC aus BMS_LadegrenzeAntw_SOC geladen werden kann
+    // 48|12@1+ (200,0) [0|818600] "Unit_Watt" Receiver: BMC_MLBevo
+    static constexpr uint32_t HVLM_LadegrenzeAnfr_Leistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6]) |
+               (static_cast<uint32_t>(d[7] & 0xF) << 8);
+    }
+    static constexpr int32_t HVLM_LadegrenzeAnfr_Leistung(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVLM_LadegrenzeAnfr_Leistung_Raw(d)) * 200;
+    }
+    static inline void HVLM_LadegrenzeAnfr_Leistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>(raw);
+        d[7] = static_cast<uint8_t>((d[7] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // Fortlaufender Zaehler fuer die Anfrage Ladegrenze
+    // 60|4@1+ (1,0) [0|13] "Unit_None" Receiver: BMC_MLBevo
+    static constexpr uint32_t HVLM_LadegrenzeAnfr_Zaehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 4);
+    }
+    static constexpr uint32_t HVLM_LadegrenzeAnfr_Zaehler(const uint8_t* d)
+    {
+        return HVLM_LadegrenzeAnfr_Zaehler_Raw(d);
+    }
+    static inline void HVLM_LadegrenzeAnfr_Zaehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF) | ((raw << 4) & 0xF0));
+    }
+};
+
+// KN_Ladegeraet Sender: Ladegeraet_Konzern
+struct KN_Ladegeraet
+{
+    enum : uint32_t
+    {
+        ID = 0x17F00044,
+        DLC = 8
+    };
+
+    // Funktionseinschraenkung aufgrund Komponentenschutz aktiv
+    // 0|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LG_KompSchutz_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0] & 0x1);
+    }
+    static constexpr uint32_t LG_KompSchutz(const uint8_t* d)
+    {
+        return LG_KompSchutz_Raw(d);
+    }
+    static inline void LG_KompSchutz_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xFE) | (raw & 0x1));
+    }
+
+    // Funktionseinschraenkung aufgrund aktiver Abschaltstufe
+    // 1|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LG_Abschaltstufe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[0] >> 1) & 0x1);
+    }
+    static constexpr uint32_t LG_Abschaltstufe(const uint8_t* d)
+    {
+        return LG_Abschaltstufe_Raw(d);
+    }
+    static inline void LG_Abschaltstufe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Funktionseinschraenkung aufgrund aktivem Transport Mode und/oder Transport Schutz
+    // 2|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t LG_Transport_Mode_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[0] >> 2) & 0x1);
+    }
+    static constexpr uint32_t LG_Transport_Mode(const uint8_t* d)
+    {
+        return LG_Transport_Mode_Raw(d);
+    }
+    static inline void LG_Transport_Mode_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Abgebildet wird die von der Hardware vorgegebene Moeglichkeit, die Kommunikation nach Klemme 15 = AUS aufrecht zu erhalten. Es wird ein Init-Wert gesendet. 0 = Kommunikation nur bei KL15=EIN (kein Nachlauf, nicht weckfaehig) 1 = Kommunikation nach KL15=AU
+    // 4|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LG_Nachlauftyp_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0] >> 4);
+    }
+    static constexpr uint32_t LG_Nachlauftyp(const uint8_t* d)
+    {
+        return LG_Nachlauftyp_Raw(d);
+    }
+    static inline void LG_Nachlauftyp_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xF) | ((raw << 4) & 0xF0));
+    }
+
+    // Das Signal beinhaltet den Source Node Identifier (Knotenadresse, die auch in der Abbildungsvorschrift zur CAN-ID fuer die NM-High Botschaft verwendet wird).
+    // 8|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LG_SNI_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1]);
+    }
+    static constexpr uint32_t LG_SNI(const uint8_t* d)
+    {
+        return LG_SNI_Raw(d);
+    }
+    static inline void LG_SNI_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>(raw);
+    }
+
+    // Ausgabe des ECUKnockOut-Timer in der Knotenbotschaft
+    // 32|6@1+ (1,0) [0|62] "Unit_Minut" Receiver: Gateway
+    static constexpr uint32_t KN_Ladegeraet_ECUKnockOutTimer_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x3F);
+    }
+    static constexpr uint32_t KN_Ladegeraet_ECUKnockOutTimer(const uint8_t* d)
+    {
+        return KN_Ladegeraet_ECUKnockOutTimer_Raw(d);
+    }
+    static inline void KN_Ladegeraet_ECUKnockOutTimer_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xC0) | (raw & 0x3F));
+    }
+
+    // Ausgabe des BusKnockout-Status in der Knotenbotschaft
+    // 38|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t KN_Ladegeraet_BusKnockOut_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 6);
+    }
+    static constexpr uint32_t KN_Ladegeraet_BusKnockOut(const uint8_t* d)
+    {
+        return KN_Ladegeraet_BusKnockOut_Raw(d);
+    }
+    static inline void KN_Ladegeraet_BusKnockOut_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // Ausgabe des BusKnockOut-Timer in der Knotenbotschaft
+    // 40|8@1+ (1,0) [0|254] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t KN_Ladegeraet_BusKnockOutTimer_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5]);
+    }
+    static constexpr uint32_t KN_Ladegeraet_BusKnockOutTimer(const uint8_t* d)
+    {
+        return KN_Ladegeraet_BusKnockOutTimer_Raw(d);
+    }
+    static inline void KN_Ladegeraet_BusKnockOutTimer_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>(raw);
+    }
+
+    // enthaelt die Weckursache; stehen mehrere Weckursachen parallel an, dann muss der kleinste Wert uebertragen werden
+    // 48|8@1+ (1,0) [0|255] "" Receiver: Vector__XXX
+    static constexpr uint32_t NM_Ladegeraet_Wakeup_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6]);
+    }
+    static constexpr uint32_t NM_Ladegeraet_Wakeup(const uint8_t* d)
+    {
+        return NM_Ladegeraet_Wakeup_Raw(d);
+    }
+    static inline void NM_Ladegeraet_Wakeup_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>(raw);
+    }
+
+    // Ausgabe des ECUKnockout-Status in der Knotenbotschaft
+    // 56|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t KN_Ladegeraet_ECUKnockOut_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] & 0x3);
+    }
+    static constexpr uint32_t KN_Ladegeraet_ECUKnockOut(const uint8_t* d)
+    {
+        return KN_Ladegeraet_ECUKnockOut_Raw(d);
+    }
+    static inline void KN_Ladegeraet_ECUKnockOut_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFC) | (raw & 0x3));
+    }
+
+    // Zeigt an ob Steuergeraet lokal aktiv war
+    // 61|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t NMH_Ladegeraet_Lokalaktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 5) & 0x1);
+    }
+    static constexpr uint32_t NMH_Ladegeraet_Lokalaktiv(const uint8_t* d)
+    {
+        return NMH_Ladegeraet_Lokalaktiv_Raw(d);
+    }
+    static inline void NMH_Ladegeraet_Lokalaktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Zeigt an ob ein Subsystem des SGs nach Klemme15 AUS und nach entsprechender MAX Aktivzeit noch aktiv war
+    // 62|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t NMH_Ladegeraet_Subsystemaktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 6) & 0x1);
+    }
+    static constexpr uint32_t NMH_Ladegeraet_Subsystemaktiv(const uint8_t* d)
+    {
+        return NMH_Ladegeraet_Subsystemaktiv_Raw(d);
+    }
+    static inline void NMH_Ladegeraet_Subsystemaktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Bei gesetztem Bit ist mindestens ein Kundendienstfehler eingetragen
+    // 63|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t LG_KD_Fehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 7);
+    }
+    static constexpr uint32_t LG_KD_Fehler(const uint8_t* d)
+    {
+        return LG_KD_Fehler_Raw(d);
+    }
+    static inline void LG_KD_Fehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x7F) | ((raw << 7) & 0x80));
+    }
+};
+
+// ZV_01 Sender: Gateway
+struct ZV_01
+{
+    enum : uint32_t
+    {
+        ID = 0x184,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_01_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t ZV_01_CRC(const uint8_t* d)
+    {
+        return ZV_01_CRC_Raw(d);
+    }
+    static inline void ZV_01_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_01_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t ZV_01_BZ(const uint8_t* d)
+    {
+        return ZV_01_BZ_Raw(d);
+    }
+    static inline void ZV_01_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Verriegelungsanforderung ZV fuer FT
+    // 12|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_FT_verriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_FT_verriegeln(const uint8_t* d)
+    {
+        return ZV_FT_verriegeln_Raw(d);
+    }
+    static inline void ZV_FT_verriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Entriegelungsanforderung ZV fuer FT
+    // 13|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV,Ladegeraet_Konzern
+    static constexpr uint32_t ZV_FT_entriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZV_FT_entriegeln(const uint8_t* d)
+    {
+        return ZV_FT_entriegeln_Raw(d);
+    }
+    static inline void ZV_FT_entriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Verriegelungsanforderung ZV fuer BT
+    // 14|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_BT_verriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_BT_verriegeln(const uint8_t* d)
+    {
+        return ZV_BT_verriegeln_Raw(d);
+    }
+    static inline void ZV_BT_verriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Beifahrertuer entriegeln (Anforderung ZV)
+    // 15|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_BT_entriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7);
+    }
+    static constexpr uint32_t ZV_BT_entriegeln(const uint8_t* d)
+    {
+        return ZV_BT_entriegeln_Raw(d);
+    }
+    static inline void ZV_BT_entriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Verriegelungsanforderung ZV fuer HFS
+    // 16|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HFS_verriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] & 0x1);
+    }
+    static constexpr uint32_t ZV_HFS_verriegeln(const uint8_t* d)
+    {
+        return ZV_HFS_verriegeln_Raw(d);
+    }
+    static inline void ZV_HFS_verriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFE) | (raw & 0x1));
+    }
+
+    // Entriegelungsanforderung ZV fuer HFS
+    // 17|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HFS_entriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZV_HFS_entriegeln(const uint8_t* d)
+    {
+        return ZV_HFS_entriegeln_Raw(d);
+    }
+    static inline void ZV_HFS_entriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Verriegelungsanforderung ZV fuer HBFS
+    // 18|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HBFS_verriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 2) & 0x1);
+    }
+    static constexpr uint32_t ZV_HBFS_verriegeln(const uint8_t* d)
+    {
+        return ZV_HBFS_verriegeln_Raw(d);
+    }
+    static inline void ZV_HBFS_verriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Entriegelungsanforderung ZV fuer HBFS
+    // 19|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HBFS_entriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 3) & 0x1);
+    }
+    static constexpr uint32_t ZV_HBFS_entriegeln(const uint8_t* d)
+    {
+        return ZV_HBFS_entriegeln_Raw(d);
+    }
+    static inline void ZV_HBFS_entriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Zentral safen
+    // 20|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zentral_safen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_zentral_safen(const uint8_t* d)
+    {
+        return ZV_zentral_safen_Raw(d);
+    }
+    static inline void ZV_zentral_safen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Zentral entsafen
+    // 21|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zentral_entsafen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZV_zentral_entsafen(const uint8_t* d)
+    {
+        return ZV_zentral_entsafen_Raw(d);
+    }
+    static inline void ZV_zentral_entsafen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Anforderung ueber ZV: Spiegel sind anzuklappen
+    // 22|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Spg_Anklappen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_Spg_Anklappen(const uint8_t* d)
+    {
+        return ZV_Spg_Anklappen_Raw(d);
+    }
+    static inline void ZV_Spg_Anklappen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Betaetigung Softtouch
+    // 23|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Softtouch_betaetigt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7);
+    }
+    static constexpr uint32_t ZV_Softtouch_betaetigt(const uint8_t* d)
+    {
+        return ZV_Softtouch_betaetigt_Raw(d);
+    }
+    static inline void ZV_Softtouch_betaetigt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Ansteuerung der LED's in den Tueren; BAF gilt nicht fuer dieses Bit
+    // 24|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_LED_Steuerung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x1);
+    }
+    static constexpr uint32_t ZV_LED_Steuerung(const uint8_t* d)
+    {
+        return ZV_LED_Steuerung_Raw(d);
+    }
+    static inline void ZV_LED_Steuerung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFE) | (raw & 0x1));
+    }
+
+    // Uebernahme der LED Steuerung durch das TSG FT
+    // 25|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_LED_Uebernahme_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZV_LED_Uebernahme(const uint8_t* d)
+    {
+        return ZV_LED_Uebernahme_Raw(d);
+    }
+    static inline void ZV_LED_Uebernahme_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // ZV Schliessstelle
+    // 26|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_auf_FT_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 2) & 0x1);
+    }
+    static constexpr uint32_t ZV_auf_FT(const uint8_t* d)
+    {
+        return ZV_auf_FT_Raw(d);
+    }
+    static inline void ZV_auf_FT_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // ZV Schliessstelle
+    // 27|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zu_FT_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 3) & 0x1);
+    }
+    static constexpr uint32_t ZV_zu_FT(const uint8_t* d)
+    {
+        return ZV_zu_FT_Raw(d);
+    }
+    static inline void ZV_zu_FT_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // ZV Schliessstelle
+    // 28|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_auf_BT_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_auf_BT(const uint8_t* d)
+    {
+        return ZV_auf_BT_Raw(d);
+    }
+    static inline void ZV_auf_BT_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // ZV Schliessstelle
+    // 29|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zu_BT_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZV_zu_BT(const uint8_t* d)
+    {
+        return ZV_zu_BT_Raw(d);
+    }
+    static inline void ZV_zu_BT_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // ZV Schliessstelle
+    // 30|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_auf_Kessy_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_auf_Kessy(const uint8_t* d)
+    {
+        return ZV_auf_Kessy_Raw(d);
+    }
+    static inline void ZV_auf_Kessy_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // ZV Schliessstelle
+    // 31|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zu_Kessy_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 7);
+    }
+    static constexpr uint32_t ZV_zu_Kessy(const uint8_t* d)
+    {
+        return ZV_zu_Kessy_Raw(d);
+    }
+    static inline void ZV_zu_Kessy_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // ZV Schliessstelle
+    // 32|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_auf_Funk_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x1);
+    }
+    static constexpr uint32_t ZV_auf_Funk(const uint8_t* d)
+    {
+        return ZV_auf_Funk_Raw(d);
+    }
+    static inline void ZV_auf_Funk_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | (raw & 0x1));
+    }
+
+    // ZV Schliessstelle
+    // 33|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zu_Funk_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZV_zu_Funk(const uint8_t* d)
+    {
+        return ZV_zu_Funk_Raw(d);
+    }
+    static inline void ZV_zu_Funk_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Heckentriegelung durch die Bedienstelle Virtuelles Pedal(VIP) erkannt. Der VIP Sensor hat eine Fusskickbewegung erkannt und es wurde ein Kessy - Schluessel im Heckaussenbereich erkannt.
+    // 34|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t VIP_Sensor_betaetigt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 2) & 0x1);
+    }
+    static constexpr uint32_t VIP_Sensor_betaetigt(const uint8_t* d)
+    {
+        return VIP_Sensor_betaetigt_Raw(d);
+    }
+    static inline void VIP_Sensor_betaetigt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Vituelles Pedal ist ueber HMI freigeschaltet.
+    // 35|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t VIP_Freigabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 3) & 0x1);
+    }
+    static constexpr uint32_t VIP_Freigabe(const uint8_t* d)
+    {
+        return VIP_Freigabe_Raw(d);
+    }
+    static inline void VIP_Freigabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // ZV Schliessstelle
+    // 36|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_zu_Zeitl_Nachverr_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_zu_Zeitl_Nachverr(const uint8_t* d)
+    {
+        return ZV_zu_Zeitl_Nachverr_Raw(d);
+    }
+    static inline void ZV_zu_Zeitl_Nachverr_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Anforderungssignal zur Ansteuerung des Handschuhkastenmotors in Richtung Entriegeln.
+    // 37|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HSK_entriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZV_HSK_entriegeln(const uint8_t* d)
+    {
+        return ZV_HSK_entriegeln_Raw(d);
+    }
+    static inline void ZV_HSK_entriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Anforderungssignal zur Ansteuerung des Handschuhkastenmotors in Richtung Verriegeln.
+    // 38|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HSK_verriegeln_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_HSK_verriegeln(const uint8_t* d)
+    {
+        return ZV_HSK_verriegeln_Raw(d);
+    }
+    static inline void ZV_HSK_verriegeln_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Anforderungssignal fuer ein Komfortschliessen des Verdecks. Signal wird angefordert wenn SKontakt = 0 und eine Doppelbetaetigung Schliesszylinder_Zu oder Funkfernbedienung_Taste_zu innerhalb zwei Sekunden empfangen wird. Signal wird auch angefordert wenn
+    // 39|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Verdeck_zu_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 7);
+    }
+    static constexpr uint32_t ZV_Verdeck_zu(const uint8_t* d)
+    {
+        return ZV_Verdeck_zu_Raw(d);
+    }
+    static inline void ZV_Verdeck_zu_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Anforderungssignal fuer ein Komfortoeffnen des Verdecks. Signal wird angefordert wenn SKontakt = 0 und eine Doppelbetaetigung Schliesszylinder_auf oder Funkfernbedienung_Taste_auf innerhalb zwei Sekunden empfangen wird. Signal wird auch angefordert wenn S
+    // 40|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Verdeck_auf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] & 0x1);
+    }
+    static constexpr uint32_t ZV_Verdeck_auf(const uint8_t* d)
+    {
+        return ZV_Verdeck_auf_Raw(d);
+    }
+    static inline void ZV_Verdeck_auf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFE) | (raw & 0x1));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 41|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_FT_hoch_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 1) & 0x1);
+    }
+    static constexpr uint32_t FH_FT_hoch(const uint8_t* d)
+    {
+        return FH_FT_hoch_Raw(d);
+    }
+    static inline void FH_FT_hoch_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 42|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_FT_tief_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 2) & 0x1);
+    }
+    static constexpr uint32_t FH_FT_tief(const uint8_t* d)
+    {
+        return FH_FT_tief_Raw(d);
+    }
+    static inline void FH_FT_tief_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 43|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_BT_hoch_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 3) & 0x1);
+    }
+    static constexpr uint32_t FH_BT_hoch(const uint8_t* d)
+    {
+        return FH_BT_hoch_Raw(d);
+    }
+    static inline void FH_BT_hoch_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 44|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_BT_tief_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 4) & 0x1);
+    }
+    static constexpr uint32_t FH_BT_tief(const uint8_t* d)
+    {
+        return FH_BT_tief_Raw(d);
+    }
+    static inline void FH_BT_tief_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 45|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_HFS_hoch_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 5) & 0x1);
+    }
+    static constexpr uint32_t FH_HFS_hoch(const uint8_t* d)
+    {
+        return FH_HFS_hoch_Raw(d);
+    }
+    static inline void FH_HFS_hoch_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 46|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_HFS_tief_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 6) & 0x1);
+    }
+    static constexpr uint32_t FH_HFS_tief(const uint8_t* d)
+    {
+        return FH_HFS_tief_Raw(d);
+    }
+    static inline void FH_HFS_tief_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 47|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_HBFS_hoch_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 7);
+    }
+    static constexpr uint32_t FH_HBFS_hoch(const uint8_t* d)
+    {
+        return FH_HBFS_hoch_Raw(d);
+    }
+    static inline void FH_HBFS_hoch_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Freigabeinformation fuer die FH-Komfortfunktion
+    // 48|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FH_HBFS_tief_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] & 0x1);
+    }
+    static constexpr uint32_t FH_HBFS_tief(const uint8_t* d)
+    {
+        return FH_HBFS_tief_Raw(d);
+    }
+    static inline void FH_HBFS_tief_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFE) | (raw & 0x1));
+    }
+
+    // Anforderung zur Aktivierung der synchronen Spiegelverstellung
+    // 49|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_Spg_Synchron_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 1) & 0x1);
+    }
+    static constexpr uint32_t BCM_Spg_Synchron(const uint8_t* d)
+    {
+        return BCM_Spg_Synchron_Raw(d);
+    }
+    static inline void BCM_Spg_Synchron_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Spiegelabsenkung Beifahrerseite
+    // 50|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_BF_Spg_Absenkung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 2) & 0x1);
+    }
+    static constexpr uint32_t BCM_BF_Spg_Absenkung(const uint8_t* d)
+    {
+        return BCM_BF_Spg_Absenkung_Raw(d);
+    }
+    static inline void BCM_BF_Spg_Absenkung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Signatur der ZV
+    // 51|11@1+ (1,0) [0|2047] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Signatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 3) |
+               (static_cast<uint32_t>(d[7] & 0x3F) << 5);
+    }
+    static constexpr uint32_t ZV_Signatur(const uint8_t* d)
+    {
+        return ZV_Signatur_Raw(d);
+    }
+    static inline void ZV_Signatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x7) | ((raw << 3) & 0xF8));
+        d[7] = static_cast<uint8_t>((d[7] & 0xC0) | ((raw >> 5) & 0x3F));
+    }
+
+    // Bei ZV Anforderung erfolgt die Entriegelung des Ladesteckers
+    // 62|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_entriegeln_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_entriegeln_Anf(const uint8_t* d)
+    {
+        return ZV_entriegeln_Anf_Raw(d);
+    }
+    static inline void ZV_entriegeln_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Kennung fuer die automatische Ansteuerung der Zentralverriegelung (Autolock/Autounlock)
+    // 63|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_auto_Ansteuerung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 7);
+    }
+    static constexpr uint32_t ZV_auto_Ansteuerung(const uint8_t* d)
+    {
+        return ZV_auto_Ansteuerung_Raw(d);
+    }
+    static inline void ZV_auto_Ansteuerung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x7F) | ((raw << 7) & 0x80));
+    }
+};
+
+// BMS_01 Sender: BMC_MLBevo
+struct BMS_01
+{
+    enum : uint32_t
+    {
+        ID = 0x191,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_01_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t BMS_01_CRC(const uint8_t* d)
+    {
+        return BMS_01_CRC_Raw(d);
+    }
+    static inline void BMS_01_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_01_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t BMS_01_BZ(const uint8_t* d)
+    {
+        return BMS_01_BZ_Raw(d);
+    }
+    static inline void BMS_01_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Momentanwert: Batteriestrom Stromrichtung: ein Ladestrom wird mit positiven, ein Entladestrom mit negativen Werten angegeben
+    // 12|12@1+ (1,-2047) [-2047|2046] "Unit_Amper" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,LE1,LE2,LE2_3_MLBevo_LB,Sub_Gateway,TME
+    static constexpr uint32_t BMS_IstStrom_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2]) << 4);
+    }
+    static constexpr int32_t BMS_IstStrom_02(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_IstStrom_02_Raw(d)) + -2047;
+    }
+    static inline void BMS_IstStrom_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((raw >> 4));
+    }
+
+    // actual voltage of the battery / Momentanwert: Batteriespannung
+    // 24|12@1+ (0.25,0) [0|1023.25] "Unit_Volt" Receiver: AWC,Gateway,Gateway_PAG,Ladegeraet_2,Ladegeraet_Konzern,LE1,LE2,LE2_3_MLBevo_LB,Sub_Gateway,TME
+    static constexpr uint32_t BMS_IstSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]) |
+               (static_cast<uint32_t>(d[4] & 0xF) << 8);
+    }
+    static constexpr float BMS_IstSpannung(const uint8_t* d)
+    {
+        return BMS_IstSpannung_Raw(d) * 0.25f;
+    }
+    static inline void BMS_IstSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+        d[4] = static_cast<uint8_t>((d[4] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // Momentanwert: Spannung an den Batterie-HV-Anschluessen
+    // 36|11@1+ (0.5,0) [0|1022.5] "Unit_Volt" Receiver: Gateway,Gateway_PAG,LE1,LE2,LE2_3_MLBevo_LB,Sub_Gateway,TME
+    static constexpr uint32_t BMS_Spannung_ZwKr_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 4) |
+               (static_cast<uint32_t>(d[5] & 0x7F) << 4);
+    }
+    static constexpr float BMS_Spannung_ZwKr(const uint8_t* d)
+    {
+        return BMS_Spannung_ZwKr_Raw(d) * 0.5f;
+    }
+    static inline void BMS_Spannung_ZwKr_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF) | ((raw << 4) & 0xF0));
+        d[5] = static_cast<uint8_t>((d[5] & 0x80) | ((raw >> 4) & 0x7F));
+    }
+
+    // State of Charge / aktueller Ladezustand der Batterie (hoehere Aufloesung)
+    // 47|11@1+ (0.05,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t BMS_SOC_HiRes_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 7) |
+               (static_cast<uint32_t>(d[6]) << 1) |
+               (static_cast<uint32_t>(d[7] & 0x3) << 9);
+    }
+    static constexpr float BMS_SOC_HiRes(const uint8_t* d)
+    {
+        return BMS_SOC_HiRes_Raw(d) * 0.05f;
+    }
+    static inline void BMS_SOC_HiRes_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x7F) | ((raw << 7) & 0x80));
+        d[6] = static_cast<uint8_t>((raw >> 1));
+        d[7] = static_cast<uint8_t>((d[7] & 0xFC) | ((raw >> 9) & 0x3));
+    }
+
+    // Vorzeichen des Offsets, bzw. der Nachkommastelle
+    // 58|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t BMS_IstStrom_02_OffsetVZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 2) & 0x1);
+    }
+    static constexpr uint32_t BMS_IstStrom_02_OffsetVZ(const uint8_t* d)
+    {
+        return BMS_IstStrom_02_OffsetVZ_Raw(d);
+    }
+    static inline void BMS_IstStrom_02_OffsetVZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Nachkommastelle des BMS_IstStrom_02
+    // 60|4@1+ (0.0625,0) [0|0.9375] "Unit_Amper" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t BMS_IstStrom_02_Offset_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 4);
+    }
+    static constexpr float BMS_IstStrom_02_Offset(const uint8_t* d)
+    {
+        return BMS_IstStrom_02_Offset_Raw(d) * 0.0625f;
+    }
+    static inline void BMS_IstStrom_02_Offset_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF) | ((raw << 4) & 0xF0));
+    }
+};
+
+// Klemmen_Status_01 Sender: Gateway
+struct Klemmen_Status_01
+{
+    enum : uint32_t
+    {
+        ID = 0x3C0,
+        DLC = 4
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: BMC_MLBevo,DCDC_HV_02,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern
+    static constexpr uint32_t Klemmen_Status_01_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t Klemmen_Status_01_CRC(const uint8_t* d)
+    {
+        return Klemmen_Status_01_CRC_Raw(d);
+    }
+    static inline void Klemmen_Status_01_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 4bit Botschaftszaehler; wird in jeder Sendebotschaft inkrementiert
+    // 8|4@1+ (1,0) [0|15] "" Receiver: BMC_MLBevo,DCDC_HV_02,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern
+    static constexpr uint32_t Klemmen_Status_01_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t Klemmen_Status_01_BZ(const uint8_t* d)
+    {
+        return Klemmen_Status_01_BZ_Raw(d);
+    }
+    static inline void Klemmen_Status_01_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Ueber das Signal fordert das BCM Fahrerhinweise im Kombi fuer die Funktion RemoteStart an.
+    // 12|4@1+ (1,0) [0|15] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t RSt_Fahrerhinweise_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4);
+    }
+    static constexpr uint32_t RSt_Fahrerhinweise(const uint8_t* d)
+    {
+        return RSt_Fahrerhinweise_Raw(d);
+    }
+    static inline void RSt_Fahrerhinweise_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+    }
+
+    // Klemme S: S-Kontakt (Schluessel steckt)
+    // 16|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern,TME
+    static constexpr uint32_t ZAS_Kl_S_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] & 0x1);
+    }
+    static constexpr uint32_t ZAS_Kl_S(const uint8_t* d)
+    {
+        return ZAS_Kl_S_Raw(d);
+    }
+    static inline void ZAS_Kl_S_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFE) | (raw & 0x1));
+    }
+
+    // Klemme 15: Zuendung (SW-Kl.15)
+    // 17|1@1+ (1,0) [0|1] "" Receiver: AWC,BMC_MLBevo,BMS_NV,DCDC_800V_PAG,DCDC_HV,DCDC_HV_02,DCDC_IHEV,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t ZAS_Kl_15_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZAS_Kl_15(const uint8_t* d)
+    {
+        return ZAS_Kl_15_Raw(d);
+    }
+    static inline void ZAS_Kl_15_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Klemme 75
+    // 18|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t ZAS_Kl_X_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 2) & 0x1);
+    }
+    static constexpr uint32_t ZAS_Kl_X(const uint8_t* d)
+    {
+        return ZAS_Kl_X_Raw(d);
+    }
+    static inline void ZAS_Kl_X_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Klemme 50: Startwunsch Fahrer
+    // 19|1@1+ (1,0) [0|1] "" Receiver: AWC,BMC_MLBevo,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern,TME
+    static constexpr uint32_t ZAS_Kl_50_Startanforderung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 3) & 0x1);
+    }
+    static constexpr uint32_t ZAS_Kl_50_Startanforderung(const uint8_t* d)
+    {
+        return ZAS_Kl_50_Startanforderung_Raw(d);
+    }
+    static inline void ZAS_Kl_50_Startanforderung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Zeigt den Status des RemoteStarts an, d.h. KL15_RSt ist aktiviert und der Motorlauf ist im RSt-Betrieb aktiv.
+    // 20|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t BCM_Remotestart_Betrieb_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x1);
+    }
+    static constexpr uint32_t BCM_Remotestart_Betrieb(const uint8_t* d)
+    {
+        return BCM_Remotestart_Betrieb_Raw(d);
+    }
+    static inline void BCM_Remotestart_Betrieb_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Separate Klemmeninformation fuer das Infotainment. Signal entspricht im wesentlichen einer Klemme S Information, kann aber ueber einen Vor - bzw. Nachlauf zu Klemme S verfuegen. Ein konkreter Anwendungsfall fuer einen Nachlauf ist die Abschaltung der Klemme
+    // 21|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t ZAS_Kl_Infotainment_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZAS_Kl_Infotainment(const uint8_t* d)
+    {
+        return ZAS_Kl_Infotainment_Raw(d);
+    }
+    static inline void ZAS_Kl_Infotainment_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Zeigt den Status der Aktivierung der KL15_RST durch das BCM an.
+    // 22|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t BCM_Remotestart_KL15_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 6) & 0x1);
+    }
+    static constexpr uint32_t BCM_Remotestart_KL15_Anf(const uint8_t* d)
+    {
+        return BCM_Remotestart_KL15_Anf_Raw(d);
+    }
+    static inline void BCM_Remotestart_KL15_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Nachdem das BCM die Remotestart MSG Freigabe sicher erkannt hat, fordert das BCM wiederum ueber dieses Signal vom MSG einen Motorstart durchzufuehren.
+    // 23|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t BCM_Remotestart_MO_Start_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7);
+    }
+    static constexpr uint32_t BCM_Remotestart_MO_Start(const uint8_t* d)
+    {
+        return BCM_Remotestart_MO_Start_Raw(d);
+    }
+    static inline void BCM_Remotestart_MO_Start_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Kombi Prio Warnung Klemmensteuerung Zuendschloss defekt, Service aufsuchen!
+    // 24|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Warn_P1_ZST_def_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x1);
+    }
+    static constexpr uint32_t KST_Warn_P1_ZST_def(const uint8_t* d)
+    {
+        return KST_Warn_P1_ZST_def_Raw(d);
+    }
+    static inline void KST_Warn_P1_ZST_def_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFE) | (raw & 0x1));
+    }
+
+    // Kombi Prio Warnung Klemmensteuerung Zuendschloss defekt!
+    // 25|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Warn_P2_ZST_def_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 1) & 0x1);
+    }
+    static constexpr uint32_t KST_Warn_P2_ZST_def(const uint8_t* d)
+    {
+        return KST_Warn_P2_ZST_def_Raw(d);
+    }
+    static inline void KST_Warn_P2_ZST_def_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Signalisierung Fahrerhinweis 1 der Klemmensteuerung an das Kombi
+    // 26|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Fahrerhinweis_1_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 2) & 0x1);
+    }
+    static constexpr uint32_t KST_Fahrerhinweis_1(const uint8_t* d)
+    {
+        return KST_Fahrerhinweis_1_Raw(d);
+    }
+    static inline void KST_Fahrerhinweis_1_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Signalisierung Fahrerhinweis 2 der Klemmensteuerung an das Kombi
+    // 27|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Fahrerhinweis_2_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 3) & 0x1);
+    }
+    static constexpr uint32_t KST_Fahrerhinweis_2(const uint8_t* d)
+    {
+        return KST_Fahrerhinweis_2_Raw(d);
+    }
+    static inline void KST_Fahrerhinweis_2_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Anforderung zur erneuten Lampenaufpruefung und Anzeige von Warnhinweisen nach einem pilotierten Ausparkvorgang (Trigger: fallende Flanke)
+    // 28|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t BCM_Ausparken_Betrieb_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 4) & 0x1);
+    }
+    static constexpr uint32_t BCM_Ausparken_Betrieb(const uint8_t* d)
+    {
+        return BCM_Ausparken_Betrieb_Raw(d);
+    }
+    static inline void BCM_Ausparken_Betrieb_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Signalisierung Fahrerhinweis 4 der Klemmensteuerung an das Kombi
+    // 29|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Fahrerhinweis_4_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 5) & 0x1);
+    }
+    static constexpr uint32_t KST_Fahrerhinweis_4(const uint8_t* d)
+    {
+        return KST_Fahrerhinweis_4_Raw(d);
+    }
+    static inline void KST_Fahrerhinweis_4_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Anzeigesignal fuer RemoteStart
+    // 30|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Fahrerhinweis_5_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 6) & 0x1);
+    }
+    static constexpr uint32_t KST_Fahrerhinweis_5(const uint8_t* d)
+    {
+        return KST_Fahrerhinweis_5_Raw(d);
+    }
+    static inline void KST_Fahrerhinweis_5_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Signal aktiviert die Kombi-Anzeigeinstrumente (Drehzahl, Tankinhalt, Kuehlmitteltemperatur) waehrend aktiviertem RemoteStart-Betrieb
+    // 31|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t KST_Fahrerhinweis_6_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 7);
+    }
+    static constexpr uint32_t KST_Fahrerhinweis_6(const uint8_t* d)
+    {
+        return KST_Fahrerhinweis_6_Raw(d);
+    }
+    static inline void KST_Fahrerhinweis_6_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x7F) | ((raw << 7) & 0x80));
+    }
+};
+
+// ESP_15 Sender: Gateway
+struct ESP_15
+{
+    enum : uint32_t
+    {
+        ID = 0x1A2,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen' Wird im Projekt
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Vector__XXX
+    static constexpr uint32_t ESP_15_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t ESP_15_CRC(const uint8_t* d)
+    {
+        return ESP_15_CRC_Raw(d);
+    }
+    static inline void ESP_15_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // Botschaftszaehler Botschaft asynchron geroutet. Zaehlerwert kann springen.
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Vector__XXX
+    static constexpr uint32_t ESP_15_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t ESP_15_BZ(const uint8_t* d)
+    {
+        return ESP_15_BZ_Raw(d);
+    }
+    static inline void ESP_15_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Fordert das Getriebe auf in Stellung 'P' zu bleiben.
+    // 12|2@1+ (1,0) [0|3] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_P_beibehalten_GE_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x3);
+    }
+    static constexpr uint32_t HMS_P_beibehalten_GE(const uint8_t* d)
+    {
+        return HMS_P_beibehalten_GE_Raw(d);
+    }
+    static inline void HMS_P_beibehalten_GE_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Zeigt an, ob die Kommunikation und die Anforderungen plausibel sind.
+    // 14|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Konsistenz_GE_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 6) & 0x1);
+    }
+    static constexpr uint32_t HMS_Konsistenz_GE(const uint8_t* d)
+    {
+        return HMS_Konsistenz_GE_Raw(d);
+    }
+    static inline void HMS_Konsistenz_GE_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Zeigt an, ob die Kommunikation und die Anforderungen plausibel sind.
+    // 15|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Konsistenz_IPA_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7);
+    }
+    static constexpr uint32_t HMS_Konsistenz_IPA(const uint8_t* d)
+    {
+        return HMS_Konsistenz_IPA_Raw(d);
+    }
+    static inline void HMS_Konsistenz_IPA_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Zeigt an, ob die Kommunikation und die Anforderungen plausibel sind.
+    // 18|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Konsistenz_STA_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 2) & 0x1);
+    }
+    static constexpr uint32_t HMS_Konsistenz_STA(const uint8_t* d)
+    {
+        return HMS_Konsistenz_STA_Raw(d);
+    }
+    static inline void HMS_Konsistenz_STA_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Zeigt an, ob die Kommunikation und die Anforderungen plausibel sind.
+    // 19|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Konsistenz_MO_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 3) & 0x1);
+    }
+    static constexpr uint32_t HMS_Konsistenz_MO(const uint8_t* d)
+    {
+        return HMS_Konsistenz_MO_Raw(d);
+    }
+    static inline void HMS_Konsistenz_MO_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Rueckmeldung HMS-Teilfunktion 'Halten' nicht verfuegbar.
+    // 20|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_halten_nicht_verfuegbar_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x1);
+    }
+    static constexpr uint32_t HMS_halten_nicht_verfuegbar(const uint8_t* d)
+    {
+        return HMS_halten_nicht_verfuegbar_Raw(d);
+    }
+    static inline void HMS_halten_nicht_verfuegbar_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Das Primaer- Bremsregelsystem uebermittelt seinen Systemstatus an zFAS und Sekundaer- Bremsregelsystem. Der Staupilot ermittelt sich ueber den Status des Primaer-und des Sekundaerbremsregelsystems den Gesamtzustand des Notlaufreglers.
+    // 21|3@1+ (1,0) [0|7] "" Receiver: Vector__XXX
+    static constexpr uint32_t NL_PRIM_STP_01_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 5);
+    }
+    static constexpr uint32_t NL_PRIM_STP_01_Status(const uint8_t* d)
+    {
+        return NL_PRIM_STP_01_Status_Raw(d);
+    }
+    static inline void NL_PRIM_STP_01_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // Ueber dieses Signal wird ein Warnblinken von Funktionen des VMM (VehicleMotionManagers) angefordert.
+    // 24|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t VMM_Warnblinken_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x1);
+    }
+    static constexpr uint32_t VMM_Warnblinken(const uint8_t* d)
+    {
+        return VMM_Warnblinken_Raw(d);
+    }
+    static inline void VMM_Warnblinken_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFE) | (raw & 0x1));
+    }
+
+    // Zeigt die Verfuegbarkeit und den Zustand der VZM Funktionen im ESC an
+    // 26|3@1+ (1,0) [0|7] "" Receiver: Vector__XXX
+    static constexpr uint32_t VZM_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 2) & 0x7);
+    }
+    static constexpr uint32_t VZM_Status(const uint8_t* d)
+    {
+        return VZM_Status_Raw(d);
+    }
+    static inline void VZM_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xE3) | ((raw << 2) & 0x1C));
+    }
+
+    // Statusinformation des Notstoppsystems an die beteiligten Systeme.
+    // 29|3@1+ (1,0) [0|7] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Notstopp_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 5);
+    }
+    static constexpr uint32_t HMS_Notstopp_Status(const uint8_t* d)
+    {
+        return HMS_Notstopp_Status_Raw(d);
+    }
+    static inline void HMS_Notstopp_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // Rueckmeldung HMS-Teilfunktionen 'Parken' nicht verfuegbar.
+    // 32|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_parken_nicht_verfuegbar_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x1);
+    }
+    static constexpr uint32_t HMS_parken_nicht_verfuegbar(const uint8_t* d)
+    {
+        return HMS_parken_nicht_verfuegbar_Raw(d);
+    }
+    static inline void HMS_parken_nicht_verfuegbar_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | (raw & 0x1));
+    }
+
+    // Fordert vom Getriebe bestimmte Schaltstellungen an.
+    // 33|3@1+ (1,0) [0|7] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Anforderung_GE_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 1) & 0x7);
+    }
+    static constexpr uint32_t HMS_Anforderung_GE(const uint8_t* d)
+    {
+        return HMS_Anforderung_GE_Raw(d);
+    }
+    static inline void HMS_Anforderung_GE_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF1) | ((raw << 1) & 0xE));
+    }
+
+    // Zeigt den aktuellen Systemstatus des HMS an.
+    // 36|4@1+ (1,0) [0|15] "" Receiver: FCU_MLBevo_FCEV,Ladegeraet_Konzern
+    static constexpr uint32_t HMS_Systemstatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 4);
+    }
+    static constexpr uint32_t HMS_Systemstatus(const uint8_t* d)
+    {
+        return HMS_Systemstatus_Raw(d);
+    }
+    static inline void HMS_Systemstatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF) | ((raw << 4) & 0xF0));
+    }
+
+    // Das Signal zeigt, basierend auf den vier ESP-Raddrehzahlinformatioen, gefiltert und/oder entprellt mehrstufig den Fahrzeuggeschwindigkeitszustand an.
+    // 40|3@1+ (1,0) [0|7] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Stillstand_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] & 0x7);
+    }
+    static constexpr uint32_t HMS_Stillstand(const uint8_t* d)
+    {
+        return HMS_Stillstand_Raw(d);
+    }
+    static inline void HMS_Stillstand_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF8) | (raw & 0x7));
+    }
+
+    // Zeigt an, von welchem System die Anforderung gerade umgesetzt wird.
+    // 43|5@1+ (1,0) [0|31] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HMS_aktives_System_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 3);
+    }
+    static constexpr uint32_t HMS_aktives_System(const uint8_t* d)
+    {
+        return HMS_aktives_System_Raw(d);
+    }
+    static inline void HMS_aktives_System_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x7) | ((raw << 3) & 0xF8));
+    }
+
+    // Zeigt an, ob die Kommunikation und die Anforderungen plausibel sind.
+    // 48|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HMS_Konsistenz_HVLM_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] & 0x1);
+    }
+    static constexpr uint32_t HMS_Konsistenz_HVLM(const uint8_t* d)
+    {
+        return HMS_Konsistenz_HVLM_Raw(d);
+    }
+    static inline void HMS_Konsistenz_HVLM_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFE) | (raw & 0x1));
+    }
+
+    // Zeigt an, ob die Kommunikation und die Anforderungen plausibel sind.
+    // 49|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HMS_Konsistenz_ACC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 1) & 0x1);
+    }
+    static constexpr uint32_t HMS_Konsistenz_ACC(const uint8_t* d)
+    {
+        return HMS_Konsistenz_ACC_Raw(d);
+    }
+    static inline void HMS_Konsistenz_ACC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Zeigt den Fehlerstatus des Haltemanagementsystems HMS an. Details zu den Werten 3/4: 3=Systemeinschraenkung, Parken EPB oder GSG nicht moeglich 4=Systemstoerung bzw. Parken EPB und GSG nicht moeglich
+    // 50|3@1+ (1,0) [0|7] "" Receiver: FCU_MLBevo_FCEV,Ladegeraet_Konzern
+    static constexpr uint32_t HMS_Fehlerstatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 2) & 0x7);
+    }
+    static constexpr uint32_t HMS_Fehlerstatus(const uint8_t* d)
+    {
+        return HMS_Fehlerstatus_Raw(d);
+    }
+    static inline void HMS_Fehlerstatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xE3) | ((raw << 2) & 0x1C));
+    }
+
+    // Zeigt an, ob das Summen-Radmoment von ESP_Haltemoment ein Bremsmoment (bergab) oder ein Antriebsmoment (bergauf) darstellt.
+    // 53|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ESP_Index_Haltemoment_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ESP_Index_Haltemoment(const uint8_t* d)
+    {
+        return ESP_Index_Haltemoment_Raw(d);
+    }
+    static inline void ESP_Index_Haltemoment_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Zeigt in Abhaengigkeit von ESP_Index_Haltemoment das notwendige Summen-Radmoment an (bergab: Bremsmoment; bergauf: Antriebsmoment), das mindestens notwendig ist um das Fahrzeug an der aktuellen Neigung zu halten.
+    // 54|10@1+ (10,0) [0|10210] "Unit_NewtoMeter" Receiver: Vector__XXX
+    static constexpr uint32_t ESP_Haltemoment_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6) |
+               (static_cast<uint32_t>(d[7]) << 2);
+    }
+    static constexpr int32_t ESP_Haltemoment(const uint8_t* d)
+    {
+        return static_cast<int32_t>(ESP_Haltemoment_Raw(d)) * 10;
+    }
+    static inline void ESP_Haltemoment_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+        d[7] = static_cast<uint8_t>((raw >> 2));
+    }
+};
+
+// DCDC_01 Sender: DCDC_800V_PAG
+struct DCDC_01
+{
+    enum : uint32_t
+    {
+        ID = 0x2AE,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t DCDC_01_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t DCDC_01_CRC(const uint8_t* d)
+    {
+        return DCDC_01_CRC_Raw(d);
+    }
+    static inline void DCDC_01_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t DCDC_01_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t DCDC_01_BZ(const uint8_t* d)
+    {
+        return DCDC_01_BZ_Raw(d);
+    }
+    static inline void DCDC_01_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Momentanwert: Hochspannung am DC/DC Wandler
+    // 12|12@1+ (0.25,0) [0|1023.25] "Unit_Volt" Receiver: BMC_MLBevo,DCDC_HV_02,Gateway,Gateway_PAG,TME
+    static constexpr uint32_t DC_IstSpannung_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2]) << 4);
+    }
+    static constexpr float DC_IstSpannung_HV(const uint8_t* d)
+    {
+        return DC_IstSpannung_HV_Raw(d) * 0.25f;
+    }
+    static inline void DC_IstSpannung_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((raw >> 4));
+    }
+
+    // Aktueller Strom des DC/DC-Wandlers Hoeherspannungsseitig. Tiefsetzen - positiv Hochsetzen - negativ
+    // 24|10@1+ (0.4,-204) [-204|204] "Unit_Amper" Receiver: DCDC_HV_02,Gateway,Gateway_PAG,Ladegeraet_Konzern,TME
+    static constexpr uint32_t DC_IstStrom_HV_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]) |
+               (static_cast<uint32_t>(d[4] & 0x3) << 8);
+    }
+    static constexpr float DC_IstStrom_HV_02(const uint8_t* d)
+    {
+        return DC_IstStrom_HV_02_Raw(d) * 0.4f + -204.0f;
+    }
+    static inline void DC_IstStrom_HV_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | ((raw >> 8) & 0x3));
+    }
+
+    // Momentanwert: Strom vom DC/DC in das Bordnetz Tiefsetzen - positiv Hochsetzen - negativ
+    // 34|10@1+ (1,-511) [-511|510] "Unit_Amper" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t DC_IstStrom_NV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 2) |
+               (static_cast<uint32_t>(d[5] & 0xF) << 6);
+    }
+    static constexpr int32_t DC_IstStrom_NV(const uint8_t* d)
+    {
+        return static_cast<int32_t>(DC_IstStrom_NV_Raw(d)) + -511;
+    }
+    static inline void DC_IstStrom_NV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3) | ((raw << 2) & 0xFC));
+        d[5] = static_cast<uint8_t>((d[5] & 0xF0) | ((raw >> 6) & 0xF));
+    }
+
+    // Momentanwert: Bordnetzspannung am DC/DC Wandler
+    // 56|8@1+ (0.1,0) [0|25.3] "Unit_Volt" Receiver: AWC,Gateway,Gateway_PAG,Ladegeraet_2,Ladegeraet_Konzern
+    static constexpr uint32_t DC_IstSpannung_NV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7]);
+    }
+    static constexpr float DC_IstSpannung_NV(const uint8_t* d)
+    {
+        return DC_IstSpannung_NV_Raw(d) * 0.1f;
+    }
+    static inline void DC_IstSpannung_NV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>(raw);
+    }
+};
+
+// HVK_01 Sender: Gateway
+struct HVK_01
+{
+    enum : uint32_t
+    {
+        ID = 0x503,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: BMC_MLBevo,DCDC_800V_PAG,DCDC_HV,DCDC_HV_02,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern,LE1,LE2,LE_MLBevo,TME
+    static constexpr uint32_t HVK_01_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t HVK_01_CRC(const uint8_t* d)
+    {
+        return HVK_01_CRC_Raw(d);
+    }
+    static inline void HVK_01_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: BMC_MLBevo,DCDC_800V_PAG,DCDC_HV,DCDC_HV_02,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern,LE1,LE2,LE_MLBevo,TME
+    static constexpr uint32_t HVK_01_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t HVK_01_BZ(const uint8_t* d)
+    {
+        return HVK_01_BZ_Raw(d);
+    }
+    static inline void HVK_01_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // HVK-Anforderung an alle HV-Komponenten deren Istmodus im schnellen Zyklus (Inhibitzeit) zu senden.
+    // 12|1@1+ (1,0) [0|1] "" Receiver: BMC_MLBevo,DCDC_HV,FCU_MLBevo_FCEV,Ladegeraet_2,Ladegeraet_Konzern,LE1,LE2,LE_MLBevo
+    static constexpr uint32_t HVK_Istmodus_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x1);
+    }
+    static constexpr uint32_t HVK_Istmodus_Anf(const uint8_t* d)
+    {
+        return HVK_Istmodus_Anf_Raw(d);
+    }
+    static inline void HVK_Istmodus_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Angeforderter Sollmodus der Steuereinheit fuer das Schuetze des Teilnetz1 'Ladepfad': 0 : HV_Off 1 : HV_On (Schuetz geschlossen) 2 : reserviert 3 : Init (CAN-Initialisierung)
+    // 13|2@1+ (1,0) [0|3] "" Receiver: DCDC_HV_02,FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_TN1_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 5) & 0x3);
+    }
+    static constexpr uint32_t HVK_TN1_Sollmodus(const uint8_t* d)
+    {
+        return HVK_TN1_Sollmodus_Raw(d);
+    }
+    static inline void HVK_TN1_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x9F) | ((raw << 5) & 0x60));
+    }
+
+    // Anforderung vom HVK Sollzustand der Elm_State 0 = HvOff 1 = HvStbyReq 2 = HvStbyWait 3 = HvBattOnReq 4 = HvBattOnWait 10 = HvOnIdle 18 = HvOnDrvReq 19 = HvOnDrvWait 20 = HvO
+    // 16|8@1+ (1,0) [0|255] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_MO_EmSollzustand_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2]);
+    }
+    static constexpr uint32_t HVK_MO_EmSollzustand(const uint8_t* d)
+    {
+        return HVK_MO_EmSollzustand_Raw(d);
+    }
+    static inline void HVK_MO_EmSollzustand_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>(raw);
+    }
+
+    // Angeforderter Sollmodus der HV-Batterie: 0 : HV_Off 1 : HV_On (HS geschlossen) 2 : nicht belegbar 3 : AC-Laden_erw (HS +AC_2-Schuetze geschlossen) 4 : AC-
+    // 24|3@1+ (1,0) [0|7] "" Receiver: BMC_MLBevo,FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_BMS_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x7);
+    }
+    static constexpr uint32_t HVK_BMS_Sollmodus(const uint8_t* d)
+    {
+        return HVK_BMS_Sollmodus_Raw(d);
+    }
+    static inline void HVK_BMS_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xF8) | (raw & 0x7));
+    }
+
+    // angeforderte Soll-Betriebsart des DC/DC-Wandlers: 0: Standby; Kommunikation aktiv 1: Zwischenkreis des HV-Netzes wird vorgeladen; HV-Netz wird aktiviert und darf nicht belastet werden. 2: Tiefsetzen (HV --> BN 14,4V) Sollwertvorgabe projek
+    // 27|3@1+ (1,0) [0|7] "" Receiver: DCDC_800V_PAG,DCDC_HV,FCU_MLBevo_FCEV,LE_MLBevo
+    static constexpr uint32_t HVK_DCDC_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 3) & 0x7);
+    }
+    static constexpr uint32_t HVK_DCDC_Sollmodus(const uint8_t* d)
+    {
+        return HVK_DCDC_Sollmodus_Raw(d);
+    }
+    static inline void HVK_DCDC_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xC7) | ((raw << 3) & 0x38));
+    }
+
+    // Sollmodus elektrischer Klimakompressor
+    // 30|3@1+ (1,0) [0|7] "" Receiver: FCU_MLBevo_FCEV,TME
+    static constexpr uint32_t HVK_EKK_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 6) |
+               (static_cast<uint32_t>(d[4] & 0x1) << 2);
+    }
+    static constexpr uint32_t HVK_EKK_Sollmodus(const uint8_t* d)
+    {
+        return HVK_EKK_Sollmodus_Raw(d);
+    }
+    static inline void HVK_EKK_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x3F) | ((raw << 6) & 0xC0));
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | ((raw >> 2) & 0x1));
+    }
+
+    // Sollmodus HV-PTC 0 : keine Freigabe 1 : Freigabe 2 : Freigabe_ausgesetzt 3 : nicht belegbar 4 : nicht belegbar 5 : nicht belegbar 6 : nicht belegbar 7 : Init (CAN-Initialisierung) Info: 'nicht belegbar' d.h. Sollmodus nicht relevant fuer HV
+    // 33|3@1+ (1,0) [0|7] "" Receiver: FCU_MLBevo_FCEV,TME
+    static constexpr uint32_t HVK_HVPTC_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 1) & 0x7);
+    }
+    static constexpr uint32_t HVK_HVPTC_Sollmodus(const uint8_t* d)
+    {
+        return HVK_HVPTC_Sollmodus_Raw(d);
+    }
+    static inline void HVK_HVPTC_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF1) | ((raw << 1) & 0xE));
+    }
+
+    // Angeforderter Sollmodus des Lademanagers.
+    // 36|3@1+ (1,0) [0|7] "" Receiver: DCDC_HV_02,FCU_MLBevo_FCEV,Ladegeraet_Konzern
+    static constexpr uint32_t HVK_HVLM_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x7);
+    }
+    static constexpr uint32_t HVK_HVLM_Sollmodus(const uint8_t* d)
+    {
+        return HVK_HVLM_Sollmodus_Raw(d);
+    }
+    static inline void HVK_HVLM_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // Anforderung Warnung/Fehler HV-System im Kombi 0: Keine Warnung/Init 1:Anforderung_Anzeige_Warnung_HV-Netz (gelbes Symbol) 2:Anforderung_Anzeige_Fehler_HV-Netz (rotes Symbol) 3:Anforderung_Anzeige_Warnung_Kein_Wiederstart_moeglich
+    // 39|2@1+ (1,0) [0|3] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_HV_Netz_Warnungen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 7) |
+               (static_cast<uint32_t>(d[5] & 0x1) << 1);
+    }
+    static constexpr uint32_t HVK_HV_Netz_Warnungen(const uint8_t* d)
+    {
+        return HVK_HV_Netz_Warnungen_Raw(d);
+    }
+    static inline void HVK_HV_Netz_Warnungen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x7F) | ((raw << 7) & 0x80));
+        d[5] = static_cast<uint8_t>((d[5] & 0xFE) | ((raw >> 1) & 0x1));
+    }
+
+    // Signalisiert ein aktives Hochvoltbordnetz. Fuer die Belastbarkeit des HV-Netzes muessen Strom- bzw. Leistungsgrenzen eingehalten werden
+    // 41|1@1+ (1,0) [0|1] "" Receiver: DCDC_HV_02,FCU_MLBevo_FCEV,Ladegeraet_Konzern,LE1,LE2,LE_MLBevo
+    static constexpr uint32_t HV_Bordnetz_aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 1) & 0x1);
+    }
+    static constexpr uint32_t HV_Bordnetz_aktiv(const uint8_t* d)
+    {
+        return HV_Bordnetz_aktiv_Raw(d);
+    }
+    static inline void HV_Bordnetz_aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Status ob im HV-Netz ein Fehler detektiert wurde.
+    // 42|1@1+ (1,0) [0|1] "" Receiver: FCU_MLBevo_FCEV,Ladegeraet_Konzern,TME
+    static constexpr uint32_t HV_Bordnetz_Fehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 2) & 0x1);
+    }
+    static constexpr uint32_t HV_Bordnetz_Fehler(const uint8_t* d)
+    {
+        return HV_Bordnetz_Fehler_Raw(d);
+    }
+    static inline void HV_Bordnetz_Fehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Status des HV-Systems
+    // 43|2@1+ (1,0) [0|3] "" Receiver: FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_Gesamtst_Spgfreiheit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 3) & 0x3);
+    }
+    static constexpr uint32_t HVK_Gesamtst_Spgfreiheit(const uint8_t* d)
+    {
+        return HVK_Gesamtst_Spgfreiheit_Raw(d);
+    }
+    static inline void HVK_Gesamtst_Spgfreiheit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xE7) | ((raw << 3) & 0x18));
+    }
+
+    // Anforderung zum aktiven Entladen des HV-Netzes, waehrend der Abschaltung des HV-Netz.
+    // 45|1@1+ (1,0) [0|1] "" Receiver: DCDC_800V_PAG,DCDC_HV,DCDC_HV_02,FCU_MLBevo_FCEV,LE1,LE2,LE_MLBevo
+    static constexpr uint32_t HVK_AktiveEntladung_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 5) & 0x1);
+    }
+    static constexpr uint32_t HVK_AktiveEntladung_Anf(const uint8_t* d)
+    {
+        return HVK_AktiveEntladung_Anf_Raw(d);
+    }
+    static inline void HVK_AktiveEntladung_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Anforderung an die isolationswiderstandsueberwachenden HV-Komponenten zur Durchfuehrung der Isolations-Widerstandsmessung.
+    // 50|3@1+ (1,0) [0|7] "" Receiver: BMC_MLBevo,FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_Iso_Messung_Start_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 2) & 0x7);
+    }
+    static constexpr uint32_t HVK_Iso_Messung_Start(const uint8_t* d)
+    {
+        return HVK_Iso_Messung_Start_Raw(d);
+    }
+    static inline void HVK_Iso_Messung_Start_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xE3) | ((raw << 2) & 0x1C));
+    }
+
+    // Bedarfsgerechtes Aktivieren des 400V-DCDC-Wandlers bei Anforderung durch TME
+    // 62|2@1+ (1,0) [0|3] "" Receiver: DCDC_800V_PAG,FCU_MLBevo_FCEV
+    static constexpr uint32_t HVK_DCDC_EKK_Sollmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 6);
+    }
+    static constexpr uint32_t HVK_DCDC_EKK_Sollmodus(const uint8_t* d)
+    {
+        return HVK_DCDC_EKK_Sollmodus_Raw(d);
+    }
+    static inline void HVK_DCDC_EKK_Sollmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+};
+
+// BMS_04 Sender: BMC_MLBevo
+struct BMS_04
+{
+    enum : uint32_t
+    {
+        ID = 0x5A2,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_04_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t BMS_04_CRC(const uint8_t* d)
+    {
+        return BMS_04_CRC_Raw(d);
+    }
+    static inline void BMS_04_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_04_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t BMS_04_BZ(const uint8_t* d)
+    {
+        return BMS_04_BZ_Raw(d);
+    }
+    static inline void BMS_04_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Status des Service Disconnect, ob dieser gesteckt oder gezogen ist. Abhaengigkeiten zu anderen Signalen: BMS_Fehler_Sicherung und BMS_Fehler_Pilot
+    // 13|1@1+ (1,0) [0|1] "" Receiver: DCDC_800V_PAG,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Status_ServiceDisconnect_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 5) & 0x1);
+    }
+    static constexpr uint32_t BMS_Status_ServiceDisconnect(const uint8_t* d)
+    {
+        return BMS_Status_ServiceDisconnect_Raw(d);
+    }
+    static inline void BMS_Status_ServiceDisconnect_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // 0=Init (ohne Funktion) 1=BMS Zwischenkreis spannungsfrei (U_Zwkr < 20V) 2=BMS Zwischenkreis nicht spannungsfrei (U_Zwkr >/= 25V, Hysterese) 3=Fehler (z.B. Fehler in der Sensorik)
+    // 14|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Status_Spgfreiheit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 6);
+    }
+    static constexpr uint32_t BMS_Status_Spgfreiheit(const uint8_t* d)
+    {
+        return BMS_Status_Spgfreiheit_Raw(d);
+    }
+    static inline void BMS_Status_Spgfreiheit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // Anforderung MIL (MalfunctionIndicationLamp) von BMS (Motorsteuergeraet reicht diese Info an Kombi weiter).
+    // 16|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_OBD_Lampe_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] & 0x1);
+    }
+    static constexpr uint32_t BMS_OBD_Lampe_Anf(const uint8_t* d)
+    {
+        return BMS_OBD_Lampe_Anf_Raw(d);
+    }
+    static inline void BMS_OBD_Lampe_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFE) | (raw & 0x1));
+    }
+
+    // Aktueller Betriebsmodus der Batterie 0: Standby; Schuetze geoeffnet; Kommunikation aktiv 1: Hauptschuetze geschlossen / HV-Netz aktiviert / normaler Fahrbetrieb 2: projektabhaengig belegt (z.B. Balancing, erweitertes DC-Schnelladen) 3: externes Laden
+    // 17|3@1+ (1,0) [0|7] "" Receiver: AWC,Gateway,Gateway_PAG,Ladegeraet_Konzern,LE1,LE2,LE2_3_MLBevo_LB,Sub_Gateway,TME
+    static constexpr uint32_t BMS_IstModus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 1) & 0x7);
+    }
+    static constexpr uint32_t BMS_IstModus(const uint8_t* d)
+    {
+        return BMS_IstModus_Raw(d);
+    }
+    static inline void BMS_IstModus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF1) | ((raw << 1) & 0xE));
+    }
+
+    // aktueller Fehlerstatus der Batterie
+    // 20|3@1+ (1,0) [0|7] "" Receiver: AWC,DCDC_800V_PAG,DCDC_HV,Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t BMS_Fehlerstatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x7);
+    }
+    static constexpr uint32_t BMS_Fehlerstatus(const uint8_t* d)
+    {
+        return BMS_Fehlerstatus_Raw(d);
+    }
+    static inline void BMS_Fehlerstatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // Nutzbare Kapazitaet der Batterie, oder alterungsabhaengige absolute Gesamtkapazitaet der Batterie. Projektabhaengig kann die Kapazitaet auf das nutzbare SOC-Fenster (zwischen oberer und unterer SOC-Grenze) bezogen sein, wobei sich dieses SOC-Fenster alteru
+    // 23|11@1+ (0.2,0) [0|409.2] "Unit_AmperHour" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t BMS_Kapazitaet_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7) |
+               (static_cast<uint32_t>(d[3]) << 1) |
+               (static_cast<uint32_t>(d[4] & 0x3) << 9);
+    }
+    static constexpr float BMS_Kapazitaet_02(const uint8_t* d)
+    {
+        return BMS_Kapazitaet_02_Raw(d) * 0.2f;
+    }
+    static inline void BMS_Kapazitaet_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+        d[3] = static_cast<uint8_t>((raw >> 1));
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | ((raw >> 9) & 0x3));
+    }
+
+    // Der Sollwert fuer den HV-Batterie-SOC bei einer SOC-steuernden Betriebsstrategie
+    // 53|11@1+ (0.05,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Soll_SOC_HiRes_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 5) |
+               (static_cast<uint32_t>(d[7]) << 3);
+    }
+    static constexpr float BMS_Soll_SOC_HiRes(const uint8_t* d)
+    {
+        return BMS_Soll_SOC_HiRes_Raw(d) * 0.05f;
+    }
+    static inline void BMS_Soll_SOC_HiRes_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x1F) | ((raw << 5) & 0xE0));
+        d[7] = static_cast<uint8_t>((raw >> 3));
+    }
+};
+
+// BMS_07 Sender: BMC_MLBevo
+struct BMS_07
+{
+    enum : uint32_t
+    {
+        ID = 0x5CA,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_07_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t BMS_07_CRC(const uint8_t* d)
+    {
+        return BMS_07_CRC_Raw(d);
+    }
+    static inline void BMS_07_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_07_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t BMS_07_BZ(const uint8_t* d)
+    {
+        return BMS_07_BZ_Raw(d);
+    }
+    static inline void BMS_07_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // aktuell nutzbarer Energieinhalt der HV-Batterie (bezogen auf ein definiertes mittleres Belastungsprofil)
+    // 12|11@1+ (50,0) [0|102250] "Unit_WattHour" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t BMS_Energieinhalt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2] & 0x7F) << 4);
+    }
+    static constexpr int32_t BMS_Energieinhalt(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_Energieinhalt_Raw(d)) * 50;
+    }
+    static inline void BMS_Energieinhalt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((d[2] & 0x80) | ((raw >> 4) & 0x7F));
+    }
+
+    // Signalisiert aktiven Ladevorgang, Ladegeraet und DC/DC aktiv. Signal bleibt nach Kl.15 ein aktiv, bis ESP_Stillstandsflag geloescht. Abhaengigkeit zu BMS_Energieinhalt
+    // 23|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Ladevorgang_aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7);
+    }
+    static constexpr uint32_t BMS_Ladevorgang_aktiv(const uint8_t* d)
+    {
+        return BMS_Ladevorgang_aktiv_Raw(d);
+    }
+    static inline void BMS_Ladevorgang_aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Anzeige von Textwarnungen
+    // 24|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Batteriediagnose_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x7);
+    }
+    static constexpr uint32_t BMS_Batteriediagnose(const uint8_t* d)
+    {
+        return BMS_Batteriediagnose_Raw(d);
+    }
+    static inline void BMS_Batteriediagnose_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xF8) | (raw & 0x7));
+    }
+
+    // Freigabe der Komponente, dass eine maximale Leistung zur Verfuegung gestellt werden kann.
+    // 27|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Freig_max_Performanz_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 3) & 0x3);
+    }
+    static constexpr uint32_t BMS_Freig_max_Performanz(const uint8_t* d)
+    {
+        return BMS_Freig_max_Performanz_Raw(d);
+    }
+    static inline void BMS_Freig_max_Performanz_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xE7) | ((raw << 3) & 0x18));
+    }
+
+    // Signal zeigt an, ob mindestens eine Zelle der HV Batterie balanciert wird
+    // 30|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Balancing_Aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 6);
+    }
+    static constexpr uint32_t BMS_Balancing_Aktiv(const uint8_t* d)
+    {
+        return BMS_Balancing_Aktiv_Raw(d);
+    }
+    static inline void BMS_Balancing_Aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // maximaler nutzbarer Energieinhalt der HV-Batterie (bezogen auf Last KBI_RWDS_Lastprofil bei SOC=100%) Abhaengig von KBI_RWDS_Lastprofil
+    // 32|11@1+ (50,0) [0|102250] "Unit_WattHour" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t BMS_MaxEnergieinhalt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]) |
+               (static_cast<uint32_t>(d[5] & 0x7) << 8);
+    }
+    static constexpr int32_t BMS_MaxEnergieinhalt(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_MaxEnergieinhalt_Raw(d)) * 50;
+    }
+    static inline void BMS_MaxEnergieinhalt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+        d[5] = static_cast<uint8_t>((d[5] & 0xF8) | ((raw >> 8) & 0x7));
+    }
+
+    // BMS wuenscht eine Ausgleichsladung Flag derzeit ungenutzt, da BalancingModus im Detail noch nicht geklaert.
+    // 43|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Ausgleichsladung_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 3) & 0x1);
+    }
+    static constexpr uint32_t BMS_Ausgleichsladung_Anf(const uint8_t* d)
+    {
+        return BMS_Ausgleichsladung_Anf_Raw(d);
+    }
+    static inline void BMS_Ausgleichsladung_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // 0 = Funktion nicht aktiviert 1 = HV-System spannungsfrei (U_Zwkr von BMS, LE und Ladegeraet < 20V, DCLadestecker nicht gesteckt und Service Disconnect entriegelt) 2 = HV-System nicht spannungsfrei (U_Zwkr von BMS, LE und Ladegeraet >= 20V, Ladestecker ges
+    // 44|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Gesamtst_Spgfreiheit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 4) & 0x3);
+    }
+    static constexpr uint32_t BMS_Gesamtst_Spgfreiheit(const uint8_t* d)
+    {
+        return BMS_Gesamtst_Spgfreiheit_Raw(d);
+    }
+    static inline void BMS_Gesamtst_Spgfreiheit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Minimum des Isolationswiderstands zwischen Batteriegehaeuse und HV+ bzw. Batteriegehaeuse und HV- bei geschlossenen Schuetzen (externe Iso Messung)
+    // 46|12@1+ (5,0) [0|20465] "Unit_KiloOhm" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_RIso_Ext_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 6) |
+               (static_cast<uint32_t>(d[6]) << 2) |
+               (static_cast<uint32_t>(d[7] & 0x3) << 10);
+    }
+    static constexpr int32_t BMS_RIso_Ext(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_RIso_Ext_Raw(d)) * 5;
+    }
+    static inline void BMS_RIso_Ext_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x3F) | ((raw << 6) & 0xC0));
+        d[6] = static_cast<uint8_t>((raw >> 2));
+        d[7] = static_cast<uint8_t>((d[7] & 0xFC) | ((raw >> 10) & 0x3));
+    }
+
+    // Kunden Warnung aufgrund eines Batteriefehlers
+    // 58|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_KundenWarnung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 2) & 0x3);
+    }
+    static constexpr uint32_t BMS_KundenWarnung(const uint8_t* d)
+    {
+        return BMS_KundenWarnung_Raw(d);
+    }
+    static inline void BMS_KundenWarnung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF3) | ((raw << 2) & 0xC));
+    }
+
+    // Bei einer Leckage im Kuehlkreislauf wird dieser Fehler gesetzt.
+    // 60|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t BMS_Fehler_KuehlkreislaufLeckage_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 4) & 0x3);
+    }
+    static constexpr uint32_t BMS_Fehler_KuehlkreislaufLeckage(const uint8_t* d)
+    {
+        return BMS_Fehler_KuehlkreislaufLeckage_Raw(d);
+    }
+    static inline void BMS_Fehler_KuehlkreislaufLeckage_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xCF) | ((raw << 4) & 0x30));
+    }
+};
+
+// DCDC_03 Sender: DCDC_800V_PAG
+struct DCDC_03
+{
+    enum : uint32_t
+    {
+        ID = 0x5CD,
+        DLC = 8
+    };
+
+    // Fuer MLB: 'Berechnung siehe Lastenheft 'Kommunikationsabsicherung fuer FlexRay und CAN'' Ab MQB und MLBevo: 'Berechnung siehe Lastenheft 'End-to-End Kommunikationsabsicherung'' Endwerte siehe Begleitdokument 'S-PDU Kennungsfolgen'
+    // 0|8@1+ (1,0) [0|255] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t DCDC_03_CRC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]);
+    }
+    static constexpr uint32_t DCDC_03_CRC(const uint8_t* d)
+    {
+        return DCDC_03_CRC_Raw(d);
+    }
+    static inline void DCDC_03_CRC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+    }
+
+    // 8|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t DCDC_03_BZ_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr uint32_t DCDC_03_BZ(const uint8_t* d)
+    {
+        return DCDC_03_BZ_Raw(d);
+    }
+    static inline void DCDC_03_BZ_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // aktueller Fehlerstatus des DCDC-Wandler:
+    // 16|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t DC_Fehlerstatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] & 0x7);
+    }
+    static constexpr uint32_t DC_Fehlerstatus(const uint8_t* d)
+    {
+        return DC_Fehlerstatus_Raw(d);
+    }
+    static inline void DC_Fehlerstatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF8) | (raw & 0x7));
+    }
+
+    // Peakstrom verfuegbar/nicht verfuegbar
+    // 19|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t DC_Peakstrom_verfuegbar_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 3) & 0x1);
+    }
+    static constexpr uint32_t DC_Peakstrom_verfuegbar(const uint8_t* d)
+    {
+        return DC_Peakstrom_verfuegbar_Raw(d);
+    }
+    static inline void DC_Peakstrom_verfuegbar_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Abregelung aufgrund Uebertemperatur im Leistungsteil (Hochtemperatur-Abregelung)
+    // 20|1@1+ (1,0) [0|1] "" Receiver: Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t DC_Abregelung_Temperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x1);
+    }
+    static constexpr uint32_t DC_Abregelung_Temperatur(const uint8_t* d)
+    {
+        return DC_Abregelung_Temperatur_Raw(d);
+    }
+    static inline void DC_Abregelung_Temperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // aktuelle Betriebsart des DC/DC Wandlers; 0: Standby; Kommunikation aktiv 1: HV_On_Vorladen 2: Tiefsetzen 3: Hochsetzen 4: Pruefimpuls_12V 5: interner Fehler DC/DC-Wandler / angeforderter Sollmodus kann nicht eingestellt werden 6: reserve 7: Initia
+    // 21|3@1+ (1,0) [0|7] "" Receiver: DCDC_HV_02,Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t DC_IstModus_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 5);
+    }
+    static constexpr uint32_t DC_IstModus_02(const uint8_t* d)
+    {
+        return DC_IstModus_02_Raw(d);
+    }
+    static inline void DC_IstModus_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // Aktuelle Betriebsart des DC/DC Wandlers 800V/400V; 0: Standby 1: Reserve 2: Tiefsetzen 3: Hochsetzen 4: Reserve 5: Fehler 6: Reserve 7: Initialisierung
+    // 28|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t DC_HV_EKK_IstModus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 4) & 0x7);
+    }
+    static constexpr uint32_t DC_HV_EKK_IstModus(const uint8_t* d)
+    {
+        return DC_HV_EKK_IstModus_Raw(d);
+    }
+    static inline void DC_HV_EKK_IstModus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // HV DC/DC-Wandler Status HV-Spannungsfreiheit
+    // 46|2@1+ (1,0) [0|3] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t DC_Status_Spgfreiheit_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 6);
+    }
+    static constexpr uint32_t DC_Status_Spgfreiheit_HV(const uint8_t* d)
+    {
+        return DC_Status_Spgfreiheit_HV_Raw(d);
+    }
+    static inline void DC_Status_Spgfreiheit_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // Ausgangsspannung des Kombiwandlers am 400V-Anschluss
+    // 48|8@1+ (2,0) [0|508] "Unit_Volt" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t DC_IstSpannung_EKK_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6]);
+    }
+    static constexpr int32_t DC_IstSpannung_EKK_HV(const uint8_t* d)
+    {
+        return static_cast<int32_t>(DC_IstSpannung_EKK_HV_Raw(d)) * 2;
+    }
+    static inline void DC_IstSpannung_EKK_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>(raw);
+    }
+
+    // Momentanwert: Temperatur des DC/DC Wandlers
+    // 56|8@1+ (1,-40) [-40|213] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
+    static constexpr uint32_t DC_Temperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7]);
+    }
+    static constexpr int32_t DC_Temperatur(const uint8_t* d)
+    {
+        return static_cast<int32_t>(DC_Temperatur_Raw(d)) + -40;
+    }
+    static inline void DC_Temperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>(raw);
+    }
+};
+
+// BMS_02 Sender: BMC_MLBevo
+struct BMS_02
+{
+    enum : uint32_t
+    {
+        ID = 0x1A1,
+        DLC = 8
+    };
+
+    // Nachkommastelle BMS_MaxDyn_LadeStrom_02
+    // 8|4@1+ (0.0625,0) [0|0.9375] "Unit_Amper" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_MaxDyn_LadeStrom_02_Offset_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr float BMS_MaxDyn_LadeStrom_02_Offset(const uint8_t* d)
+    {
+        return BMS_MaxDyn_LadeStrom_02_Offset_Raw(d) * 0.0625f;
+    }
+    static inline void BMS_MaxDyn_LadeStrom_02_Offset_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // max current (discharge) maximal zulaessiger Entladestrom (zwingend einzuhaltender Grenzwert); Wert ist fuer eine Dauer von 1s garantiert
+    // 12|11@1+ (1,0) [0|2045] "Unit_Amper" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MaxDyn_EntladeStrom_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2] & 0x7F) << 4);
+    }
+    static constexpr uint32_t BMS_MaxDyn_EntladeStrom_02(const uint8_t* d)
+    {
+        return BMS_MaxDyn_EntladeStrom_02_Raw(d);
+    }
+    static inline void BMS_MaxDyn_EntladeStrom_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((d[2] & 0x80) | ((raw >> 4) & 0x7F));
+    }
+
+    // max current (charge) maximal zulaessiger Ladestrom (zwingend einzuhaltender Grenzwert); Wert ist fuer eine Dauer von 1s garantiert (Im Balancing-Mode wird ueber diesen Wert der Ladestrom-Sollwert angegeben)
+    // 23|11@1+ (1,0) [0|2045] "Unit_Amper" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,Ladegeraet_Konzern,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MaxDyn_LadeStrom_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7) |
+               (static_cast<uint32_t>(d[3]) << 1) |
+               (static_cast<uint32_t>(d[4] & 0x3) << 9);
+    }
+    static constexpr uint32_t BMS_MaxDyn_LadeStrom_02(const uint8_t* d)
+    {
+        return BMS_MaxDyn_LadeStrom_02_Raw(d);
+    }
+    static inline void BMS_MaxDyn_LadeStrom_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+        d[3] = static_cast<uint8_t>((raw >> 1));
+        d[4] = static_cast<uint8_t>((d[4] & 0xFC) | ((raw >> 9) & 0x3));
+    }
+
+    // min. voltage / minimal erlaubte Batteriespannung (zwingend einzuhaltender Grenzwert)
+    // 34|10@1+ (1,0) [0|1021] "Unit_Volt" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,Ladegeraet_Konzern,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_Min_EntladeSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 2) |
+               (static_cast<uint32_t>(d[5] & 0xF) << 6);
+    }
+    static constexpr uint32_t BMS_Min_EntladeSpannung(const uint8_t* d)
+    {
+        return BMS_Min_EntladeSpannung_Raw(d);
+    }
+    static inline void BMS_Min_EntladeSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3) | ((raw << 2) & 0xFC));
+        d[5] = static_cast<uint8_t>((d[5] & 0xF0) | ((raw >> 6) & 0xF));
+    }
+
+    // min. voltage during discharge with current MaxDyn_EntladeStrom resp. iDisChMax / rechnerischer Wert: minimales, fuer eine Dauer von ~1s garantiertes Spannungsniveau, das unter Belastung mit MaxDyn_EntladeStrom bzw. iDisChMax nicht unterschritten werden wuer
+    // 44|10@1+ (1,0) [0|1022] "Unit_Volt" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MinDyn_EntladeSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 4) |
+               (static_cast<uint32_t>(d[6] & 0x3F) << 4);
+    }
+    static constexpr uint32_t BMS_MinDyn_EntladeSpannung(const uint8_t* d)
+    {
+        return BMS_MinDyn_EntladeSpannung_Raw(d);
+    }
+    static inline void BMS_MinDyn_EntladeSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF) | ((raw << 4) & 0xF0));
+        d[6] = static_cast<uint8_t>((d[6] & 0xC0) | ((raw >> 4) & 0x3F));
+    }
+
+    // min. voltage during charge with current MaxDyn_LadeStrom resp. iChMax / rechnerischer Wert: minimales, fuer eine Dauer von ~1s garantiertes Spannungsniveau, das unter Belastung mit MaxDyn_LadeStrom bzw. iChMax nicht unterschritten werden wuerde
+    // 54|10@1+ (1,0) [0|1022] "Unit_Volt" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MinDyn_LadeSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6) |
+               (static_cast<uint32_t>(d[7]) << 2);
+    }
+    static constexpr uint32_t BMS_MinDyn_LadeSpannung(const uint8_t* d)
+    {
+        return BMS_MinDyn_LadeSpannung_Raw(d);
+    }
+    static inline void BMS_MinDyn_LadeSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+        d[7] = static_cast<uint8_t>((raw >> 2));
+    }
+};
+
+// BMS_03 Sender: BMC_MLBevo
+struct BMS_03
+{
+    enum : uint32_t
+    {
+        ID = 0x39D,
+        DLC = 8
+    };
+
+    // Leerlaufspannung der Gesamtbatterie, Open Circuit Voltage of the battery system
+    // 0|10@1+ (1,0) [0|1022] "Unit_Volt" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG
+    static constexpr uint32_t BMS_Leerlaufspannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]) |
+               (static_cast<uint32_t>(d[1] & 0x3) << 8);
+    }
+    static constexpr uint32_t BMS_Leerlaufspannung(const uint8_t* d)
+    {
+        return BMS_Leerlaufspannung_Raw(d);
+    }
+    static inline void BMS_Leerlaufspannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+        d[1] = static_cast<uint8_t>((d[1] & 0xFC) | ((raw >> 8) & 0x3));
+    }
+
+    // max. voltage / maximal erlaubte Batteriespannung (zwingend einzuhaltender Grenzwert)
+    // 12|10@1+ (1,0) [0|1021] "Unit_Volt" Receiver: AWC,FCU_MLBevo_FCEV,Gateway,Gateway_PAG,Ladegeraet_2,Ladegeraet_Konzern,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_Max_LadeSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2] & 0x3F) << 4);
+    }
+    static constexpr uint32_t BMS_Max_LadeSpannung(const uint8_t* d)
+    {
+        return BMS_Max_LadeSpannung_Raw(d);
+    }
+    static inline void BMS_Max_LadeSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((d[2] & 0xC0) | ((raw >> 4) & 0x3F));
+    }
+
+    // dynamic el. limit, max. current (discharge) for the specified time (e.g. 10s): and the voltage limit (only for prediction) rechnerischer Wert: quasistationaerer, fuer eine Dauer von z.B. 10s garantierter maximaler Entladestrom
+    // 22|11@1+ (1,0) [0|2045] "Unit_Amper" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MaxPred_EntladeStrom_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 6) |
+               (static_cast<uint32_t>(d[3]) << 2) |
+               (static_cast<uint32_t>(d[4] & 0x1) << 10);
+    }
+    static constexpr uint32_t BMS_MaxPred_EntladeStrom_02(const uint8_t* d)
+    {
+        return BMS_MaxPred_EntladeStrom_02_Raw(d);
+    }
+    static inline void BMS_MaxPred_EntladeStrom_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x3F) | ((raw << 6) & 0xC0));
+        d[3] = static_cast<uint8_t>((raw >> 2));
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | ((raw >> 10) & 0x1));
+    }
+
+    // dynamic el. limit, max. current (charge) for the specified time (e.g. 10s), and the voltage limit (only for prediction) rechnerischer Wert: quasistationaerer, fuer eine Dauer von z.B. 10s garantierter maximaler Ladestrom EV / PlugIn: externes Laden (BMS
+    // 33|11@1+ (1,0) [0|2045] "Unit_Amper" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,Ladegeraet_Konzern,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MaxPred_LadeStrom_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 1) |
+               (static_cast<uint32_t>(d[5] & 0xF) << 7);
+    }
+    static constexpr uint32_t BMS_MaxPred_LadeStrom_02(const uint8_t* d)
+    {
+        return BMS_MaxPred_LadeStrom_02_Raw(d);
+    }
+    static inline void BMS_MaxPred_LadeStrom_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x1) | ((raw << 1) & 0xFE));
+        d[5] = static_cast<uint8_t>((d[5] & 0xF0) | ((raw >> 7) & 0xF));
+    }
+
+    // static el. limit, min. battery voltage (~10s) during current MaxPred_EntladeStrom resp iDisChPredMax / rechnerischer Wert: minimales, fuer eine Dauer von 10s garantiertes Spannungsniveau, das unter Belastung mit MaxPred_EntladeStrom bzw. iDisChPredMax nich
+    // 44|10@1+ (1,0) [0|1022] "Unit_Volt" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,Ladegeraet_Konzern,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MinPred_EntladeSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 4) |
+               (static_cast<uint32_t>(d[6] & 0x3F) << 4);
+    }
+    static constexpr uint32_t BMS_MinPred_EntladeSpannung(const uint8_t* d)
+    {
+        return BMS_MinPred_EntladeSpannung_Raw(d);
+    }
+    static inline void BMS_MinPred_EntladeSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF) | ((raw << 4) & 0xF0));
+        d[6] = static_cast<uint8_t>((d[6] & 0xC0) | ((raw >> 4) & 0x3F));
+    }
+
+    // static el. limit, min. battery voltage (~10s) during current MaxPred_LadeStrom resp. iChPredMax / rechnerischer Wert: minimales, fuer eine Dauer von ~10s garantiertes Spannungsniveau, das unter Belastung mit MaxPred_LadeStrom bzw. iChPredMax nicht untersch
+    // 54|10@1+ (1,0) [0|1022] "Unit_Volt" Receiver: FCU_MLBevo_FCEV,Gateway,Gateway_PAG,LE2_3_MLBevo_LB
+    static constexpr uint32_t BMS_MinPred_LadeSpannung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6) |
+               (static_cast<uint32_t>(d[7]) << 2);
+    }
+    static constexpr uint32_t BMS_MinPred_LadeSpannung(const uint8_t* d)
+    {
+        return BMS_MinPred_LadeSpannung_Raw(d);
+    }
+    static inline void BMS_MinPred_LadeSpannung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+        d[7] = static_cast<uint8_t>((raw >> 2));
+    }
+};
+
+// BMS_10 Sender: BMC_MLBevo
+struct BMS_10
+{
+    enum : uint32_t
+    {
+        ID = 0x509,
+        DLC = 8
+    };
+
+    // aktuell nutzbarer Energieinhalt der HV-Batterie (bezogen auf ein definiertes mittleres Belastungsprofil)
+    // 0|15@1+ (4,0) [0|131060] "Unit_WattHour" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Energieinhalt_HiRes_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]) |
+               (static_cast<uint32_t>(d[1] & 0x7F) << 8);
+    }
+    static constexpr int32_t BMS_Energieinhalt_HiRes(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_Energieinhalt_HiRes_Raw(d)) * 4;
+    }
+    static inline void BMS_Energieinhalt_HiRes_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+        d[1] = static_cast<uint8_t>((d[1] & 0x80) | ((raw >> 8) & 0x7F));
+    }
+
+    // maximal nutzbarer Energieinhalt der HV-Batterie (bezogen auf ein definiertes mittleres Belastungsprofil)
+    // 15|15@1+ (4,0) [0|131060] "Unit_WattHour" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_MaxEnergieinhalt_HiRes_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7) |
+               (static_cast<uint32_t>(d[2]) << 1) |
+               (static_cast<uint32_t>(d[3] & 0x3F) << 9);
+    }
+    static constexpr int32_t BMS_MaxEnergieinhalt_HiRes(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_MaxEnergieinhalt_HiRes_Raw(d)) * 4;
+    }
+    static inline void BMS_MaxEnergieinhalt_HiRes_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+        d[2] = static_cast<uint8_t>((raw >> 1));
+        d[3] = static_cast<uint8_t>((d[3] & 0xC0) | ((raw >> 9) & 0x3F));
+    }
+
+    // Aktueller relativer Ladezustand der HV-Batterie
+    // 30|8@1+ (0.5,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t BMS_NutzbarerSOC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 6) |
+               (static_cast<uint32_t>(d[4] & 0x3F) << 2);
+    }
+    static constexpr float BMS_NutzbarerSOC(const uint8_t* d)
+    {
+        return BMS_NutzbarerSOC_Raw(d) * 0.5f;
+    }
+    static inline void BMS_NutzbarerSOC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x3F) | ((raw << 6) & 0xC0));
+        d[4] = static_cast<uint8_t>((d[4] & 0xC0) | ((raw >> 2) & 0x3F));
+    }
+
+    // Restenergieinhalt der Traktionsbatterie, bezogen auf die Betriebsstrategiegrenzen
+    // 38|12@1+ (25,0) [0|102325] "Unit_WattHour" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_NutzbarerEnergieinhalt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 6) |
+               (static_cast<uint32_t>(d[5]) << 2) |
+               (static_cast<uint32_t>(d[6] & 0x3) << 10);
+    }
+    static constexpr int32_t BMS_NutzbarerEnergieinhalt(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_NutzbarerEnergieinhalt_Raw(d)) * 25;
+    }
+    static inline void BMS_NutzbarerEnergieinhalt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3F) | ((raw << 6) & 0xC0));
+        d[5] = static_cast<uint8_t>((raw >> 2));
+        d[6] = static_cast<uint8_t>((d[6] & 0xFC) | ((raw >> 10) & 0x3));
+    }
+
+    // Indikator Stromintegral in Entladerichtung. 0% = Start abrampen Peak-Entladestromgrenze auf Dauer-Entladestromgrenze. 100% = Voller Peak-Entladestrom verfuegbar
+    // 50|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Pred_Entladeperformance_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 2) |
+               (static_cast<uint32_t>(d[7] & 0x1) << 6);
+    }
+    static constexpr uint32_t BMS_Pred_Entladeperformance(const uint8_t* d)
+    {
+        return BMS_Pred_Entladeperformance_Raw(d);
+    }
+    static inline void BMS_Pred_Entladeperformance_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3) | ((raw << 2) & 0xFC));
+        d[7] = static_cast<uint8_t>((d[7] & 0xFE) | ((raw >> 6) & 0x1));
+    }
+
+    // Indikator Stromintegral in Laderichtung. 0% = Start abrampen Peak-Ladestromgrenze auf Dauer-Ladestromgrenze. 100% = Voller Peak-Ladestrom verfuegbar
+    // 57|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_Pred_Ladeperformance_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 1);
+    }
+    static constexpr uint32_t BMS_Pred_Ladeperformance(const uint8_t* d)
+    {
+        return BMS_Pred_Ladeperformance_Raw(d);
+    }
+    static inline void BMS_Pred_Ladeperformance_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x1) | ((raw << 1) & 0xFE));
+    }
+};
+
+// HVEM_05 Sender: Gateway
+struct HVEM_05
+{
+    enum : uint32_t
+    {
+        ID = 0x552,
+        DLC = 8
+    };
+
+    // HV-Lademanagement benoetigt die Energiemenge fuer das Laden der 12V Batterie, um die Ladezeit zu berechnen
+    // 12|8@1+ (25,0) [0|6325] "Unit_WattHour" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HVEM_NVNachladen_Energie_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4) |
+               (static_cast<uint32_t>(d[2] & 0xF) << 4);
+    }
+    static constexpr int32_t HVEM_NVNachladen_Energie(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVEM_NVNachladen_Energie_Raw(d)) * 25;
+    }
+    static inline void HVEM_NVNachladen_Energie_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+        d[2] = static_cast<uint8_t>((d[2] & 0xF0) | ((raw >> 4) & 0xF));
+    }
+
+    // Betriebslaufzeit der Standklimatisierung
+    // 26|6@1+ (1,0) [0|60] "Unit_Minut" Receiver: TME
+    static constexpr uint32_t HVEM_Max_VK_Betriebsdauer_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 2);
+    }
+    static constexpr uint32_t HVEM_Max_VK_Betriebsdauer(const uint8_t* d)
+    {
+        return HVEM_Max_VK_Betriebsdauer_Raw(d);
+    }
+    static inline void HVEM_Max_VK_Betriebsdauer_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x3) | ((raw << 2) & 0xFC));
+    }
+
+    // Anforderung fuer HV Laden bei gestecktem Stecker und deaktivierter Ladeanforderung
+    // 32|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HVEM_Nachladen_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x1);
+    }
+    static constexpr uint32_t HVEM_Nachladen_Anf(const uint8_t* d)
+    {
+        return HVEM_Nachladen_Anf_Raw(d);
+    }
+    static inline void HVEM_Nachladen_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | (raw & 0x1));
+    }
+
+    // Sollstrom Laden auf der HV-Seite
+    // 33|11@1+ (0.2,-204.4) [-204.4|204.6] "Unit_Amper" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HVEM_SollStrom_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 1) |
+               (static_cast<uint32_t>(d[5] & 0xF) << 7);
+    }
+    static constexpr float HVEM_SollStrom_HV(const uint8_t* d)
+    {
+        return HVEM_SollStrom_HV_Raw(d) * 0.2f + -204.4f;
+    }
+    static inline void HVEM_SollStrom_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x1) | ((raw << 1) & 0xFE));
+        d[5] = static_cast<uint8_t>((d[5] & 0xF0) | ((raw >> 7) & 0xF));
+    }
+
+    // maximale Ladespannung an das Ladegeraet bzw. DC-Ladestation
+    // 44|10@1+ (1,0) [0|1021] "Unit_Volt" Receiver: Vector__XXX
+    static constexpr uint32_t HVEM_MaxSpannung_HV_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 4) |
+               (static_cast<uint32_t>(d[6] & 0x3F) << 4);
+    }
+    static constexpr uint32_t HVEM_MaxSpannung_HV(const uint8_t* d)
+    {
+        return HVEM_MaxSpannung_HV_Raw(d);
+    }
+    static inline void HVEM_MaxSpannung_HV_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF) | ((raw << 4) & 0xF0));
+        d[6] = static_cast<uint8_t>((d[6] & 0xC0) | ((raw >> 4) & 0x3F));
+    }
+
+    // Status der Reduzierungsstufen der Klimakomponenten beim Laden 0 = 100% (keine Reduzierung) 1 = 75% 2 = 50% 3 = 25% 7 = Init
+    // 54|3@1+ (1,0) [0|7] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HVEM_Abschaltstatus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6) |
+               (static_cast<uint32_t>(d[7] & 0x1) << 2);
+    }
+    static constexpr uint32_t HVEM_Abschaltstatus(const uint8_t* d)
+    {
+        return HVEM_Abschaltstatus_Raw(d);
+    }
+    static inline void HVEM_Abschaltstatus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+        d[7] = static_cast<uint8_t>((d[7] & 0xFE) | ((raw >> 2) & 0x1));
+    }
+
+    // Freigabe des DCDC wenn das Fzg nicht Fahrbereit ist.
+    // 57|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HVEM_DCDC_Freigabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 1) & 0x1);
+    }
+    static constexpr uint32_t HVEM_DCDC_Freigabe(const uint8_t* d)
+    {
+        return HVEM_DCDC_Freigabe_Raw(d);
+    }
+    static inline void HVEM_DCDC_Freigabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Klimatisierung freigeben
+    // 58|2@1+ (1,0) [0|3] "" Receiver: TME
+    static constexpr uint32_t HVEM_FreigabeKlimatisierung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 2) & 0x3);
+    }
+    static constexpr uint32_t HVEM_FreigabeKlimatisierung(const uint8_t* d)
+    {
+        return HVEM_FreigabeKlimatisierung_Raw(d);
+    }
+    static inline void HVEM_FreigabeKlimatisierung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF3) | ((raw << 2) & 0xC));
+    }
+};
+
+// HVEM_02 Sender: Gateway
+struct HVEM_02
+{
+    enum : uint32_t
+    {
+        ID = 0x5AC,
+        DLC = 8
+    };
+
+    // Iststromaufnahme der elektrischen Nebenaggregate aus dem HV Zwischenkreis
+    // 0|12@1+ (0.1,-204.7) [-204.7|204.6] "Unit_Amper" Receiver: Vector__XXX
+    static constexpr uint32_t HVEM_IstStrom_HVVerbraucher_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0]) |
+               (static_cast<uint32_t>(d[1] & 0xF) << 8);
+    }
+    static constexpr float HVEM_IstStrom_HVVerbraucher(const uint8_t* d)
+    {
+        return HVEM_IstStrom_HVVerbraucher_Raw(d) * 0.1f + -204.7f;
+    }
+    static inline void HVEM_IstStrom_HVVerbraucher_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>(raw);
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // Erweiterte Aufloesung von 10Wh fuer Signal HVEM_Energie_Klima_Vorgabe. Signalwert wird zu HVEM_Energie_Klima_Vorgabe Addiert
+    // 12|3@1+ (10,0) [0|50] "Unit_WattHour" Receiver: TME
+    static constexpr uint32_t HVEM_Energie_Klima_Vorgabe_HighR_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x7);
+    }
+    static constexpr int32_t HVEM_Energie_Klima_Vorgabe_HighR(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVEM_Energie_Klima_Vorgabe_HighR_Raw(d)) * 10;
+    }
+    static inline void HVEM_Energie_Klima_Vorgabe_HighR_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // aktuelle Leistungsaufnahme der Nebenaggregate
+    // 15|9@1+ (50,0) [0|25450] "Unit_Watt" Receiver: Vector__XXX
+    static constexpr uint32_t HVEM_IstLeistungNA_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7) |
+               (static_cast<uint32_t>(d[2]) << 1);
+    }
+    static constexpr int32_t HVEM_IstLeistungNA(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVEM_IstLeistungNA_Raw(d)) * 50;
+    }
+    static inline void HVEM_IstLeistungNA_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+        d[2] = static_cast<uint8_t>((raw >> 1));
+    }
+
+    // Leistungsvorgabe Thermo (fuer Kuehlen und Heizen)
+    // 24|8@1+ (50,0) [0|12650] "Unit_Watt" Receiver: TME
+    static constexpr uint32_t HVEM_Leistung_Klima_Vorgabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]);
+    }
+    static constexpr int32_t HVEM_Leistung_Klima_Vorgabe(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVEM_Leistung_Klima_Vorgabe_Raw(d)) * 50;
+    }
+    static inline void HVEM_Leistung_Klima_Vorgabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+    }
+
+    // Nutzbare Energie welche fuer Komfortfunktionen vom HVEM freigegeben wird.
+    // 32|11@1+ (50,0) [0|102200] "Unit_WattHour" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t HVEM_Nutzbare_Energie_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]) |
+               (static_cast<uint32_t>(d[5] & 0x7) << 8);
+    }
+    static constexpr int32_t HVEM_Nutzbare_Energie(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVEM_Nutzbare_Energie_Raw(d)) * 50;
+    }
+    static inline void HVEM_Nutzbare_Energie_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+        d[5] = static_cast<uint8_t>((d[5] & 0xF8) | ((raw >> 8) & 0x7));
+    }
+
+    // HVEM-Energievorgabe fuer Klima-Vorkonditionierung
+    // 43|8@1+ (50,0) [0|12650] "Unit_WattHour" Receiver: TME
+    static constexpr uint32_t HVEM_Energie_Klima_Vorgabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 3) |
+               (static_cast<uint32_t>(d[6] & 0x7) << 5);
+    }
+    static constexpr int32_t HVEM_Energie_Klima_Vorgabe(const uint8_t* d)
+    {
+        return static_cast<int32_t>(HVEM_Energie_Klima_Vorgabe_Raw(d)) * 50;
+    }
+    static inline void HVEM_Energie_Klima_Vorgabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x7) | ((raw << 3) & 0xF8));
+        d[6] = static_cast<uint8_t>((d[6] & 0xF8) | ((raw >> 5) & 0x7));
+    }
+
+    // Rueckmeldung des HVEM ob die vorgegebene MaxLeistung vom MSG eingehalten wird.
+    // 63|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HVEM_MO_MaxLeistungIgnoriert_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 7);
+    }
+    static constexpr uint32_t HVEM_MO_MaxLeistungIgnoriert(const uint8_t* d)
+    {
+        return HVEM_MO_MaxLeistungIgnoriert_Raw(d);
+    }
+    static inline void HVEM_MO_MaxLeistungIgnoriert_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x7F) | ((raw << 7) & 0x80));
+    }
+};
+
+// ZV_02 Sender: Gateway
+struct ZV_02
+{
+    enum : uint32_t
+    {
+        ID = 0x583,
+        DLC = 8
+    };
+
+    // Funktionsfreigabe Fensterheber
+    // 12|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_FH_Freigabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x1);
+    }
+    static constexpr uint32_t BCM_FH_Freigabe(const uint8_t* d)
+    {
+        return BCM_FH_Freigabe_Raw(d);
+    }
+    static inline void BCM_FH_Freigabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // globale Freigabe der Komfortfunktion
+    // 13|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_Komfortfkt_Freigabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 5) & 0x1);
+    }
+    static constexpr uint32_t BCM_Komfortfkt_Freigabe(const uint8_t* d)
+    {
+        return BCM_Komfortfkt_Freigabe_Raw(d);
+    }
+    static inline void BCM_Komfortfkt_Freigabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Handschuhkastenfreigabe
+    // 14|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_HSK_Freigabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 6) & 0x1);
+    }
+    static constexpr uint32_t BCM_HSK_Freigabe(const uint8_t* d)
+    {
+        return BCM_HSK_Freigabe_Raw(d);
+    }
+    static inline void BCM_HSK_Freigabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Freigabe Verdeckbetrieb
+    // 15|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_Verdeck_Freigabe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7);
+    }
+    static constexpr uint32_t BCM_Verdeck_Freigabe(const uint8_t* d)
+    {
+        return BCM_Verdeck_Freigabe_Raw(d);
+    }
+    static inline void BCM_Verdeck_Freigabe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Istzustand: Verriegelung Fahrzeug innen
+    // 16|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_verriegelt_intern_ist_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] & 0x1);
+    }
+    static constexpr uint32_t ZV_verriegelt_intern_ist(const uint8_t* d)
+    {
+        return ZV_verriegelt_intern_ist_Raw(d);
+    }
+    static inline void ZV_verriegelt_intern_ist_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFE) | (raw & 0x1));
+    }
+
+    // Istzustand: Verriegelung Fahrzeug aussen
+    // 17|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_verriegelt_extern_ist_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZV_verriegelt_extern_ist(const uint8_t* d)
+    {
+        return ZV_verriegelt_extern_ist_Raw(d);
+    }
+    static inline void ZV_verriegelt_extern_ist_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Sollzustand: Verriegelung Fahrzeug innen
+    // 18|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_verriegelt_intern_soll_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 2) & 0x1);
+    }
+    static constexpr uint32_t ZV_verriegelt_intern_soll(const uint8_t* d)
+    {
+        return ZV_verriegelt_intern_soll_Raw(d);
+    }
+    static inline void ZV_verriegelt_intern_soll_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Sollzustand: Verriegelung Fahrzeug aussen
+    // 19|1@1+ (1,0) [0|1] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t ZV_verriegelt_extern_soll_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 3) & 0x1);
+    }
+    static constexpr uint32_t ZV_verriegelt_extern_soll(const uint8_t* d)
+    {
+        return ZV_verriegelt_extern_soll_Raw(d);
+    }
+    static inline void ZV_verriegelt_extern_soll_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Istzustand: Fahrzeug aussen gesafet
+    // 20|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_gesafet_extern_ist_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_gesafet_extern_ist(const uint8_t* d)
+    {
+        return ZV_gesafet_extern_ist_Raw(d);
+    }
+    static inline void ZV_gesafet_extern_ist_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Sollzustand: Fahrzeug gesafet extern
+    // 21|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_gesafet_extern_soll_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZV_gesafet_extern_soll(const uint8_t* d)
+    {
+        return ZV_gesafet_extern_soll_Raw(d);
+    }
+    static inline void ZV_gesafet_extern_soll_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Einzeltuerentriegelung ZV
+    // 22|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Einzeltuerentriegelung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_Einzeltuerentriegelung(const uint8_t* d)
+    {
+        return ZV_Einzeltuerentriegelung_Raw(d);
+    }
+    static inline void ZV_Einzeltuerentriegelung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Heckdeckeleinzelentriegelung
+    // 23|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Heckeinzelentriegelung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7);
+    }
+    static constexpr uint32_t ZV_Heckeinzelentriegelung(const uint8_t* d)
+    {
+        return ZV_Heckeinzelentriegelung_Raw(d);
+    }
+    static inline void ZV_Heckeinzelentriegelung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // gespiegeltes Bit FT_Tuer_geoeffnet TSG_FT_1 Botschaft
+    // 24|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_FT_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x1);
+    }
+    static constexpr uint32_t ZV_FT_offen(const uint8_t* d)
+    {
+        return ZV_FT_offen_Raw(d);
+    }
+    static inline void ZV_FT_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFE) | (raw & 0x1));
+    }
+
+    // gespiegeltes Bit BT_Tuer_geoeffnet TSG_BT_1 Botschaft
+    // 25|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_BT_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZV_BT_offen(const uint8_t* d)
+    {
+        return ZV_BT_offen_Raw(d);
+    }
+    static inline void ZV_BT_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // gespiegeltes Bit HFS_Tuer_geoeffnet TSG_HFS_1 Botschaft
+    // 26|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HFS_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 2) & 0x1);
+    }
+    static constexpr uint32_t ZV_HFS_offen(const uint8_t* d)
+    {
+        return ZV_HFS_offen_Raw(d);
+    }
+    static inline void ZV_HFS_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // gespiegeltes Bit HBFS_Tuer_geoeffnet TSG_HBFS_1 Botschaft
+    // 27|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HBFS_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 3) & 0x1);
+    }
+    static constexpr uint32_t ZV_HBFS_offen(const uint8_t* d)
+    {
+        return ZV_HBFS_offen_Raw(d);
+    }
+    static inline void ZV_HBFS_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Status Heckdeckel
+    // 28|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HD_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_HD_offen(const uint8_t* d)
+    {
+        return ZV_HD_offen_Raw(d);
+    }
+    static inline void ZV_HD_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Status Heckscheibe
+    // 29|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_HS_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 5) & 0x1);
+    }
+    static constexpr uint32_t ZV_HS_offen(const uint8_t* d)
+    {
+        return ZV_HS_offen_Raw(d);
+    }
+    static inline void ZV_HS_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Status Innenraumueberwachung
+    // 30|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t IRUE_aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 6) & 0x1);
+    }
+    static constexpr uint32_t IRUE_aktiv(const uint8_t* d)
+    {
+        return IRUE_aktiv_Raw(d);
+    }
+    static inline void IRUE_aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Status DWA
+    // 31|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t DWA_aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 7);
+    }
+    static constexpr uint32_t DWA_aktiv(const uint8_t* d)
+    {
+        return DWA_aktiv_Raw(d);
+    }
+    static inline void DWA_aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // SBL-Schloss (MQB/MLBevo): Drehfalle Heckdeckel sonst (MQB): Hauptraste Heckdeckel
+    // 32|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HD_Hauptraste_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x1);
+    }
+    static constexpr uint32_t HD_Hauptraste(const uint8_t* d)
+    {
+        return HD_Hauptraste_Raw(d);
+    }
+    static inline void HD_Hauptraste_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | (raw & 0x1));
+    }
+
+    // SBL_Schloss (MQB/MLBevo): Sperrklinke Heckdeckel sonst (MQB): Vorraste Heckdeckel
+    // 33|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HD_Vorraste_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 1) & 0x1);
+    }
+    static constexpr uint32_t HD_Vorraste(const uint8_t* d)
+    {
+        return HD_Vorraste_Raw(d);
+    }
+    static inline void HD_Vorraste_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Car Finder Funktion (Blinken ohne zu entriegeln)
+    // 38|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FFB_CarFinder_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 6) & 0x1);
+    }
+    static constexpr uint32_t FFB_CarFinder(const uint8_t* d)
+    {
+        return FFB_CarFinder_Raw(d);
+    }
+    static inline void FFB_CarFinder_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Komfortoeffnen Funk
+    // 39|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FFB_Komfortoeffnen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 7);
+    }
+    static constexpr uint32_t FFB_Komfortoeffnen(const uint8_t* d)
+    {
+        return FFB_Komfortoeffnen_Raw(d);
+    }
+    static inline void FFB_Komfortoeffnen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Komfortschliessen Funk
+    // 40|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FFB_Komfortschliessen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] & 0x1);
+    }
+    static constexpr uint32_t FFB_Komfortschliessen(const uint8_t* d)
+    {
+        return FFB_Komfortschliessen_Raw(d);
+    }
+    static inline void FFB_Komfortschliessen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFE) | (raw & 0x1));
+    }
+
+    // aktuelle Funkschluesselnummer
+    // 42|4@1+ (1,0) [0|15] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Schluessel_Zugang_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 2) & 0xF);
+    }
+    static constexpr uint32_t ZV_Schluessel_Zugang(const uint8_t* d)
+    {
+        return ZV_Schluessel_Zugang_Raw(d);
+    }
+    static inline void ZV_Schluessel_Zugang_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xC3) | ((raw << 2) & 0x3C));
+    }
+
+    // Statusuebermittlung ob die Safe Funktion im Fzg. aktiv ist. Das Kombi benoetigt das Signal, um den Text Safelock aktiv anzuzeigen.
+    // 46|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_SafeFunktion_aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_SafeFunktion_aktiv(const uint8_t* d)
+    {
+        return ZV_SafeFunktion_aktiv_Raw(d);
+    }
+    static inline void ZV_SafeFunktion_aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Kombi Prio Warnung Schluessel Batterie 'Bitte Schluesselbatterie wechseln!'
+    // 47|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t FBS_Warn_Schluessel_Batt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 7);
+    }
+    static constexpr uint32_t FBS_Warn_Schluessel_Batt(const uint8_t* d)
+    {
+        return FBS_Warn_Schluessel_Batt_Raw(d);
+    }
+    static inline void FBS_Warn_Schluessel_Batt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Konfigurierter Oeffnungsmodus fuer ZV: 0 = globale Oeffnung (alle Tueren) 1 = ZV mit Einzeltuerentriegelung (FFB - nur Fahrertuer, Kessy - nur bediente Tuer) 2 = ZV individuell selektive Oeffnung (FFB - Fahrerseite, Kessy - bediente Tuer + Fahrertuer)
+    // 48|2@1+ (1,0) [0|3] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Oeffnungsmodus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] & 0x3);
+    }
+    static constexpr uint32_t ZV_Oeffnungsmodus(const uint8_t* d)
+    {
+        return ZV_Oeffnungsmodus_Raw(d);
+    }
+    static inline void ZV_Oeffnungsmodus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFC) | (raw & 0x3));
+    }
+
+    // HFS Tuer verriegelt
+    // 50|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HFS_verriegelt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 2) & 0x1);
+    }
+    static constexpr uint32_t HFS_verriegelt(const uint8_t* d)
+    {
+        return HFS_verriegelt_Raw(d);
+    }
+    static inline void HFS_verriegelt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // HFS Tuer gesafet. Im Zustand Safe wird auch das Signal HFS_verriegelt = 1 gesendet.
+    // 51|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HFS_gesafet_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 3) & 0x1);
+    }
+    static constexpr uint32_t HFS_gesafet(const uint8_t* d)
+    {
+        return HFS_gesafet_Raw(d);
+    }
+    static inline void HFS_gesafet_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Verriegelungsstatus Tuer
+    // 52|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HBFS_verriegelt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 4) & 0x1);
+    }
+    static constexpr uint32_t HBFS_verriegelt(const uint8_t* d)
+    {
+        return HBFS_verriegelt_Raw(d);
+    }
+    static inline void HBFS_verriegelt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // HBFS Tuer gesafet. Im Zustand Safe wird auch das Signal HBFS_verriegelt = 1 gesendet.
+    // 53|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t HBFS_gesafet_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 5) & 0x1);
+    }
+    static constexpr uint32_t HBFS_gesafet(const uint8_t* d)
+    {
+        return HBFS_gesafet_Raw(d);
+    }
+    static inline void HBFS_gesafet_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Verfuegbarkeit IST-Zustand ZV
+    // 54|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_ist_Zustand_verfuegbar_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[6] >> 6) & 0x1);
+    }
+    static constexpr uint32_t ZV_ist_Zustand_verfuegbar(const uint8_t* d)
+    {
+        return ZV_ist_Zustand_verfuegbar_Raw(d);
+    }
+    static inline void ZV_ist_Zustand_verfuegbar_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Anforderung Funktions-LED IRUE-Taster (LED wird vom TSG angesteuert) MQB: Bei Verbau eines einzelnen Taster zur Deaktivierung von IRUE und NGS wird dieses Signal zur Ansteuerung der Funktions-LED gesendet.
+    // 55|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t IRUE_Taster_Fkts_LED_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 7);
+    }
+    static constexpr uint32_t IRUE_Taster_Fkts_LED(const uint8_t* d)
+    {
+        return IRUE_Taster_Fkts_LED_Raw(d);
+    }
+    static inline void IRUE_Taster_Fkts_LED_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Oeffnungsstatus der Tankklappe
+    // 56|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Tankklappe_offen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] & 0x1);
+    }
+    static constexpr uint32_t ZV_Tankklappe_offen(const uint8_t* d)
+    {
+        return ZV_Tankklappe_offen_Raw(d);
+    }
+    static inline void ZV_Tankklappe_offen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFE) | (raw & 0x1));
+    }
+
+    // Komfortoeffnen des Dachrollos
+    // 57|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Rollo_auf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 1) & 0x1);
+    }
+    static constexpr uint32_t ZV_Rollo_auf(const uint8_t* d)
+    {
+        return ZV_Rollo_auf_Raw(d);
+    }
+    static inline void ZV_Rollo_auf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Komfortschliessen des Dachrollos
+    // 58|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_Rollo_zu_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 2) & 0x1);
+    }
+    static constexpr uint32_t ZV_Rollo_zu(const uint8_t* d)
+    {
+        return ZV_Rollo_zu_Raw(d);
+    }
+    static inline void ZV_Rollo_zu_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFB) | ((raw << 2) & 0x4));
+    }
+
+    // Komfortoeffnen des Schiebeausstelldaches
+    // 59|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_SAD_auf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 3) & 0x1);
+    }
+    static constexpr uint32_t ZV_SAD_auf(const uint8_t* d)
+    {
+        return ZV_SAD_auf_Raw(d);
+    }
+    static inline void ZV_SAD_auf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Komfortschliessen des Schiebeausstelldaches
+    // 60|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_SAD_zu_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 4) & 0x1);
+    }
+    static constexpr uint32_t ZV_SAD_zu(const uint8_t* d)
+    {
+        return ZV_SAD_zu_Raw(d);
+    }
+    static inline void ZV_SAD_zu_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Fehler: nicht Funktionalitaet des Tankklappenstellers
+    // 61|1@1+ (1,0) [0|1] "" Receiver: Vector__XXX
+    static constexpr uint32_t BCM_Tankklappensteller_Fehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[7] >> 5) & 0x1);
+    }
+    static constexpr uint32_t BCM_Tankklappensteller_Fehler(const uint8_t* d)
+    {
+        return BCM_Tankklappensteller_Fehler_Raw(d);
+    }
+    static inline void BCM_Tankklappensteller_Fehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Fahrzeug Gesamtverriegelungsstatus Sollzustand fuer Ladestecker- und Ladeklappenverriegelung.
+    // 62|2@1+ (1,0) [0|3] "" Receiver: Vector__XXX
+    static constexpr uint32_t ZV_verriegelt_soll_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 6);
+    }
+    static constexpr uint32_t ZV_verriegelt_soll(const uint8_t* d)
+    {
+        return ZV_verriegelt_soll_Raw(d);
+    }
+    static inline void ZV_verriegelt_soll_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+};
+
+// FCU_02 Sender: FCU_MLBevo_FCEV
+struct FCU_02
+{
+    enum : uint32_t
+    {
+        ID = 0x17B,
+        DLC = 8
+    };
+
+    // Warnung H2-Konzentration im Motorraum Ansteuerung Kuehlerluefter fuer Motorraumspuelung & ggf. Deaktivierung Innenraumgeblaese. Ggf. muessen Akustikgrenzen aufgehoben werden
+    // 12|3@1+ (1,0) [0|7] "" Receiver: Gateway,TME
+    static constexpr uint32_t FCU_Warn_H2_Konzentrat_Motorraum_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[1] >> 4) & 0x7);
+    }
+    static constexpr uint32_t FCU_Warn_H2_Konzentrat_Motorraum(const uint8_t* d)
+    {
+        return FCU_Warn_H2_Konzentrat_Motorraum_Raw(d);
+    }
+    static inline void FCU_Warn_H2_Konzentrat_Motorraum_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x8F) | ((raw << 4) & 0x70));
+    }
+
+    // FCU-System-Verfuegbarkeitsstatus
+    // 15|1@1+ (1,0) [0|1] "" Receiver: Gateway
+    static constexpr uint32_t FCU_nicht_verfuegbar_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 7);
+    }
+    static constexpr uint32_t FCU_nicht_verfuegbar(const uint8_t* d)
+    {
+        return FCU_nicht_verfuegbar_Raw(d);
+    }
+    static inline void FCU_nicht_verfuegbar_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // Start/Stop-Anforderungen der FCU, z.B. Stopverbot, -freigabe, -anforderung, -wunsch und Startwunsch
+    // 16|4@1+ (1,0) [0|15] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Startstopp_Anforderung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] & 0xF);
+    }
+    static constexpr uint32_t FCU_Startstopp_Anforderung(const uint8_t* d)
+    {
+        return FCU_Startstopp_Anforderung_Raw(d);
+    }
+    static inline void FCU_Startstopp_Anforderung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF0) | (raw & 0xF));
+    }
+
+    // Anforderung 'HV-Netz aktivieren'
+    // 20|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t FCU_HV_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 4) & 0x3);
+    }
+    static constexpr uint32_t FCU_HV_Anf(const uint8_t* d)
+    {
+        return FCU_HV_Anf_Raw(d);
+    }
+    static inline void FCU_HV_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // beschraenkt Kompressorleistung / Kompressorabwurf
+    // 22|2@1+ (1,0) [0|3] "" Receiver: Gateway,TME
+    static constexpr uint32_t FCU_Klima_Eingr_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 6);
+    }
+    static constexpr uint32_t FCU_Klima_Eingr(const uint8_t* d)
+    {
+        return FCU_Klima_Eingr_Raw(d);
+    }
+    static inline void FCU_Klima_Eingr_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // IST-Modus des FCU-Systems
+    // 24|5@1+ (1,0) [0|31] "" Receiver: Gateway
+    static constexpr uint32_t FCU_IstModus_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] & 0x1F);
+    }
+    static constexpr uint32_t FCU_IstModus(const uint8_t* d)
+    {
+        return FCU_IstModus_Raw(d);
+    }
+    static inline void FCU_IstModus_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0xE0) | (raw & 0x1F));
+    }
+
+    // 0=Init 1=HV-Komponente spannungsfrei (U_Zwkr < 20V) 2=HV-Komponente nicht spannungsfrei (U_Zwkr >/= 25V, Hysterese) 3=Fehler (z.B. Fehler in der Sensorik)
+    // 29|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Status_Spgfreiheit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[3] >> 5) & 0x3);
+    }
+    static constexpr uint32_t FCU_Status_Spgfreiheit(const uint8_t* d)
+    {
+        return FCU_Status_Spgfreiheit_Raw(d);
+    }
+    static inline void FCU_Status_Spgfreiheit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x9F) | ((raw << 5) & 0x60));
+    }
+
+    // Leistungsreduzierung der FCU aufgrund Fehler aktiv (nur mit Fehlerspeichereintrag), z.B. LimpHome
+    // 31|1@1+ (1,0) [0|1] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Fehler_Leistungsreduzierung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 7);
+    }
+    static constexpr uint32_t FCU_Fehler_Leistungsreduzierung(const uint8_t* d)
+    {
+        return FCU_Fehler_Leistungsreduzierung_Raw(d);
+    }
+    static inline void FCU_Fehler_Leistungsreduzierung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x7F) | ((raw << 7) & 0x80));
+    }
+
+    // FCU-System-Stoppanforderung der FCU aufgrund Fehler in der FCU (nur mit Fehlerspeichereintrag)
+    // 32|1@1+ (1,0) [0|1] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Fehler_Abschaltanforderung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] & 0x1);
+    }
+    static constexpr uint32_t FCU_Fehler_Abschaltanforderung(const uint8_t* d)
+    {
+        return FCU_Fehler_Abschaltanforderung_Raw(d);
+    }
+    static inline void FCU_Fehler_Abschaltanforderung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | (raw & 0x1));
+    }
+
+    // FCU-System-Notabschaltung aufgrund Fehler in der FCU (nur mit Fehlerspeichereintrag)
+    // 33|1@1+ (1,0) [0|1] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Fehler_Notabschaltung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 1) & 0x1);
+    }
+    static constexpr uint32_t FCU_Fehler_Notabschaltung(const uint8_t* d)
+    {
+        return FCU_Fehler_Notabschaltung_Raw(d);
+    }
+    static inline void FCU_Fehler_Notabschaltung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xFD) | ((raw << 1) & 0x2));
+    }
+
+    // Aktueller Fehlerstatus der Entladung
+    // 34|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Fehler_Entladung_defekt_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 2) & 0x3);
+    }
+    static constexpr uint32_t FCU_Fehler_Entladung_defekt(const uint8_t* d)
+    {
+        return FCU_Fehler_Entladung_defekt_Raw(d);
+    }
+    static inline void FCU_Fehler_Entladung_defekt_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xF3) | ((raw << 2) & 0xC));
+    }
+
+    // Aktueller Isofehlerstatus des Brennstoffzellensystems
+    // 36|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Fehler_Isofehler_I_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x3);
+    }
+    static constexpr uint32_t FCU_Fehler_Isofehler_I(const uint8_t* d)
+    {
+        return FCU_Fehler_Isofehler_I_Raw(d);
+    }
+    static inline void FCU_Fehler_Isofehler_I_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xCF) | ((raw << 4) & 0x30));
+    }
+
+    // Aktueller Isofehlerstatus des Brennstoffzellensystems
+    // 38|2@1+ (1,0) [0|3] "" Receiver: Gateway
+    static constexpr uint32_t FCU_Fehler_Isofehler_II_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 6);
+    }
+    static constexpr uint32_t FCU_Fehler_Isofehler_II(const uint8_t* d)
+    {
+        return FCU_Fehler_Isofehler_II_Raw(d);
+    }
+    static inline void FCU_Fehler_Isofehler_II_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // Anforderung MIL (MalfunctionIndicationLamp) von FCU
+    // 40|1@1+ (1,0) [0|1] "" Receiver: Gateway
+    static constexpr uint32_t FCU_OBD_Lampe_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] & 0x1);
+    }
+    static constexpr uint32_t FCU_OBD_Lampe_Anf(const uint8_t* d)
+    {
+        return FCU_OBD_Lampe_Anf_Raw(d);
+    }
+    static inline void FCU_OBD_Lampe_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xFE) | (raw & 0x1));
+    }
+
+    // Abtrennung HT-Kreis von Heizkreis
+    // 41|2@1+ (1,0) [0|3] "" Receiver: Gateway,TME
+    static constexpr uint32_t FCU_Absperrventil_schliessen_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 1) & 0x3);
+    }
+    static constexpr uint32_t FCU_Absperrventil_schliessen(const uint8_t* d)
+    {
+        return FCU_Absperrventil_schliessen_Raw(d);
+    }
+    static inline void FCU_Absperrventil_schliessen_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF9) | ((raw << 1) & 0x6));
+    }
+
+    // Notwendig fuer Tankvorgang, um Weiterfahrt zu unterbinden. Triggert: - BZ zum Herunterfahren bzw. Sleep-Mode - EPB aktivieren - Fahrbereitschaft deaktivieren
+    // 43|1@1+ (1,0) [0|1] "" Receiver: Gateway,Ladegeraet_Konzern
+    static constexpr uint32_t FCU_TK_Betankung_Anforderung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 3) & 0x1);
+    }
+    static constexpr uint32_t FCU_TK_Betankung_Anforderung(const uint8_t* d)
+    {
+        return FCU_TK_Betankung_Anforderung_Raw(d);
+    }
+    static inline void FCU_TK_Betankung_Anforderung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF7) | ((raw << 3) & 0x8));
+    }
+
+    // Absolute minimale Leistung des BZ-Systems Leistungsabgabe BZ-System - positiv Leistungsaufnahme BZ-System - negativ
+    // 44|10@1+ (0.1,-50) [-50|52.2] "Unit_KiloWatt" Receiver: Gateway
+    static constexpr uint32_t FCU_MinAbs_Leistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 4) |
+               (static_cast<uint32_t>(d[6] & 0x3F) << 4);
+    }
+    static constexpr float FCU_MinAbs_Leistung(const uint8_t* d)
+    {
+        return FCU_MinAbs_Leistung_Raw(d) * 0.1f + -50.0f;
+    }
+    static inline void FCU_MinAbs_Leistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xF) | ((raw << 4) & 0xF0));
+        d[6] = static_cast<uint8_t>((d[6] & 0xC0) | ((raw >> 4) & 0x3F));
+    }
+
+    // Spuelung aller Kuehlkreislaeufe der Brennstoffzelle 0= keine Spuelung 1= Spuelung zwingend notwendig 2= Spuelung Anforderung
+    // 54|2@1+ (1,0) [0|3] "" Receiver: Gateway,TME
+    static constexpr uint32_t FCU_Ionenspuelung_aktiv_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6);
+    }
+    static constexpr uint32_t FCU_Ionenspuelung_aktiv(const uint8_t* d)
+    {
+        return FCU_Ionenspuelung_aktiv_Raw(d);
+    }
+    static inline void FCU_Ionenspuelung_aktiv_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+    }
+
+    // Freigabesignal fuer Entriegelung Tankklappe.
+    // 56|2@1+ (1,0) [0|3] "" Receiver: Gateway,Ladegeraet_Konzern
+    static constexpr uint32_t FCU_TK_Freigabe_Tankklappe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] & 0x3);
+    }
+    static constexpr uint32_t FCU_TK_Freigabe_Tankklappe(const uint8_t* d)
+    {
+        return FCU_TK_Freigabe_Tankklappe_Raw(d);
+    }
+    static inline void FCU_TK_Freigabe_Tankklappe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xFC) | (raw & 0x3));
+    }
+};
+
+// BMS_06 Sender: BMC_MLBevo
+struct BMS_06
+{
+    enum : uint32_t
+    {
+        ID = 0x59E,
+        DLC = 8
+    };
+
+    // Temperierungsbedarf der HV-Batterie
+    // 0|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_Temperierung_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0] & 0x7);
+    }
+    static constexpr uint32_t BMS_Temperierung_Anf(const uint8_t* d)
+    {
+        return BMS_Temperierung_Anf_Raw(d);
+    }
+    static inline void BMS_Temperierung_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xF8) | (raw & 0x7));
+    }
+
+    // Status des 3-2-Wege-Ventils (betaetigt/unbetaetigt/Fehler)
+    // 3|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t BMS_Status_Ventil_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[0] >> 3) & 0x7);
+    }
+    static constexpr uint32_t BMS_Status_Ventil(const uint8_t* d)
+    {
+        return BMS_Status_Ventil_Raw(d);
+    }
+    static inline void BMS_Status_Ventil_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xC7) | ((raw << 3) & 0x38));
+    }
+
+    // Das Signal beschreibt die Differenz zwischen Batterie Soll-Temperatur und Batterie Ist-Temperatur.
+    // 8|4@1+ (1,-15) [-15|0] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_Temp_Epsilon_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0xF);
+    }
+    static constexpr int32_t BMS_Temp_Epsilon(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_Temp_Epsilon_Raw(d)) + -15;
+    }
+    static inline void BMS_Temp_Epsilon_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF0) | (raw & 0xF));
+    }
+
+    // Ansteuerungs-Sollwert der Batterie-Kuehlmittelpumpe. Speziell im MQB PHEV: Istwert der Pumpenansteuerung (Batterie steuert Pumpe selbstaendig an).
+    // 12|4@1+ (10,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_Soll_PWM_Pumpe_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 4);
+    }
+    static constexpr int32_t BMS_Soll_PWM_Pumpe(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_Soll_PWM_Pumpe_Raw(d)) * 10;
+    }
+    static inline void BMS_Soll_PWM_Pumpe_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xF) | ((raw << 4) & 0xF0));
+    }
+
+    // battery temperature / Momentanwert: Temperatur der Traktionsbatterie
+    // 16|8@1+ (0.5,-40) [-40|86.5] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,TME
+    static constexpr uint32_t BMS_Temperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2]);
+    }
+    static constexpr float BMS_Temperatur(const uint8_t* d)
+    {
+        return BMS_Temperatur_Raw(d) * 0.5f + -40.0f;
+    }
+    static inline void BMS_Temperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>(raw);
+    }
+
+    // Aktuelle Vorlauftemperatur der Batterie
+    // 24|8@1+ (0.5,-40) [-40|86.5] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_IstVorlaufTemperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]);
+    }
+    static constexpr float BMS_IstVorlaufTemperatur(const uint8_t* d)
+    {
+        return BMS_IstVorlaufTemperatur_Raw(d) * 0.5f + -40.0f;
+    }
+    static inline void BMS_IstVorlaufTemperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+    }
+
+    // Fehler im NTKreis, HV-Batterie wird nicht klimatisiert (Fehler, Fehlerfrei)
+    // 36|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t BMS_Fehler_NTKreis_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 4) & 0x1);
+    }
+    static constexpr uint32_t BMS_Fehler_NTKreis(const uint8_t* d)
+    {
+        return BMS_Fehler_NTKreis_Raw(d);
+    }
+    static inline void BMS_Fehler_NTKreis_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xEF) | ((raw << 4) & 0x10));
+    }
+
+    // Fehlerstatus der elektrischen Wasserpumpe der HV-Batterie
+    // 37|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_Fehlerstatus_EWP_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 5);
+    }
+    static constexpr uint32_t BMS_Fehlerstatus_EWP_02(const uint8_t* d)
+    {
+        return BMS_Fehlerstatus_EWP_02_Raw(d);
+    }
+    static inline void BMS_Fehlerstatus_EWP_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // Soll Volumenstrom fuer Kuehlkreislauf Batterie
+    // 40|6@1+ (1,0) [0|61] "Unit_LiterPerMinut" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_SollVolumenstrom_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] & 0x3F);
+    }
+    static constexpr uint32_t BMS_SollVolumenstrom(const uint8_t* d)
+    {
+        return BMS_SollVolumenstrom_Raw(d);
+    }
+    static inline void BMS_SollVolumenstrom_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xC0) | (raw & 0x3F));
+    }
+
+    // Anforderung des BMC die Bauteilvorkonditionierung der HV-Batterie durchzufuehren.
+    // 46|1@1+ (1,0) [0|1] "" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,TME
+    static constexpr uint32_t BMS_Batterie_Voko_Anf_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[5] >> 6) & 0x1);
+    }
+    static constexpr uint32_t BMS_Batterie_Voko_Anf(const uint8_t* d)
+    {
+        return BMS_Batterie_Voko_Anf_Raw(d);
+    }
+    static inline void BMS_Batterie_Voko_Anf_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0xBF) | ((raw << 6) & 0x40));
+    }
+
+    // Soll_Vorlauftemperatur_Kuehlmedium in degC
+    // 48|8@1+ (0.5,-40) [-40|86.5] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_SollVorlauftemperatur_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6]);
+    }
+    static constexpr float BMS_SollVorlauftemperatur(const uint8_t* d)
+    {
+        return BMS_SollVorlauftemperatur_Raw(d) * 0.5f + -40.0f;
+    }
+    static inline void BMS_SollVorlauftemperatur_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>(raw);
+    }
+
+    // Aktuelle Ruecklauftemperatur der Batterie
+    // 56|8@1+ (0.5,-40) [-40|86.5] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,TME
+    static constexpr uint32_t BMS_IstRuecklaufTemperatur_02_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7]);
+    }
+    static constexpr float BMS_IstRuecklaufTemperatur_02(const uint8_t* d)
+    {
+        return BMS_IstRuecklaufTemperatur_02_Raw(d) * 0.5f + -40.0f;
+    }
+    static inline void BMS_IstRuecklaufTemperatur_02_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>(raw);
+    }
+};
+
+// NavData_02 Sender: Gateway
+struct NavData_02
+{
+    enum : uint32_t
+    {
+        ID = 0x485,
+        DLC = 8
+    };
+
+    // Anzahl der zur Berechnung verwendeten Satelliten
+    // 0|5@1+ (1,0) [0|29] "" Receiver: Sub_Gateway,TME
+    static constexpr uint32_t ND_SatInUse_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[0] & 0x1F);
+    }
+    static constexpr uint32_t ND_SatInUse(const uint8_t* d)
+    {
+        return ND_SatInUse_Raw(d);
+    }
+    static inline void ND_SatInUse_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xE0) | (raw & 0x1F));
+    }
+
+    // Bei gesetztem Bit wird das Signal POS_Guete_horizontal befuellt und ist verfuegbar.
+    // 5|1@1+ (1,0) [0|1] "" Receiver: Sub_Gateway
+    static constexpr uint32_t POS_Guete_horizontal_verfuegbar_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[0] >> 5) & 0x1);
+    }
+    static constexpr uint32_t POS_Guete_horizontal_verfuegbar(const uint8_t* d)
+    {
+        return POS_Guete_horizontal_verfuegbar_Raw(d);
+    }
+    static inline void POS_Guete_horizontal_verfuegbar_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[0] = static_cast<uint8_t>((d[0] & 0xDF) | ((raw << 5) & 0x20));
+    }
+
+    // Anzahl der sichtbaren Satelliten
+    // 8|5@1+ (1,0) [0|29] "" Receiver: Sub_Gateway
+    static constexpr uint32_t ND_SatInView_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] & 0x1F);
+    }
+    static constexpr uint32_t ND_SatInView(const uint8_t* d)
+    {
+        return ND_SatInView_Raw(d);
+    }
+    static inline void ND_SatInView_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0xE0) | (raw & 0x1F));
+    }
+
+    // Horizontale Genauigkeit der Position in der Botschaft NavPos_02_MapMatched (Signale POS_LatDegree, POS_LongDegree) Abhaengig vom Signal POS_Guete_horizontal_verfuegbar
+    // 13|7@1+ (2,0) [0|246] "Unit_Meter" Receiver: Sub_Gateway
+    static constexpr uint32_t POS_Guete_horizontal_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[1] >> 5) |
+               (static_cast<uint32_t>(d[2] & 0xF) << 3);
+    }
+    static constexpr int32_t POS_Guete_horizontal(const uint8_t* d)
+    {
+        return static_cast<int32_t>(POS_Guete_horizontal_Raw(d)) * 2;
+    }
+    static inline void POS_Guete_horizontal_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[1] = static_cast<uint8_t>((d[1] & 0x1F) | ((raw << 5) & 0xE0));
+        d[2] = static_cast<uint8_t>((d[2] & 0xF0) | ((raw >> 3) & 0xF));
+    }
+
+    // Hoehe ueber NN 0xFFF = Fehler bei der Berechnung der Hoehe ueber NN
+    // 20|12@1+ (2,-500) [-500|7686] "Unit_Meter" Receiver: Sub_Gateway,TME
+    static constexpr uint32_t NP_Altitude_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 4) |
+               (static_cast<uint32_t>(d[3]) << 4);
+    }
+    static constexpr int32_t NP_Altitude(const uint8_t* d)
+    {
+        return static_cast<int32_t>(NP_Altitude_Raw(d)) * 2 + -500;
+    }
+    static inline void NP_Altitude_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xF) | ((raw << 4) & 0xF0));
+        d[3] = static_cast<uint8_t>((raw >> 4));
+    }
+
+    // UTC-Zeit, verstrichene Sekunden seit 01.01.1970 00:00 0xFFFFFFFE = Init 0xFFFFFFFF = Fehler bei Berechnung der UTC-Time
+    // 32|32@1+ (1,0) [0|4294967293] "Unit_Secon" Receiver: Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t ND_UTC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]) |
+               (static_cast<uint32_t>(d[5]) << 8) |
+               (static_cast<uint32_t>(d[6]) << 16) |
+               (static_cast<uint32_t>(d[7]) << 24);
+    }
+    static constexpr uint32_t ND_UTC(const uint8_t* d)
+    {
+        return ND_UTC_Raw(d);
+    }
+    static inline void ND_UTC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+        d[5] = static_cast<uint8_t>((raw >> 8));
+        d[6] = static_cast<uint8_t>((raw >> 16));
+        d[7] = static_cast<uint8_t>((raw >> 24));
+    }
+};
+
+// Authentic_Time_01 Sender: Gateway
+struct Authentic_Time_01
+{
+    enum : uint32_t
+    {
+        ID = 0x1A5555AD,
+        DLC = 8
+    };
+
+    // Valide (plausible) Zeit vom Zeitmaster der authentischen Zeit im cGW. Der Zeitmaster der authentischen Zeit im cGW fuehrt eine Plausibilisierung der GPS-Zeit ueber die Kommunikation mit dem Backend durch. Diese plausibilisierte Zeit wird in diesem Signal
+    // 32|32@1+ (1,0) [1|4294967295] "" Receiver: Ladegeraet_Konzern
+    static constexpr uint32_t AT_VALID_TIME_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]) |
+               (static_cast<uint32_t>(d[5]) << 8) |
+               (static_cast<uint32_t>(d[6]) << 16) |
+               (static_cast<uint32_t>(d[7]) << 24);
+    }
+    static constexpr uint32_t AT_VALID_TIME(const uint8_t* d)
+    {
+        return AT_VALID_TIME_Raw(d);
+    }
+    static inline void AT_VALID_TIME_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+        d[5] = static_cast<uint8_t>((raw >> 8));
+        d[6] = static_cast<uint8_t>((raw >> 16));
+        d[7] = static_cast<uint8_t>((raw >> 24));
+    }
+};
+
+// BMS_09 Sender: BMC_MLBevo
+struct BMS_09
+{
+    enum : uint32_t
+    {
+        ID = 0x16A955EB,
+        DLC = 8
+    };
+
+    // Status HV-Auszeit.
+    // 21|2@1+ (1,0) [0|3] "" Receiver: DCDC_800V_PAG,DCDC_HV,Gateway,Gateway_PAG,Ladegeraet_2,Ladegeraet_Konzern,LE2_3_MLBevo_LB,TME
+    static constexpr uint32_t BMS_HV_Auszeit_Status_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 5) & 0x3);
+    }
+    static constexpr uint32_t BMS_HV_Auszeit_Status(const uint8_t* d)
+    {
+        return BMS_HV_Auszeit_Status_Raw(d);
+    }
+    static inline void BMS_HV_Auszeit_Status_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x9F) | ((raw << 5) & 0x60));
+    }
+
+    // Zeit seit letzter Hochvoltaktivitaet.
+    // 23|9@1+ (4,0) [0|2036] "Unit_Minut" Receiver: DCDC_800V_PAG,DCDC_HV,Gateway,Gateway_PAG,Ladegeraet_2,Ladegeraet_Konzern,LE2_3_MLBevo_LB,TME
+    static constexpr uint32_t BMS_HV_Auszeit_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 7) |
+               (static_cast<uint32_t>(d[3]) << 1);
+    }
+    static constexpr int32_t BMS_HV_Auszeit(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_HV_Auszeit_Raw(d)) * 4;
+    }
+    static inline void BMS_HV_Auszeit_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x7F) | ((raw << 7) & 0x80));
+        d[3] = static_cast<uint8_t>((raw >> 1));
+    }
+
+    // Gesamtenergiekapazitaet der HV-Batterie unter Beruecksichtigung der Alterung
+    // 32|11@1+ (0.1,0) [0|204.6] "Unit_AmperHour" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_Kapazitaet_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]) |
+               (static_cast<uint32_t>(d[5] & 0x7) << 8);
+    }
+    static constexpr float BMS_Kapazitaet(const uint8_t* d)
+    {
+        return BMS_Kapazitaet_Raw(d) * 0.1f;
+    }
+    static inline void BMS_Kapazitaet_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+        d[5] = static_cast<uint8_t>((d[5] & 0xF8) | ((raw >> 8) & 0x7));
+    }
+
+    // Abhaengig von der notwendigen Kaltstartleistung berechneter SOC Wert.
+    // 43|11@1+ (0.05,0) [0|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG
+    static constexpr uint32_t BMS_SOC_Kaltstart_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5] >> 3) |
+               (static_cast<uint32_t>(d[6] & 0x3F) << 5);
+    }
+    static constexpr float BMS_SOC_Kaltstart(const uint8_t* d)
+    {
+        return BMS_SOC_Kaltstart_Raw(d) * 0.05f;
+    }
+    static inline void BMS_SOC_Kaltstart_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>((d[5] & 0x7) | ((raw << 3) & 0xF8));
+        d[6] = static_cast<uint8_t>((d[6] & 0xC0) | ((raw >> 5) & 0x3F));
+    }
+
+    // oberer Grenz SOC - Betriebsstrategie
+    // 54|5@1+ (1,70) [70|100] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_max_Grenz_SOC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 6) |
+               (static_cast<uint32_t>(d[7] & 0x7) << 2);
+    }
+    static constexpr int32_t BMS_max_Grenz_SOC(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_max_Grenz_SOC_Raw(d)) + 70;
+    }
+    static inline void BMS_max_Grenz_SOC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0x3F) | ((raw << 6) & 0xC0));
+        d[7] = static_cast<uint8_t>((d[7] & 0xF8) | ((raw >> 2) & 0x7));
+    }
+
+    // unterer Grenz SOC - Betriebsstrategie
+    // 59|5@1+ (1,0) [0|30] "Unit_PerCent" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_min_Grenz_SOC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 3);
+    }
+    static constexpr uint32_t BMS_min_Grenz_SOC(const uint8_t* d)
+    {
+        return BMS_min_Grenz_SOC_Raw(d);
+    }
+    static inline void BMS_min_Grenz_SOC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0x7) | ((raw << 3) & 0xF8));
+    }
+};
+
+// BMS_11 Sender: BMC_MLBevo
+struct BMS_11
+{
+    enum : uint32_t
+    {
+        ID = 0x16A954A6,
+        DLC = 8
+    };
+
+    // Ergebnis des aktuellen/letzten Isolations-Messzyklus: Messung laeuft; Messung Batterie-intern oder Gesamtsystem; gemessener Wert unterschreitet Schwelle 1 / Schwelle 2.
+    // 17|4@1+ (1,0) [0|15] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_IsoZustand_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[2] >> 1) & 0xF);
+    }
+    static constexpr uint32_t BMS_IsoZustand(const uint8_t* d)
+    {
+        return BMS_IsoZustand_Raw(d);
+    }
+    static inline void BMS_IsoZustand_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0xE1) | ((raw << 1) & 0x1E));
+    }
+
+    // Ergebnis der Isolationsmessung des BMS
+    // 21|3@1+ (1,0) [0|7] "" Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    static constexpr uint32_t BMS_IsoFehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[2] >> 5);
+    }
+    static constexpr uint32_t BMS_IsoFehler(const uint8_t* d)
+    {
+        return BMS_IsoFehler_Raw(d);
+    }
+    static inline void BMS_IsoFehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[2] = static_cast<uint8_t>((d[2] & 0x1F) | ((raw << 5) & 0xE0));
+    }
+
+    // aktuell hoechste Temperatur in der Batterie
+    // 24|8@1+ (0.5,-40) [-40|86] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t BMS_IstTemperatur_hoechste_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3]);
+    }
+    static constexpr float BMS_IstTemperatur_hoechste(const uint8_t* d)
+    {
+        return BMS_IstTemperatur_hoechste_Raw(d) * 0.5f + -40.0f;
+    }
+    static inline void BMS_IstTemperatur_hoechste_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>(raw);
+    }
+
+    // aktuell niedrigsteTemperatur in der Batterie
+    // 32|8@1+ (0.5,-40) [-40|86] "Unit_DegreCelsi" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway,TME
+    static constexpr uint32_t BMS_IstTemperatur_niedrigste_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4]);
+    }
+    static constexpr float BMS_IstTemperatur_niedrigste(const uint8_t* d)
+    {
+        return BMS_IstTemperatur_niedrigste_Raw(d) * 0.5f + -40.0f;
+    }
+    static inline void BMS_IstTemperatur_niedrigste_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>(raw);
+    }
+
+    // hoechster Wert aller Zellspannungen im BMS
+    // 40|12@1+ (1,1000) [1000|5091] "Unit_MilliVolt" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t BMS_IstZellspannung_hoechste_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[5]) |
+               (static_cast<uint32_t>(d[6] & 0xF) << 8);
+    }
+    static constexpr int32_t BMS_IstZellspannung_hoechste(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_IstZellspannung_hoechste_Raw(d)) + 1000;
+    }
+    static inline void BMS_IstZellspannung_hoechste_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[5] = static_cast<uint8_t>(raw);
+        d[6] = static_cast<uint8_t>((d[6] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // niedrigster Wert aller Zellspannungen im BMS
+    // 52|12@1+ (1,1000) [1000|5091] "Unit_MilliVolt" Receiver: Gateway,Gateway_PAG,Ladegeraet_Konzern,Sub_Gateway
+    static constexpr uint32_t BMS_IstZellspannung_niedrigste_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6] >> 4) |
+               (static_cast<uint32_t>(d[7]) << 4);
+    }
+    static constexpr int32_t BMS_IstZellspannung_niedrigste(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_IstZellspannung_niedrigste_Raw(d)) + 1000;
+    }
+    static inline void BMS_IstZellspannung_niedrigste_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>((d[6] & 0xF) | ((raw << 4) & 0xF0));
+        d[7] = static_cast<uint8_t>((raw >> 4));
+    }
+};
+
+// BMS_27 Sender: BMC_MLBevo
+struct BMS_27
+{
+    enum : uint32_t
+    {
+        ID = 0x1A555552,
+        DLC = 8
+    };
+
+    // SOC-Grenze bis zu welcher mit der Leistung aus BMS_LadegrenzeAntw_Leistung geladen werden kann.
+    // 26|7@1+ (1,0) [0|100] "Unit_PerCent" Receiver: Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_LadegrenzeAntw_SOC_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[3] >> 2) |
+               (static_cast<uint32_t>(d[4] & 0x1) << 6);
+    }
+    static constexpr uint32_t BMS_LadegrenzeAntw_SOC(const uint8_t* d)
+    {
+        return BMS_LadegrenzeAntw_SOC_Raw(d);
+    }
+    static inline void BMS_LadegrenzeAntw_SOC_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[3] = static_cast<uint8_t>((d[3] & 0x3) | ((raw << 2) & 0xFC));
+        d[4] = static_cast<uint8_t>((d[4] & 0xFE) | ((raw >> 6) & 0x1));
+    }
+
+    // Fortlaufender Zaehler fuer die Antwort Energie.
+    // 33|4@1+ (1,0) [0|13] "Unit_None" Receiver: Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_EnergieAntw_Zaehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>((d[4] >> 1) & 0xF);
+    }
+    static constexpr uint32_t BMS_EnergieAntw_Zaehler(const uint8_t* d)
+    {
+        return BMS_EnergieAntw_Zaehler_Raw(d);
+    }
+    static inline void BMS_EnergieAntw_Zaehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0xE1) | ((raw << 1) & 0x1E));
+    }
+
+    // Fuer Laden der HV-Batterie notwendige Energie (um angefragten SOC-Hub zu erreichen).
+    // 37|11@1+ (250,0) [0|511250] "Unit_WattHour" Receiver: Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_EnergieAntw_Energie_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[4] >> 5) |
+               (static_cast<uint32_t>(d[5]) << 3);
+    }
+    static constexpr int32_t BMS_EnergieAntw_Energie(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_EnergieAntw_Energie_Raw(d)) * 250;
+    }
+    static inline void BMS_EnergieAntw_Energie_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[4] = static_cast<uint8_t>((d[4] & 0x1F) | ((raw << 5) & 0xE0));
+        d[5] = static_cast<uint8_t>((raw >> 3));
+    }
+
+    // Ladeleistung mit welcher bis zu SOC aus BMS_LadegrenzeAntw_SOC geladen werden kann.
+    // 48|12@1+ (200,0) [0|818600] "Unit_Watt" Receiver: Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_LadegrenzeAntw_Leistung_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[6]) |
+               (static_cast<uint32_t>(d[7] & 0xF) << 8);
+    }
+    static constexpr int32_t BMS_LadegrenzeAntw_Leistung(const uint8_t* d)
+    {
+        return static_cast<int32_t>(BMS_LadegrenzeAntw_Leistung_Raw(d)) * 200;
+    }
+    static inline void BMS_LadegrenzeAntw_Leistung_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[6] = static_cast<uint8_t>(raw);
+        d[7] = static_cast<uint8_t>((d[7] & 0xF0) | ((raw >> 8) & 0xF));
+    }
+
+    // Fortlaufender Zaehler fuer die Antwort Leistung.
+    // 60|4@1+ (1,0) [0|13] "Unit_None" Receiver: Gateway_PAG,Ladegeraet_Konzern
+    static constexpr uint32_t BMS_LadegrenzeAntw_Zaehler_Raw(const uint8_t* d)
+    {
+        return static_cast<uint32_t>(d[7] >> 4);
+    }
+    static constexpr uint32_t BMS_LadegrenzeAntw_Zaehler(const uint8_t* d)
+    {
+        return BMS_LadegrenzeAntw_Zaehler_Raw(d);
+    }
+    static inline void BMS_LadegrenzeAntw_Zaehler_Encode(uint8_t* d, uint32_t raw)
+    {
+        d[7] = static_cast<uint8_t>((d[7] & 0xF) | ((raw << 4) & 0xF0));
+    }
+};
+
+} // namespace mlb_dbc
+
+#endif // MLB_DBC_H
@@ -47,16 +47,75 @@
    2. Temporary parameters (id = 0)
    3. Display values
  */
-// Next param id (increase when adding new parameter!): 167
-// Next value Id: 2338
+// Next param id (increase when adding new parameter!): 225
+// Next value Id: 2373
 /*              category     name         unit       min     max     default id */
 #define PARAM_LIST                                                                        \
    PARAM_ENTRY(CAT_COMM, canspeed, CANSPEEDS, 0, 4, 2, 1)                                 \
    PARAM_ENTRY(CAT_COMM, canperiod, CANPERIODS, 0, 1, 0, 2)                               \
+   PARAM_ENTRY(CAT_COMM, CAN3Speed, CAN3SPEEDS, 0, 2, 1, 220)                             \
+   PARAM_ENTRY(CAT_COMM, can_rx_deferred, YESNO, 0, 1, 0, 181)                            \
+   PARAM_ENTRY(CAT_COMM, can_rx_stats, YESNO, 0, 1, 1, 182)                               \
+   PARAM_ENTRY(CAT_COMM, can_rx_limit, "Hz", 0, 5000, 500, 218)                           \
+   PARAM_ENTRY(CAT_COMM, can_rx_burst, "dig", 1, 100, 10, 219)                            \
+   PARAM_ENTRY(CAT_COMM, canmap_per1, CANMAP_PERIODS, 0, 7, 0, 188)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per2, CANMAP_PERIODS, 0, 7, 0, 189)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per3, CANMAP_PERIODS, 0, 7, 0, 190)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per4, CANMAP_PERIODS, 0, 7, 0, 191)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per5, CANMAP_PERIODS, 0, 7, 0, 192)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per6, CANMAP_PERIODS, 0, 7, 0, 193)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per7, CANMAP_PERIODS, 0, 7, 0, 194)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per8, CANMAP_PERIODS, 0, 7, 0, 195)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per9, CANMAP_PERIODS, 0, 7, 0, 196)                       \
+   PARAM_ENTRY(CAT_COMM, canmap_per10, CANMAP_PERIODS, 0, 7, 0, 197)                      \
+   PARAM_ENTRY(CAT_COMM, gw1_src, GW_IFACES, 0, 3, 0, 198)                                \
+   PARAM_ENTRY(CAT_COMM, gw1_dst, GW_IFACES, 0, 3, 0, 199)                                \
+   PARAM_ENTRY(CAT_COMM, gw1_id, "dig", 0, 67108863, 0, 200)                              \
+   PARAM_ENTRY(CAT_COMM, gw1_mask, "dig", 0, 67108863, 0, 201)                            \
+   PARAM_ENTRY(CAT_COMM, gw1_newid, "dig", 0, 67108863, 0, 202)                           \
+   PARAM_ENTRY(CAT_COMM, gw1_ext, YESNO, 0, 1, 0, 221)                                    \
+   PARAM_ENTRY(CAT_COMM, gw2_src, GW_IFACES, 0, 3, 0, 203)                                \
+   PARAM_ENTRY(CAT_COMM, gw2_dst, GW_IFACES, 0, 3, 0, 204)                                \
+   PARAM_ENTRY(CAT_COMM, gw2_id, "dig", 0, 67108863, 0, 205)                              \
+   PARAM_ENTRY(CAT_COMM, gw2_mask, "dig", 0, 67108863, 0, 206)                            \
+   PARAM_ENTRY(CAT_COMM, gw2_newid, "dig", 0, 67108863, 0, 207)                           \
+   PARAM_ENTRY(CAT_COMM, gw2_ext, YESNO, 0, 1, 0, 222)                                    \
+   PARAM_ENTRY(CAT_COMM, gw3_src, GW_IFACES, 0, 3, 0, 208)                                \
+   PARAM_ENTRY(CAT_COMM, gw3_dst, GW_IFACES, 0, 3, 0, 209)                                \
+   PARAM_ENTRY(CAT_COMM, gw3_id, "dig", 0, 67108863, 0, 210)                              \
+   PARAM_ENTRY(CAT_COMM, gw3_mask, "dig", 0, 67108863, 0, 211)                            \
+   PARAM_ENTRY(CAT_COMM, gw3_newid, "dig", 0, 67108863, 0, 212)                           \
+   PARAM_ENTRY(CAT_COMM, gw3_ext, YESNO, 0, 1, 0, 223)                                    \
+   PARAM_ENTRY(CAT_COMM, gw4_src, GW_IFACES, 0, 3, 0, 213)                                \
+   PARAM_ENTRY(CAT_COMM, gw4_dst, GW_IFACES, 0, 3, 0, 214)                                \
+   PARAM_ENTRY(CAT_COMM, gw4_id, "dig", 0, 67108863, 0, 215)                              \
+   PARAM_ENTRY(CAT_COMM, gw4_mask, "dig", 0, 67108863, 0, 216)                            \
+   PARAM_ENTRY(CAT_COMM, gw4_newid, "dig", 0, 67108863, 0, 217)                           \
+   PARAM_ENTRY(CAT_COMM, gw4_ext, YESNO, 0, 1, 0, 224)                                    \
                                                                                           \
    VALUE_ENTRY(version, VERSTR, 2001)                                                     \
    VALUE_ENTRY(lasterr, errorListString, 2002)                                            \
    VALUE_ENTRY(cpuload, "%", 2004)                                                        \
+   VALUE_ENTRY(crc_retries, "dig", 2338)                                                  \
+   VALUE_ENTRY(crc_fallbacks, "dig", 2339)                                                \
+   VALUE_ENTRY(can_rx_unmatched, "dig", 2340)                                             \
+   VALUE_ENTRY(can_rx_queue_hwm, "dig", 2341)                                             \
+   VALUE_ENTRY(can_rx_queue_overflow, "dig", 2342)                                        \
+   VALUE_ENTRY(can_rx_ids, "dig", 2343)                                                   \
+   VALUE_ENTRY(can_rx_stale, "dig", 2344)                                                 \
+   VALUE_ENTRY(can_rx_missed, "dig", 2345)                                                \
+   VALUE_ENTRY(can_rx_stats_cyc, "dig", 2346)                                             \
+   VALUE_ENTRY(can_rx_timeouts, "dig", 2347)                                              \
+   VALUE_ENTRY(can_rx_limited, "dig", 2371)                                               \
+   VALUE_ENTRY(can_rx_babbler, "dig", 2372)                                               \
+   VALUE_ENTRY(can_filter_banks, "dig", 2348)                                             \
+   VALUE_ENTRY(can_filter_extra, "dig", 2349)                                             \
+   VALUE_ENTRY(can_tx_mbox_full, "dig", 2350)                                             \
+   VALUE_ENTRY(can_tx_queue_hwm, "dig", 2352)                                             \
+   VALUE_ENTRY(can_tx_queue_fail, "dig", 2353)                                            \
+   VALUE_ENTRY(can_tx_latency, "us", 2354)                                                \
+   VALUE_ENTRY(can_tx_suppressed, "dig", 2355)                                            \
+   VALUE_ENTRY(can_tx_period_viol, "dig", 2356)                                           \
                                                                                           \
    PARAM_ENTRY(CAT_VALVE, valve_out_1, VALVE, 0, 2, 0, 100)                               \
    VALUE_ENTRY(valve_in_raw, "V", 2100)                                                   \
@@ -98,6 +157,26 @@
    PARAM_ENTRY(CAT_MLB_SIM, mlb_chr_sim_Activation_Crg, "dig", 0, 1, 0, 164)              \
    PARAM_ENTRY(CAT_MLB_SIM, mlb_chr_sim_Lock, "dig", 0, 1, 0, 165)                        \
    PARAM_ENTRY(CAT_SETUP, charger_can, CAN_DEV, 0, 1, 1, 180)                             \
+   PARAM_ENTRY(CAT_SETUP, mlb_tx_per_tick, "dig", 1, 8, 3, 183)                           \
+   PARAM_ENTRY(CAT_SETUP, can_tx_heartbeat, "ms", 0, 1000, 0, 184)                        \
+   PARAM_ENTRY(CAT_SETUP, can_tx_period_tol, "%", 1, 50, 10, 185)                         \
+   PARAM_ENTRY(CAT_SETUP, mlb_tx_policy, MLB_TX_POLICY, 0, 1, 1, 186)                     \
+   PARAM_ENTRY(CAT_SETUP, mlb_tx_cache, YESNO, 0, 1, 1, 187)                              \
+   VALUE_ENTRY(mlb_tx_late, "dig", 2351)                                                  \
+   VALUE_ENTRY(mlb_tx_level, MLB_TX_LEVEL, 2357)                                          \
+   VALUE_ENTRY(can1_load, "%", 2358)                                                      \
+   VALUE_ENTRY(can1_load_1s, "%", 2359)                                                   \
+   VALUE_ENTRY(can1_load_peak, "%", 2360)                                                 \
+   VALUE_ENTRY(can2_load, "%", 2361)                                                      \
+   VALUE_ENTRY(can2_load_1s, "%", 2362)                                                   \
+   VALUE_ENTRY(can2_load_peak, "%", 2363)                                                 \
+   VALUE_ENTRY(can3_load, "%", 2364)                                                      \
+   VALUE_ENTRY(can3_load_1s, "%", 2365)                                                   \
+   VALUE_ENTRY(can3_load_peak, "%", 2366)                                                 \
+   VALUE_ENTRY(gw_forwarded, "dig", 2367)                                                 \
+   VALUE_ENTRY(gw_dropped, "dig", 2368)                                                   \
+   VALUE_ENTRY(gw_latency, "us", 2369)                                                    \
+   VALUE_ENTRY(sniff_overflow, "dig", 2370)                                               \
    VALUE_ENTRY(mlb_chr_HVLM_MaxLadeLeistung, "W", 2300)                                   \
    VALUE_ENTRY(mlb_chr_HVLM_MaxSpannung_DCLS, "V", 2301)                                  \
    VALUE_ENTRY(mlb_chr_HVLM_IstStrom_DCLS, "A", 2302)                                     \
@@ -214,6 +293,9 @@
 #define OPMODES "0=Off, 1=Run, 2=Precharge, 3=PchFail, 4=Charge"
 #define CANSPEEDS "0=125k, 1=250k, 2=500k, 3=800k, 4=1M"
 #define CANPERIODS "0=100ms, 1=10ms"
+#define CAN3SPEEDS "0=33.3k, 1=500k, 2=100k"
+#define GW_IFACES "0=Off, 1=CAN1, 2=CAN2, 3=CAN3"
+#define CANMAP_PERIODS "0=canperiod, 1=10ms, 2=20ms, 3=50ms, 4=100ms, 5=200ms, 6=500ms, 7=1000ms"
 #define CAT_TEST "Testing"
 #define CAT_BMS "BMS"
 #define CAT_HEATER "Heater"
@@ -231,6 +313,8 @@
 #define CAT_SETUP "General Setup"
 #define CAT_TESLA_DCDC "Tesla DCDC"
 #define YESNO "0=No, 1=Yes"
+#define MLB_TX_POLICY "0=Always, 1=VehicleState"
+#define MLB_TX_LEVEL "0=Off, 1=Wake, 2=Full"
 #define CAT_LVDU "Low Voltage Distribution"
 #define CAT_MLB_SIM "MLB Charger Sim"
 #define CHGMODS "0=Off, 1=EXT_DIGI, 2=Volt_Ampera, 3=Leaf_PDM, 4=TeslaOI, 5=Out_lander, 6=Elcon, 7=MGgen2, 8=MLBEvo"
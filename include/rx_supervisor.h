@@ -0,0 +1,56 @@
+#ifndef RX_SUPERVISOR_H
+#define RX_SUPERVISOR_H
+
+#include <stdint.h>
+
+#define RX_SUPERVISOR_MAX_ENTRIES 16
+
+typedef void (*RxFreshnessHandler)(void* ctx, uint32_t id, bool fresh);
+
+// Watches that received CAN messages keep arriving.
+// Modules register an expected period and tolerance per message from
+// SetCanInterface() and call Refresh() with the returned handle for every
+// accepted frame. Tick() runs in the 10 ms task and calls the handler only
+// when a message changes between fresh and stale, so the modules no longer
+// need their own timeout counters.
+// A message that has never been received turns stale once period + tolerance
+// have passed since registration.
+class RxSupervisor
+{
+public:
+    enum State
+    {
+        RX_NEVER,
+        RX_FRESH,
+        RX_STALE
+    };
+
+    static void BeginUpdate();
+    static int Register(uint32_t id, uint16_t periodMs, uint16_t toleranceMs, RxFreshnessHandler handler, void* ctx);
+    static void Refresh(int handle);
+    static void Tick(uint32_t now);
+
+    static State GetState(int handle);
+    static int GetNumEntries() { return numEntries; }
+    static uint32_t GetId(int handle) { return entries[handle].id; }
+    static int GetStale() { return stale; }
+
+private:
+    struct Entry
+    {
+        uint32_t id;
+        uint32_t lastSeen;
+        uint16_t timeout;
+        uint8_t state;
+        volatile bool arrived;
+        RxFreshnessHandler handler;
+        void* ctx;
+    };
+
+    static Entry entries[RX_SUPERVISOR_MAX_ENTRIES];
+    static int numEntries;
+    static int stale;
+    static volatile uint32_t now;
+};
+
+#endif // RX_SUPERVISOR_H
@@ -0,0 +1,58 @@
+#ifndef SPI_DMA_H
+#define SPI_DMA_H
+
+#include <stdint.h>
+
+#define SPI_DMA_QUEUE_SIZE 8 // including the transaction on the bus
+#define SPI_DMA_MAX_LEN 16
+
+// Transaction queue for SPI2, the bytes are moved by DMA1 channel 5 (TX) and
+// channel 4 (RX) instead of the CPU. Every transaction asserts the chip
+// select, shifts its bytes out and the answer in, and releases the chip
+// select in the transfer complete interrupt of the RX channel, which comes
+// after the last byte has been clocked in.
+// The completion callback runs in that interrupt with the received bytes,
+// including the ones clocked in during the command. It may queue follow-up
+// transactions, e.g. read the RX buffer the RX status points to.
+// Blocking users of the same bus (spi_xfer) have to WaitIdle() first.
+class SpiDma
+{
+public:
+    typedef void (*Callback)(void* ctx, const uint8_t* rx, uint8_t len);
+
+    static void Init(void (*chipSelect)(bool active));
+    // tx is copied, returns false if the queue is full
+    static bool Queue(const uint8_t* tx, uint8_t len, Callback done = nullptr, void* ctx = nullptr);
+    static int GetFree() { return SPI_DMA_QUEUE_SIZE - count; }
+    static bool IsBusy() { return count > 0; }
+    // Completes the queue by polling, also works with interrupts masked
+    static void WaitIdle();
+    // DMA1 channel 4 interrupt
+    static void OnComplete();
+
+    static uint32_t GetTransactions() { return transactions; }
+    static uint32_t GetOverflows() { return overflows; }
+    static int GetMaxDepth() { return maxDepth; }
+
+private:
+    struct Transaction
+    {
+        uint8_t tx[SPI_DMA_MAX_LEN];
+        uint8_t len;
+        Callback done;
+        void* ctx;
+    };
+
+    static void Start();
+
+    static Transaction queue[SPI_DMA_QUEUE_SIZE];
+    static uint8_t rx[SPI_DMA_MAX_LEN];
+    static void (*chipSelect)(bool active);
+    static volatile int head;
+    static volatile int count;
+    static uint32_t transactions;
+    static uint32_t overflows;
+    static int maxDepth;
+};
+
+#endif // SPI_DMA_H
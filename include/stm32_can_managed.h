@@ -0,0 +1,55 @@
+#ifndef STM32_CAN_MANAGED_H
+#define STM32_CAN_MANAGED_H
+
+#include <stdint.h>
+#include "stm32_can.h"
+#include "can_filter_planner.h"
+#include "can_tx_queue.h"
+
+// Stm32Can with the filter banks of CAN1 and CAN2 planned together.
+// Whenever the user messages of either interface change, the registrations of
+// both are handed to CanFilterPlanner and all 28 banks plus the CAN2 start
+// bank are rewritten, instead of filling one list bank after the other per
+// interface.
+// Every frame passed to Send() goes through a CanTxQueue, which hands the
+// mailboxes out in priority order. Frames that find all three mailboxes busy
+// wait in the queue until the next Send() or ServiceTx(). The hand-over to
+// the mailbox is timestamped for CanTxTiming, counted by CanBusLoad and
+// logged by CanSniffer.
+// An optional TX gate drops frames before they are queued, see CanMapSchedule.
+class Stm32CanManaged : public Stm32Can
+{
+public:
+    Stm32CanManaged(uint32_t baseAddr, enum baudrates baudrate, bool remap = false);
+
+    using Stm32Can::Send;
+    void Send(uint32_t canId, uint32_t data[2], uint8_t len) override;
+
+    static void ServiceTx();
+    static Stm32CanManaged* GetManaged(int index) { return interfaces[index]; }
+    void SetTxGate(bool (*gate)(uint32_t canId)) { txGate = gate; }
+    const CanTxQueue& GetTxQueue() const { return txQueue; }
+    uint32_t GetTxLatencyUs() const;
+    // Worst of both interfaces
+    static int GetTxQueueMaxDepth();
+    static uint32_t GetTxQueueFailures();
+    static uint32_t GetTxLatencyMaxUs();
+
+    static int GetFilterResult() { return filterResult; }
+    static uint32_t GetTxMailboxFull() { return txMailboxFull; }
+
+private:
+    void ConfigureFilters() override;
+    static void WriteFilterBanks();
+    void DrainTxQueue();
+
+    uint32_t canDev;
+    CanTxQueue txQueue;
+    bool (*volatile txGate)(uint32_t canId);
+
+    static Stm32CanManaged* interfaces[CAN_FILTER_MAX_IFACES];
+    static int filterResult;
+    static volatile uint32_t txMailboxFull;
+};
+
+#endif // STM32_CAN_MANAGED_H
@@ -4,26 +4,36 @@
 #include "bms.h"
 #include "canhardware.h"
 #include "errormessage.h"
+#include "e2e_protection.h"
+#include "tx_on_change.h"
 #include <stdint.h>
 
-#define BMS_TIMEOUT_TICKS 3 // 300ms @ 100ms cycle
+#define BMS_MSG_FIRST_ID 0x41A
+#define BMS_MSG_COUNT 5
+#define BMS_MSG_PERIOD_MS 100
+#define BMS_MSG_TOLERANCE_MS 200 // stale after 300ms
+#define BMS_MSG_ALL_STALE ((1 << BMS_MSG_COUNT) - 1)
 
 class TeensyBMS : public BMS {
 public:
     void SetCanInterface(CanHardware* c) override;
-    void DecodeCAN(int id, uint8_t* data) override;
+    void DecodeCAN(const CanFrame& frame) override;
     float MaxChargeCurrent() override;
     void Task100Ms() override;
+    void Task10Ms() override;
+    void FreshnessChanged(uint32_t id, bool fresh);
 
 private:
-    void parseMsg1(uint8_t* data);
-    void parseMsg2(uint8_t* data);
-    void parseMsg3(uint8_t* data);
-    void parseMsg4(uint8_t* data);
-    void parseMsg5(uint8_t* data);
-    bool checkCrc(uint8_t* data);
+    void parseMsg1(const CanFrame& frame);
+    void parseMsg2(const CanFrame& frame);
+    void parseMsg3(const CanFrame& frame);
+    void parseMsg4(const CanFrame& frame);
+    void parseMsg5(const CanFrame& frame);
+    void SendVcuStatus(uint32_t elapsedMs);
 
-    int timeoutCounter = 0;
+    // One supervised handle per message, a set bit in staleMask means not fresh
+    int rxHandle[BMS_MSG_COUNT] = { -1, -1, -1, -1, -1 };
+    uint8_t staleMask = BMS_MSG_ALL_STALE;
 
     float vMin = 0;
     float vMax = 0;
@@ -56,12 +66,22 @@ private:
 
     // Contactor manager
     uint8_t contactorState = 0;
+    bool hvRequestSent = false;
     bool contactorNegativeInput = false;
     bool contactorPositiveInput = false;
     bool contactorPrechargeInput = false;
     bool contactorSupplyAvailable = false;
 
-    uint8_t txCounter = 0;
+    // Counter/CRC of 0x41A..0x41E. Counter jumps are only counted, not rejected.
+    E2EProtection rxE2E[BMS_MSG_COUNT] = {
+        { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x41A },
+        { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x41B },
+        { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x41C },
+        { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x41D },
+        { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x41E }
+    };
+    E2EProtection txE2E { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x437 };
+    TxOnChange vcuStatusTx;
 };
 
 #endif // TEENSYBMS_H
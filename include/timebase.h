@@ -0,0 +1,25 @@
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include <stdint.h>
+#include <libopencm3/cm3/dwt.h>
+
+// Free running microsecond clock on the DWT cycle counter. The cycle counter
+// wraps after 59 s at 72 MHz, every reading carries the elapsed time over to
+// a 32 bit us count (wraps after 71 minutes). It has to be read at least once
+// per half cycle counter period (29 s), the 100 ms task does that.
+class Timebase
+{
+public:
+    static void SetTicksPerUs(uint32_t ticks) { ticksPerUs = ticks; }
+    static uint32_t Now() { return Extend(dwt_read_cycle_counter()); }
+    // Converts a cycle counter reading taken a moment ago
+    static uint32_t Extend(uint32_t cycles);
+
+private:
+    static uint32_t ticksPerUs;
+    static uint32_t lastCycles;
+    static uint32_t micros;
+};
+
+#endif // TIMEBASE_H
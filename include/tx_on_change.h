@@ -0,0 +1,27 @@
+#ifndef TX_ON_CHANGE_H
+#define TX_ON_CHANGE_H
+
+#include <stdint.h>
+
+// Transmit policy of a slave originated status frame. With a heartbeat of 0
+// every call is due, which keeps the fixed 100 ms cycle. Otherwise a frame is
+// due when its payload differs from the last one sent or the heartbeat has
+// expired. The payload is compared before counter and CRC are filled in, so
+// the E2E counter only advances on frames that actually go out.
+class TxOnChange
+{
+public:
+    bool Due(const uint8_t* payload, uint8_t len, uint32_t elapsedMs, uint32_t heartbeatMs);
+    void Reset() { valid = false; }
+
+    static uint32_t GetSuppressed() { return suppressed; }
+
+private:
+    uint8_t last[8];
+    uint32_t sinceSent = 0;
+    bool valid = false;
+
+    static uint32_t suppressed; // frames held back by all instances
+};
+
+#endif // TX_ON_CHANGE_H
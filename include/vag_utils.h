@@ -28,6 +28,7 @@
  
  namespace vag_utils
  {
+    uint8_t vw_crc_compute(const uint8_t* inputBytes, uint8_t length, uint32_t address);
     uint8_t vw_crc_calc(uint8_t* inputBytes, uint8_t length, uint32_t address);
     uint8_t vw_crc_calc_MQB(uint8_t* inputBytes, uint8_t length, uint32_t address);
  }
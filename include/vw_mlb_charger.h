@@ -29,6 +29,15 @@
 #include "stm32_can.h"
 #include "CANSPI.h"
 #include "vag_utils.h"
+#include "e2e_protection.h"
+#include "mlb_dbc.h"
+
+#define MLB_RX_MSG_COUNT 11
+#define MLB_HVLM_04_PERIOD_MS 100
+#define MLB_HVLM_04_TOLERANCE_MS 400 // stale after 500ms
+#define MLB_TX_MSG_COUNT 26
+#define MLB_TX_TICK_MS 10
+#define MLB_TX_CACHE_SLOTS 10
 
 #define LAD_ISTMODUS_ENUM "0=Standby, 1=AC_Netzladung, 3=DC_Netzladung, 4=PreCharge_aktiv, 5=Fehler, 7=Init"
 enum LAD_IstModus_Enum
@@ -904,7 +913,7 @@ struct ChargerControl {
     uint16_t HVpwr = 0;
     uint16_t HVcur = 0;
     uint16_t calcpwr = 0;
-    bool activate;
+    bool activate = false;
     uint8_t HVActiveDelayOff;
 };
 
@@ -1019,10 +1028,31 @@ class VWMLBClass: public Chargerhw
 public:
       bool ControlCharge(bool RunCh, bool ACReq);
       void SetCanInterface(CanHardware*);
-      void DecodeCAN(int id, uint32_t data[2]);
+      void DecodeCAN(const CanFrame& frame);
       void Task10Ms();
       void Task100Ms();
-
+      void FreshnessChanged(bool fresh);
+
+      struct TxStatus
+      {
+         uint32_t id;
+         uint16_t periodMs;
+         uint16_t phaseMs;
+         uint32_t sent;
+         uint32_t late; // sent on a later tick because of mlb_tx_per_tick
+      };
+      static bool GetTxStatus(int index, TxStatus &status);
+      static uint32_t GetTxLate();
+
+      // Emulated traffic, each level includes the messages of the ones below
+      enum TxLevel
+      {
+         TX_OFF,  // nothing, the charger may fall asleep
+         TX_WAKE, // keeps the charger awake so it reports the plug
+         TX_FULL  // everything the charger needs to charge
+      };
+      static TxLevel GetTxLevel() { return txLevel; }
+      static uint32_t GetTxCacheRebuilds() { return txCacheRebuilds; }
 
 private:
       static constexpr uint32_t ID_ZV_01  = 0x184;
@@ -1052,46 +1082,49 @@ private:
       //void CommandStates();
       void TagParams();
       void CalcValues100ms();
-      void msg3C0();
-      void msg1A1();      // BMS_02     0x1A1
-      void msg2B1();      // MSG_TME_02   0x2B1
-      void msg39D();      // BMS_03     0x39D
-      void msg485();      // NavData_02 0x485
-      void msg509();      // BMS_10     0x509
-      void msg552();      // HVEM_05    0x552
-      void msg583();      // ZV_02      0x583
-      void msg17B();      // FCU_02     0x17B
-      void msg59E();      // BMS_06     0x59E
-      void msg5AC();      // HVEM_02    0x5AC
+      void DecodeReceived();
+      void DecodeFrame(const CanFrame& frame);
+      void msg3C0(uint8_t *buf);
+      void msg1A1(uint8_t *buf);      // BMS_02     0x1A1
+      void msg2B1(uint8_t *buf);      // MSG_TME_02   0x2B1
+      void msg39D(uint8_t *buf);      // BMS_03     0x39D
+      void msg485(uint8_t *buf);      // NavData_02 0x485
+      void msg509(uint8_t *buf);      // BMS_10     0x509
+      void msg552(uint8_t *buf);      // HVEM_05    0x552
+      void msg583(uint8_t *buf);      // ZV_02      0x583
+      void msg17B(uint8_t *buf);      // FCU_02     0x17B
+      void msg59E(uint8_t *buf);      // BMS_06     0x59E
+      void msg5AC(uint8_t *buf);      // HVEM_02    0x5AC
       void msg64F();      // BCM1_04    0x64F
       void msg663();      // NVEM_02    0x663
-      void msg1A555548(); // ORU_01     0x1A555548
-      void msg1A5555AD(); // Authentic_Time_01   0x1A5555AD
-      void msg96A955EB(); // BMS_09     0x96A955EB
-      void msg96A954A6(); // BMS_11     0x96A954A6
-      void msg9A555539(); // BMS_16     0x9A555539
-      void msg9A555552(); // BMS_27     0x9A555552
+      void msg1A555548(uint8_t *buf); // ORU_01     0x1A555548
+      void msg1A5555AD(uint8_t *buf); // Authentic_Time_01   0x1A5555AD
+      void msg96A955EB(uint8_t *buf); // BMS_09     0x96A955EB
+      void msg96A954A6(uint8_t *buf); // BMS_11     0x96A954A6
+      void msg9A555539(uint8_t *buf); // BMS_16     0x9A555539
+      void msg9A555552(uint8_t *buf); // BMS_27     0x9A555552
       void msg040();      // Airbag_01  0x40
-      void msg184();      // ZV_01      0x184
-      void msg191();      // BMS_01     0x191
-      void msg1A2();      // ESP_15   0x1A2
-      void msg2AE();      // DCDC_01    0x2AE
+      void msg184(uint8_t *buf);      // ZV_01      0x184
+      void msg191(uint8_t *buf);      // BMS_01     0x191
+      void msg1A2(uint8_t *buf);      // ESP_15   0x1A2
+      void msg2AE(uint8_t *buf);      // DCDC_01    0x2AE
       void msg37C();      // EM1_HYB_11    0x37C
-      void msg503();      // HVK_01     0x503
-      void msg578();      // BMS_DC_01  0x578
-      void msg5A2();      // BMS_04     0x5A2
-      void msg5CA();      // BMS_07     0x5CA
-      void msg5CD();      // DCDC_03    0x5CD
-      uint8_t vag_cnt3C0            = 0x00;
-      uint8_t vag_cnt184            = 0x00;
-      uint8_t vag_cnt191            = 0x00;
-      uint8_t vag_cnt1A2            = 0x00;
-      uint8_t vag_cnt2AE            = 0x00;
-      uint8_t vag_cnt503            = 0x00;
-      uint8_t vag_cnt578            = 0x00;
-      uint8_t vag_cnt5A2            = 0x00;
-      uint8_t vag_cnt5CA            = 0x00;
-      uint8_t vag_cnt5CD            = 0x00;
+      void msg503(uint8_t *buf);      // HVK_01     0x503
+      void msg578(uint8_t *buf);      // BMS_DC_01  0x578
+      void msg5A2(uint8_t *buf);      // BMS_04     0x5A2
+      void msg5CA(uint8_t *buf);      // BMS_07     0x5CA
+      void msg5CD(uint8_t *buf);      // DCDC_03    0x5CD
+      // VAG counter + CRC of the emulated messages
+      E2EProtection e2e3C0 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, 0x3C0 };
+      E2EProtection e2e184 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_ZV_01 };
+      E2EProtection e2e191 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_BMS_01 };
+      E2EProtection e2e1A2 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_ESP_15 };
+      E2EProtection e2e2AE { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_DCDC_01 };
+      E2EProtection e2e503 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_HVK_01 };
+      E2EProtection e2e578 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_BMS_DC_01 };
+      E2EProtection e2e5A2 { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_BMS_04 };
+      E2EProtection e2e5CA { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_BMS_07 };
+      E2EProtection e2e5CD { E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, ID_DCDC_03 };
 
       VehicleStatus vehicle_status;
       ChargerStatus charger_status;
@@ -1100,6 +1133,69 @@ private:
 
       MLB_State mlb_state{};
 
+      // Latest raw payload per received message. seq is odd while the
+      // receive interrupt writes data, decodedSeq is the last decoded seq.
+      struct RawFrame
+      {
+         volatile uint32_t seq;
+         uint32_t decodedSeq;
+         uint32_t data[2];
+      };
+      RawFrame rxFrames[MLB_RX_MSG_COUNT] = {};
+
+      // Periodic emulated messages, see txTable. The schedule is static
+      // so the terminal can report it, there is only one MLB charger.
+      typedef void (VWMLBClass::*TxPacker)(uint8_t *buf);
+      enum TxMode
+      {
+         TX_PACK,  // packed, counted and signed on every send
+         TX_CACHED // all 16 counter variants signed ahead, see RefreshTxCache()
+      };
+      struct TxMessage
+      {
+         uint32_t id;
+         uint16_t periodMs;
+         uint8_t dlc;
+         TxLevel level; // lowest level that sends the message
+         TxMode mode;   // TX_CACHED needs an e2e member
+         TxPacker pack;
+         E2EProtection VWMLBClass::*e2e; // counter and CRC, or nullptr
+      };
+      struct TxState
+      {
+         uint16_t phase; // [ticks]
+         uint32_t nextDue;
+         uint32_t sent;
+         uint32_t late;
+         int8_t cacheSlot; // -1 if packed
+      };
+      struct TxCache
+      {
+         uint8_t payload[8]; // packer output the frames were signed from
+         uint8_t frames[16][8]; // by counter
+         bool valid;
+      };
+      static const TxMessage txTable[MLB_TX_MSG_COUNT];
+      static TxState txState[MLB_TX_MSG_COUNT];
+      static uint32_t txTick;
+      static bool txPhasesAssigned;
+      static TxLevel txLevel;
+      static TxCache txCache[MLB_TX_CACHE_SLOTS];
+      static uint32_t txCacheRebuilds;
+
+      static void AssignTxPhases();
+      static void AssignTxCacheSlots();
+      static void InvalidateTxCache();
+      void RefreshTxCache();
+      static void ResetTxSchedule();
+      TxLevel SelectTxLevel() const;
+      void SetTxLevel(TxLevel level);
+      void SendDueMessages();
+      void SendTxMessage(int index);
+      // HVLM_04 carries the plug state, charging is only requested while it is fresh
+      int hvlm04Handle = -1;
+      bool hvlm04Fresh = false;
+
       void emulateMLB();
 
       
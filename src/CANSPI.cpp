@@ -24,6 +24,10 @@
 #include "CANSPI.h"
 #include "MCP2515.h"
 #include "params.h"
+#include "can_bus_load.h"
+#include "can_sniffer.h"
+#include "can_frame.h"
+#include "timebase.h"
 
 /**
     Local Function Prototypes
@@ -31,6 +35,8 @@
 uint32_t convertReg2ExtendedCANid(uint8_t tempRXBn_EIDH, uint8_t tempRXBn_EIDL, uint8_t tempRXBn_SIDH, uint8_t tempRXBn_SIDL);
 uint32_t convertReg2StandardCANid(uint8_t tempRXBn_SIDH, uint8_t tempRXBn_SIDL) ;
 void convertCANid2Reg(uint32_t tempPassedInID, uint8_t canIdType, id_reg_t *passedIdReg);
+static void decodeRxReg(ctrl_rx_status_t rxStatus, const uint8_t *regs, uCAN_MSG *tempCanMsg);
+static void recordTx(const uCAN_MSG *tempCanMsg);
 
 /**
     Local Variables
@@ -39,6 +45,16 @@ ctrl_status_t ctrlStatus;
 ctrl_error_status_t errorStatus;
 id_reg_t idReg;
 
+//State of the SpiDma receive and transmit chains
+static void (*rxDmaCallback)(uCAN_MSG *tempCanMsg);
+static ctrl_rx_status_t rxDmaStatus;
+static volatile bool rxDmaBusy;
+static uCAN_MSG txDmaMsg;
+static id_reg_t txDmaIdReg;
+static volatile bool txDmaBusy;
+static void (*txDmaCallback)(void);
+static uint32_t txDmaDropped;
+
 /**
  CAN SPI APIs
 */
@@ -146,6 +162,7 @@ if(Param::GetInt(Param::CAN3Speed)==1)
       MCP2515_Write_Byte(MCP2515_CNF1, 0x40);//500kbps at 16HMz xtal.
       MCP2515_Write_Byte(MCP2515_CNF2, 0xe5);
       MCP2515_Write_Byte(MCP2515_CNF3, 0x83);
+      CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN3, 500000);
 }
 
 if(Param::GetInt(Param::CAN3Speed)==2)
@@ -153,6 +170,7 @@ if(Param::GetInt(Param::CAN3Speed)==2)
    MCP2515_Write_Byte(MCP2515_CNF1, 0x03);//100kbps at 16HMz xtal.
    MCP2515_Write_Byte(MCP2515_CNF2, 0xFA);
    MCP2515_Write_Byte(MCP2515_CNF3, 0x87);
+   CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN3, 100000);
 }
 
 if(Param::GetInt(Param::CAN3Speed)==0)
@@ -160,6 +178,7 @@ if(Param::GetInt(Param::CAN3Speed)==0)
    MCP2515_Write_Byte(MCP2515_CNF1, 0x4E);//33kbps at 16HMz xtal.
    MCP2515_Write_Byte(MCP2515_CNF2, 0xe5);
    MCP2515_Write_Byte(MCP2515_CNF3, 0x83);
+   CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN3, 33333);
 }
 
 
@@ -205,9 +224,100 @@ uint8_t CANSPI_Transmit(uCAN_MSG *tempCanMsg)
       returnValue = 1;
    }
 
+   if (returnValue)
+   {
+      recordTx(tempCanMsg);
+   }
+
    return (returnValue);
 }
 
+static void txDmaSent(void *ctx, const uint8_t *rx, uint8_t len)
+{
+   (void)ctx; (void)rx; (void)len;
+
+   recordTx(&txDmaMsg);
+   txDmaBusy = false;
+
+   if (txDmaCallback)
+      txDmaCallback();
+}
+
+//Picks the free TX buffer like CANSPI_Transmit() and queues load and RTS
+static void txDmaStatus(void *ctx, const uint8_t *rx, uint8_t len)
+{
+   static const uint8_t loadInst[] = { MCP2515_LOAD_TXB0SIDH, MCP2515_LOAD_TXB1SIDH, MCP2515_LOAD_TXB2SIDH };
+   static const uint8_t rtsInst[] = { MCP2515_RTS_TX0, MCP2515_RTS_TX1, MCP2515_RTS_TX2 };
+   ctrl_status_t status;
+   int buffer = -1;
+
+   (void)ctx; (void)len;
+   status.ctrl_status = rx[1];
+
+   if (status.ctrl.TXB0REQ == 0)
+      buffer = 0;
+   else if (status.ctrl.TXB1REQ == 0)
+      buffer = 1;
+   else if (status.ctrl.TXB2REQ == 0)
+      buffer = 2;
+
+   if (buffer < 0 || !MCP2515_Load_TxSequence_Dma(loadInst[buffer], &(txDmaIdReg.tempSIDH), txDmaMsg.frame.dlc,
+                                                  &(txDmaMsg.frame.data0), rtsInst[buffer], txDmaSent, nullptr))
+   {
+      txDmaDropped++;
+      txDmaBusy = false;
+
+      if (txDmaCallback)
+         txDmaCallback();
+   }
+}
+
+//Same as CANSPI_Transmit() without waiting for the SPI bus: the status read,
+//the buffer load and the RTS run on SpiDma. The frame is copied, one frame
+//is in flight at a time. Returns 0 if the previous one is not sent yet or
+//the queue is full, frames finding all TX buffers busy are counted in
+//CANSPI_GetTxDmaDropped(). sent is called from the DMA interrupt when the
+//frame is in a TX buffer or dropped, the next frame may be passed from there.
+uint8_t CANSPI_TransmitDma(uCAN_MSG *tempCanMsg, void (*sent)(void))
+{
+   if (txDmaBusy)
+      return 0;
+
+   txDmaCallback = sent;
+   txDmaMsg = *tempCanMsg;
+   txDmaIdReg.tempSIDH = 0;
+   txDmaIdReg.tempSIDL = 0;
+   txDmaIdReg.tempEID8 = 0;
+   txDmaIdReg.tempEID0 = 0;
+   convertCANid2Reg(txDmaMsg.frame.id, txDmaMsg.frame.idType, &txDmaIdReg);
+   txDmaBusy = true;
+
+   if (!MCP2515_Read_Status_Dma(txDmaStatus, nullptr))
+   {
+      txDmaBusy = false;
+      return 0;
+   }
+   return 1;
+}
+
+uint8_t CANSPI_isTxDmaBusy(void)
+{
+   return txDmaBusy;
+}
+
+uint32_t CANSPI_GetTxDmaDropped(void)
+{
+   return txDmaDropped;
+}
+
+static void recordTx(const uCAN_MSG *tempCanMsg)
+{
+   CanBusLoad::Record(CAN_BUS_LOAD_CAN3, tempCanMsg->frame.idType == dEXTENDED_CAN_MSG_ID_2_0B, tempCanMsg->frame.dlc);
+   if (CanSniffer::IsActive())
+      CanSniffer::Capture(CAN_BUS_LOAD_CAN3, true, tempCanMsg->frame.id | (tempCanMsg->frame.idType == dEXTENDED_CAN_MSG_ID_2_0B ? CAN_FRAME_EXT_FLAG : 0),
+                          &tempCanMsg->frame.data0, tempCanMsg->frame.dlc, Timebase::Now());
+}
+
 uint8_t CANSPI_receive(uCAN_MSG *tempCanMsg)
 {
    uint8_t returnValue = 0;
@@ -229,32 +339,93 @@ uint8_t CANSPI_receive(uCAN_MSG *tempCanMsg)
          MCP2515_Read_RxbSequence(MCP2515_READ_RXB1SIDH, sizeof(rxReg.rx_reg_array), rxReg.rx_reg_array);
       }
 
-      if (rxStatus.ctrlRx.msgType == dEXTENDED_CAN_MSG_ID_2_0B)
-      {
-         tempCanMsg->frame.idType = (uint8_t) dEXTENDED_CAN_MSG_ID_2_0B;
-         tempCanMsg->frame.id = convertReg2ExtendedCANid(rxReg.RxReg.RXBnEID8, rxReg.RxReg.RXBnEID0, rxReg.RxReg.RXBnSIDH, rxReg.RxReg.RXBnSIDL);
-      }
-      else
-      {
-         tempCanMsg->frame.idType = (uint8_t) dSTANDARD_CAN_MSG_ID_2_0B;
-         tempCanMsg->frame.id = convertReg2StandardCANid(rxReg.RxReg.RXBnSIDH, rxReg.RxReg.RXBnSIDL);
-      }
-
-      tempCanMsg->frame.dlc   = rxReg.RxReg.RXBnDLC;
-      tempCanMsg->frame.data0 = rxReg.RxReg.RXBnD0;
-      tempCanMsg->frame.data1 = rxReg.RxReg.RXBnD1;
-      tempCanMsg->frame.data2 = rxReg.RxReg.RXBnD2;
-      tempCanMsg->frame.data3 = rxReg.RxReg.RXBnD3;
-      tempCanMsg->frame.data4 = rxReg.RxReg.RXBnD4;
-      tempCanMsg->frame.data5 = rxReg.RxReg.RXBnD5;
-      tempCanMsg->frame.data6 = rxReg.RxReg.RXBnD6;
-      tempCanMsg->frame.data7 = rxReg.RxReg.RXBnD7;
-
+      decodeRxReg(rxStatus, rxReg.rx_reg_array, tempCanMsg);
       returnValue = 1;
    }
    return (returnValue);
 }
 
+static void rxDmaBuffer(void *ctx, const uint8_t *rx, uint8_t len)
+{
+   uCAN_MSG msg;
+
+   (void)ctx; (void)len;
+   decodeRxReg(rxDmaStatus, rx + 1, &msg);
+   rxDmaBusy = false;
+   rxDmaCallback(&msg);
+}
+
+//Reads the buffer the RX status points to, RXB0 first like CANSPI_receive()
+static void rxDmaStatusRead(void *ctx, const uint8_t *rx, uint8_t len)
+{
+   (void)ctx; (void)len;
+   rxDmaStatus.ctrl_rx_status = rx[1];
+
+   if (rxDmaStatus.ctrlRx.rxBuffer == 0 ||
+       !MCP2515_Read_RxbSequence_Dma(rxDmaStatus.ctrlRx.rxBuffer == MSG_IN_RXB1 ? MCP2515_READ_RXB1SIDH : MCP2515_READ_RXB0SIDH,
+                                     sizeof(rx_reg_t), rxDmaBuffer, nullptr))
+   {
+      rxDmaBusy = false;
+   }
+}
+
+//Same as CANSPI_receive() without waiting for the SPI bus: the RX status and
+//the buffer are read on SpiDma and received is called from the DMA interrupt
+//with the frame, nothing is called if there is none. Returns 0 while the
+//previous read is still running or the queue is full.
+uint8_t CANSPI_ReceiveDma(void (*received)(uCAN_MSG *tempCanMsg))
+{
+   if (rxDmaBusy)
+      return 0;
+
+   rxDmaCallback = received;
+   rxDmaBusy = true;
+
+   if (!MCP2515_Get_RxStatus_Dma(rxDmaStatusRead, nullptr))
+   {
+      rxDmaBusy = false;
+      return 0;
+   }
+   return 1;
+}
+
+//regs = RXBnSIDH to RXBnD7 as read from the controller
+static void decodeRxReg(ctrl_rx_status_t rxStatus, const uint8_t *regs, uCAN_MSG *tempCanMsg)
+{
+   rx_reg_t rxReg;
+
+   for (uint8_t i = 0; i < sizeof(rxReg.rx_reg_array); i++)
+   {
+      rxReg.rx_reg_array[i] = regs[i];
+   }
+
+   if (rxStatus.ctrlRx.msgType == dEXTENDED_CAN_MSG_ID_2_0B)
+   {
+      tempCanMsg->frame.idType = (uint8_t) dEXTENDED_CAN_MSG_ID_2_0B;
+      tempCanMsg->frame.id = convertReg2ExtendedCANid(rxReg.RxReg.RXBnEID8, rxReg.RxReg.RXBnEID0, rxReg.RxReg.RXBnSIDH, rxReg.RxReg.RXBnSIDL);
+   }
+   else
+   {
+      tempCanMsg->frame.idType = (uint8_t) dSTANDARD_CAN_MSG_ID_2_0B;
+      tempCanMsg->frame.id = convertReg2StandardCANid(rxReg.RxReg.RXBnSIDH, rxReg.RxReg.RXBnSIDL);
+   }
+
+   tempCanMsg->frame.dlc   = rxReg.RxReg.RXBnDLC;
+   tempCanMsg->frame.data0 = rxReg.RxReg.RXBnD0;
+   tempCanMsg->frame.data1 = rxReg.RxReg.RXBnD1;
+   tempCanMsg->frame.data2 = rxReg.RxReg.RXBnD2;
+   tempCanMsg->frame.data3 = rxReg.RxReg.RXBnD3;
+   tempCanMsg->frame.data4 = rxReg.RxReg.RXBnD4;
+   tempCanMsg->frame.data5 = rxReg.RxReg.RXBnD5;
+   tempCanMsg->frame.data6 = rxReg.RxReg.RXBnD6;
+   tempCanMsg->frame.data7 = rxReg.RxReg.RXBnD7;
+
+   CanBusLoad::Record(CAN_BUS_LOAD_CAN3, tempCanMsg->frame.idType == dEXTENDED_CAN_MSG_ID_2_0B, tempCanMsg->frame.dlc & 0x0F);
+   if (CanSniffer::IsActive())
+      CanSniffer::Capture(CAN_BUS_LOAD_CAN3, false, tempCanMsg->frame.id | (tempCanMsg->frame.idType == dEXTENDED_CAN_MSG_ID_2_0B ? CAN_FRAME_EXT_FLAG : 0),
+                          &tempCanMsg->frame.data0, tempCanMsg->frame.dlc & 0x0F, Timebase::Now());
+}
+
 uint8_t CANSPI_messagesInBuffer(void)
 {
    uint8_t messageCount = 0;
@@ -27,9 +27,9 @@
 #include "MCP2515.h"
 //#include "pin_manager.h"
 
-//Defines for chip select
+//Defines for chip select, the blocking functions wait for queued DMA transactions first
 #define MCP2515_CS_HIGH()   DigIo::mcp_cs.Set();;
-#define MCP2515_CS_LOW()    DigIo::mcp_cs.Clear();;
+#define MCP2515_CS_LOW()    SpiDma::WaitIdle(); DigIo::mcp_cs.Clear();;
 #define SPI_CAN                 SPI2
 #define SPI_TIMEOUT             10
 
@@ -37,11 +37,26 @@
 static uint8_t readDummy;
 static uint8_t writeDummy = 0x00;
 
+static void MCP2515_Select(bool active)
+{
+   if (active)
+      DigIo::mcp_cs.Clear();
+   else
+      DigIo::mcp_cs.Set();
+}
+
+//SPI2 RX DMA transfer complete, ends the running SpiDma transaction
+extern "C" void dma1_channel4_isr(void)
+{
+   SpiDma::OnComplete();
+}
+
 //Set CAN controller to config mode
 void MCP2515_Initialize(void)
 {
    //MCP2515_CS_HIGH();
    spi_enable(SPI2);
+   SpiDma::Init(MCP2515_Select);
 }
 
 //Set CAN contoller to config mode
@@ -189,6 +204,60 @@ void MCP2515_Load_TxSequence(uint8_t loadtxBnSidhInst, uint8_t *idReg, uint8_t d
    MCP2515_CS_HIGH();
 }
 
+//Same as MCP2515_Read_RxbSequence() on SpiDma, done gets the data from rx[1] on
+//rxLength = up to SPI_DMA_MAX_LEN - 1 bytes
+bool MCP2515_Read_RxbSequence_Dma(uint8_t readRxBuffInst, uint8_t rxLength, SpiDma::Callback done, void* ctx)
+{
+   uint8_t tx[SPI_DMA_MAX_LEN] = { readRxBuffInst };
+
+   if (rxLength >= SPI_DMA_MAX_LEN)
+      return false;
+
+   return SpiDma::Queue(tx, rxLength + 1, done, ctx);
+}
+
+//Same as MCP2515_Load_TxSequence() followed by MCP2515_RequestToSend() on SpiDma,
+//done is called after the RTS instruction
+bool MCP2515_Load_TxSequence_Dma(uint8_t loadtxBnSidhInst, uint8_t *idReg, uint8_t dlc, uint8_t *txData,
+                                 uint8_t rtsTxBuffInst, SpiDma::Callback done, void* ctx)
+{
+   uint8_t tx[14];
+
+   //Both or nothing, a load without RTS would block the TX buffer
+   if (SpiDma::GetFree() < 2)
+      return false;
+
+   tx[0] = loadtxBnSidhInst;
+   for(uint8_t i = 0; i < 4; i++)
+   {
+      tx[1 + i] = idReg[i];
+   }
+   tx[5] = dlc;
+   for(uint8_t i = 0; i < 8; i++)
+   {
+      tx[6 + i] = txData[i];
+   }
+
+   SpiDma::Queue(tx, sizeof(tx));
+   return SpiDma::Queue(&rtsTxBuffInst, 1, done, ctx);
+}
+
+//Same as MCP2515_Read_Status() on SpiDma, done gets the status in rx[1]
+bool MCP2515_Read_Status_Dma(SpiDma::Callback done, void* ctx)
+{
+   const uint8_t tx[2] = { MCP2515_READ_STATUS, 0 };
+
+   return SpiDma::Queue(tx, sizeof(tx), done, ctx);
+}
+
+//Same as MCP2515_Get_RxStatus() on SpiDma, done gets the status in rx[1]
+bool MCP2515_Get_RxStatus_Dma(SpiDma::Callback done, void* ctx)
+{
+   const uint8_t tx[2] = { MCP2515_RX_STATUS, 0 };
+
+   return SpiDma::Queue(tx, sizeof(tx), done, ctx);
+}
+
 //Write one byte to a tx buffer
 //loadTxBuffInst = instruction to load to a TXBnSIDH or TXBnD0 buffer
 //loadTxData = data to load to the given buffer
@@ -24,10 +24,14 @@
 #include "TeslaDCDC.h"
 #include "lvdu.h" // for VehicleState enums
 #include "errormessage.h"
+#include "can_dispatch.h"
+#include "rx_supervisor.h"
+#include "can_tx_queue.h"
 
  #define TESLA_DCDC_STATUS_ID     0x210
  #define TESLA_DCDC_CMD_ID        0x3D8
- #define TESLA_DCDC_TIMEOUT_TICKS 10  // 10 x 100ms = 1000ms
+ #define TESLA_DCDC_STATUS_PERIOD_MS    100
+ #define TESLA_DCDC_STATUS_TOLERANCE_MS 900 // stale after 1000ms
 #define DCDC_OFF_CONFIRM_STEPS 5
 #define DCDC_INPUT_POWER_OFF_THRESHOLD_W 50.0f
 
@@ -58,22 +62,47 @@ void TeslaDCDC::UpdateInputPowerOffConfirmed(bool monitorOffCondition)
     Param::SetInt(Param::dcdc_input_power_off_confirmed, dcdcOffCounter >= DCDC_OFF_CONFIRM_STEPS ? 1 : 0);
 }
  
+ static void HandleRx(void* ctx, const CanFrame& frame)
+ {
+     static_cast<TeslaDCDC*>(ctx)->DecodeCAN(frame);
+ }
+
+ static void HandleFreshness(void* ctx, uint32_t, bool fresh)
+ {
+     static_cast<TeslaDCDC*>(ctx)->FreshnessChanged(fresh);
+ }
+ 
  void TeslaDCDC::SetCanInterface(CanHardware* c)
  {
      if (!c)
          return;
  
      can = c;
+     CanTxQueue::SetUrgent(TESLA_DCDC_CMD_ID); // keeps the 12V supply enabled
      can->RegisterUserMessage(TESLA_DCDC_STATUS_ID);
-     timeoutCounter = 0;
+     CanDispatch::Register(TESLA_DCDC_STATUS_ID, HandleRx, this);
+     rxHandle = RxSupervisor::Register(TESLA_DCDC_STATUS_ID, TESLA_DCDC_STATUS_PERIOD_MS,
+                                       TESLA_DCDC_STATUS_TOLERANCE_MS, HandleFreshness, this);
+ }
+
+ // Fresh status frames clear the fault flag again in DecodeCAN()
+ void TeslaDCDC::FreshnessChanged(bool fresh)
+ {
+     if (!fresh)
+     {
+         ErrorMessage::Post(ERR_DCDC_TIMEOUT);
+         Param::SetInt(Param::dcdc_fault_any, 1);
+     }
  }
  
- void TeslaDCDC::DecodeCAN(int id, uint8_t *data)
+ void TeslaDCDC::DecodeCAN(const CanFrame& frame)
  {
-     if (id != TESLA_DCDC_STATUS_ID || !data)
+     if (frame.GetId() != TESLA_DCDC_STATUS_ID)
          return;
+
+     const uint8_t* data = frame.Bytes();
  
-     timeoutCounter = 0;
+     RxSupervisor::Refresh(rxHandle);
  
      // Byte 0: Fault flags
      bool heaterShorted     = data[0] & (1 << 0);
@@ -144,14 +173,6 @@ void TeslaDCDC::UpdateInputPowerOffConfirmed(bool monitorOffCondition)
     float DCSetVal = Param::GetFloat(Param::dcdc_voltage_setpoint);
     uint8_t bytes[8] = {0};
 
-    // Timeout handling
-    timeoutCounter++;
-    if (timeoutCounter > TESLA_DCDC_TIMEOUT_TICKS)
-    {
-        ErrorMessage::Post(ERR_DCDC_TIMEOUT);
-        Param::SetInt(Param::dcdc_fault_any, 1);
-    }
-
     // Enable DC output only when HV is connected
     int hvState = Param::GetInt(Param::HVCM_state);
     bool outputEnabled = (hvState == HvContactorManager::HV_CONNECTED);
@@ -0,0 +1,48 @@
+#include "can_bus_load.h"
+
+#define FRAME_BITS(ext) { CanBusLoad::FrameBits(ext, 0), CanBusLoad::FrameBits(ext, 1), CanBusLoad::FrameBits(ext, 2), \
+                          CanBusLoad::FrameBits(ext, 3), CanBusLoad::FrameBits(ext, 4), CanBusLoad::FrameBits(ext, 5), \
+                          CanBusLoad::FrameBits(ext, 6), CanBusLoad::FrameBits(ext, 7), CanBusLoad::FrameBits(ext, 8) }
+
+const uint16_t CanBusLoad::frameBits[2][9] = { FRAME_BITS(false), FRAME_BITS(true) };
+volatile uint32_t CanBusLoad::bits[CAN_BUS_LOAD_IFACES];
+uint32_t CanBusLoad::bitrate[CAN_BUS_LOAD_IFACES];
+uint32_t CanBusLoad::lastBits[CAN_BUS_LOAD_IFACES];
+uint32_t CanBusLoad::windows[CAN_BUS_LOAD_IFACES][CAN_BUS_LOAD_WINDOWS];
+int CanBusLoad::window = 0;
+uint32_t CanBusLoad::load[CAN_BUS_LOAD_IFACES];
+uint32_t CanBusLoad::load1s[CAN_BUS_LOAD_IFACES];
+uint32_t CanBusLoad::peak[CAN_BUS_LOAD_IFACES];
+
+// The 1 s average is over the last CAN_BUS_LOAD_WINDOWS calls
+void CanBusLoad::Update()
+{
+    for (int i = 0; i < CAN_BUS_LOAD_IFACES; i++)
+    {
+        const uint32_t total = bits[i];
+        const uint32_t windowBits = total - lastBits[i];
+        uint32_t sum = 0;
+
+        lastBits[i] = total;
+        windows[i][window] = windowBits;
+        for (int w = 0; w < CAN_BUS_LOAD_WINDOWS; w++)
+            sum += windows[i][w];
+
+        if (bitrate[i] == 0)
+            continue;
+
+        // 100 ms hold bitrate / 10 bits, in 0.1 % that is windowBits * 10000 / bitrate
+        load[i] = static_cast<uint64_t>(windowBits) * 10000 / bitrate[i];
+        load1s[i] = static_cast<uint64_t>(sum) * 1000 / bitrate[i];
+        if (load[i] > peak[i])
+            peak[i] = load[i];
+    }
+
+    window = (window + 1) % CAN_BUS_LOAD_WINDOWS;
+}
+
+void CanBusLoad::ResetPeak()
+{
+    for (int i = 0; i < CAN_BUS_LOAD_IFACES; i++)
+        peak[i] = 0;
+}
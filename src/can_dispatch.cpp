@@ -0,0 +1,102 @@
+#include "can_dispatch.h"
+
+
+uint32_t CanDispatch::ids[CAN_DISPATCH_MAX_ENTRIES];
+CanDispatch::Target CanDispatch::targets[CAN_DISPATCH_MAX_ENTRIES];
+volatile int CanDispatch::numEntries = 0;
+volatile bool CanDispatch::ready = false;
+volatile uint32_t CanDispatch::unmatched = 0;
+
+// Table key: the 29 bit ID plus the IDE bit. IDs up to 0x7FF only count as
+// extended when flagged, Stm32Can never flags them.
+static uint32_t Key(uint32_t id)
+{
+    const bool ext = (id & CAN_FRAME_EXT_FLAG) != 0 || (id & CAN_FRAME_ID_MASK) > CAN_FRAME_STD_MAX;
+
+    return (id & CAN_FRAME_ID_MASK) | (ext ? CAN_FRAME_EXT_FLAG : 0);
+}
+
+// Frames received while the table is rebuilt are dropped, the modules
+// are being re-assigned to their interfaces at that time anyway.
+void CanDispatch::BeginUpdate()
+{
+    ready = false;
+    numEntries = 0;
+}
+
+void CanDispatch::EndUpdate()
+{
+    ready = true;
+}
+
+bool CanDispatch::Register(uint32_t id, CanRxHandler handler, void* ctx)
+{
+    id = Key(id);
+
+    int slot = Find(id);
+
+    if (slot >= 0)
+    {
+        // Same ID registered twice, e.g. raw and flag-encoded extended ID
+        return targets[slot].handler == handler && targets[slot].ctx == ctx;
+    }
+
+    if (numEntries >= CAN_DISPATCH_MAX_ENTRIES)
+        return false;
+
+    // Insertion sort, the table is only built from SetCanFilters()
+    int pos = numEntries;
+    while (pos > 0 && ids[pos - 1] > id)
+    {
+        ids[pos] = ids[pos - 1];
+        targets[pos] = targets[pos - 1];
+        pos--;
+    }
+
+    ids[pos] = id;
+    targets[pos].handler = handler;
+    targets[pos].ctx = ctx;
+    numEntries = numEntries + 1;
+    return true;
+}
+
+int CanDispatch::Find(uint32_t id)
+{
+    int lo = 0;
+    int hi = numEntries;
+
+    id = Key(id);
+
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+
+        if (ids[mid] < id)
+            lo = mid + 1;
+        else if (ids[mid] > id)
+            hi = mid;
+        else
+            return mid;
+    }
+    return -1;
+}
+
+int CanDispatch::Dispatch(uint32_t id, const uint32_t data[2], uint8_t dlc, uint32_t timeUs)
+{
+    return DispatchSlot(Find(id), id, data, dlc, timeUs);
+}
+
+int CanDispatch::DispatchSlot(int slot, uint32_t id, const uint32_t data[2], uint8_t dlc, uint32_t timeUs)
+{
+    if (!ready)
+        return -1;
+
+    if (slot < 0)
+    {
+        unmatched = unmatched + 1;
+        return -1;
+    }
+
+    targets[slot].handler(targets[slot].ctx, CanFrame(id, data, dlc, timeUs));
+    return slot;
+}
@@ -0,0 +1,384 @@
+#include "can_filter_planner.h"
+#include <string.h>
+
+#define CAN_FILTER_STD_MASK 0x7FFU
+#define CAN_FILTER_EXT_MASK 0x1FFFFFFFU
+#define CAN_FILTER_EXT_FLAG 0x80000000U
+// Groups further apart in ID order than this are not tried as a merge pair
+#define CAN_FILTER_MERGE_WINDOW 8
+// Iface::overflow bits, an ID of that format did not fit the ID table
+#define CAN_FILTER_OVERFLOW_STD 1
+#define CAN_FILTER_OVERFLOW_EXT 2
+
+// Register layout of a filter entry: 16 bit STID[15:5] RTR[4] IDE[3],
+// 32 bit EXID[31:3] IDE[2] RTR[1]. Masks always compare IDE and RTR, so
+// neither remote frames nor the other ID format get through.
+#define FILTER16_ID(id) ((uint32_t)(id) << 5)
+#define FILTER16_MASK(mask) (((uint32_t)(mask) << 5) | 0x18)
+#define FILTER32_ID(id) (((uint32_t)(id) << 3) | 0x4)
+#define FILTER32_MASK(mask) (((uint32_t)(mask) << 3) | 0x6)
+
+CanFilterPlanner::Iface CanFilterPlanner::ifaces[CAN_FILTER_MAX_IFACES];
+CanFilterPlanner::Bank CanFilterPlanner::banks[CAN_FILTER_BANKS];
+int CanFilterPlanner::numBanks = 0;
+int CanFilterPlanner::firstBank[CAN_FILTER_MAX_IFACES];
+CanFilterPlanner::Group CanFilterPlanner::candidate[CAN_FILTER_MAX_GROUPS];
+CanFilterPlanner::Group CanFilterPlanner::best[CAN_FILTER_MAX_GROUPS];
+
+void CanFilterPlanner::Begin()
+{
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        ifaces[i].numIds = 0;
+        ifaces[i].numGroups = 0;
+        ifaces[i].banks = 0;
+        ifaces[i].overflow = 0;
+        firstBank[i] = 0;
+    }
+    numBanks = 0;
+}
+
+// Keeps the IDs sorted and unique, standard IDs first
+bool CanFilterPlanner::Add(int iface, uint32_t id)
+{
+    if (iface < 0 || iface >= CAN_FILTER_MAX_IFACES)
+        return false;
+
+    Iface& f = ifaces[iface];
+    const bool ext = (id & CAN_FILTER_EXT_FLAG) || (id & CAN_FILTER_EXT_MASK) > CAN_FILTER_STD_MASK;
+    const uint32_t key = (id & CAN_FILTER_EXT_MASK) | (ext ? CAN_FILTER_EXT_FLAG : 0);
+    int pos = f.numIds;
+
+    for (int i = 0; i < f.numIds; i++)
+    {
+        if (f.ids[i] == key)
+            return true;
+        if (f.ids[i] > key)
+        {
+            pos = i;
+            break;
+        }
+    }
+
+    if (f.numIds >= CAN_FILTER_MAX_IDS)
+    {
+        // Plan() opens the filter for this format so the ID still gets through
+        f.overflow |= ext ? CAN_FILTER_OVERFLOW_EXT : CAN_FILTER_OVERFLOW_STD;
+        return false;
+    }
+
+    memmove(&f.ids[pos + 1], &f.ids[pos], (f.numIds - pos) * sizeof(f.ids[0]));
+    f.ids[pos] = key;
+    f.numIds++;
+    return true;
+}
+
+int CanFilterPlanner::Plan(int totalBanks)
+{
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        Iface& f = ifaces[i];
+
+        for (int n = 0; n < f.numIds; n++)
+        {
+            Group& g = f.groups[n];
+            g.ext = (f.ids[n] & CAN_FILTER_EXT_FLAG) != 0;
+            g.id = f.ids[n] & CAN_FILTER_EXT_MASK;
+            g.mask = g.ext ? CAN_FILTER_EXT_MASK : CAN_FILTER_STD_MASK;
+            g.members = 1;
+        }
+        f.numGroups = f.numIds;
+        if (f.overflow)
+            OpenOverflowed(f);
+        f.banks = CountBanks(f.groups, f.numGroups);
+    }
+
+    // Merge one pair at a time. Within budget only merges that save a bank for
+    // free are taken, above budget the one admitting the fewest extra IDs.
+    for (;;)
+    {
+        const bool overBudget = Need() > totalBanks;
+        int bestIface = -1;
+        int bestCount = 0;
+        int bestBanks = 0;
+        uint32_t bestAdded = 0;
+
+        for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+        {
+            const Iface& f = ifaces[i];
+
+            for (int a = 0; a < f.numGroups; a++)
+            {
+                for (int b = a + 1; b < f.numGroups && b <= a + CAN_FILTER_MERGE_WINDOW; b++)
+                {
+                    if (f.groups[b].ext != f.groups[a].ext)
+                        break;
+
+                    uint32_t added;
+                    const int count = MergeInto(f, a, b, candidate, added);
+                    const int nb = CountBanks(candidate, count);
+
+                    if (overBudget ? nb > f.banks : (added > 0 || nb >= f.banks))
+                        continue;
+                    if (bestIface >= 0 && (added > bestAdded || (added == bestAdded && nb >= bestBanks)))
+                        continue;
+
+                    bestIface = i;
+                    bestCount = count;
+                    bestBanks = nb;
+                    bestAdded = added;
+                    memcpy(best, candidate, count * sizeof(best[0]));
+                }
+            }
+        }
+
+        if (bestIface < 0)
+            break;
+
+        Iface& f = ifaces[bestIface];
+        memcpy(f.groups, best, bestCount * sizeof(best[0]));
+        f.numGroups = bestCount;
+        f.banks = bestBanks;
+    }
+
+    numBanks = 0;
+
+    if (Need() > totalBanks)
+        return -1;
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+        Emit(i);
+
+    int used = 0;
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+        used += ifaces[i].banks;
+    return used;
+}
+
+uint32_t CanFilterPlanner::GetExtra(int iface)
+{
+    const Iface& f = ifaces[iface];
+    uint32_t extra = 0;
+
+    for (int i = 0; i < f.numGroups; i++)
+        extra += Covered(f.groups[i]) - f.groups[i].members;
+    return extra;
+}
+
+uint32_t CanFilterPlanner::GetExtra()
+{
+    uint32_t extra = 0;
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+        extra += GetExtra(i);
+    return extra;
+}
+
+bool CanFilterPlanner::IsOverflowed(int iface)
+{
+    return ifaces[iface].overflow != 0;
+}
+
+// Replaces all groups of an overflowed format by one that accepts every ID of
+// that format, the IDs are then only checked by CanDispatch
+void CanFilterPlanner::OpenOverflowed(Iface& f)
+{
+    int count = 0;
+
+    for (int ext = 0; ext < 2; ext++)
+    {
+        const bool open = f.overflow & (ext ? CAN_FILTER_OVERFLOW_EXT : CAN_FILTER_OVERFLOW_STD);
+        int members = 0;
+
+        for (int i = 0; i < f.numGroups; i++)
+        {
+            if (f.groups[i].ext != ext)
+                continue;
+            if (open)
+                members++;
+            else
+                candidate[count++] = f.groups[i];
+        }
+
+        if (open)
+        {
+            Group& g = candidate[count++];
+            g.id = 0;
+            g.mask = 0;
+            g.ext = ext;
+            g.members = members;
+        }
+    }
+    memcpy(f.groups, candidate, count * sizeof(candidate[0]));
+    f.numGroups = count;
+}
+
+// The CAN2 start bank can not be 0, so every interface occupies at least one bank
+int CanFilterPlanner::Need()
+{
+    int need = 0;
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+        need += ifaces[i].banks > 0 ? ifaces[i].banks : 1;
+    return need;
+}
+
+int CanFilterPlanner::CountBanks(const Group* groups, int count)
+{
+    int list16 = 0, mask16 = 0, list32 = 0, mask32 = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const bool single = Covered(groups[i]) == 1;
+
+        if (groups[i].ext)
+            single ? list32++ : mask32++;
+        else
+            single ? list16++ : mask16++;
+    }
+
+    return (list16 + 3) / 4 + (mask16 + 1) / 2 + (list32 + 1) / 2 + mask32;
+}
+
+// Masks are always contiguous from the top, so a group is an aligned block of IDs
+uint32_t CanFilterPlanner::Covered(const Group& g)
+{
+    const uint32_t full = g.ext ? CAN_FILTER_EXT_MASK : CAN_FILTER_STD_MASK;
+
+    return (full & ~g.mask) + 1;
+}
+
+bool CanFilterPlanner::Contains(const Group& outer, const Group& inner)
+{
+    return outer.ext == inner.ext && (inner.id & outer.mask) == outer.id;
+}
+
+// Smallest aligned block holding both groups
+CanFilterPlanner::Group CanFilterPlanner::Merge(const Group& a, const Group& b)
+{
+    const uint32_t full = a.ext ? CAN_FILTER_EXT_MASK : CAN_FILTER_STD_MASK;
+    uint32_t diff = (a.id ^ b.id) | (full & ~a.mask) | (full & ~b.mask);
+    uint32_t low = 0;
+
+    while (diff)
+    {
+        low = (low << 1) | 1;
+        diff >>= 1;
+    }
+
+    Group g;
+    g.ext = a.ext;
+    g.mask = full & ~low;
+    g.id = a.id & g.mask;
+    g.members = 0;
+    return g;
+}
+
+// Replaces groups a and b and everything in between by their merged block,
+// added is the number of unregistered IDs it admits on top
+int CanFilterPlanner::MergeInto(const Iface& src, int a, int b, Group* dst, uint32_t& added)
+{
+    Group merged = Merge(src.groups[a], src.groups[b]);
+    uint32_t removed = 0;
+    int mergedPos = -1;
+    int count = 0;
+
+    for (int i = 0; i < src.numGroups; i++)
+    {
+        const Group& g = src.groups[i];
+
+        if (Contains(merged, g))
+        {
+            removed += Covered(g);
+            merged.members += g.members;
+            if (mergedPos < 0)
+                mergedPos = count++;
+        }
+        else
+        {
+            dst[count++] = g;
+        }
+    }
+
+    dst[mergedPos] = merged;
+    added = Covered(merged) - removed;
+    return count;
+}
+
+void CanFilterPlanner::Emit(int iface)
+{
+    const Iface& f = ifaces[iface];
+    uint32_t pending[4];
+    int numPending;
+
+    firstBank[iface] = numBanks;
+
+    // Unused slots repeat the first entry, a zero would admit ID 0
+    numPending = 0;
+    for (int i = 0; i < f.numGroups; i++)
+    {
+        if (f.groups[i].ext || Covered(f.groups[i]) != 1)
+            continue;
+        pending[numPending++] = FILTER16_ID(f.groups[i].id);
+        if (numPending == 4)
+        {
+            AddBank(iface, LIST16, pending[0] | (pending[1] << 16), pending[2] | (pending[3] << 16));
+            numPending = 0;
+        }
+    }
+    if (numPending > 0)
+    {
+        for (int i = numPending; i < 4; i++)
+            pending[i] = pending[0];
+        AddBank(iface, LIST16, pending[0] | (pending[1] << 16), pending[2] | (pending[3] << 16));
+    }
+
+    numPending = 0;
+    for (int i = 0; i < f.numGroups; i++)
+    {
+        if (f.groups[i].ext || Covered(f.groups[i]) == 1)
+            continue;
+        pending[numPending++] = FILTER16_ID(f.groups[i].id) | FILTER16_MASK(f.groups[i].mask) << 16;
+        if (numPending == 2)
+        {
+            AddBank(iface, MASK16, pending[0], pending[1]);
+            numPending = 0;
+        }
+    }
+    if (numPending > 0)
+        AddBank(iface, MASK16, pending[0], pending[0]);
+
+    numPending = 0;
+    for (int i = 0; i < f.numGroups; i++)
+    {
+        if (!f.groups[i].ext || Covered(f.groups[i]) != 1)
+            continue;
+        pending[numPending++] = FILTER32_ID(f.groups[i].id);
+        if (numPending == 2)
+        {
+            AddBank(iface, LIST32, pending[0], pending[1]);
+            numPending = 0;
+        }
+    }
+    if (numPending > 0)
+        AddBank(iface, LIST32, pending[0], pending[0]);
+
+    for (int i = 0; i < f.numGroups; i++)
+    {
+        if (f.groups[i].ext && Covered(f.groups[i]) != 1)
+            AddBank(iface, MASK32, FILTER32_ID(f.groups[i].id), FILTER32_MASK(f.groups[i].mask));
+    }
+
+    if (numBanks == firstBank[iface])
+        AddBank(CAN_FILTER_UNUSED, LIST16, 0, 0);
+}
+
+void CanFilterPlanner::AddBank(int iface, uint8_t mode, uint32_t fr1, uint32_t fr2)
+{
+    Bank& bank = banks[numBanks++];
+
+    bank.mode = mode;
+    bank.iface = iface;
+    bank.fr1 = fr1;
+    bank.fr2 = fr2;
+}
@@ -0,0 +1,132 @@
+#include <libopencm3/cm3/dwt.h>
+#include "can_gateway.h"
+#include "can_frame.h"
+
+CanHardware** CanGateway::canInterface = nullptr;
+CanGateway::Route CanGateway::routes[CAN_GATEWAY_MAX_ROUTES];
+volatile int CanGateway::numRoutes = 0;
+volatile bool CanGateway::ready = false;
+uint32_t CanGateway::maxCycles = 0;
+
+void CanGateway::BeginUpdate()
+{
+    ready = false;
+    numRoutes = 0;
+}
+
+void CanGateway::EndUpdate()
+{
+    ready = true;
+}
+
+// Rejects loops onto the source, masks that would register too many IDs,
+// standard routes beyond 11 bits and extended routes CAN1/CAN2 cannot
+// tell from standard ones
+bool CanGateway::AddRoute(int src, uint32_t id, uint32_t ignore, int dst, uint32_t newId, bool ext)
+{
+    int openBits = 0;
+
+    if (numRoutes >= CAN_GATEWAY_MAX_ROUTES || src == dst ||
+        src < 0 || src >= CAN_GATEWAY_IFACES || dst < 0 || dst >= CAN_GATEWAY_IFACES)
+        return false;
+
+    if (!ext && ((id | ignore | newId) & CAN_FRAME_ID_MASK) > CAN_FRAME_STD_MAX)
+        return false;
+
+    if (ext && src != CAN_GATEWAY_CAN3 && (id & ~ignore & CAN_FRAME_ID_MASK) <= CAN_FRAME_STD_MAX)
+        return false;
+
+    for (uint32_t bits = ignore & CAN_FRAME_ID_MASK; bits != 0; bits &= bits - 1)
+        openBits++;
+
+    if (openBits > CAN_GATEWAY_MAX_OPEN_BITS)
+        return false;
+
+    Route& r = routes[numRoutes];
+
+    r.ignore = ignore & CAN_FRAME_ID_MASK;
+    r.id = id & CAN_FRAME_ID_MASK & ~r.ignore;
+    r.newId = newId & CAN_FRAME_ID_MASK & ~r.ignore;
+    r.src = src;
+    r.dst = dst;
+    r.ext = ext;
+    r.forwarded = 0;
+    r.dropped = 0;
+    numRoutes = numRoutes + 1;
+    return true;
+}
+
+// Called from SetCanFilters() after the modules registered their IDs
+void CanGateway::RegisterIds()
+{
+    for (int i = 0; i < numRoutes; i++)
+    {
+        const Route& r = routes[i];
+        CanHardware* hw = canInterface != nullptr ? canInterface[r.src] : nullptr;
+
+        if (hw == nullptr)
+            continue;
+
+        // Walks all combinations of the ignored bits
+        uint32_t open = 0;
+        do
+        {
+            hw->RegisterUserMessage(r.id | open | (r.ext ? CAN_FRAME_EXT_FLAG : 0));
+            open = (open - r.ignore) & r.ignore;
+        } while (open != 0);
+    }
+}
+
+void CanGateway::Forward(int src, uint32_t id, uint32_t data[2], uint8_t dlc)
+{
+    if (!ready)
+        return;
+
+    const uint32_t start = dwt_read_cycle_counter();
+    const uint32_t rawId = id & CAN_FRAME_ID_MASK;
+    const bool ext = (id & CAN_FRAME_EXT_FLAG) != 0 || rawId > CAN_FRAME_STD_MAX;
+
+    for (int i = 0; i < numRoutes; i++)
+    {
+        Route& r = routes[i];
+
+        if (r.src != src || r.ext != ext || (rawId & ~r.ignore) != r.id)
+            continue;
+
+        CanHardware* hw = canInterface[r.dst];
+
+        if (hw == nullptr)
+        {
+            r.dropped++;
+            continue;
+        }
+
+        const uint32_t txId = r.newId != 0 ? r.newId | (rawId & r.ignore) : rawId;
+
+        hw->Send(txId | (r.ext ? CAN_FRAME_EXT_FLAG : 0), reinterpret_cast<uint8_t*>(data), dlc);
+        r.forwarded++;
+    }
+
+    const uint32_t cycles = dwt_read_cycle_counter() - start;
+
+    if (cycles > maxCycles)
+        maxCycles = cycles;
+}
+
+uint32_t CanGateway::GetForwarded()
+{
+    uint32_t forwarded = 0;
+
+    for (int i = 0; i < numRoutes; i++)
+        forwarded += routes[i].forwarded;
+    return forwarded;
+}
+
+uint32_t CanGateway::GetDropped()
+{
+    uint32_t dropped = 0;
+
+    for (int i = 0; i < numRoutes; i++)
+        dropped += routes[i].dropped;
+    return dropped;
+}
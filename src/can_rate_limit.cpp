@@ -0,0 +1,79 @@
+#include <libopencm3/cm3/cortex.h>
+#include "can_rate_limit.h"
+
+CanRateLimit::Entry CanRateLimit::entries[CAN_DISPATCH_MAX_ENTRIES];
+uint32_t CanRateLimit::periodUs = 0;
+uint32_t CanRateLimit::maxCredit = 0;
+volatile uint32_t CanRateLimit::dropped = 0;
+uint32_t CanRateLimit::offender = 0;
+
+void CanRateLimit::SetBudget(uint32_t framesPerSecond, uint32_t burst)
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    periodUs = framesPerSecond > 0 ? 1000000 / framesPerSecond : 0;
+    maxCredit = periodUs * (burst > 0 ? burst : 1);
+    cm_mask_interrupts(mask);
+}
+
+// The buckets start full, the first frame after Reset() tops them up anyway
+void CanRateLimit::Reset()
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    for (int i = 0; i < CAN_DISPATCH_MAX_ENTRIES; i++)
+    {
+        entries[i].lastUs = 0;
+        entries[i].credit = maxCredit;
+        entries[i].dropped = 0;
+        entries[i].reported = 0;
+    }
+    dropped = 0;
+    offender = 0;
+    cm_mask_interrupts(mask);
+}
+
+// Called from the receive interrupt of both interfaces
+bool CanRateLimit::Admit(int slot, uint32_t timeUs)
+{
+    if (periodUs == 0)
+        return true;
+
+    Entry& e = entries[slot];
+    uint32_t credit = e.credit + (timeUs - e.lastUs);
+
+    e.lastUs = timeUs;
+
+    if (credit > maxCredit || credit < e.credit)
+        credit = maxCredit;
+
+    if (credit < periodUs)
+    {
+        e.credit = credit;
+        e.dropped++;
+        dropped = dropped + 1;
+        return false;
+    }
+
+    e.credit = credit - periodUs;
+    return true;
+}
+
+void CanRateLimit::Update()
+{
+    uint32_t worst = 0;
+
+    for (int slot = 0; slot < CanDispatch::GetNumEntries(); slot++)
+    {
+        Entry& e = entries[slot];
+        const uint32_t n = e.dropped - e.reported;
+
+        e.reported += n;
+
+        if (n > worst)
+        {
+            worst = n;
+            offender = CanDispatch::GetId(slot);
+        }
+    }
+}
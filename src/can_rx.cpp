@@ -0,0 +1,53 @@
+#include <libopencm3/cm3/dwt.h>
+#include "can_rx.h"
+#include "can_dispatch.h"
+#include "can_rx_queue.h"
+#include "can_rx_stats.h"
+#include "can_rate_limit.h"
+#include "can_gateway.h"
+#include "params.h"
+#include "timebase.h"
+
+volatile uint32_t CanRx::statsCycles = 0;
+
+void CanRx::Receive(int iface, uint32_t id, uint32_t data[2], uint8_t dlc, uint32_t time)
+{
+    const uint32_t timeUs = Timebase::Now();
+    const int slot = CanDispatch::Find(id);
+
+    // A babbling ID is dropped before it is forwarded, takes a queue entry or a decode
+    if (slot >= 0 && !CanRateLimit::Admit(slot, timeUs))
+        return;
+
+    CanGateway::Forward(iface, id, data, dlc);
+
+    // In deferred mode the frame is only queued here and decoded in the 10ms task
+    if (Param::GetInt(Param::can_rx_deferred))
+        CanRxQueue::Push(id, data, dlc, time, timeUs);
+    else
+        Record(CanDispatch::DispatchSlot(slot, id, data, dlc, timeUs), time);
+}
+
+// Decode the frames queued by the receive interrupt in deferred mode
+void CanRx::ProcessQueue()
+{
+    CanRxFrame frame;
+
+    while (CanRxQueue::Pop(frame))
+        Record(CanDispatch::Dispatch(frame.id, frame.data, frame.dlc, frame.timeUs), frame.timestamp);
+}
+
+// Accounts a dispatched frame to its ID. The worst case cost is published
+// in can_rx_stats_cyc, setting can_rx_stats to 0 removes it altogether.
+void CanRx::Record(int slot, uint32_t timestamp)
+{
+    if (slot < 0 || !Param::GetInt(Param::can_rx_stats))
+        return;
+
+    uint32_t start = dwt_read_cycle_counter();
+    CanRxStats::Record(slot, timestamp);
+    uint32_t cycles = dwt_read_cycle_counter() - start;
+
+    if (cycles > statsCycles)
+        statsCycles = cycles;
+}
@@ -0,0 +1,53 @@
+#include "can_rx_queue.h"
+
+#define CAN_RX_QUEUE_MASK (CAN_RX_QUEUE_SIZE - 1)
+
+CanRxFrame CanRxQueue::frames[CAN_RX_QUEUE_SIZE];
+volatile uint32_t CanRxQueue::head = 0;
+volatile uint32_t CanRxQueue::tail = 0;
+volatile int CanRxQueue::highWaterMark = 0;
+volatile uint32_t CanRxQueue::overflows = 0;
+
+bool CanRxQueue::Push(uint32_t id, const uint32_t data[2], uint8_t dlc, uint32_t timestamp, uint32_t timeUs)
+{
+    const uint32_t h = head;
+    const int used = h - tail;
+
+    if (used >= CAN_RX_QUEUE_SIZE)
+    {
+        overflows = overflows + 1;
+        return false;
+    }
+
+    CanRxFrame& frame = frames[h & CAN_RX_QUEUE_MASK];
+    frame.id = id;
+    frame.data[0] = data[0];
+    frame.data[1] = data[1];
+    frame.dlc = dlc;
+    frame.timestamp = timestamp;
+    frame.timeUs = timeUs;
+
+    // Publish the frame only after it is completely written
+    asm volatile("" ::: "memory");
+    head = h + 1;
+
+    if (used + 1 > highWaterMark)
+        highWaterMark = used + 1;
+
+    return true;
+}
+
+bool CanRxQueue::Pop(CanRxFrame& frame)
+{
+    const uint32_t t = tail;
+
+    if (t == head)
+        return false;
+
+    frame = frames[t & CAN_RX_QUEUE_MASK];
+
+    // Hand the slot back only after it has been copied out
+    asm volatile("" ::: "memory");
+    tail = t + 1;
+    return true;
+}
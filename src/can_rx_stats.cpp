@@ -0,0 +1,105 @@
+#include "can_rx_stats.h"
+
+// An ID that has not been seen for this many learned periods counts as stale
+#define CAN_RX_STATS_STALE_PERIODS 4
+// Smallest period used for the loss check, 1 ms in 1/16 ms
+#define CAN_RX_STATS_MIN_PERIOD 16
+// Gaps are clamped to about 9 hours for the period, so the 1/16 ms arithmetic
+// below stays within 32 bit
+#define CAN_RX_STATS_MAX_GAP 0x1FFFFFF
+
+CanRxStats::Entry CanRxStats::entries[CAN_DISPATCH_MAX_ENTRIES];
+uint32_t CanRxStats::now = 0;
+int CanRxStats::active = 0;
+int CanRxStats::stale = 0;
+uint32_t CanRxStats::missed = 0;
+
+// The slots are re-assigned whenever the dispatch table is rebuilt
+void CanRxStats::Reset()
+{
+    for (int i = 0; i < CAN_DISPATCH_MAX_ENTRIES; i++)
+        entries[i] = Entry();
+
+    active = 0;
+    stale = 0;
+    missed = 0;
+}
+
+void CanRxStats::Record(int slot, uint32_t timestamp)
+{
+    if (slot < 0 || slot >= CAN_DISPATCH_MAX_ENTRIES)
+        return;
+
+    Entry& e = entries[slot];
+
+    if (e.count > 0)
+    {
+        const uint32_t gap = timestamp - e.lastSeen;
+        const uint32_t scaled = (gap > CAN_RX_STATS_MAX_GAP ? CAN_RX_STATS_MAX_GAP : gap) << 4;
+        const uint32_t period = e.period < CAN_RX_STATS_MIN_PERIOD ? CAN_RX_STATS_MIN_PERIOD : e.period;
+
+        if (e.count == 1 || gap < e.minGap)
+            e.minGap = gap;
+        if (gap > e.maxGap)
+            e.maxGap = gap;
+        e.sumGap += gap;
+
+        if (e.period == 0)
+        {
+            e.period = scaled;
+        }
+        else if (2 * scaled >= 3 * period)
+        {
+            // At least 1.5 periods: count the frames that should have been in between
+            e.missed += (scaled + period / 2) / period - 1;
+        }
+        else
+        {
+            // Running average over roughly 8 gaps
+            e.period = static_cast<int32_t>(e.period) + (static_cast<int32_t>(scaled) - static_cast<int32_t>(e.period)) / 8;
+        }
+    }
+
+    e.lastSeen = timestamp;
+    e.count++;
+}
+
+void CanRxStats::Update(uint32_t time)
+{
+    int numActive = 0;
+    int numStale = 0;
+    uint32_t sumMissed = 0;
+
+    now = time;
+
+    for (int i = 0; i < CanDispatch::GetNumEntries(); i++)
+    {
+        if (entries[i].count == 0)
+            continue;
+
+        numActive++;
+        sumMissed += entries[i].missed;
+        if (IsStale(i))
+            numStale++;
+    }
+
+    active = numActive;
+    stale = numStale;
+    missed = sumMissed;
+}
+
+uint32_t CanRxStats::GetMeanGap(int slot)
+{
+    const Entry& e = entries[slot];
+
+    return e.count > 1 ? e.sumGap / (e.count - 1) : 0;
+}
+
+bool CanRxStats::IsStale(int slot)
+{
+    const Entry& e = entries[slot];
+
+    if (e.period == 0)
+        return false;
+    return GetAge(slot) > ((e.period * CAN_RX_STATS_STALE_PERIODS) >> 4);
+}
@@ -0,0 +1,187 @@
+#include <libopencm3/cm3/cortex.h>
+#include "can_sniffer.h"
+#include "can_frame.h"
+
+#define DIR_RX 1
+#define DIR_TX 2
+#define MAX_RECORD (2 + 1 + 5 + 4 + 8)
+
+volatile bool CanSniffer::active = false;
+uint8_t CanSniffer::ifaceMask = 0;
+uint8_t CanSniffer::dirMask = 0;
+CanSniffer::Filter CanSniffer::filters[CAN_SNIFFER_MAX_FILTERS];
+int CanSniffer::numFilters = 0;
+uint8_t CanSniffer::buffer[CAN_SNIFFER_BUFFER];
+volatile uint32_t CanSniffer::head = 0;
+volatile uint32_t CanSniffer::tail = 0;
+uint32_t CanSniffer::inFlight = 0;
+uint32_t CanSniffer::lastUs = 0;
+uint32_t CanSniffer::lost = 0;
+volatile uint32_t CanSniffer::overflows = 0;
+
+// Stops a running capture, filters are added afterwards
+void CanSniffer::Select(uint8_t ifaces, bool rx, bool tx)
+{
+    active = false;
+    ifaceMask = ifaces;
+    dirMask = (rx ? DIR_RX : 0) | (tx ? DIR_TX : 0);
+    numFilters = 0;
+}
+
+// Drops whatever was not sent yet, the new capture starts with the header
+void CanSniffer::Start(uint32_t timeUs)
+{
+    const char* magic = CAN_SNIFFER_MAGIC;
+
+    head = tail = 0;
+    inFlight = 0;
+    lost = 0;
+    overflows = 0;
+    lastUs = timeUs;
+
+    while (*magic)
+        Put(*magic++);
+    Put(CAN_SNIFFER_VERSION);
+    active = true;
+}
+
+bool CanSniffer::AddFilter(uint32_t id, uint32_t mask)
+{
+    if (numFilters >= CAN_SNIFFER_MAX_FILTERS)
+        return false;
+
+    filters[numFilters].id = id & mask & CAN_FRAME_ID_MASK;
+    filters[numFilters].mask = mask & CAN_FRAME_ID_MASK;
+    numFilters++;
+    return true;
+}
+
+// Called from the receive interrupts and the transmit path
+void CanSniffer::Record(int iface, bool tx, uint32_t id, const uint8_t* data, uint8_t dlc, uint32_t timeUs)
+{
+    if ((ifaceMask & (1 << iface)) == 0 || (dirMask & (tx ? DIR_TX : DIR_RX)) == 0)
+        return;
+
+    const uint32_t rawId = id & CAN_FRAME_ID_MASK;
+
+    if (!Passes(rawId))
+        return;
+
+    const bool ext = (id & CAN_FRAME_EXT_FLAG) != 0 || rawId > CAN_FRAME_STD_MAX;
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    // Room for the overflow record too, so lost frames are always reported
+    if (Free() < 2 * MAX_RECORD)
+    {
+        lost++;
+        overflows = overflows + 1;
+        cm_mask_interrupts(mask);
+        return;
+    }
+
+    // A record preempted by a younger one goes out with delta 0
+    const uint32_t deltaUs = (int32_t)(timeUs - lastUs) > 0 ? timeUs - lastUs : 0;
+    uint32_t start;
+
+    lastUs += deltaUs;
+
+    if (lost > 0)
+    {
+        start = BeginRecord();
+        Put((iface << 6) | CAN_SNIFFER_OVERFLOW);
+        PutVarint(0);
+        PutVarint(lost);
+        EndRecord(start);
+        lost = 0;
+    }
+
+    if (dlc > 8)
+        dlc = 8;
+
+    start = BeginRecord();
+    Put((iface << 6) | (tx ? 0x20 : 0) | (ext ? 0x10 : 0) | dlc);
+    PutVarint(deltaUs);
+    Put(rawId);
+    Put(rawId >> 8);
+    if (ext)
+    {
+        Put(rawId >> 16);
+        Put(rawId >> 24);
+    }
+    for (int i = 0; i < dlc; i++)
+        Put(data[i]);
+    EndRecord(start);
+
+    cm_mask_interrupts(mask);
+}
+
+bool CanSniffer::Passes(uint32_t id)
+{
+    if (numFilters == 0)
+        return true;
+
+    for (int i = 0; i < numFilters; i++)
+    {
+        if ((id & filters[i].mask) == filters[i].id)
+            return true;
+    }
+    return false;
+}
+
+int CanSniffer::Peek(const uint8_t*& data)
+{
+    const uint32_t end = head;
+    const uint32_t start = tail;
+    const uint32_t offset = start & (CAN_SNIFFER_BUFFER - 1);
+    uint32_t count = end - start;
+
+    if (count > CAN_SNIFFER_BUFFER - offset)
+        count = CAN_SNIFFER_BUFFER - offset;
+
+    data = &buffer[offset];
+    inFlight = count;
+    return count;
+}
+
+void CanSniffer::Consume()
+{
+    tail = tail + inFlight;
+    inFlight = 0;
+}
+
+int CanSniffer::Free()
+{
+    return CAN_SNIFFER_BUFFER - (head - tail);
+}
+
+void CanSniffer::Put(uint8_t b)
+{
+    buffer[head & (CAN_SNIFFER_BUFFER - 1)] = b;
+    head = head + 1;
+}
+
+void CanSniffer::PutVarint(uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        Put((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    Put(value);
+}
+
+// The length is filled in by EndRecord(), the consumer cannot run in between
+// as records are written with interrupts masked
+uint32_t CanSniffer::BeginRecord()
+{
+    const uint32_t start = head;
+
+    Put(CAN_SNIFFER_SYNC);
+    Put(0);
+    return start;
+}
+
+void CanSniffer::EndRecord(uint32_t start)
+{
+    buffer[(start + 1) & (CAN_SNIFFER_BUFFER - 1)] = head - start - 2;
+}
@@ -0,0 +1,87 @@
+#include "can_tx_queue.h"
+
+#define CAN_ID_MASK 0x1FFFFFFF
+#define CAN_TX_NORMAL (1U << 29) // above every 29 bit ID
+
+uint32_t CanTxQueue::urgentIds[CAN_TX_MAX_URGENT];
+int CanTxQueue::numUrgent = 0;
+
+bool CanTxQueue::Push(uint32_t id, const uint32_t data[2], uint8_t len, uint32_t time)
+{
+    const uint32_t key = (IsUrgent(id) ? 0 : CAN_TX_NORMAL) | (id & CAN_ID_MASK);
+
+    if (count >= CAN_TX_QUEUE_DEPTH)
+    {
+        failures++;
+
+        // The lowest priority frame sits at index 0
+        if (key >= frames[0].key)
+            return false;
+
+        for (int i = 1; i < count; i++)
+            frames[i - 1] = frames[i];
+        count--;
+    }
+
+    // Frames with the same key stay in front of the new one, they are older
+    int pos = count;
+    while (pos > 0 && frames[pos - 1].key <= key)
+    {
+        frames[pos] = frames[pos - 1];
+        pos--;
+    }
+
+    CanTxFrame& frame = frames[pos];
+    frame.id = id;
+    frame.data[0] = data[0];
+    frame.data[1] = data[1];
+    frame.key = key;
+    frame.enqueued = time;
+    frame.len = len;
+    count++;
+
+    if (count > maxDepth)
+        maxDepth = count;
+
+    return true;
+}
+
+bool CanTxQueue::Pop(CanTxFrame& frame, uint32_t time)
+{
+    if (count == 0)
+        return false;
+
+    count--;
+    frame = frames[count];
+
+    if (time - frame.enqueued > maxLatency)
+        maxLatency = time - frame.enqueued;
+
+    return true;
+}
+
+// Called from SetCanInterface(), the list is never cleared as IDs keep their meaning
+bool CanTxQueue::SetUrgent(uint32_t id)
+{
+    id &= CAN_ID_MASK;
+
+    if (IsUrgent(id))
+        return true;
+    if (numUrgent >= CAN_TX_MAX_URGENT)
+        return false;
+
+    urgentIds[numUrgent++] = id;
+    return true;
+}
+
+bool CanTxQueue::IsUrgent(uint32_t id)
+{
+    id &= CAN_ID_MASK;
+
+    for (int i = 0; i < numUrgent; i++)
+    {
+        if (urgentIds[i] == id)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,137 @@
+#include "can_tx_timing.h"
+
+#define CAN_ID_MASK 0x1FFFFFFF
+#define CAN_TX_TIMING_PAUSE_PERIODS 4
+// Pause limit of IDs without a declared period
+#define CAN_TX_TIMING_PAUSE_US 5000000
+
+CanTxTiming::Entry CanTxTiming::entries[CAN_TX_TIMING_MAX_IDS];
+int CanTxTiming::numEntries = 0;
+uint32_t CanTxTiming::ticksPerUs = 1;
+int CanTxTiming::violations = 0;
+
+bool CanTxTiming::Declare(uint32_t id, uint16_t periodMs)
+{
+    Entry* e = Find(id);
+
+    if (e == nullptr)
+        e = Add(id);
+    if (e == nullptr)
+        return false;
+
+    e->periodMs = periodMs;
+    return true;
+}
+
+void CanTxTiming::Record(uint32_t id, uint32_t ticks)
+{
+    Entry* e = Find(id);
+
+    if (e == nullptr)
+        e = Add(id);
+    if (e == nullptr)
+        return;
+
+    if (e->running)
+    {
+        const uint32_t us = (ticks - e->lastTx) / ticksPerUs;
+
+        if (us > PauseUs(*e))
+        {
+            e->pauses++;
+        }
+        else
+        {
+            if (e->count == 0 || us < e->minUs)
+                e->minUs = us;
+            if (us > e->maxUs)
+                e->maxUs = us;
+            e->sumUs += us;
+            e->count++;
+        }
+    }
+
+    e->lastTx = ticks;
+    e->running = true;
+}
+
+void CanTxTiming::Update(uint32_t ticks, int tolerancePct)
+{
+    int n = 0;
+
+    for (int i = 0; i < numEntries; i++)
+    {
+        Entry& e = entries[i];
+
+        if (e.running && (ticks - e.lastTx) / ticksPerUs > PauseUs(e))
+        {
+            e.running = false;
+            e.pauses++;
+        }
+
+        n += IsViolation(e, tolerancePct);
+    }
+
+    violations = n;
+}
+
+void CanTxTiming::Reset()
+{
+    for (int i = 0; i < numEntries; i++)
+    {
+        Entry& e = entries[i];
+
+        e.count = 0;
+        e.pauses = 0;
+        e.sumUs = 0;
+        e.minUs = 0;
+        e.maxUs = 0;
+        e.running = false;
+    }
+    violations = 0;
+}
+
+uint32_t CanTxTiming::GetMeanUs(const Entry& e)
+{
+    return e.count ? e.sumUs / e.count : 0;
+}
+
+// Any single period outside the tolerance band around the declared period
+bool CanTxTiming::IsViolation(const Entry& e, int tolerancePct)
+{
+    if (e.count == 0 || e.periodMs == 0)
+        return false;
+
+    const uint32_t low = e.periodMs * (100 - tolerancePct) * 10;
+    const uint32_t high = e.periodMs * (100 + tolerancePct) * 10;
+
+    return e.minUs < low || e.maxUs > high;
+}
+
+CanTxTiming::Entry* CanTxTiming::Find(uint32_t id)
+{
+    id &= CAN_ID_MASK;
+
+    for (int i = 0; i < numEntries; i++)
+    {
+        if (entries[i].id == id)
+            return &entries[i];
+    }
+    return nullptr;
+}
+
+CanTxTiming::Entry* CanTxTiming::Add(uint32_t id)
+{
+    if (numEntries >= CAN_TX_TIMING_MAX_IDS)
+        return nullptr;
+
+    Entry& e = entries[numEntries++];
+    e = Entry();
+    e.id = id & CAN_ID_MASK;
+    return &e;
+}
+
+uint32_t CanTxTiming::PauseUs(const Entry& e)
+{
+    return e.periodMs ? e.periodMs * CAN_TX_TIMING_PAUSE_PERIODS * 1000 : CAN_TX_TIMING_PAUSE_US;
+}
@@ -0,0 +1,67 @@
+#include "canmap_schedule.h"
+
+CanMapSchedule::Entry CanMapSchedule::entries[CANMAP_SCHEDULE_MAX];
+int CanMapSchedule::numEntries = 0;
+uint32_t CanMapSchedule::tick = 0;
+
+void CanMapSchedule::Begin()
+{
+    numEntries = 0;
+}
+
+// The send counters survive a rebuild as long as the message keeps its place
+bool CanMapSchedule::Add(uint32_t id, uint16_t periodMs)
+{
+    if (numEntries >= CANMAP_SCHEDULE_MAX)
+        return false;
+
+    Entry& e = entries[numEntries];
+    const uint16_t period = periodMs < CANMAP_SCHEDULE_TICK_MS ? CANMAP_SCHEDULE_TICK_MS : periodMs;
+    int sharing = 0;
+
+    for (int i = 0; i < numEntries; i++)
+        sharing += entries[i].periodMs == period;
+
+    if (e.id != id || e.periodMs != period)
+        e.sent = 0;
+
+    e.id = id;
+    e.periodMs = period;
+    e.phaseMs = (sharing * CANMAP_SCHEDULE_TICK_MS) % period;
+    numEntries++;
+    return true;
+}
+
+bool CanMapSchedule::Advance()
+{
+    bool due = false;
+
+    tick++;
+
+    for (int i = 0; i < numEntries; i++)
+    {
+        if (IsDue(entries[i]))
+        {
+            entries[i].sent++;
+            due = true;
+        }
+    }
+    return due;
+}
+
+bool CanMapSchedule::Pass(uint32_t canId)
+{
+    for (int i = 0; i < numEntries; i++)
+    {
+        if (entries[i].id == canId)
+            return IsDue(entries[i]);
+    }
+    return true;
+}
+
+bool CanMapSchedule::IsDue(const Entry& e)
+{
+    const uint32_t periodTicks = e.periodMs / CANMAP_SCHEDULE_TICK_MS;
+
+    return tick % periodTicks == e.phaseMs / CANMAP_SCHEDULE_TICK_MS;
+}
@@ -0,0 +1,155 @@
+#include "e2e_protection.h"
+#include "vag_utils.h"
+#include "crc_service.h"
+
+E2EProtection* E2EProtection::first = nullptr;
+
+static inline uint32_t LoadLe32(const uint8_t* d)
+{
+    return static_cast<uint32_t>(d[0]) | (static_cast<uint32_t>(d[1]) << 8) |
+           (static_cast<uint32_t>(d[2]) << 16) | (static_cast<uint32_t>(d[3]) << 24);
+}
+
+E2EProtection::E2EProtection(Profile p, Direction d, uint32_t i, bool strict)
+    : profile(p), direction(d), id(i), strictCounter(strict), counter(0), haveCounter(false), stats(),
+      next(first)
+{
+    first = this;
+}
+
+E2EProtection::~E2EProtection()
+{
+    for (E2EProtection** link = &first; *link; link = &(*link)->next)
+    {
+        if (*link == this)
+        {
+            *link = next;
+            break;
+        }
+    }
+}
+
+void E2EProtection::Reset()
+{
+    counter = 0;
+    haveCounter = false;
+    stats = Stats();
+}
+
+// CRC over bytes 0..6 with the CRC byte cleared. The words are assembled
+// straight from the frame, so no aligned copy of the payload is needed.
+uint8_t E2EProtection::Crc32Byte7(const uint8_t* data)
+{
+    return Crc32Byte7(LoadLe32(data), LoadLe32(data + 4));
+}
+
+uint8_t E2EProtection::Crc32Byte7(uint32_t word0, uint32_t word1)
+{
+    const uint32_t words[2] = { word0, word1 & 0x00FFFFFF };
+
+    return CrcService::Calculate(words, 2) & 0xFF;
+}
+
+uint8_t E2EProtection::CounterOf(const uint8_t* data) const
+{
+    if (profile == PROFILE_VAG)
+        return data[1] & 0x0F;
+    return data[6] & 0x0F;
+}
+
+bool E2EProtection::CrcValid(const uint8_t* data, uint8_t length) const
+{
+    if (profile == PROFILE_VAG)
+        return vag_utils::vw_crc_compute(data, length, id) == data[0];
+    return length >= 8 && Crc32Byte7(data) == data[7];
+}
+
+void E2EProtection::Protect(uint8_t* data, uint8_t length)
+{
+    Sign(data, length, NextCounter());
+}
+
+void E2EProtection::Sign(uint8_t* data, uint8_t length, uint8_t counterValue) const
+{
+    if (profile == PROFILE_VAG)
+    {
+        data[1] = (data[1] & 0xF0) | counterValue;
+        data[0] = vag_utils::vw_crc_compute(data, length, id);
+    }
+    else
+    {
+        data[6] = (data[6] & 0xF0) | counterValue;
+        data[7] = Crc32Byte7(data);
+    }
+}
+
+uint8_t E2EProtection::NextCounter()
+{
+    const uint8_t current = counter;
+
+    counter = (counter + 1) & 0x0F;
+    stats.ok++;
+    return current;
+}
+
+bool E2EProtection::Check(const uint8_t* data, uint8_t length)
+{
+    if (!CrcValid(data, length))
+    {
+        stats.crcErrors++;
+        return false;
+    }
+
+    return Accept(CounterOf(data));
+}
+
+// Received frames, the payload is read in place from the driver's words
+bool E2EProtection::Check(const CanFrame& frame)
+{
+    bool crcValid;
+    uint8_t rxCounter;
+
+    if (profile == PROFILE_VAG)
+    {
+        crcValid = vag_utils::vw_crc_compute(frame.Bytes(), frame.GetDlc(), id) == frame.Byte(0);
+        rxCounter = frame.Byte(1) & 0x0F;
+    }
+    else
+    {
+        crcValid = frame.GetDlc() >= 8 && Crc32Byte7(frame.Word(0), frame.Word(1)) == frame.Byte(7);
+        rxCounter = frame.Byte(6) & 0x0F;
+    }
+
+    if (!crcValid)
+    {
+        stats.crcErrors++;
+        return false;
+    }
+
+    return Accept(rxCounter);
+}
+
+bool E2EProtection::Accept(uint8_t rxCounter)
+{
+    if (haveCounter)
+    {
+        const uint8_t expected = (counter + 1) & 0x0F;
+
+        if (rxCounter != expected)
+        {
+            const uint8_t delta = (rxCounter - counter) & 0x0F;
+
+            stats.counterJumps++;
+            if (delta > 1)
+                stats.lost += delta - 1;
+
+            if (strictCounter)
+                return false;
+        }
+    }
+
+    haveCounter = true;
+    counter = rxCounter;
+    stats.ok++;
+    return true;
+}
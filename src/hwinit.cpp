@@ -131,11 +131,28 @@ void nvic_setup(void)
     nvic_enable_irq(NVIC_USB_HP_CAN_TX_IRQ); //CAN TX
     nvic_set_priority(NVIC_USB_HP_CAN_TX_IRQ, 0xe << 4); //second lowest priority
 
+    // CAN3 frames are handled in the SPI2 RX DMA interrupt, enabled by SpiDma::Init()
+    nvic_set_priority(NVIC_DMA1_CHANNEL4_IRQ, 0xe << 4); //second lowest priority
+
     /* Without this the RTC interrupt routine will never be called. */
     nvic_enable_irq(NVIC_RTC_IRQ);
     nvic_set_priority(NVIC_RTC_IRQ, 0x20);
 }
 
+/**
+ * SPI2 to the MCP2515 (CAN3), mode 0 at 36MHz/8 = 4.5MHz
+ * The chip select is the mcp_cs DigIo
+ */
+void spi2_setup()
+{
+   gpio_set_mode(GPIOB, GPIO_MODE_OUTPUT_50_MHZ, GPIO_CNF_OUTPUT_ALTFN_PUSHPULL, GPIO13 | GPIO15); // SCK, MOSI
+   gpio_set_mode(GPIOB, GPIO_MODE_INPUT, GPIO_CNF_INPUT_FLOAT, GPIO14); // MISO
+   spi_init_master(SPI2, SPI_CR1_BAUDRATE_FPCLK_DIV_8, SPI_CR1_CPOL_CLK_TO_0_WHEN_IDLE,
+                   SPI_CR1_CPHA_CLK_TRANSITION_1, SPI_CR1_DFF_8BIT, SPI_CR1_MSBFIRST);
+   spi_enable_software_slave_management(SPI2);
+   spi_set_nss_high(SPI2);
+}
+
 void rtc_setup()
 {
    // Base clock is HSE/128 = 8MHz/128 = 62.5kHz
@@ -0,0 +1,123 @@
+#include <libopencm3/cm3/cortex.h>
+#include "latency_probe.h"
+
+static const uint32_t bucketLimitsMs[LATENCY_PROBE_BUCKETS - 1] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000
+};
+
+const LatencyProbe::Definition LatencyProbe::definitions[] = {
+    { "hv_close", EVT_HV_REQUEST_ON, EVT_CONTACTOR_CLOSED },
+    { "hv_open", EVT_HV_REQUEST_OFF, EVT_CONTACTOR_OPEN },
+    { "heater_on", EVT_HEATER_REQUEST_ON, EVT_HEATER_CONTACTOR_ON },
+};
+
+#define NUM_PROBES (int)(sizeof(definitions) / sizeof(definitions[0]))
+
+LatencyProbe::Probe LatencyProbe::probes[NUM_PROBES];
+uint32_t LatencyProbe::txIds[EVT_LAST];
+volatile uint32_t LatencyProbe::txPending = 0;
+
+// Called from the receive path, the transmit path and the tasks
+void LatencyProbe::Signal(Event event, uint32_t timeUs)
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    for (int i = 0; i < NUM_PROBES; i++)
+    {
+        Probe& p = probes[i];
+
+        if (definitions[i].stop == event && p.armed)
+        {
+            Record(p, timeUs - p.startUs);
+            p.armed = false;
+        }
+        if (definitions[i].start == event)
+        {
+            if (p.armed)
+                p.aborted++;
+            p.armed = true;
+            p.startUs = timeUs;
+        }
+    }
+
+    cm_mask_interrupts(mask);
+}
+
+// A later event on the same ID replaces one that has not been sent yet
+void LatencyProbe::SignalOnTx(Event event, uint32_t canId)
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    for (int e = 0; e < EVT_LAST; e++)
+    {
+        if (txIds[e] == canId)
+            txPending = txPending & ~(1 << e);
+    }
+    txIds[event] = canId;
+    txPending = txPending | (1 << event);
+    cm_mask_interrupts(mask);
+}
+
+// Called at the mailbox hand-over, only while TxPending()
+void LatencyProbe::OnTx(uint32_t canId, uint32_t timeUs)
+{
+    for (int e = 0; e < EVT_LAST; e++)
+    {
+        if ((txPending & (1 << e)) != 0 && txIds[e] == canId)
+        {
+            txPending = txPending & ~(1 << e);
+            Signal((Event)e, timeUs);
+        }
+    }
+}
+
+void LatencyProbe::Reset()
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    for (int i = 0; i < NUM_PROBES; i++)
+    {
+        Probe& p = probes[i];
+
+        p.armed = false;
+        p.count = p.aborted = p.lastUs = p.maxUs = 0;
+        p.minUs = 0;
+        p.sumUs = 0;
+        for (int b = 0; b < LATENCY_PROBE_BUCKETS; b++)
+            p.histogram[b] = 0;
+    }
+
+    cm_mask_interrupts(mask);
+}
+
+int LatencyProbe::GetNumProbes()
+{
+    return NUM_PROBES;
+}
+
+const LatencyProbe::Probe& LatencyProbe::Get(int index)
+{
+    return probes[index];
+}
+
+uint32_t LatencyProbe::GetBucketLimitMs(int bucket)
+{
+    return bucket < LATENCY_PROBE_BUCKETS - 1 ? bucketLimitsMs[bucket] : 0;
+}
+
+void LatencyProbe::Record(Probe& p, uint32_t us)
+{
+    int bucket = 0;
+
+    while (bucket < LATENCY_PROBE_BUCKETS - 1 && us >= bucketLimitsMs[bucket] * 1000)
+        bucket++;
+
+    if (p.count == 0 || us < p.minUs)
+        p.minUs = us;
+    if (us > p.maxUs)
+        p.maxUs = us;
+    p.lastUs = us;
+    p.sumUs += us;
+    p.count++;
+    p.histogram[bucket]++;
+}
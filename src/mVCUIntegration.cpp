@@ -1,12 +1,24 @@
 #include "mVCUIntegration.h"
 #include "params.h"
-#include <libopencm3/stm32/crc.h>
-#include <string.h>
+#include "can_dispatch.h"
+#include "rx_supervisor.h"
+#include "latency_probe.h"
 
 #define MVCU_CHARGE_POWER_STATUS_ID 0x438
 #define MVCU_HEATER_STATUS_ID 0x439
 #define MVCU_HEATER_CONTROL_ID 0x43A
-#define MVCU_RX_TIMEOUT_TICKS_100MS 5
+#define MVCU_HEATER_CONTROL_PERIOD_MS 100
+#define MVCU_HEATER_CONTROL_TOLERANCE_MS 400 // stale after 500ms
+
+static void HandleRx(void* ctx, const CanFrame& frame)
+{
+    static_cast<mVCUIntegration*>(ctx)->DecodeCAN(frame);
+}
+
+static void HandleFreshness(void* ctx, uint32_t, bool fresh)
+{
+    static_cast<mVCUIntegration*>(ctx)->FreshnessChanged(fresh);
+}
 
 void mVCUIntegration::SetCanInterface(CanHardware* c)
 {
@@ -14,76 +26,80 @@ void mVCUIntegration::SetCanInterface(CanHardware* c)
     {
         can = nullptr;
         heaterCanCloseRequest = false;
-        haveSeenValidCounter = false;
-        rxTimeoutTicks = 0;
+        rxE2E.Reset();
+        rxHandle = -1;
         Param::SetInt(Param::heater_can_contactor_request, 0);
         return;
     }
 
     can = c;
+    chargePowerTx.Reset();
+    heaterStatusTx.Reset();
     can->RegisterUserMessage(MVCU_HEATER_CONTROL_ID);
+    CanDispatch::Register(MVCU_HEATER_CONTROL_ID, HandleRx, this);
+    rxHandle = RxSupervisor::Register(MVCU_HEATER_CONTROL_ID, MVCU_HEATER_CONTROL_PERIOD_MS,
+                                      MVCU_HEATER_CONTROL_TOLERANCE_MS, HandleFreshness, this);
 }
 
-bool mVCUIntegration::CheckCrc(const uint8_t* data) const
+// The heater contactor request is dropped as soon as the mVCU goes silent
+void mVCUIntegration::FreshnessChanged(bool fresh)
 {
-    uint32_t buf[2] = {0, 0};
-    memcpy(buf, data, 8);
-    buf[1] &= 0x00FFFFFF; // clear CRC byte (byte 7)
-    crc_reset();
-    const uint32_t crc = crc_calculate_block(buf, 2) & 0xFFU;
-    return crc == data[7];
+    if (!fresh)
+    {
+        heaterCanCloseRequest = false;
+        Param::SetInt(Param::heater_can_contactor_request, 0);
+    }
 }
 
-bool mVCUIntegration::ValidateCounter(uint8_t counter)
+void mVCUIntegration::DecodeCAN(const CanFrame& frame)
 {
-    counter &= 0x0FU;
-
-    if (!haveSeenValidCounter)
+    if (frame.GetId() != MVCU_HEATER_CONTROL_ID || frame.GetDlc() < 8)
     {
-        haveSeenValidCounter = true;
-        lastRxCounter = counter;
-        return true;
+        return;
     }
 
-    const uint8_t expectedCounter = static_cast<uint8_t>((lastRxCounter + 1U) & 0x0FU);
-    if (counter != expectedCounter)
+    if (!rxE2E.Check(frame))
     {
-        return false;
+        return;
     }
 
-    lastRxCounter = counter;
-    return true;
+    const bool request = (frame.Byte(0) & 0x01U) != 0U;
+
+    if (request && !heaterCanCloseRequest)
+        LatencyProbe::Signal(LatencyProbe::EVT_HEATER_REQUEST_ON, frame.GetTimeUs());
+
+    heaterCanCloseRequest = request;
+    RxSupervisor::Refresh(rxHandle);
+    Param::SetInt(Param::heater_can_contactor_request, heaterCanCloseRequest ? 1 : 0);
 }
 
-void mVCUIntegration::DecodeCAN(int id, uint8_t* data, uint8_t dlc)
+// Fixed 100 ms cycle unless a heartbeat is configured, see Task10Ms()
+void mVCUIntegration::Task100Ms()
 {
-    if (id != MVCU_HEATER_CONTROL_ID || data == nullptr || dlc < 8)
+    if (Param::GetInt(Param::can_tx_heartbeat) == 0)
     {
-        return;
-    }
-
-    if (!CheckCrc(data))
-    {
-        return;
+        SendStatus(100);
     }
+}
 
-    if (!ValidateCounter(data[6] & 0x0FU))
+// With a heartbeat the status frames go out within 10 ms of a change
+void mVCUIntegration::Task10Ms()
+{
+    if (Param::GetInt(Param::can_tx_heartbeat) > 0)
     {
-        return;
+        SendStatus(10);
     }
-
-    heaterCanCloseRequest = (data[0] & 0x01U) != 0U;
-    rxTimeoutTicks = MVCU_RX_TIMEOUT_TICKS_100MS;
-    Param::SetInt(Param::heater_can_contactor_request, heaterCanCloseRequest ? 1 : 0);
 }
 
-void mVCUIntegration::Task100Ms()
+void mVCUIntegration::SendStatus(uint32_t elapsedMs)
 {
     if (!can)
     {
         return;
     }
 
+    const uint32_t heartbeatMs = Param::GetInt(Param::can_tx_heartbeat);
+
     int dcChargePowerW = Param::GetInt(Param::mlb_chr_LAD_IstSpannung_HV) * Param::GetInt(Param::mlb_chr_LAD_IstStrom_HV);
     if (dcChargePowerW < 0)
     {
@@ -118,16 +134,9 @@ void mVCUIntegration::Task100Ms()
     bytes[6] = static_cast<uint8_t>((maxChargePower >> 16) & 0xFFU);
     bytes[7] = static_cast<uint8_t>((maxChargePower >> 24) & 0xFFU);
 
-    can->Send(MVCU_CHARGE_POWER_STATUS_ID, bytes, 8);
-
-    if (rxTimeoutTicks > 0)
+    if (chargePowerTx.Due(bytes, 8, elapsedMs, heartbeatMs))
     {
-        rxTimeoutTicks--;
-    }
-    if (rxTimeoutTicks == 0)
-    {
-        heaterCanCloseRequest = false;
-        Param::SetInt(Param::heater_can_contactor_request, 0);
+        can->Send(MVCU_CHARGE_POWER_STATUS_ID, bytes, 8);
     }
 
     uint8_t heaterStatusBytes[8] = {0};
@@ -137,14 +146,10 @@ void mVCUIntegration::Task100Ms()
     heaterStatusBytes[3] = static_cast<uint8_t>(Param::GetInt(Param::heater_thermal_switch_in) ? 1 : 0);
     heaterStatusBytes[4] = static_cast<uint8_t>(Param::GetInt(Param::heater_contactor_out) ? 1 : 0);
     heaterStatusBytes[5] = static_cast<uint8_t>(Param::GetInt(Param::heater_can_contactor_request) ? 1 : 0);
-    heaterStatusBytes[6] = txCounter & 0x0FU;
-
-    uint32_t crcBuf[2] = {0, 0};
-    memcpy(crcBuf, heaterStatusBytes, sizeof(crcBuf));
-    crcBuf[1] &= 0x00FFFFFF; // clear CRC byte (byte 7)
-    crc_reset();
-    heaterStatusBytes[7] = static_cast<uint8_t>(crc_calculate_block(crcBuf, 2) & 0xFFU);
 
-    can->Send(MVCU_HEATER_STATUS_ID, heaterStatusBytes, 8);
-    txCounter = static_cast<uint8_t>((txCounter + 1U) & 0x0FU);
+    if (heaterStatusTx.Due(heaterStatusBytes, 8, elapsedMs, heartbeatMs))
+    {
+        txE2E.Protect(heaterStatusBytes, 8); // counter in byte 6, CRC in byte 7
+        can->Send(MVCU_HEATER_STATUS_ID, heaterStatusBytes, 8);
+    }
 }
@@ -22,7 +22,12 @@
 #include <libopencm3/stm32/rtc.h>
 #include <libopencm3/stm32/can.h>
 #include <libopencm3/stm32/iwdg.h>
+#include <libopencm3/cm3/dwt.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/dma.h>
 #include "stm32_can.h"
+#include "stm32_can_managed.h"
+#include "mcp2515_can.h"
 #include "canmap.h"
 #include "cansdo.h"
 #include "terminal.h"
@@ -49,6 +54,20 @@
 #include "eps.h"
 #include "vw_mlb_charger.h"
 #include "mVCUIntegration.h"
+#include "crc_service.h"
+#include "can_dispatch.h"
+#include "can_rx_queue.h"
+#include "can_rx_stats.h"
+#include "can_rx.h"
+#include "can_rate_limit.h"
+#include "rx_supervisor.h"
+#include "tx_on_change.h"
+#include "can_tx_timing.h"
+#include "can_bus_load.h"
+#include "canmap_schedule.h"
+#include "can_gateway.h"
+#include "can_sniffer.h"
+#include "timebase.h"
 
 #define PRINT_JSON 0
 
@@ -56,6 +75,7 @@
 static Stm32Scheduler *scheduler;
 static CanHardware *canInterface[3];
 static CanMap *canMap;
+static volatile uint32_t msTicks;
 
 // Functional SW components
 static TeslaCoolantPump coolantPump;
@@ -77,25 +97,130 @@ static void SetCanFilters()
    CanHardware *bms_can = canInterface[Param::GetInt(Param::BMS_CAN)];
    CanHardware *charger_can = canInterface[Param::GetInt(Param::charger_can)];
 
+   // Modules register their receive handlers while setting up their interface
+   CanDispatch::BeginUpdate();
+   CanRxStats::Reset();
+   CanRateLimit::SetBudget(Param::GetInt(Param::can_rx_limit), Param::GetInt(Param::can_rx_burst));
+   CanRateLimit::Reset();
+   RxSupervisor::BeginUpdate();
    DCDCTesla.SetCanInterface(dcdc_can);
    teensyBms.SetCanInterface(bms_can);
    mlbCharger.SetCanInterface(charger_can);
    mvcuIntegration.SetCanInterface(charger_can);
+   CanDispatch::EndUpdate();
 
    canInterface[0]->RegisterUserMessage(0x601); // CanSDO
    canInterface[1]->RegisterUserMessage(0x601); // CanSDO
+
+   // Routes gw1..gw4, an interface set to Off disables the route
+   const int gwParams = Param::gw2_src - Param::gw1_src;
+
+   CanGateway::BeginUpdate();
+
+   for (int i = 0; i < CAN_GATEWAY_MAX_ROUTES; i++)
+   {
+      const int src = Param::GetInt((Param::PARAM_NUM)(Param::gw1_src + i * gwParams));
+      const int dst = Param::GetInt((Param::PARAM_NUM)(Param::gw1_dst + i * gwParams));
+
+      if (src == 0 || dst == 0)
+         continue;
+
+      CanGateway::AddRoute(src - 1, Param::GetInt((Param::PARAM_NUM)(Param::gw1_id + i * gwParams)),
+                           Param::GetInt((Param::PARAM_NUM)(Param::gw1_mask + i * gwParams)), dst - 1,
+                           Param::GetInt((Param::PARAM_NUM)(Param::gw1_newid + i * gwParams)),
+                           Param::GetInt((Param::PARAM_NUM)(Param::gw1_ext + i * gwParams)) != 0);
+   }
+
+   CanGateway::EndUpdate();
+   CanGateway::RegisterIds();
 }
 
-static bool CanCallback(uint32_t id, uint32_t data[2], uint8_t dlc) // This is where we go when a defined CAN message is received.
+static bool CanCallback(int iface, uint32_t id, uint32_t data[2], uint8_t dlc) // This is where we go when a defined CAN message is received.
 {
-   dlc = dlc;
-   DCDCTesla.DecodeCAN(id, (uint8_t *)data);
-   teensyBms.DecodeCAN(id, (uint8_t *)data);
-   mlbCharger.DecodeCAN(id, data);
-   mvcuIntegration.DecodeCAN(id, (uint8_t *)data, dlc);
+   CanRx::Receive(iface, id, data, dlc, msTicks);
    return false;
 }
 
+// The interfaces only differ in the bus load accounting
+static bool Can1Callback(uint32_t id, uint32_t data[2], uint8_t dlc)
+{
+   CanBusLoad::Record(CAN_BUS_LOAD_CAN1, id, dlc);
+   if (CanSniffer::IsActive())
+      CanSniffer::Capture(0, false, id, reinterpret_cast<uint8_t*>(data), dlc, Timebase::Now());
+   return CanCallback(0, id, data, dlc);
+}
+
+static bool Can2Callback(uint32_t id, uint32_t data[2], uint8_t dlc)
+{
+   CanBusLoad::Record(CAN_BUS_LOAD_CAN2, id, dlc);
+   if (CanSniffer::IsActive())
+      CanSniffer::Capture(1, false, id, reinterpret_cast<uint8_t*>(data), dlc, Timebase::Now());
+   return CanCallback(1, id, data, dlc);
+}
+
+// Bus load and sniffer are recorded by the MCP2515 driver, runs in the SPI2 RX DMA interrupt
+static bool Can3Callback(uint32_t id, uint32_t data[2], uint8_t dlc)
+{
+   return CanCallback(2, id, data, dlc);
+}
+
+// Period of every mapped TX message, those set to 0 follow canperiod
+static void UpdateCanMapSchedule()
+{
+   static const uint16_t periods[] = { 0, 10, 20, 50, 100, 200, 500, 1000 }; // CANMAP_PERIODS
+   const uint16_t global = Param::GetInt(Param::canperiod) == CAN_PERIOD_10MS ? 10 : 100;
+   uint32_t canId;
+
+   CanMapSchedule::Begin();
+
+   for (int i = 0; i < CANMAP_SCHEDULE_MAX && canMap->GetMap(false, i, 0, canId) != 0; i++)
+   {
+      const int period = Param::GetInt((Param::PARAM_NUM)(Param::canmap_per1 + i));
+
+      CanMapSchedule::Add(canId, period > 0 ? periods[period] : global);
+   }
+}
+
+// Hands the sniffer records to the USART3 TX DMA (DMA1 channel 2). Runs in
+// the main loop like the terminal, so a transfer of the terminal is never cut
+// short. TCIF stays set after our transfer, which is what the terminal waits
+// for before it starts its own.
+static void SniffTx()
+{
+   const uint8_t* data;
+
+   if (CanSniffer::IsSending())
+   {
+      if (!dma_get_interrupt_flag(DMA1, DMA_CHANNEL2, DMA_TCIF))
+         return;
+      CanSniffer::Consume();
+   }
+
+   if (!CanSniffer::IsActive())
+      return;
+
+   // The terminal is still sending
+   if ((DMA_CCR(DMA1, DMA_CHANNEL2) & DMA_CCR_EN) && !dma_get_interrupt_flag(DMA1, DMA_CHANNEL2, DMA_TCIF))
+      return;
+
+   const int len = CanSniffer::Peek(data);
+
+   if (len == 0)
+      return;
+
+   dma_disable_channel(DMA1, DMA_CHANNEL2);
+   dma_set_peripheral_address(DMA1, DMA_CHANNEL2, (uint32_t)&USART3_DR);
+   dma_set_memory_address(DMA1, DMA_CHANNEL2, (uint32_t)data);
+   dma_set_number_of_data(DMA1, DMA_CHANNEL2, len);
+   dma_set_read_from_memory(DMA1, DMA_CHANNEL2);
+   dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL2);
+   dma_set_peripheral_size(DMA1, DMA_CHANNEL2, DMA_CCR_PSIZE_8BIT);
+   dma_set_memory_size(DMA1, DMA_CHANNEL2, DMA_CCR_MSIZE_8BIT);
+   dma_clear_interrupt_flags(DMA1, DMA_CHANNEL2, DMA_TCIF);
+   usart_enable_tx_dma(USART3);
+   dma_enable_channel(DMA1, DMA_CHANNEL2);
+}
+
 // sample 100ms task
 static void Ms100Task(void)
 {
@@ -109,14 +234,54 @@ static void Ms100Task(void)
    // The boot loader enables the watchdog, we have to reset it
    // at least every 2s or otherwise the controller is hard reset.
    iwdg_reset();
+   // Carries the us timebase over the cycle counter wrap
+   Timebase::Now();
    // Calculate CPU load. Don't be surprised if it is zero.
    float cpuLoad = scheduler->GetCpuLoad();
    // This sets a fixed point value WITHOUT calling the parm_Change() function
    Param::SetFloat(Param::cpuload, cpuLoad / 10);
+   Param::SetInt(Param::crc_retries, CrcService::GetRetries());
+   Param::SetInt(Param::crc_fallbacks, CrcService::GetFallbacks());
+   Param::SetInt(Param::can_rx_unmatched, CanDispatch::GetUnmatched());
+   Param::SetInt(Param::can_rx_queue_hwm, CanRxQueue::GetHighWaterMark());
+   Param::SetInt(Param::can_rx_queue_overflow, CanRxQueue::GetOverflows());
+   CanRxStats::Update(msTicks);
+   Param::SetInt(Param::can_rx_ids, CanRxStats::GetActive());
+   Param::SetInt(Param::can_rx_stale, CanRxStats::GetStale());
+   Param::SetInt(Param::can_rx_missed, CanRxStats::GetMissed());
+   Param::SetInt(Param::can_rx_stats_cyc, CanRx::GetStatsCycles());
+   Param::SetInt(Param::can_rx_timeouts, RxSupervisor::GetStale());
+   CanRateLimit::Update();
+   Param::SetInt(Param::can_rx_limited, CanRateLimit::GetDropped());
+   // Extended IDs beyond the value range saturate, canstats names them in full
+   Param::SetInt(Param::can_rx_babbler, CanRateLimit::GetOffender() < 67108863 ? CanRateLimit::GetOffender() : 67108863);
+   Param::SetInt(Param::can_filter_banks, CanFilterPlanner::GetBanks(0) + CanFilterPlanner::GetBanks(1));
+   Param::SetInt(Param::can_filter_extra, CanFilterPlanner::GetExtra() < 67108863 ? CanFilterPlanner::GetExtra() : 67108863);
+   Param::SetInt(Param::can_tx_mbox_full, Stm32CanManaged::GetTxMailboxFull());
+   Param::SetInt(Param::can_tx_queue_hwm, Stm32CanManaged::GetTxQueueMaxDepth());
+   Param::SetInt(Param::can_tx_queue_fail, Stm32CanManaged::GetTxQueueFailures());
+   Param::SetInt(Param::can_tx_latency, Stm32CanManaged::GetTxLatencyMaxUs());
+   Param::SetInt(Param::can_tx_suppressed, TxOnChange::GetSuppressed());
+   CanTxTiming::Update(dwt_read_cycle_counter(), Param::GetInt(Param::can_tx_period_tol));
+   Param::SetInt(Param::can_tx_period_viol, CanTxTiming::GetViolations());
+   Param::SetInt(Param::mlb_tx_late, VWMLBClass::GetTxLate());
+   CanBusLoad::Update();
+   Param::SetFloat(Param::can1_load, CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN1) / 10.0f);
+   Param::SetFloat(Param::can1_load_1s, CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN1) / 10.0f);
+   Param::SetFloat(Param::can1_load_peak, CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN1) / 10.0f);
+   Param::SetFloat(Param::can2_load, CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN2) / 10.0f);
+   Param::SetFloat(Param::can2_load_1s, CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN2) / 10.0f);
+   Param::SetFloat(Param::can2_load_peak, CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN2) / 10.0f);
+   Param::SetFloat(Param::can3_load, CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN3) / 10.0f);
+   Param::SetFloat(Param::can3_load_1s, CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN3) / 10.0f);
+   Param::SetFloat(Param::can3_load_peak, CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN3) / 10.0f);
+   Param::SetInt(Param::gw_forwarded, CanGateway::GetForwarded());
+   Param::SetInt(Param::gw_dropped, CanGateway::GetDropped());
+   Param::SetInt(Param::gw_latency, CanGateway::GetMaxCycles() / (rcc_ahb_frequency / 1000000));
+   Param::SetInt(Param::sniff_overflow, CanSniffer::GetOverflows());
 
-   // If we chose to send CAN messages every 100 ms, do this here.
-   if (Param::GetInt(Param::canperiod) == CAN_PERIOD_100MS)
-      canMap->SendAll();
+   // Picks up changed periods and CAN mappings
+   UpdateCanMapSchedule();
 
    // Give calculation power to the module
    teslaValve.Task100Ms();
@@ -135,19 +300,34 @@ static void Ms10Task(void)
    // Set timestamp of error message
    ErrorMessage::SetTime(rtc_get_counter_val());
 
-   // If we chose to send CAN messages every 10 ms, do this here.
-   if (Param::GetInt(Param::canperiod) == CAN_PERIOD_10MS)
+   // Mapped messages go out with their own period, the gate holds back those not due
+   if (CanMapSchedule::Advance())
+   {
+      Stm32CanManaged::GetManaged(0)->SetTxGate(CanMapSchedule::Pass);
       canMap->SendAll();
+      Stm32CanManaged::GetManaged(0)->SetTxGate(nullptr);
+   }
+
+   // Decode the frames queued by the receive interrupt in deferred mode
+   CanRx::ProcessQueue();
+
+   // Timeout handlers of the modules are called from here
+   RxSupervisor::Tick(msTicks);
 
    heater.Task10Ms();
    vacuumPump.Task10Ms();
    mlbCharger.Task10Ms();
+   teensyBms.Task10Ms();
+   mvcuIntegration.Task10Ms();
 }
 
 // sample 1 ms task
 static void Ms1Task(void)
 {
+   msTicks = msTicks + 1;
    coolantPump.Task1Ms();
+   Stm32CanManaged::ServiceTx();
+   Mcp2515Can::Poll();
 }
 
 /** This function is called when the user changes a parameter */
@@ -167,8 +347,15 @@ void Param::Change(Param::PARAM_NUM paramNum)
       SetCanFilters(); // Re-assign CAN interface to Charger
       break;
 
+   case Param::can_rx_limit:
+   case Param::can_rx_burst:
+      CanRateLimit::SetBudget(Param::GetInt(Param::can_rx_limit), Param::GetInt(Param::can_rx_burst));
+      break;
+
    default:
       // Handle general parameter changes here. Add paramNum labels for handling specific parameters
+      if (paramNum >= Param::gw1_src && paramNum <= Param::gw4_ext)
+         SetCanFilters(); // Re-register the routed IDs
       break;
    }
 }
@@ -185,6 +372,7 @@ extern "C" int main(void)
    extern const TERM_CMD termCmds[];
 
    clock_setup(); // Must always come first
+   dwt_enable_cycle_counter(); // Used to measure the cost of the receive statistics and the TX timing
    rtc_setup();
    gpio_primary_remap(AFIO_MAPR_SWJ_CFG_JTAG_OFF_SW_ON, AFIO_MAPR_CAN2_REMAP | AFIO_MAPR_TIM1_REMAP_FULL_REMAP);//32f107
    ANA_IN_CONFIGURE(ANA_IN_LIST);
@@ -197,16 +385,28 @@ extern "C" int main(void)
    parm_load();  // Load stored parameters
 
    // Initialize CAN1, including interrupts. Clock must be enabled in clock_setup()
-   Stm32Can c(CAN1, (CanHardware::baudrates)Param::GetInt(Param::canspeed));
-   Stm32Can c2(CAN2, (CanHardware::baudrates)Param::GetInt(Param::canspeed), true);
-   FunctionPointerCallback cb(CanCallback, SetCanFilters);
+   // Both interfaces share the 28 filter banks, see CanFilterPlanner
+   Stm32CanManaged c(CAN1, (CanHardware::baudrates)Param::GetInt(Param::canspeed));
+   Stm32CanManaged c2(CAN2, (CanHardware::baudrates)Param::GetInt(Param::canspeed), true);
+   FunctionPointerCallback cb(Can1Callback, SetCanFilters);
+   FunctionPointerCallback cb2(Can2Callback, SetCanFilters);
+   // CAN3 on the MCP2515, its bit rate is set by CAN3Speed
+   spi2_setup();
+   Mcp2515Can c3;
+   FunctionPointerCallback cb3(Can3Callback, SetCanFilters);
+   static const uint32_t bitrates[] = { 125000, 250000, 500000, 800000, 1000000 }; // CANSPEEDS
+   CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN1, bitrates[Param::GetInt(Param::canspeed)]);
+   CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN2, bitrates[Param::GetInt(Param::canspeed)]);
    CanMap cm(&c);
    CanSdo sdo(&c, &cm);
    sdo.SetNodeId(33); // id 33 for vcu?
    canInterface[0] = &c;
    canInterface[1] = &c2;
+   canInterface[2] = &c3;
+   CanGateway::SetInterfaces(canInterface);
    c.AddCallback(&cb);
-   c2.AddCallback(&cb);
+   c2.AddCallback(&cb2);
+   c3.AddCallback(&cb3);
    TerminalCommands::SetCanMap(&cm);
    canMap = &cm;
 
@@ -240,7 +440,16 @@ extern "C" int main(void)
    while (1)
    {
       char c = 0;
-      t.Run();
+
+      // The UART carries nothing but the capture, any key stops it
+      if (!CanSniffer::IsActive())
+         t.Run();
+      else if (t.KeyPressed())
+      {
+         t.FlushInput();
+         CanSniffer::Stop();
+      }
+      SniffTx();
       if (sdo.GetPrintRequest() == PRINT_JSON)
       {
          TerminalCommands::PrintParamsJson(&sdo, &c);
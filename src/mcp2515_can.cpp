@@ -0,0 +1,84 @@
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
+#include "mcp2515_can.h"
+#include "spi_dma.h"
+#include "digio.h"
+#include "can_frame.h"
+
+Mcp2515Can* Mcp2515Can::instance = nullptr;
+
+Mcp2515Can::Mcp2515Can()
+{
+    instance = this;
+    DigIo::mcp_cs.Set();
+    CANSPI_Initialize();
+}
+
+void Mcp2515Can::SetBaudrate(enum baudrates baudrate)
+{
+    (void)baudrate;
+}
+
+// Called from the tasks and from the receive interrupts (gateway)
+void Mcp2515Can::Send(uint32_t canId, uint32_t data[2], uint8_t len)
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    txQueue.Push(canId, data, len, dwt_read_cycle_counter());
+    cm_mask_interrupts(mask);
+    StartTx();
+}
+
+// Run from the 1 ms task
+void Mcp2515Can::Poll()
+{
+    if (instance == nullptr)
+        return;
+
+    StartTx();
+    CANSPI_ReceiveDma(Received);
+}
+
+// SPI2 RX DMA interrupt
+void Mcp2515Can::Received(uCAN_MSG* msg)
+{
+    const bool ext = msg->frame.idType == dEXTENDED_CAN_MSG_ID_2_0B;
+    const uint8_t* src = &msg->frame.data0;
+    uint32_t data[2];
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(data);
+
+    for (int i = 0; i < 8; i++)
+        bytes[i] = src[i];
+
+    // The other RX buffer may hold a frame as well
+    CANSPI_ReceiveDma(Received);
+    instance->HandleRx(msg->frame.id | (ext ? CAN_FRAME_EXT_FLAG : 0), data, msg->frame.dlc & 0x0F);
+}
+
+// Loads the next frame once the previous one is in a TX buffer of the
+// controller, called from Send(), Poll() and when CANSPI is done with a frame.
+// Without a free SpiDma slot for the status read Poll() tries again.
+void Mcp2515Can::StartTx()
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+    CanTxFrame frame;
+
+    if (!CANSPI_isTxDmaBusy() && SpiDma::GetFree() > 0 && instance->txQueue.Pop(frame, dwt_read_cycle_counter()))
+    {
+        const uint32_t rawId = frame.id & CAN_FRAME_ID_MASK;
+        const uint8_t* src = reinterpret_cast<const uint8_t*>(frame.data);
+        uCAN_MSG msg;
+        uint8_t* dst = &msg.frame.data0;
+
+        msg.frame.idType = (frame.id & CAN_FRAME_EXT_FLAG) != 0 || rawId > CAN_FRAME_STD_MAX ?
+                           dEXTENDED_CAN_MSG_ID_2_0B : dSTANDARD_CAN_MSG_ID_2_0B;
+        msg.frame.id = rawId;
+        msg.frame.dlc = frame.len > 8 ? 8 : frame.len;
+        for (int i = 0; i < 8; i++)
+            dst[i] = src[i];
+
+        CANSPI_TransmitDma(&msg, StartTx);
+    }
+
+    cm_mask_interrupts(mask);
+}
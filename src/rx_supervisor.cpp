@@ -0,0 +1,83 @@
+#include "rx_supervisor.h"
+
+RxSupervisor::Entry RxSupervisor::entries[RX_SUPERVISOR_MAX_ENTRIES];
+int RxSupervisor::numEntries = 0;
+int RxSupervisor::stale = 0;
+volatile uint32_t RxSupervisor::now = 0;
+
+// Called together with CanDispatch::BeginUpdate(), the modules register again
+// when they are assigned to their interface.
+void RxSupervisor::BeginUpdate()
+{
+    numEntries = 0;
+    stale = 0;
+}
+
+int RxSupervisor::Register(uint32_t id, uint16_t periodMs, uint16_t toleranceMs, RxFreshnessHandler handler, void* ctx)
+{
+    if (numEntries >= RX_SUPERVISOR_MAX_ENTRIES)
+        return -1;
+
+    Entry& e = entries[numEntries];
+    e.id = id;
+    e.lastSeen = now;
+    e.timeout = periodMs + toleranceMs;
+    e.state = RX_NEVER;
+    e.arrived = false;
+    e.handler = handler;
+    e.ctx = ctx;
+
+    return numEntries++;
+}
+
+// Only timestamps the arrival, the state change is handled in Tick()
+void RxSupervisor::Refresh(int handle)
+{
+    if (handle < 0 || handle >= numEntries)
+        return;
+
+    entries[handle].lastSeen = now;
+    entries[handle].arrived = true;
+}
+
+void RxSupervisor::Tick(uint32_t time)
+{
+    int numStale = 0;
+
+    now = time;
+
+    for (int i = 0; i < numEntries; i++)
+    {
+        Entry& e = entries[i];
+        State next = static_cast<State>(e.state);
+
+        if (e.arrived)
+        {
+            e.arrived = false;
+            next = RX_FRESH;
+        }
+        else if (e.state != RX_STALE && time - e.lastSeen > e.timeout)
+        {
+            next = RX_STALE;
+        }
+
+        if (next != e.state)
+        {
+            e.state = next;
+            if (e.handler)
+                e.handler(e.ctx, e.id, next == RX_FRESH);
+        }
+
+        if (e.state == RX_STALE)
+            numStale++;
+    }
+
+    stale = numStale;
+}
+
+RxSupervisor::State RxSupervisor::GetState(int handle)
+{
+    if (handle < 0 || handle >= numEntries)
+        return RX_STALE;
+    return static_cast<State>(entries[handle].state);
+}
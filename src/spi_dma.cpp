@@ -0,0 +1,127 @@
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/spi.h>
+#include "spi_dma.h"
+
+#define SPI_DMA_RX DMA_CHANNEL4
+#define SPI_DMA_TX DMA_CHANNEL5
+
+SpiDma::Transaction SpiDma::queue[SPI_DMA_QUEUE_SIZE];
+uint8_t SpiDma::rx[SPI_DMA_MAX_LEN];
+void (*SpiDma::chipSelect)(bool active) = nullptr;
+volatile int SpiDma::head = 0;
+volatile int SpiDma::count = 0;
+uint32_t SpiDma::transactions = 0;
+uint32_t SpiDma::overflows = 0;
+int SpiDma::maxDepth = 0;
+
+// Everything but the TX memory address and the lengths stays fixed
+void SpiDma::Init(void (*cs)(bool active))
+{
+    chipSelect = cs;
+    head = count = 0;
+
+    dma_channel_reset(DMA1, SPI_DMA_RX);
+    dma_set_peripheral_address(DMA1, SPI_DMA_RX, (uint32_t)(uintptr_t)&SPI_DR(SPI2));
+    dma_set_memory_address(DMA1, SPI_DMA_RX, (uint32_t)(uintptr_t)rx);
+    dma_set_read_from_peripheral(DMA1, SPI_DMA_RX);
+    dma_enable_memory_increment_mode(DMA1, SPI_DMA_RX);
+    dma_set_peripheral_size(DMA1, SPI_DMA_RX, DMA_CCR_PSIZE_8BIT);
+    dma_set_memory_size(DMA1, SPI_DMA_RX, DMA_CCR_MSIZE_8BIT);
+    dma_enable_transfer_complete_interrupt(DMA1, SPI_DMA_RX);
+
+    dma_channel_reset(DMA1, SPI_DMA_TX);
+    dma_set_peripheral_address(DMA1, SPI_DMA_TX, (uint32_t)(uintptr_t)&SPI_DR(SPI2));
+    dma_set_read_from_memory(DMA1, SPI_DMA_TX);
+    dma_enable_memory_increment_mode(DMA1, SPI_DMA_TX);
+    dma_set_peripheral_size(DMA1, SPI_DMA_TX, DMA_CCR_PSIZE_8BIT);
+    dma_set_memory_size(DMA1, SPI_DMA_TX, DMA_CCR_MSIZE_8BIT);
+
+    spi_enable_rx_dma(SPI2);
+    spi_enable_tx_dma(SPI2);
+    nvic_enable_irq(NVIC_DMA1_CHANNEL4_IRQ);
+}
+
+// Called from tasks and from completion callbacks
+bool SpiDma::Queue(const uint8_t* tx, uint8_t len, Callback done, void* ctx)
+{
+    if (len == 0 || len > SPI_DMA_MAX_LEN)
+        return false;
+
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    if (count >= SPI_DMA_QUEUE_SIZE)
+    {
+        overflows++;
+        cm_mask_interrupts(mask);
+        return false;
+    }
+
+    Transaction& t = queue[(head + count) % SPI_DMA_QUEUE_SIZE];
+
+    for (int i = 0; i < len; i++)
+        t.tx[i] = tx[i];
+    t.len = len;
+    t.done = done;
+    t.ctx = ctx;
+    count = count + 1;
+
+    if (count > maxDepth)
+        maxDepth = count;
+    if (count == 1)
+        Start();
+
+    cm_mask_interrupts(mask);
+    return true;
+}
+
+void SpiDma::WaitIdle()
+{
+    while (count > 0)
+    {
+        const uint32_t mask = cm_mask_interrupts(1);
+
+        OnComplete();
+        cm_mask_interrupts(mask);
+    }
+}
+
+// The interrupt may find the transfer already completed by WaitIdle()
+void SpiDma::OnComplete()
+{
+    if (count == 0 || !dma_get_interrupt_flag(DMA1, SPI_DMA_RX, DMA_TCIF))
+        return;
+
+    const Transaction& t = queue[head];
+
+    dma_clear_interrupt_flags(DMA1, SPI_DMA_RX, DMA_TCIF);
+    dma_disable_channel(DMA1, SPI_DMA_RX);
+    dma_disable_channel(DMA1, SPI_DMA_TX);
+    chipSelect(false);
+    transactions++;
+
+    // The slot stays taken during the callback, so a transaction it queues
+    // does not start on top of the one just finished
+    if (t.done != nullptr)
+        t.done(t.ctx, rx, t.len);
+
+    head = (head + 1) % SPI_DMA_QUEUE_SIZE;
+    count = count - 1;
+
+    if (count > 0)
+        Start();
+}
+
+// RX is enabled first, so no received byte is missed
+void SpiDma::Start()
+{
+    const Transaction& t = queue[head];
+
+    chipSelect(true);
+    dma_set_memory_address(DMA1, SPI_DMA_TX, (uint32_t)(uintptr_t)t.tx);
+    dma_set_number_of_data(DMA1, SPI_DMA_RX, t.len);
+    dma_set_number_of_data(DMA1, SPI_DMA_TX, t.len);
+    dma_enable_channel(DMA1, SPI_DMA_RX);
+    dma_enable_channel(DMA1, SPI_DMA_TX);
+}
@@ -0,0 +1,175 @@
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
+#include <libopencm3/stm32/can.h>
+#include <libopencm3/stm32/rcc.h>
+#include "stm32_can_managed.h"
+#include "can_tx_timing.h"
+#include "can_bus_load.h"
+#include "can_sniffer.h"
+#include "latency_probe.h"
+#include "timebase.h"
+#include "errormessage.h"
+
+#define CAN_TSR_TME_ANY (CAN_TSR_TME0 | CAN_TSR_TME1 | CAN_TSR_TME2)
+
+Stm32CanManaged* Stm32CanManaged::interfaces[CAN_FILTER_MAX_IFACES];
+int Stm32CanManaged::filterResult = 0;
+volatile uint32_t Stm32CanManaged::txMailboxFull = 0;
+
+Stm32CanManaged::Stm32CanManaged(uint32_t baseAddr, enum baudrates baudrate, bool remap)
+    : Stm32Can(baseAddr, baudrate, remap), canDev(baseAddr), txGate(nullptr)
+{
+    interfaces[baseAddr == CAN1 ? 0 : 1] = this;
+    CanTxTiming::SetTicksPerUs(rcc_ahb_frequency / 1000000);
+    Timebase::SetTicksPerUs(rcc_ahb_frequency / 1000000);
+}
+
+// Called from the tasks and from the receive interrupt (SDO replies)
+void Stm32CanManaged::Send(uint32_t canId, uint32_t data[2], uint8_t len)
+{
+    if (txGate != nullptr && !txGate(canId))
+        return;
+
+    const uint32_t mask = cm_mask_interrupts(1);
+
+    if ((CAN_TSR(canDev) & CAN_TSR_TME_ANY) == 0)
+        txMailboxFull = txMailboxFull + 1;
+
+    txQueue.Push(canId, data, len, dwt_read_cycle_counter());
+    cm_mask_interrupts(mask);
+    DrainTxQueue();
+}
+
+// Hands queued frames to the mailboxes freed since the last call, run from the 1 ms task
+void Stm32CanManaged::ServiceTx()
+{
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        if (interfaces[i] != nullptr && interfaces[i]->txQueue.Count() > 0)
+            interfaces[i]->DrainTxQueue();
+    }
+}
+
+uint32_t Stm32CanManaged::GetTxLatencyUs() const
+{
+    return txQueue.GetMaxLatency() / (rcc_ahb_frequency / 1000000);
+}
+
+int Stm32CanManaged::GetTxQueueMaxDepth()
+{
+    int depth = 0;
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        if (interfaces[i] != nullptr && interfaces[i]->txQueue.GetMaxDepth() > depth)
+            depth = interfaces[i]->txQueue.GetMaxDepth();
+    }
+    return depth;
+}
+
+uint32_t Stm32CanManaged::GetTxQueueFailures()
+{
+    uint32_t failures = 0;
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        if (interfaces[i] != nullptr)
+            failures += interfaces[i]->txQueue.GetFailures();
+    }
+    return failures;
+}
+
+uint32_t Stm32CanManaged::GetTxLatencyMaxUs()
+{
+    uint32_t latency = 0;
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        if (interfaces[i] != nullptr && interfaces[i]->GetTxLatencyUs() > latency)
+            latency = interfaces[i]->GetTxLatencyUs();
+    }
+    return latency;
+}
+
+// A mailbox is free, so Stm32Can transmits right away and its own buffer stays empty.
+// Only taking the frame and writing the mailbox is done with interrupts masked,
+// the statistics run afterwards so they do not add to the interrupt latency.
+void Stm32CanManaged::DrainTxQueue()
+{
+    CanTxFrame frame;
+
+    for (;;)
+    {
+        const uint32_t mask = cm_mask_interrupts(1);
+        const uint32_t now = dwt_read_cycle_counter();
+        const bool sent = (CAN_TSR(canDev) & CAN_TSR_TME_ANY) != 0 && txQueue.Pop(frame, now);
+
+        if (sent)
+            Stm32Can::Send(frame.id, frame.data, frame.len);
+        cm_mask_interrupts(mask);
+
+        if (!sent)
+            break;
+
+        CanTxTiming::Record(frame.id, now);
+        CanBusLoad::Record(canDev == CAN1 ? CAN_BUS_LOAD_CAN1 : CAN_BUS_LOAD_CAN2, frame.id, frame.len);
+        if (CanSniffer::IsActive() || LatencyProbe::TxPending())
+        {
+            const uint32_t nowUs = Timebase::Extend(now);
+
+            CanSniffer::Capture(canDev == CAN1 ? 0 : 1, true, frame.id, reinterpret_cast<uint8_t*>(frame.data), frame.len, nowUs);
+            if (LatencyProbe::TxPending())
+                LatencyProbe::OnTx(frame.id, nowUs);
+        }
+    }
+}
+
+// Called by CanHardware after every change of the user messages
+void Stm32CanManaged::ConfigureFilters()
+{
+    bool complete = true;
+
+    CanFilterPlanner::Begin();
+
+    for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+    {
+        if (interfaces[i] == nullptr)
+            continue;
+
+        for (int n = 0; n < interfaces[i]->nextUserMessageIndex; n++)
+            complete &= CanFilterPlanner::Add(i, interfaces[i]->userIds[n]);
+    }
+
+    // More IDs than the planner holds, the filter is opened for their format
+    if (!complete)
+        ErrorMessage::Post(ERR_CAN_FILTER_OVERFLOW);
+
+    filterResult = CanFilterPlanner::Plan();
+
+    if (filterResult >= 0)
+        WriteFilterBanks();
+}
+
+// The filter registers only exist in CAN1 and are shared by both interfaces.
+// Banks are spread over both receive FIFOs.
+void Stm32CanManaged::WriteFilterBanks()
+{
+    CAN_FMR(CAN1) |= CAN_FMR_FINIT;
+    CAN_FA1R(CAN1) = 0;
+    CAN_FMR(CAN1) = (CAN_FMR(CAN1) & ~CAN_FMR_CAN2SB_MASK) | (CanFilterPlanner::GetFirstBank(1) << CAN_FMR_CAN2SB_SHIFT);
+
+    for (int i = 0; i < CanFilterPlanner::GetNumBanks(); i++)
+    {
+        const CanFilterPlanner::Bank& bank = CanFilterPlanner::GetBank(i);
+
+        if (bank.iface == CAN_FILTER_UNUSED)
+            continue;
+
+        can_filter_init(i,
+                        bank.mode == CanFilterPlanner::LIST32 || bank.mode == CanFilterPlanner::MASK32,
+                        bank.mode == CanFilterPlanner::LIST16 || bank.mode == CanFilterPlanner::LIST32,
+                        bank.fr1, bank.fr2, i & 1, true);
+    }
+
+    CAN_FMR(CAN1) &= ~CAN_FMR_FINIT;
+}
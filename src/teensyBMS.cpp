@@ -1,104 +1,128 @@
 #include "teensyBMS.h"
 #include "params.h"
-#include <string.h>
-#include <libopencm3/stm32/crc.h>
+#include "can_dispatch.h"
+#include "rx_supervisor.h"
+#include "can_tx_queue.h"
+#include "latency_probe.h"
 
 // CAN message ID for the periodic VCU -> BMS status frame.
 // Byte 1 carries the "force VCU shutdown" pre-sleep warning.
 // Byte 2 carries the independent HV request state from the HVCM/LVDU.
 #define VCU_STATUS_MSG_ID 0x437
 
+// CONT_STATE of 0x41C byte 4
+#define CONTACTOR_OPEN 1
+#define CONTACTOR_CLOSED 4
+
+static void HandleRx(void* ctx, const CanFrame& frame) {
+    static_cast<TeensyBMS*>(ctx)->DecodeCAN(frame);
+}
+
+static void HandleFreshness(void* ctx, uint32_t id, bool fresh) {
+    static_cast<TeensyBMS*>(ctx)->FreshnessChanged(id, fresh);
+}
+
 void TeensyBMS::SetCanInterface(CanHardware* c) {
+    staleMask = BMS_MSG_ALL_STALE;
+    vcuStatusTx.Reset();
+
     if (c == nullptr) {
         can = nullptr;
+        for (int i = 0; i < BMS_MSG_COUNT; i++)
+            rxHandle[i] = -1;
         return;
     }
 
     can = c;
+    // The VCU status carries the HV request, it must not wait behind emulation traffic
+    CanTxQueue::SetUrgent(VCU_STATUS_MSG_ID);
     can->RegisterUserMessage(0x41A); // MSG1: Voltage
     can->RegisterUserMessage(0x41B); // MSG2: Cell Temp
     can->RegisterUserMessage(0x41C); // MSG3: Limits/Fault
     can->RegisterUserMessage(0x41D); // MSG4: SOC/SOH
     can->RegisterUserMessage(0x41E); // MSG5: HMI
 
+    for (int i = 0; i < BMS_MSG_COUNT; i++) {
+        CanDispatch::Register(BMS_MSG_FIRST_ID + i, HandleRx, this);
+        rxHandle[i] = RxSupervisor::Register(BMS_MSG_FIRST_ID + i, BMS_MSG_PERIOD_MS, BMS_MSG_TOLERANCE_MS,
+                                             HandleFreshness, this);
+    }
 }
 
-void TeensyBMS::DecodeCAN(int id, uint8_t* data) {
-    // Store diagnostics for the unit tests/stubs (removed params)
+// Every message has to be fresh, a silent MSG3 (limits/faults) is as bad as a silent MSG1
+void TeensyBMS::FreshnessChanged(uint32_t id, bool fresh) {
+    const int index = id - BMS_MSG_FIRST_ID;
 
-    switch (id) {
-        case 0x41A: parseMsg1(data); break;
-        case 0x41B: parseMsg2(data); break;
-        case 0x41C: parseMsg3(data); break;
-        case 0x41D: parseMsg4(data); break;
-        case 0x41E: parseMsg5(data); break;
-    }
-}
+    if (index < 0 || index >= BMS_MSG_COUNT) return;
 
-bool TeensyBMS::checkCrc(uint8_t* d) {
-    uint32_t buf[2];
-    memcpy(buf, d, 8);
-    buf[1] &= 0x00FFFFFF; // clear CRC byte
-    crc_reset();
-    uint32_t crc = crc_calculate_block(buf, 2) & 0xFF;
-    return crc == d[7];
+    if (fresh)
+        staleMask &= ~(1 << index);
+    else
+        staleMask |= 1 << index;
 }
 
-void TeensyBMS::parseMsg1(uint8_t* d) {
-    if (!checkCrc(d)) return;
-    const uint16_t rawPackVoltage = static_cast<uint16_t>(d[0]) | (static_cast<uint16_t>(d[1]) << 8);
-    packVoltage = rawPackVoltage / 10.0f;
+void TeensyBMS::DecodeCAN(const CanFrame& frame) {
+    const int index = frame.GetId() - BMS_MSG_FIRST_ID;
 
-    const uint16_t rawPackCurrent = static_cast<uint16_t>(d[2]) | (static_cast<uint16_t>(d[3]) << 8);
-    actualCurrent = (static_cast<int32_t>(rawPackCurrent) - 5000) / 10.0f;
-    vMin = d[4] / 50.0f;
-    vMax = d[5] / 50.0f;
-    timeoutCounter = BMS_TIMEOUT_TICKS;
+    if (index < 0 || index >= BMS_MSG_COUNT) return;
+    if (!rxE2E[index].Check(frame)) return;
+    RxSupervisor::Refresh(rxHandle[index]);
+
+    switch (frame.GetId()) {
+        case 0x41A: parseMsg1(frame); break;
+        case 0x41B: parseMsg2(frame); break;
+        case 0x41C: parseMsg3(frame); break;
+        case 0x41D: parseMsg4(frame); break;
+        case 0x41E: parseMsg5(frame); break;
+    }
+}
+
+void TeensyBMS::parseMsg1(const CanFrame& f) {
+    packVoltage = f.Le16(0) / 10.0f;
+    actualCurrent = (static_cast<int32_t>(f.Le16(2)) - 5000) / 10.0f;
+    vMin = f.Byte(4) / 50.0f;
+    vMax = f.Byte(5) / 50.0f;
 }
 
-void TeensyBMS::parseMsg2(uint8_t* d) {
-    if (!checkCrc(d)) return;
-    tMin = static_cast<float>(d[0]) - 40.0f;
-    tMax = static_cast<float>(d[1]) - 40.0f;
-    balancingVoltage = d[2] / 50.0f;
+void TeensyBMS::parseMsg2(const CanFrame& f) {
+    tMin = static_cast<float>(f.Byte(0)) - 40.0f;
+    tMax = static_cast<float>(f.Byte(1)) - 40.0f;
+    balancingVoltage = f.Byte(2) / 50.0f;
     // Delta cell voltage is sent with a 500x gain (0.002 V/LSB). Report it in mV.
-    deltaVoltageMv = static_cast<float>(d[3]) * 2.0f;
+    deltaVoltageMv = static_cast<float>(f.Byte(3)) * 2.0f;
 
-    const uint16_t rawPackPower = static_cast<uint16_t>(d[4]) | (static_cast<uint16_t>(d[5]) << 8);
-    const float packPowerKw = (static_cast<int32_t>(rawPackPower) - 30000) / 100.0f;
+    const float packPowerKw = (static_cast<int32_t>(f.Le16(4)) - 30000) / 100.0f;
     packPower = packPowerKw * 1000.0f;
 }
 
-void TeensyBMS::parseMsg3(uint8_t* d) {
-    if (!checkCrc(d)) return;
-    maxDischargeCurrent = (d[0] | (d[1] << 8)) / 10.0f;
-    maxChargeCurrent = (d[2] | (d[3] << 8)) / 10.0f;
-    contactorState = d[4];
+void TeensyBMS::parseMsg3(const CanFrame& f) {
+    maxDischargeCurrent = f.Le16(0) / 10.0f;
+    maxChargeCurrent = f.Le16(2) / 10.0f;
+
+    if (f.Byte(4) != contactorState) {
+        if (f.Byte(4) == CONTACTOR_CLOSED)
+            LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, f.GetTimeUs());
+        else if (f.Byte(4) == CONTACTOR_OPEN)
+            LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_OPEN, f.GetTimeUs());
+    }
+    contactorState = f.Byte(4);
     // Byte 5 is BMS-level DTC bits in current TeensyVCU firmware.
-    dtc = d[5];
+    dtc = f.Byte(5);
 }
 
-void TeensyBMS::parseMsg4(uint8_t* d) {
-    if (!checkCrc(d)) return;
-    soc = (d[0] | (d[1] << 8)) / 100.0f;
-    soh = (d[2] | (d[3] << 8)) / 100.0f;
-    balancingStatus = d[4];
+void TeensyBMS::parseMsg4(const CanFrame& f) {
+    soc = f.Le16(0) / 100.0f;
+    soh = f.Le16(2) / 100.0f;
+    balancingStatus = f.Byte(4);
     balancingActive = balancingStatus == 1;
     anyBalancing = balancingActive;
-    state = d[5];
+    state = f.Byte(5);
 }
 
-void TeensyBMS::parseMsg5(uint8_t* d) {
-    if (!checkCrc(d)) return;
-    const int16_t rawEnergyPerHour = static_cast<int16_t>(static_cast<uint16_t>(d[0]) |
-                                                         (static_cast<uint16_t>(d[1]) << 8));
-    averageEnergyPerHour = rawEnergyPerHour / 100.0f; // kWh per hour == kW
-
-    remainingTimeSeconds = static_cast<uint16_t>(d[2]) | (static_cast<uint16_t>(d[3]) << 8);
-
-    const uint16_t rawRemainingEnergyWh =
-        static_cast<uint16_t>(d[4]) | (static_cast<uint16_t>(d[5]) << 8);
-    remainingEnergyKWh = rawRemainingEnergyWh / 1000.0f;
+void TeensyBMS::parseMsg5(const CanFrame& f) {
+    averageEnergyPerHour = static_cast<int16_t>(f.Le16(0)) / 100.0f; // kWh per hour == kW
+    remainingTimeSeconds = f.Le16(2);
+    remainingEnergyKWh = f.Le16(4) / 1000.0f;
 }
 
 float TeensyBMS::MaxChargeCurrent() {
@@ -106,11 +130,7 @@ float TeensyBMS::MaxChargeCurrent() {
 }
 
 void TeensyBMS::Task100Ms() {
-    if (timeoutCounter > 0) {
-        timeoutCounter--;
-    }
-
-    const bool timeout = timeoutCounter == 0;
+    const bool timeout = staleMask != 0;
     const bool fault = dtc != 0;
     const bool contactorFault = (dtc & 0x08) != 0; // DTC_BMS_CONTACTOR_FAULT
     const bool bmsValid = !timeout && !fault && !contactorFault;
@@ -157,29 +177,48 @@ void TeensyBMS::Task100Ms() {
     // Current firmware does not publish contactor-manager specific DTCs on 0x41C byte 5.
     Param::SetInt(Param::BMS_CONT_DTC, 0);
 
-    // Send VCU status back to the BMS every cycle (100ms).
-    // Byte 1 is the pre-sleep shutdown warning for downstream VCUs.
-    // Byte 2 is the separate HV request signal and must not be used as shutdown messaging.
-    if (can) {
-        uint8_t bytes[8] = {0};
-        bytes[0] = static_cast<uint8_t>(Param::GetInt(Param::LVDU_vehicle_state));
-        bytes[1] = static_cast<uint8_t>(Param::GetInt(Param::LVDU_forceVCUsShutdown));
-        bytes[2] = static_cast<uint8_t>(Param::GetInt(Param::HVCM_to_bms_hv_request));
-        bytes[3] = 0; // reserved
-
-        bytes[4] = 0; // reserved
-        bytes[5] = 0; // reserved
-
-        bytes[6] = txCounter & 0x0F;
-        // Calculate CRC over the first 7 bytes and place the result in the last
-        // byte to match the CRC format used by the BMS messages.
-        uint32_t buf[2] = {0, 0};
-        memcpy(buf, bytes, sizeof(buf));
-        buf[1] &= 0x00FFFFFF;  // clear CRC byte
-        crc_reset();
-        uint32_t crc = crc_calculate_block(buf, 2) & 0xFF;
-        bytes[7] = crc;
-        can->Send(VCU_STATUS_MSG_ID, bytes, 8);
-        txCounter = (txCounter + 1) & 0x0F;
+    // Fixed 100 ms cycle unless a heartbeat is configured, see Task10Ms()
+    if (Param::GetInt(Param::can_tx_heartbeat) == 0) {
+        SendVcuStatus(100);
+    }
+}
+
+// With a heartbeat the status goes out within 10 ms of a change
+void TeensyBMS::Task10Ms() {
+    if (Param::GetInt(Param::can_tx_heartbeat) > 0) {
+        SendVcuStatus(10);
+    }
+}
+
+// Byte 1 is the pre-sleep shutdown warning for downstream VCUs.
+// Byte 2 is the separate HV request signal and must not be used as shutdown messaging.
+void TeensyBMS::SendVcuStatus(uint32_t elapsedMs) {
+    if (!can) {
+        return;
     }
+
+    uint8_t bytes[8] = {0};
+    bytes[0] = static_cast<uint8_t>(Param::GetInt(Param::LVDU_vehicle_state));
+    bytes[1] = static_cast<uint8_t>(Param::GetInt(Param::LVDU_forceVCUsShutdown));
+    bytes[2] = static_cast<uint8_t>(Param::GetInt(Param::HVCM_to_bms_hv_request));
+    bytes[3] = 0; // reserved
+
+    bytes[4] = 0; // reserved
+    bytes[5] = 0; // reserved
+
+    if (!vcuStatusTx.Due(bytes, 8, elapsedMs, Param::GetInt(Param::can_tx_heartbeat))) {
+        return;
+    }
+
+    // The HV probes start when the changed request reaches a mailbox
+    if ((bytes[2] != 0) != hvRequestSent) {
+        hvRequestSent = bytes[2] != 0;
+        LatencyProbe::SignalOnTx(hvRequestSent ? LatencyProbe::EVT_HV_REQUEST_ON : LatencyProbe::EVT_HV_REQUEST_OFF,
+                                 VCU_STATUS_MSG_ID);
+    }
+
+    // Counter in byte 6, CRC over the first 7 bytes in the last byte
+    // to match the CRC format used by the BMS messages.
+    txE2E.Protect(bytes, 8);
+    can->Send(VCU_STATUS_MSG_ID, bytes, 8);
 }
@@ -32,11 +32,34 @@
 #include "param_save.h"
 #include "errormessage.h"
 #include "terminalcommands.h"
+#include "e2e_protection.h"
+#include "can_dispatch.h"
+#include "can_rx_stats.h"
+#include "can_rate_limit.h"
+#include "can_filter_planner.h"
+#include "stm32_can_managed.h"
+#include "vw_mlb_charger.h"
+#include "can_tx_timing.h"
+#include "canmap_schedule.h"
+#include "can_gateway.h"
+#include "can_sniffer.h"
+#include "latency_probe.h"
+#include "timebase.h"
 
 static void LoadDefaults(Terminal* term, char *arg);
 static void Help(Terminal* term, char *arg);
 static void PrintSerial(Terminal* term, char *arg);
 static void PrintErrors(Terminal* term, char *arg);
+static void PrintE2EStats(Terminal* term, char *arg);
+static void PrintCanStats(Terminal* term, char *arg);
+static void PrintCanFilters(Terminal* term, char *arg);
+static void PrintMlbTx(Terminal* term, char *arg);
+static void PrintCanTx(Terminal* term, char *arg);
+static void PrintTxTiming(Terminal* term, char *arg);
+static void PrintCanMapSchedule(Terminal* term, char *arg);
+static void PrintGateway(Terminal* term, char *arg);
+static void Sniff(Terminal* term, char *arg);
+static void PrintLatency(Terminal* term, char *arg);
 
 extern "C" const TERM_CMD termCmds[] =
 {
@@ -53,6 +76,16 @@ extern "C" const TERM_CMD termCmds[] =
   { "help", Help },
   { "serial", PrintSerial },
   { "errors", PrintErrors },
+  { "e2e", PrintE2EStats },
+  { "canstats", PrintCanStats },
+  { "canfilters", PrintCanFilters },
+  { "mlbtx", PrintMlbTx },
+  { "cantx", PrintCanTx },
+  { "txtiming", PrintTxTiming },
+  { "canperiods", PrintCanMapSchedule },
+  { "gateway", PrintGateway },
+  { "sniff", Sniff },
+  { "latency", PrintLatency },
   { NULL, NULL }
 };
 
@@ -76,6 +109,261 @@ static void PrintSerial(Terminal* term, char *arg)
    fprintf(term, "%08X:%08X:%08X\r\n", DESIG_UNIQUE_ID2, DESIG_UNIQUE_ID1, DESIG_UNIQUE_ID0);
 }
 
+static void PrintE2EStats(Terminal* term, char *arg)
+{
+   arg = arg;
+
+   for (E2EProtection* link = E2EProtection::First(); link; link = link->GetNext())
+   {
+      const E2EProtection::Stats& stats = link->GetStats();
+
+      fprintf(term, "%s %x ok=%d crc=%d jumps=%d lost=%d\r\n",
+              link->GetDirection() == E2EProtection::DIR_TX ? "TX" : "RX", link->GetId(),
+              stats.ok, stats.crcErrors, stats.counterJumps, stats.lost);
+   }
+}
+
+// Ages are relative to the last statistics update in the 100ms task
+static void PrintCanStats(Terminal* term, char *arg)
+{
+   arg = arg;
+
+   for (int slot = 0; slot < CanDispatch::GetNumEntries(); slot++)
+   {
+      const CanRxStats::Entry& e = CanRxStats::Get(slot);
+
+      fprintf(term, "%x n=%d min=%d max=%d mean=%d age=%d missed=%d limited=%d%s\r\n",
+              CanDispatch::GetId(slot), e.count, e.minGap, e.maxGap, CanRxStats::GetMeanGap(slot),
+              e.count ? CanRxStats::GetAge(slot) : 0, e.missed, CanRateLimit::GetDropped(slot),
+              CanRxStats::IsStale(slot) ? " stale" : "");
+   }
+}
+
+// Prints the filter bank plan, every entry that is not an exact ID admits
+// frames which CanDispatch has to reject (unmatched)
+static void PrintCanFilters(Terminal* term, char *arg)
+{
+   static const char* modes[] = { "list16", "mask16", "list32", "mask32" };
+
+   arg = arg;
+
+   for (int i = 0; i < CanFilterPlanner::GetNumBanks(); i++)
+   {
+      const CanFilterPlanner::Bank& bank = CanFilterPlanner::GetBank(i);
+
+      if (bank.iface == CAN_FILTER_UNUSED)
+         fprintf(term, "%d unused\r\n", i);
+      else
+         fprintf(term, "%d can%d %s %08x %08x\r\n", i, bank.iface + 1, modes[bank.mode], bank.fr1, bank.fr2);
+   }
+
+   for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+   {
+      fprintf(term, "can%d ids=%d banks=%d extra=%d%s\r\n", i + 1, CanFilterPlanner::GetIds(i),
+              CanFilterPlanner::GetBanks(i), CanFilterPlanner::GetExtra(i),
+              CanFilterPlanner::IsOverflowed(i) ? " overflow" : "");
+   }
+
+   fprintf(term, "result=%d banks=%d unmatched=%d\r\n", Stm32CanManaged::GetFilterResult(),
+           CAN_FILTER_BANKS, CanDispatch::GetUnmatched());
+}
+
+// Schedule of the emulated MLB messages, late frames were held back by mlb_tx_per_tick.
+// Level 0 sends nothing, 1 the wake set, 2 everything (mlb_tx_policy).
+static void PrintMlbTx(Terminal* term, char *arg)
+{
+   VWMLBClass::TxStatus status;
+
+   arg = arg;
+
+   for (int i = 0; VWMLBClass::GetTxStatus(i, status); i++)
+   {
+      fprintf(term, "%x period=%d phase=%d sent=%d late=%d\r\n", status.id, status.periodMs,
+              status.phaseMs, status.sent, status.late);
+   }
+
+   fprintf(term, "level=%d cache rebuilds=%d mailbox full=%d\r\n", VWMLBClass::GetTxLevel(),
+           VWMLBClass::GetTxCacheRebuilds(), Stm32CanManaged::GetTxMailboxFull());
+}
+
+// Software TX queues, latency is from Send() until a mailbox takes the frame
+static void PrintCanTx(Terminal* term, char *arg)
+{
+   arg = arg;
+
+   for (int i = 0; i < CAN_FILTER_MAX_IFACES; i++)
+   {
+      const Stm32CanManaged* can = Stm32CanManaged::GetManaged(i);
+
+      if (can == nullptr)
+         continue;
+
+      const CanTxQueue& queue = can->GetTxQueue();
+      fprintf(term, "can%d queued=%d max=%d failed=%d latency=%dus\r\n", i + 1, queue.Count(),
+              queue.GetMaxDepth(), queue.GetFailures(), can->GetTxLatencyUs());
+   }
+
+   fprintf(term, "mailbox full=%d\r\n", Stm32CanManaged::GetTxMailboxFull());
+}
+
+// Measured transmit periods [us] against the declared ones (GenMsgCycleTime),
+// "txtiming reset" starts a new measurement
+static void PrintTxTiming(Terminal* term, char *arg)
+{
+   const int tolerance = Param::GetInt(Param::can_tx_period_tol);
+
+   arg = my_trim(arg);
+
+   if (my_strcmp(arg, "reset") == 0)
+   {
+      CanTxTiming::Reset();
+      fprintf(term, "TX timing reset\r\n");
+      return;
+   }
+
+   for (int i = 0; i < CanTxTiming::GetNumEntries(); i++)
+   {
+      const CanTxTiming::Entry& e = CanTxTiming::Get(i);
+
+      fprintf(term, "%x dbc=%d n=%d min=%d max=%d mean=%d jitter=%d pauses=%d%s\r\n", e.id, e.periodMs,
+              e.count, e.minUs, e.maxUs, CanTxTiming::GetMeanUs(e), CanTxTiming::GetJitterUs(e), e.pauses,
+              CanTxTiming::IsViolation(e, tolerance) ? " VIOLATION" : "");
+   }
+
+   fprintf(term, "tolerance=%d%% violations=%d\r\n", tolerance, CanTxTiming::GetViolations());
+}
+
+// Period and phase of the mapped TX messages (canmap_per1..10), sent counts the ticks they were due in
+static void PrintCanMapSchedule(Terminal* term, char *arg)
+{
+   arg = arg;
+
+   for (int i = 0; i < CanMapSchedule::GetNumEntries(); i++)
+   {
+      const CanMapSchedule::Entry& e = CanMapSchedule::Get(i);
+
+      fprintf(term, "%d %x period=%d phase=%d sent=%d\r\n", i + 1, e.id, e.periodMs, e.phaseMs, e.sent);
+   }
+}
+
+// Active gateway routes (gw1..gw4), dropped frames had no destination interface
+static void PrintGateway(Terminal* term, char *arg)
+{
+   arg = arg;
+
+   for (int i = 0; i < CanGateway::GetNumRoutes(); i++)
+   {
+      const CanGateway::Route& r = CanGateway::GetRoute(i);
+
+      fprintf(term, "can%d %x/%x -> can%d %x%s forwarded=%d dropped=%d\r\n", r.src + 1, r.id, r.ignore,
+              r.dst + 1, r.newId ? r.newId : r.id, r.ext ? " ext" : "", r.forwarded, r.dropped);
+   }
+}
+
+static uint32_t ParseHex(char*& p)
+{
+   uint32_t value = 0;
+
+   for (;; p++)
+   {
+      const char c = *p | 0x20; // lower case
+
+      if (*p >= '0' && *p <= '9')
+         value = (value << 4) | (*p - '0');
+      else if (c >= 'a' && c <= 'f')
+         value = (value << 4) | (c - 'a' + 10);
+      else
+         return value;
+   }
+}
+
+// "sniff <interface mask> [rx|tx] [id[/mask] ...]" streams a binary capture
+// (see CanSniffer) until any key is pressed, IDs and masks in hex.
+// The terminal is muted meanwhile, "sniff off" reports the lost frames.
+// E.g. "sniff 2 41a/7f8 43a" logs the BMS and mVCU frames of CAN2.
+static void Sniff(Terminal* term, char *arg)
+{
+   char* p = my_trim(arg);
+
+   if (my_strcmp(p, "off") == 0 || *p == 0)
+   {
+      CanSniffer::Stop();
+      fprintf(term, "sniff off, %d frames lost\r\n", CanSniffer::GetOverflows());
+      return;
+   }
+
+   const uint8_t ifaces = ParseHex(p);
+   bool rx = true, tx = true;
+
+   while (*p == ' ')
+      p++;
+
+   if (p[0] == 'r' && p[1] == 'x')
+      tx = false, p += 2;
+   else if (p[0] == 't' && p[1] == 'x')
+      rx = false, p += 2;
+
+   CanSniffer::Select(ifaces, rx, tx);
+
+   while (*p != 0)
+   {
+      while (*p == ' ')
+         p++;
+      if (*p == 0)
+         break;
+
+      const char* start = p;
+      const uint32_t id = ParseHex(p);
+      uint32_t mask = 0x1FFFFFFF;
+
+      if (*p == '/')
+         mask = ParseHex(++p);
+
+      if (p == start || (*p != ' ' && *p != 0) || !CanSniffer::AddFilter(id, mask))
+      {
+         fprintf(term, "Invalid or too many filters\r\n");
+         return;
+      }
+   }
+
+   // The next bytes on the UART belong to the capture
+   fprintf(term, "sniffing\r\n");
+   CanSniffer::Start(Timebase::Now());
+}
+
+// Response times [us] and their histogram (upper bucket limits in ms),
+// "latency reset" clears them
+static void PrintLatency(Terminal* term, char *arg)
+{
+   arg = my_trim(arg);
+
+   if (my_strcmp(arg, "reset") == 0)
+   {
+      LatencyProbe::Reset();
+      fprintf(term, "Latency probes reset\r\n");
+      return;
+   }
+
+   for (int i = 0; i < LatencyProbe::GetNumProbes(); i++)
+   {
+      const LatencyProbe::Probe& p = LatencyProbe::Get(i);
+
+      fprintf(term, "%s n=%d min=%d max=%d mean=%d last=%d aborted=%d%s\r\n", LatencyProbe::GetName(i), p.count,
+              p.minUs, p.maxUs, LatencyProbe::GetMeanUs(p), p.lastUs, p.aborted, p.armed ? " armed" : "");
+
+      for (int b = 0; b < LATENCY_PROBE_BUCKETS; b++)
+      {
+         if (p.histogram[b] == 0)
+            continue;
+
+         if (LatencyProbe::GetBucketLimitMs(b) > 0)
+            fprintf(term, "  <%dms %d\r\n", LatencyProbe::GetBucketLimitMs(b), p.histogram[b]);
+         else
+            fprintf(term, "  >=%dms %d\r\n", LatencyProbe::GetBucketLimitMs(b - 1), p.histogram[b]);
+      }
+   }
+}
+
 static void Help(Terminal* term, char *arg)
 {
    //If you want you could print some instructions here
@@ -0,0 +1,31 @@
+#include <libopencm3/cm3/cortex.h>
+#include "timebase.h"
+
+uint32_t Timebase::ticksPerUs = 72;
+uint32_t Timebase::lastCycles = 0;
+uint32_t Timebase::micros = 0;
+
+// Called from interrupts and tasks. A reading that is older than the last
+// one (taken before an interrupt that read the clock) is projected backwards.
+uint32_t Timebase::Extend(uint32_t cycles)
+{
+    const uint32_t mask = cm_mask_interrupts(1);
+    const int32_t delta = cycles - lastCycles;
+    uint32_t now;
+
+    if (delta >= 0)
+    {
+        const uint32_t us = (uint32_t)delta / ticksPerUs;
+
+        lastCycles += us * ticksPerUs;
+        micros += us;
+        now = micros;
+    }
+    else
+    {
+        now = micros - (uint32_t)(-delta) / ticksPerUs;
+    }
+
+    cm_mask_interrupts(mask);
+    return now;
+}
@@ -0,0 +1,23 @@
+#include <string.h>
+#include "tx_on_change.h"
+
+uint32_t TxOnChange::suppressed = 0;
+
+bool TxOnChange::Due(const uint8_t* payload, uint8_t len, uint32_t elapsedMs, uint32_t heartbeatMs)
+{
+    if (len > sizeof(last))
+        len = sizeof(last);
+
+    sinceSent += elapsedMs;
+
+    if (heartbeatMs == 0 || !valid || sinceSent >= heartbeatMs || memcmp(payload, last, len) != 0)
+    {
+        memcpy(last, payload, len);
+        sinceSent = 0;
+        valid = true;
+        return true;
+    }
+
+    suppressed++;
+    return false;
+}
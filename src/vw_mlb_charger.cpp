@@ -19,6 +19,12 @@
 
 #include <vw_mlb_charger.h>
 #include "params.h"
+#include "can_dispatch.h"
+#include "rx_supervisor.h"
+#include "can_tx_timing.h"
+#include "lvdu.h" // for VehicleState enums
+#include "errormessage.h"
+#include <string.h>
 
 #ifndef MLB_CHARGER_STANDALONE
 #define MLB_CHARGER_STANDALONE // Comment out to run in Zombie integrated mode
@@ -123,12 +129,14 @@ bool VWMLBClass::ControlCharge(bool RunCh, bool ACReq)
 #ifdef MLB_CHARGER_STANDALONE
     /*
      * In simulation mode the activation request is supplied via parameter
-     * mlb_chr_sim_Activation_Crg.  Do not override it here.
+     * mlb_chr_sim_Activation_Crg.  Do not override it here, but never
+     * request charging from a charger that has gone silent.
      */
-    charger_params.activate = Param::GetInt(Param::mlb_chr_sim_Activation_Crg);
+    charger_params.activate = hvlm04Fresh && Param::GetInt(Param::mlb_chr_sim_Activation_Crg);
     return charger_params.activate;
 #else
-    if (charger_status.HVLM_Stecker_Status > 1 && RunCh)
+    DecodeReceived();
+    if (hvlm04Fresh && charger_status.HVLM_Stecker_Status > 1 && RunCh)
     {
         charger_params.activate = 1;
         return true;
@@ -143,117 +151,30 @@ bool VWMLBClass::ControlCharge(bool RunCh, bool ACReq)
 
 void VWMLBClass::Task10Ms()
 {
-    static uint16_t counter10ms = 0;
+    // The plug status decides the level, so it has to be current
+    DecodeReceived();
+    SetTxLevel(SelectTxLevel());
 
-    // stop CAN chatter when requested
-    if (vehicle_status.CANQuiet == 1)
+    if (txLevel == TX_OFF)
     {
-        counter10ms = 0;
+        ResetTxSchedule();
         return;
     }
 
-    // called every 10 ms
-    counter10ms++;
-
-    // --- 10 ms tasks ---
-    if (counter10ms % 1 == 0)
-    {
-        msg191(); // BMS_01   0x191     CRC
-    }
-
-    // --- 20 ms tasks (reserved) ---
-    if (counter10ms % 2 == 0)
-    {
-    }
-
-    // --- 40 ms tasks ---
-    if (counter10ms % 4 == 0)
-    {
-        // msg040(); // Airbag_01 - 0x40     CRC
-        msg2B1();
-    }
-
-    // --- 50 ms tasks ---
-    if (counter10ms % 5 == 0)
-    {
-        msg2AE(); // DCDC_01    0x2AE     CRC
-    }
-
-    // --- 960 ms tasks ---
-    if (counter10ms % 96 == 0)
-    {
-        msg1A555548(); // ORU_01 0x1A555548
-    }
+    SendDueMessages();
 }
 
 void VWMLBClass::Task100Ms()
 {
-    static uint8_t counter100ms = 0;
-
     TagParams();
     CalcValues100ms();
-
-    // stop CAN chatter when requested
-    if (vehicle_status.CANQuiet == 1)
-    {
-        counter100ms = 0;
-        return;
-    }
-
-    // called every 100 ms
-    counter100ms++;
-
-    // --- 100 ms tasks ---
-    if (counter100ms % 1 == 0)
-    {
-        msg3C0(); //  Klemmen_Status_01   CRC
-        msg503(); // HVK_01     0x503     CRC
-        msg17B(); // FCU_02    0x17B       DBC GenMsgCycleTime = 100 ms
-        msg1A1();
-        msg39D();
-        msg509();
-        msg552(); // HVEM_05 0x552         DBC GenMsgCycleTime = 100 ms
-        msg5AC();
-    }
-
-    // --- 200 ms tasks ---
-    if (counter100ms % 2 == 0)
-    {
-        msg1A2(); // ESP_15   0x1A2       CRC
-        msg583(); // ZV_02 0x583           DBC GenMsgCycleTime = 200 ms
-    }
-
-    // --- 500 ms tasks ---
-    if (counter100ms % 5 == 0)
-    {
-        msg5A2(); // BMS_04   0x5A2       CRC
-        msg5CA(); // BMS_07   0x5CA       CRC
-        msg5CD(); // DCDC_03    0x5CD     CRC
-        msg59E();
-    }
-
-    // --- 1000 ms tasks ---
-    if (counter100ms % 10 == 0)
-    {
-        msg184(); // ZV_01    0x184       CRC
-        msg578(); // BMS_DC_01    0x578   CRC
-        msg485();
-        msg1A5555AD();
-        msg96A955EB();
-        msg9A555539();
-        msg9A555552();
-    }
-
-    // --- 2000 ms tasks ---
-    if (counter100ms % 20 == 0)
-    {
-        msg96A954A6();
-        counter100ms = 0;
-    }
 }
 
 void VWMLBClass::TagParams() // To make code portable between standalone (more params) vs Zombie (basic params)
 {
+    DecodeReceived();
+
+    Param::SetInt(Param::mlb_tx_level, txLevel);
 
     // copy charger state into values
     Param::SetInt(Param::mlb_chr_HVLM_MaxLadeLeistung, charger_status.HVLM_MaxLadeLeistung);
@@ -386,6 +307,7 @@ void VWMLBClass::CalcValues100ms() // Run to calculate values every 100 ms
     // charger_params.IDCSetpnt = charger_params.HVpwr / (battery_status.BMSVoltx10 / 10);
 
     emulateMLB();
+    RefreshTxCache();
 }
 
 //----------------------------------------------------------------------------------------------------------------------------------------------
@@ -639,6 +561,31 @@ void VWMLBClass::emulateMLB()
 // CAN-Messaging
 //----------------------------------------------------------------------------------------------------------------------------------------------
 
+// Received messages, the order defines the index into rxFrames
+static const uint32_t rxIds[MLB_RX_MSG_COUNT] = {
+    mlb_dbc::HVLM_06::ID,
+    mlb_dbc::HVLM_04::ID,
+    mlb_dbc::LAD_01::ID,
+    mlb_dbc::HVLM_03::ID,
+    mlb_dbc::LAD_02::ID,
+    mlb_dbc::HVLM_08::ID,
+    mlb_dbc::HVLM_09::ID,
+    mlb_dbc::HVLM_10::ID,
+    mlb_dbc::HVLM_11::ID,
+    mlb_dbc::HVLM_15::ID,
+    mlb_dbc::KN_Ladegeraet::ID
+};
+
+static void HandleRx(void* ctx, const CanFrame& frame)
+{
+    static_cast<VWMLBClass*>(ctx)->DecodeCAN(frame);
+}
+
+static void HandleFreshness(void* ctx, uint32_t, bool fresh)
+{
+    static_cast<VWMLBClass*>(ctx)->FreshnessChanged(fresh);
+}
+
 void VWMLBClass::SetCanInterface(CanHardware *c)
 {
     can = c;
@@ -660,342 +607,518 @@ void VWMLBClass::SetCanInterface(CanHardware *c)
     can->RegisterUserMessage(0x9A55554D); // HVLM_15 (legacy flag-encoded)
     can->RegisterUserMessage(0x17F00044); // KN_Ladegeraet
     can->RegisterUserMessage(0x97F00044); // KN_Ladegeraet (legacy flag-encoded)
-}
 
-void VWMLBClass::DecodeCAN(int id, uint32_t data[2])
-{
-    uint8_t *bytes = (uint8_t *)data; // arrgghhh this converts the two 32bit array into bytes. See comments are useful:) ... Stolen from Zombie, Left comments as they're now famous.
-    uint32_t can_id = static_cast<uint32_t>(id);
-    if (can_id > 0x1FFFFFFFU) can_id &= 0x1FFFFFFFU;
-    switch (can_id)
-    {
-    case 0x488: // HVLM_06 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 1160 HVLM_MaxLadeLeistung "maximale DC Ladeleistung";
-        charger_status.HVLM_MaxLadeLeistung = (((bytes[2] & (0x3FU)) << 4) | ((bytes[1] >> 4) & (0x0FU))) * 250; // Receiver: Gateway,Gateway_PAG,TME
-
-        // CM_ SG_ 1160 HVLM_MaxSpannung_DCLS "maximale DC Ladespannung";
-        charger_status.HVLM_MaxSpannung_DCLS = ((bytes[3] & (0xFFU)) << 2) | ((bytes[2] >> 6) & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1160 HVLM_IstStrom_DCLS "aktueller DC Ladestrom";
-        charger_status.HVLM_IstStrom_DCLS = ((bytes[5] & (0x01U)) << 8) | (bytes[4] & (0xFFU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1160 HVLM_MaxStrom_DCLS "maximaler DC Ladestrom";
-        charger_status.HVLM_MaxStrom_DCLS = ((bytes[6] & (0x03U)) << 7) | ((bytes[5] >> 1) & (0x7FU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1160 HVLM_MinSpannung_DCLS "minimale DC Ladespannung";
-        charger_status.HVLM_MinSpannung_DCLS = ((bytes[7] & (0x07U)) << 6) | ((bytes[6] >> 2) & (0x3FU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1160 HVLM_MinStrom_DCLS "minimaler DC Ladestrom";
-        charger_status.HVLM_MinStrom_DCLS = ((bytes[7] >> 3) & (0x1FU)); // Receiver: Gateway,Gateway_PAG
-        break;
-
-    case 0x53C: // HVLM_04 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 1340 HVLM_04_CRC "Berechnung siehe Lastenheft Kommunikationsabsicherung / End-to-End Kommunikationsabsicherung";
-        charger_status.HVLM_04_CRC = (bytes[0] & (0xFFU)); // Receiver: AWC,BMC_MLBevo,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway
-
-        // CM_ SG_ 1340 HVLM_04_BZ "Fortlaufender Botschaftszaehler";
-        charger_status.HVLM_04_BZ = (bytes[1] & (0x0FU)); // Receiver: AWC,BMC_MLBevo,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway
-
-        // CM_ SG_ 1340 HVLM_STH_Betriebsmodus "Betriebsmodus der Standheizung fuer Vorkonditionierung und Timerklimatisierung";
-        charger_status.HVLM_STH_Betriebsmodus = ((bytes[1] >> 4) & (0x07U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
-
-        // CM_ SG_ 1340 HVLM_Standklima_Timer_Status "Signalisierung an KBT ob ein Timer programmiert ist";
-        charger_status.HVLM_Standklima_Timer_Status = ((bytes[1] >> 7) & (0x01U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    // The dispatcher works on 29-bit IDs, one entry covers both encodings
+    for (int i = 0; i < MLB_RX_MSG_COUNT; i++)
+        CanDispatch::Register(rxIds[i], HandleRx, this);
 
-        // CM_ SG_ 1340 HVLM_HVEM_MaxLeistung "Maximal zulaessige Leistung, die HVEM vom Lader nutzen darf";
-        charger_status.HVLM_HVEM_MaxLeistung = (((bytes[3] & (0x01U)) << 8) | (bytes[2] & (0xFFU))) * 50; // Receiver: Gateway,Gateway_PAG,Sub_Gateway
-
-        // CM_ SG_ 1340 HVLM_Status_Netz "Information, ob Fahrzeug mit Stromnetz verbunden ist";
-        charger_status.HVLM_Status_Netz = ((bytes[3] >> 1) & (0x01U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
-
-        // CM_ SG_ 1340 HVLM_Anf_Ladescreen "Anforderung fuer Ladescreen (BEV)";
-        charger_status.HVLM_Anf_Ladescreen = ((bytes[3] >> 2) & (0x01U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
-
-        // CM_ SG_ 1340 HVLM_Ladeart "Anzeige, ob Strom in Fahrzeug fliesst und wofuer";
-        charger_status.HVLM_Ladeart = ((bytes[3] >> 3) & (0x03U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
-
-        // CM_ SG_ 1340 HVLM_VK_STH_Einsatz "Auswahl der PHEV Standheizung";
-        charger_status.HVLM_VK_STH_Einsatz = ((bytes[3] >> 5) & (0x07U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
-
-        // CM_ SG_ 1340 HVLM_VK_Modus "aktueller Konditionierungs-Status";
-        charger_status.HVLM_VK_Modus = (bytes[4] & (0x03U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway,TME
-
-        // CM_ SG_ 1340 HVLM_IstModus_02 "aktueller Modus";
-        charger_status.HVLM_IstModus_02 = ((bytes[4] >> 2) & (0x03U)); // Receiver: DCDC_800V_PAG,DCDC_HV,Gateway,Gateway_PAG,Sub_Gateway,TME
-
-        // CM_ SG_ 1340 HVLM_HV_Anf "HV-Aktivierung Anforderung und Grund";
-        charger_status.HVLM_HV_Anf = ((bytes[4] >> 4) & (0x03U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    if (!txPhasesAssigned)
+    {
+        AssignTxPhases();
+        AssignTxCacheSlots();
+    }
+    ResetTxSchedule();
+    // The cache holds frames packed from the mlb_state of the previous owner
+    InvalidateTxCache();
+    for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+        CanTxTiming::Declare(txTable[i].id, txTable[i].periodMs);
+
+    hvlm04Fresh = false;
+    hvlm04Handle = RxSupervisor::Register(mlb_dbc::HVLM_04::ID, MLB_HVLM_04_PERIOD_MS, MLB_HVLM_04_TOLERANCE_MS,
+                                          HandleFreshness, this);
+}
 
-        // CM_ SG_ 1340 HVLM_Fehlerstatus "aktueller Fehlerstatus des Ladegeraetes";
-        charger_status.HVLM_Fehlerstatus = ((bytes[5] & (0x01U)) << 2) | ((bytes[4] >> 6) & (0x03U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+void VWMLBClass::FreshnessChanged(bool fresh)
+{
+    hvlm04Fresh = fresh;
+    // A charger that is not in use may sleep, that is no fault
+    if (!fresh && (charger_params.activate || txLevel == TX_FULL))
+        ErrorMessage::Post(ERR_CHARGER_TIMEOUT);
+}
 
-        // CM_ SG_ 1340 HVLM_Anforderung_HMS "Anforderung zur Verriegelung des Triebstrangs";
-        charger_status.HVLM_Anforderung_HMS = ((bytes[5] >> 1) & (0x07U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+// Only stores the raw payload, the signals are decoded by DecodeReceived()
+// when they are actually read.
+void VWMLBClass::DecodeCAN(const CanFrame& received)
+{
+    const uint32_t can_id = received.GetId();
 
-        // CM_ SG_ 1340 HVLM_Parken_beibehalten_HMS "Anforderung Triebstrang verriegelt zu halten";
-        charger_status.HVLM_Parken_beibehalten_HMS = ((bytes[5] >> 4) & (0x03U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    for (int i = 0; i < MLB_RX_MSG_COUNT; i++)
+    {
+        if (rxIds[i] == can_id)
+        {
+            RawFrame &frame = rxFrames[i];
+
+            // Sequence is odd while the payload is written
+            frame.seq = frame.seq + 1;
+            asm volatile("" ::: "memory");
+            frame.data[0] = received.Word(0);
+            frame.data[1] = received.Word(1);
+            asm volatile("" ::: "memory");
+            frame.seq = frame.seq + 1;
+
+            if (can_id == mlb_dbc::HVLM_04::ID)
+                RxSupervisor::Refresh(hvlm04Handle);
+            break;
+        }
+    }
+}
 
-        // CM_ SG_ 1340 HVLM_AWC_Sollmodus "Sollmodus AWC Ladegeraet";
-        charger_status.HVLM_AWC_Sollmodus = (bytes[6] & (0x07U)); // Receiver: AWC,Gateway,Gateway_PAG,Sub_Gateway
+// Decodes every message that was received since its last decode.
+// Called before the signals in charger_status are read.
+void VWMLBClass::DecodeReceived()
+{
+    for (int i = 0; i < MLB_RX_MSG_COUNT; i++)
+    {
+        RawFrame &frame = rxFrames[i];
+        uint32_t words[2];
+        uint32_t seq;
 
-        // CM_ SG_ 1340 HVLM_Stecker_Status "Status der Steckererkennung";
-        charger_status.HVLM_Stecker_Status = ((bytes[6] >> 3) & (0x03U)); // Receiver: BMC_MLBevo,Gateway,Gateway_PAG,Sub_Gateway,TME
+        // Retry if the receive interrupt updated the payload while we copied it
+        do
+        {
+            seq = frame.seq;
+            asm volatile("" ::: "memory");
+            words[0] = frame.data[0];
+            words[1] = frame.data[1];
+            asm volatile("" ::: "memory");
+        } while ((seq & 1) || seq != frame.seq);
+
+        if (seq == frame.decodedSeq)
+            continue;
+
+        frame.decodedSeq = seq;
+        DecodeFrame(CanFrame(rxIds[i], words, 8));
+    }
+}
 
-        // CM_ SG_ 1340 HVLM_LadeAnforderung "Mitteilung Lademanagement an MSG";
-        charger_status.HVLM_LadeAnforderung = ((bytes[6] >> 5) & (0x07U)); // Receiver: AWC,Gateway,Gateway_PAG,Sub_Gateway,TME
+void VWMLBClass::DecodeFrame(const CanFrame& frame)
+{
+    const uint8_t *bytes = frame.Bytes();
 
-        // CM_ SG_ 1340 HVLM_MaxBatLadestromHV "Empfohlener HV Batterieladestrom";
-        charger_status.HVLM_MaxBatLadestromHV = (bytes[7] & (0xFFU)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    // Bit layout, CM_ comments and receivers of every signal are in the generated mlb_dbc.h
+    switch (frame.GetId())
+    {
+    case mlb_dbc::HVLM_06::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_MaxLadeLeistung = mlb_dbc::HVLM_06::HVLM_MaxLadeLeistung(bytes);
+        charger_status.HVLM_MaxSpannung_DCLS = mlb_dbc::HVLM_06::HVLM_MaxSpannung_DCLS(bytes);
+        charger_status.HVLM_IstStrom_DCLS = mlb_dbc::HVLM_06::HVLM_IstStrom_DCLS(bytes);
+        charger_status.HVLM_MaxStrom_DCLS = mlb_dbc::HVLM_06::HVLM_MaxStrom_DCLS(bytes);
+        charger_status.HVLM_MinSpannung_DCLS = mlb_dbc::HVLM_06::HVLM_MinSpannung_DCLS(bytes);
+        charger_status.HVLM_MinStrom_DCLS = mlb_dbc::HVLM_06::HVLM_MinStrom_DCLS(bytes);
         break;
 
-    case 0X564: // LAD_01 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 1380 LAD_01_CRC "Ab MQB und MLBevo: Berechnung siehe Lastenheft End-to-End Kommunikationsabsicherung.";
-        charger_status.LAD_01_CRC = (bytes[0] & (0xFFU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1380 LAD_01_BZ "freilaufender Botschaftszaehler";
-        charger_status.LAD_01_BZ = (bytes[1] & (0x0FU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1380 LAD_IstModus "Betriebsmodus des Ladegeraetes";
-        charger_status.LAD_IstModus = ((bytes[1] >> 4) & (0x07U)); // Receiver: Gateway,Gateway_PAG,Ladegeraet_2,TME
-
-        // CM_ SG_ 1380 LAD_AC_Istspannung "Istwert AC-Netzspannung (RMS)";
-        charger_status.LAD_AC_Istspannung = ((bytes[2] & (0xFFU)) << 1) | ((bytes[1] >> 7) & (0x01U)); // Receiver: Gateway_PAG
-
-        // CM_ SG_ 1380 LAD_IstSpannung_HV "Ausgangsspannung Lader";
-        charger_status.LAD_IstSpannung_HV = ((bytes[4] & (0x03U)) << 8) | (bytes[3] & (0xFFU)); // Receiver: Gateway_PAG
-
-        // CM_ SG_ 1380 LAD_IstStrom_HV "Ausgangsstrom Lader";
-        charger_status.LAD_IstStrom_HV =
-            ((((bytes[5] & (0x0FU)) << 6) | ((bytes[4] >> 2) & (0x3FU))) * 0.2f) - 102.0f; // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1380 LAD_Status_Spgfreiheit "0=Init, 1=HV-Komponenten spannungsfrei, 2=HV-Komponenten nicht spannungsfrei, 3=Fehler";
-        charger_status.LAD_Status_Spgfreiheit = ((bytes[5] >> 4) & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1380 LAD_Temperatur "Momentanwert: Temperatur Ladegeraet";
-        charger_status.LAD_Temperatur = static_cast<int16_t>(bytes[6]) - 40; // Receiver: Gateway_PAG,TME
-
-        // CM_ SG_ 1380 LAD_Verlustleistung "Momentanwert: Verlustleistung Ladegeraet";
-        charger_status.LAD_Verlustleistung = (bytes[7] & (0xFFU)) * 20; // Receiver: Gateway_PAG,TME
+    case mlb_dbc::HVLM_04::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_04_CRC = mlb_dbc::HVLM_04::HVLM_04_CRC(bytes);
+        charger_status.HVLM_04_BZ = mlb_dbc::HVLM_04::HVLM_04_BZ(bytes);
+        charger_status.HVLM_STH_Betriebsmodus = mlb_dbc::HVLM_04::HVLM_STH_Betriebsmodus(bytes);
+        charger_status.HVLM_Standklima_Timer_Status = mlb_dbc::HVLM_04::HVLM_Standklima_Timer_Status(bytes);
+        charger_status.HVLM_HVEM_MaxLeistung = mlb_dbc::HVLM_04::HVLM_HVEM_MaxLeistung(bytes);
+        charger_status.HVLM_Status_Netz = mlb_dbc::HVLM_04::HVLM_Status_Netz(bytes);
+        charger_status.HVLM_Anf_Ladescreen = mlb_dbc::HVLM_04::HVLM_Anf_Ladescreen(bytes);
+        charger_status.HVLM_Ladeart = mlb_dbc::HVLM_04::HVLM_Ladeart(bytes);
+        charger_status.HVLM_VK_STH_Einsatz = mlb_dbc::HVLM_04::HVLM_VK_STH_Einsatz(bytes);
+        charger_status.HVLM_VK_Modus = mlb_dbc::HVLM_04::HVLM_VK_Modus(bytes);
+        charger_status.HVLM_IstModus_02 = mlb_dbc::HVLM_04::HVLM_IstModus_02(bytes);
+        charger_status.HVLM_HV_Anf = mlb_dbc::HVLM_04::HVLM_HV_Anf(bytes);
+        charger_status.HVLM_Fehlerstatus = mlb_dbc::HVLM_04::HVLM_Fehlerstatus(bytes);
+        charger_status.HVLM_Anforderung_HMS = mlb_dbc::HVLM_04::HVLM_Anforderung_HMS(bytes);
+        charger_status.HVLM_Parken_beibehalten_HMS = mlb_dbc::HVLM_04::HVLM_Parken_beibehalten_HMS(bytes);
+        charger_status.HVLM_AWC_Sollmodus = mlb_dbc::HVLM_04::HVLM_AWC_Sollmodus(bytes);
+        charger_status.HVLM_Stecker_Status = mlb_dbc::HVLM_04::HVLM_Stecker_Status(bytes);
+        charger_status.HVLM_LadeAnforderung = mlb_dbc::HVLM_04::HVLM_LadeAnforderung(bytes);
+        charger_status.HVLM_MaxBatLadestromHV = mlb_dbc::HVLM_04::HVLM_MaxBatLadestromHV(bytes);
         break;
 
-    case 0x565: // HVLM_03 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 1381 HVLM_HV_Abstellzeit "Zeitraum zwischen HV-Deaktiviert und HV-Aktiviert";
-        charger_status.HVLM_HV_Abstellzeit = (bytes[0] & (0xFFU)) * 4; // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_Ladesystemhinweise "Anzeigen von Hinweisen zum Ladesystem";
-        charger_status.HVLM_Ladesystemhinweise = (bytes[1] & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_Schluessel_Anfrage "Anforderung HVLM an BCM fuer Schluesselsuche ueber Kessy";
-        charger_status.HVLM_Schluessel_Anfrage = ((bytes[1] >> 2) & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_Zustand_LED "Zustand der Lade-LED";
-        charger_status.HVLM_Zustand_LED = ((bytes[1] >> 4) & (0x0FU)); // Receiver: AWC,Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_MaxStrom_Netz "maximal zulaessiger Strom auf Primaerseite (AC) des Ladegeraetes";
-        charger_status.HVLM_MaxStrom_Netz = (bytes[3] & (0x7FU)) * 0.5f; // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_LG_Sollmodus "Sollmodus AC Ladegeraet";
-        charger_status.HVLM_LG_Sollmodus = ((bytes[3] >> 7) & (0x01U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_FreigabeTankdeckel "Tankdeckelfreigabe";
-        charger_status.HVLM_FreigabeTankdeckel = (bytes[4] & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_Stecker_Verriegeln "Anforderung Steckerverriegelung";
-        charger_status.HVLM_Stecker_Verriegeln = ((bytes[4] >> 2) & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_Start_Spannungsmessung_DCLS "Meldung an das BMS, dass eine Messspannung aufgeschaltet wird";
-        charger_status.HVLM_Start_Spannungsmessung_DCLS = ((bytes[4] >> 4) & (0x03U)); // Receiver: BMC_MLBevo,Gateway,Gateway_PAG
-
-        charger_status.PnC_Trigger_OBC_cGW = ((bytes[5] & (0x03U)) << 2) | ((bytes[4] >> 6) & (0x03U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_FreigabeKlimatisierung "Klimatisierung freigeben";
-        charger_status.HVLM_FreigabeKlimatisierung = ((bytes[5] >> 2) & (0x03U)); // Receiver: Gateway,Gateway_PAG,TME
-
-        // CM_ SG_ 1381 HVLM_Ladetexte "Anzeige, ob AC- oder DC-Laden nicht moeglich ist";
-        charger_status.HVLM_Ladetexte = ((bytes[6] >> 1) & (0x07U)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_IsoMessung_Anf "Signalisierung, ob waehrend des Ladens eine Iso-Messung durchgefuehrt werden muss";
-        charger_status.HVLM_IsoMessung_Anf = ((bytes[6] >> 5) & (0x01U)); // Receiver: BMC_MLBevo,DCDC_HV_02,Gateway,Gateway_PAG
-
-        // CM_ SG_ 1381 HVLM_IstSpannung_HV "Ausgangsspannung des Ladegeraetes und DC-Spannung der Ladesaeule";
-        charger_status.HVLM_IstSpannung_HV = ((bytes[7] & (0xFFU)) << 2) | ((bytes[6] >> 6) & (0x03U)); // Receiver: Gateway,Gateway_PAG
+    case mlb_dbc::LAD_01::ID: // Sender: Ladegeraet_Konzern
+        charger_status.LAD_01_CRC = mlb_dbc::LAD_01::LAD_01_CRC(bytes);
+        charger_status.LAD_01_BZ = mlb_dbc::LAD_01::LAD_01_BZ(bytes);
+        charger_status.LAD_IstModus = mlb_dbc::LAD_01::LAD_IstModus(bytes);
+        charger_status.LAD_AC_Istspannung = mlb_dbc::LAD_01::LAD_AC_Istspannung(bytes);
+        charger_status.LAD_IstSpannung_HV = mlb_dbc::LAD_01::LAD_IstSpannung_HV(bytes);
+        charger_status.LAD_IstStrom_HV = mlb_dbc::LAD_01::LAD_IstStrom_HV(bytes);
+        charger_status.LAD_Status_Spgfreiheit = mlb_dbc::LAD_01::LAD_Status_Spgfreiheit(bytes);
+        charger_status.LAD_Temperatur = mlb_dbc::LAD_01::LAD_Temperatur(bytes);
+        charger_status.LAD_Verlustleistung = mlb_dbc::LAD_01::LAD_Verlustleistung(bytes);
         break;
 
-    case 0x67E: // LAD_02 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 1662 LAD_02_CRC "Ab MQB und MLBevo: Berechnung siehe Lastenheft End-to-End Kommunikationsabsicherung.";
-        charger_status.LAD_02_CRC = (bytes[0] & (0xFFU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1662 LAD_02_BZ "freilaufender Botschaftszaehler";
-        charger_status.LAD_02_BZ = (bytes[1] & (0x0FU)); // Receiver: Gateway,Gateway_PAG
-
-        // CM_ SG_ 1662 LAD_Abregelung_Temperatur "Abregelung aufgrund interner Uebertemperatur im Ladegeraet";
-        charger_status.LAD_Abregelung_Temperatur = ((bytes[1] >> 4) & (0x01U)); // Receiver: TME
-
-        // CM_ SG_ 1662 LAD_Abregelung_IU_Ein_Aus "Abregelung aufgrund Strom oder Spannung am Eingang oder Ausgang";
-        charger_status.LAD_Abregelung_IU_Ein_Aus = ((bytes[1] >> 5) & (0x01U)); // Receiver: Vector__XXX
-
-        // CM_ SG_ 1662 LAD_Abregelung_BuchseTemp "Reduzierung aufgrund zu hoher Temperatur der Ladebuchse";
-        charger_status.LAD_Abregelung_BuchseTemp = ((bytes[1] >> 6) & (0x01U)); // Receiver: Vector__XXX
-
-        // CM_ SG_ 1662 LAD_MaxLadLeistung_HV "Maximale Leistung Ladegeraet (inkl. Infrastruktur/Wirkungsgrad)";
-        charger_status.LAD_MaxLadLeistung_HV = (((bytes[3] & (0x01U)) << 8) | (bytes[2] & (0xFFU))) * 100; // Receiver: TME
-
-        // CM_ SG_ 1662 LAD_PRX_Stromlimit "AC-Stromlimit aufgrund der PRX Kabelkodierung";
-        charger_status.LAD_PRX_Stromlimit = (bytes[4] & (0x07U)); // Receiver: Vector__XXX
-
-        // CM_ SG_ 1662 LAD_CP_Erkennung "Status Control Pilot Ueberwachung";
-        charger_status.LAD_CP_Erkennung = ((bytes[4] >> 3) & (0x01U)); // Receiver: Vector__XXX
-
-        // CM_ SG_ 1662 LAD_Stecker_Verriegelt "Status Steckerverriegelung";
-        charger_status.LAD_Stecker_Verriegelt = ((bytes[4] >> 4) & (0x01U)); // Receiver: Vector__XXX
-
-        // CM_ SG_ 1662 LAD_Kuehlbedarf "Kuehlbedarf des Ladegeraetes";
-        charger_status.LAD_Kuehlbedarf = ((bytes[4] >> 6) & (0x03U)); // Receiver: Vector__XXX
+    case mlb_dbc::HVLM_03::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_HV_Abstellzeit = mlb_dbc::HVLM_03::HVLM_HV_Abstellzeit(bytes);
+        charger_status.HVLM_Ladesystemhinweise = mlb_dbc::HVLM_03::HVLM_Ladesystemhinweise(bytes);
+        charger_status.HVLM_Schluessel_Anfrage = mlb_dbc::HVLM_03::HVLM_Schluessel_Anfrage(bytes);
+        charger_status.HVLM_Zustand_LED = mlb_dbc::HVLM_03::HVLM_Zustand_LED(bytes);
+        charger_status.HVLM_MaxStrom_Netz = mlb_dbc::HVLM_03::HVLM_MaxStrom_Netz(bytes);
+        charger_status.HVLM_LG_Sollmodus = mlb_dbc::HVLM_03::HVLM_LG_Sollmodus(bytes);
+        charger_status.HVLM_FreigabeTankdeckel = mlb_dbc::HVLM_03::HVLM_FreigabeTankdeckel(bytes);
+        charger_status.HVLM_Stecker_Verriegeln = mlb_dbc::HVLM_03::HVLM_Stecker_Verriegeln(bytes);
+        charger_status.HVLM_Start_Spannungsmessung_DCLS = mlb_dbc::HVLM_03::HVLM_Start_Spannungsmessung_DCLS(bytes);
+        charger_status.PnC_Trigger_OBC_cGW = mlb_dbc::HVLM_03::PnC_Trigger_OBC_cGW(bytes);
+        charger_status.HVLM_FreigabeKlimatisierung = mlb_dbc::HVLM_03::HVLM_FreigabeKlimatisierung(bytes);
+        charger_status.HVLM_Ladetexte = mlb_dbc::HVLM_03::HVLM_Ladetexte(bytes);
+        charger_status.HVLM_IsoMessung_Anf = mlb_dbc::HVLM_03::HVLM_IsoMessung_Anf(bytes);
+        charger_status.HVLM_IstSpannung_HV = mlb_dbc::HVLM_03::HVLM_IstSpannung_HV(bytes);
+        break;
 
-        // CM_ SG_ 1662 LAD_MaxLadLeistung_HV_Offset "Offset zur 100W-Skalierung in 25W-Schritten";
-        charger_status.LAD_MaxLadLeistung_HV_Offset = ((bytes[7] >> 1) & (0x03U)); // Receiver: Vector__XXX
+    case mlb_dbc::LAD_02::ID: // Sender: Ladegeraet_Konzern
+        charger_status.LAD_02_CRC = mlb_dbc::LAD_02::LAD_02_CRC(bytes);
+        charger_status.LAD_02_BZ = mlb_dbc::LAD_02::LAD_02_BZ(bytes);
+        charger_status.LAD_Abregelung_Temperatur = mlb_dbc::LAD_02::LAD_Abregelung_Temperatur(bytes);
+        charger_status.LAD_Abregelung_IU_Ein_Aus = mlb_dbc::LAD_02::LAD_Abregelung_IU_Ein_Aus(bytes);
+        charger_status.LAD_Abregelung_BuchseTemp = mlb_dbc::LAD_02::LAD_Abregelung_BuchseTemp(bytes);
+        charger_status.LAD_MaxLadLeistung_HV = mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV(bytes);
+        charger_status.LAD_PRX_Stromlimit = mlb_dbc::LAD_02::LAD_PRX_Stromlimit(bytes);
+        charger_status.LAD_CP_Erkennung = mlb_dbc::LAD_02::LAD_CP_Erkennung(bytes);
+        charger_status.LAD_Stecker_Verriegelt = mlb_dbc::LAD_02::LAD_Stecker_Verriegelt(bytes);
+        charger_status.LAD_Kuehlbedarf = mlb_dbc::LAD_02::LAD_Kuehlbedarf(bytes);
+        charger_status.LAD_MaxLadLeistung_HV_Offset = mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV_Offset(bytes);
+        charger_status.LAD_Warnzustand = mlb_dbc::LAD_02::LAD_Warnzustand(bytes);
+        charger_status.LAD_Fehlerzustand = mlb_dbc::LAD_02::LAD_Fehlerzustand(bytes);
+        break;
 
-        // CM_ SG_ 1662 LAD_Warnzustand "Sammelwarnung Ladegeraet";
-        charger_status.LAD_Warnzustand = ((bytes[7] >> 6) & (0x01U)); // Receiver: Vector__XXX
+    case mlb_dbc::HVLM_08::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_Funktion_Dauer_BattKond = mlb_dbc::HVLM_08::HVLM_Funktion_Dauer_BattKond(bytes);
+        charger_status.HVLM_BattKond_Anf = mlb_dbc::HVLM_08::HVLM_BattKond_Anf(bytes);
+        charger_status.HVLM_Dauer_Klima_02 = mlb_dbc::HVLM_08::HVLM_Dauer_Klima_02(bytes);
+        break;
 
-        // CM_ SG_ 1662 LAD_Fehlerzustand "Sammelfehler Ladegeraet - kein Laden moeglich";
-        charger_status.LAD_Fehlerzustand = ((bytes[7] >> 7) & (0x01U)); // Receiver: Vector__XXX
+    case mlb_dbc::HVLM_09::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_AWC_Sollstrom = mlb_dbc::HVLM_09::HVLM_AWC_Sollstrom(bytes);
         break;
 
-    case 0x1A55549D: // HVLM_08 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 2589283485 HVLM_Funktion_Dauer_BattKond "Funktion Dauerkonditionierung HV-Batterie.";
-        charger_status.HVLM_Funktion_Dauer_BattKond = ((bytes[6] >> 6) & (0x01U)); // Receiver: BMC_MLBevo,Gateway,Gateway_PAG
+    case mlb_dbc::HVLM_10::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_RtmWarnLadeverbindung = mlb_dbc::HVLM_10::HVLM_RtmWarnLadeverbindung(bytes);
+        charger_status.HVLM_RtmWarnLadesystem = mlb_dbc::HVLM_10::HVLM_RtmWarnLadesystem(bytes);
+        charger_status.HVLM_RtmWarnLadestatus = mlb_dbc::HVLM_10::HVLM_RtmWarnLadestatus(bytes);
+        charger_status.HVLM_RtmWarnLadeKommunikation = mlb_dbc::HVLM_10::HVLM_RtmWarnLadeKommunikation(bytes);
+        charger_status.HVLM_Ladeanzeige_Anf = mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Anf(bytes);
+        charger_status.HVLM_Ladeanzeige_Status = mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Status(bytes);
+        charger_status.HVLM_Ladeanzeige_Rampzeit = mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Rampzeit(bytes);
+        charger_status.HVLM_Ladeanzeige_Intens_Heck = mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Heck(bytes);
+        charger_status.HVLM_Ladeanzeige_Intens_Front = mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Front(bytes);
+        break;
 
-        // CM_ SG_ 2589283485 HVLM_BattKond_Anf "Anforderung Batteriekonditionierung";
-        charger_status.HVLM_BattKond_Anf = ((bytes[6] >> 7) & (0x01U)) | ((bytes[7] & (0x03U)) << 1); // Receiver: Gateway,Gateway_PAG,TME
+    case mlb_dbc::HVLM_11::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_11_CRC = mlb_dbc::HVLM_11::HVLM_11_CRC(bytes);
+        charger_status.HVLM_11_BZ = mlb_dbc::HVLM_11::HVLM_11_BZ(bytes);
+        charger_status.HVLM_HVLB_SollSpannung_HVLS = mlb_dbc::HVLM_11::HVLM_HVLB_SollSpannung_HVLS(bytes);
+        charger_status.HVLM_HVLB_Status = mlb_dbc::HVLM_11::HVLM_HVLB_Status(bytes);
+        charger_status.HVLM_HVLB_SollModus = mlb_dbc::HVLM_11::HVLM_HVLB_SollModus(bytes);
+        break;
 
-        // CM_ SG_ 2589283485 HVLM_Dauer_Klima_02 "Dauer der Innenraumklimatisierung.";
-        charger_status.HVLM_Dauer_Klima_02 = ((bytes[7] >> 2) & (0x3FU)); // Receiver: Gateway,Gateway_PAG,TME
+    case mlb_dbc::HVLM_15::ID: // Sender: Ladegeraet_Konzern
+        charger_status.HVLM_PlanAnfr_Leistung = mlb_dbc::HVLM_15::HVLM_PlanAnfr_Leistung(bytes);
+        charger_status.HVLM_PlanAnfr_Zaehler = mlb_dbc::HVLM_15::HVLM_PlanAnfr_Zaehler(bytes);
+        charger_status.HVLM_PlanAnfr_Dauer = mlb_dbc::HVLM_15::HVLM_PlanAnfr_Dauer(bytes);
+        charger_status.HVLM_PlanAnfr_Ladeart = mlb_dbc::HVLM_15::HVLM_PlanAnfr_Ladeart(bytes);
+        charger_status.HVLM_EnergieAnfr_SocStart = mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocStart(bytes);
+        charger_status.HVLM_EnergieAnfr_SocZiel = mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocZiel(bytes);
+        charger_status.HVLM_EnergieAnfr_Zaehler = mlb_dbc::HVLM_15::HVLM_EnergieAnfr_Zaehler(bytes);
+        charger_status.HVLM_LadegrenzeAnfr_Leistung = mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Leistung(bytes);
+        charger_status.HVLM_LadegrenzeAnfr_Zaehler = mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Zaehler(bytes);
         break;
 
-    case 0x1A555515: // HVLM_09 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 2589283605 HVLM_AWC_Sollstrom "Angeforderter Sollstrom fuer AWC Laden";
-        charger_status.HVLM_AWC_Sollstrom =
-            ((((bytes[6] >> 7) & (0x01U)) | ((bytes[7] & (0xFFU)) << 1)) * 0.1f); // Receiver: AWC
+    case mlb_dbc::KN_Ladegeraet::ID: // Sender: Ladegeraet_Konzern
+        charger_status.LG_KompSchutz = mlb_dbc::KN_Ladegeraet::LG_KompSchutz(bytes);
+        charger_status.LG_Abschaltstufe = mlb_dbc::KN_Ladegeraet::LG_Abschaltstufe(bytes);
+        charger_status.LG_Transport_Mode = mlb_dbc::KN_Ladegeraet::LG_Transport_Mode(bytes);
+        charger_status.LG_Nachlauftyp = mlb_dbc::KN_Ladegeraet::LG_Nachlauftyp(bytes);
+        charger_status.LG_SNI = mlb_dbc::KN_Ladegeraet::LG_SNI(bytes);
+        charger_status.KN_Ladegeraet_ECUKnockOutTimer = mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOutTimer(bytes);
+        charger_status.KN_Ladegeraet_BusKnockOut = mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOut(bytes);
+        charger_status.KN_Ladegeraet_BusKnockOutTimer = mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOutTimer(bytes);
+        charger_status.NM_Ladegeraet_Wakeup = mlb_dbc::KN_Ladegeraet::NM_Ladegeraet_Wakeup(bytes);
+        charger_status.KN_Ladegeraet_ECUKnockOut = mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOut(bytes);
+        charger_status.NMH_Ladegeraet_Lokalaktiv = mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Lokalaktiv(bytes);
+        charger_status.NMH_Ladegeraet_Subsystemaktiv = mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Subsystemaktiv(bytes);
+        charger_status.LG_KD_Fehler = mlb_dbc::KN_Ladegeraet::LG_KD_Fehler(bytes);
         break;
+    }
+}
 
-    case 0x12DD5472: // HVLM_10 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 2463978610 HVLM_RtmWarnLadeverbindung "RTM Charging connection fault";
-        charger_status.HVLM_RtmWarnLadeverbindung = ((bytes[3] >> 7) & (0x01U)) | ((bytes[4] & (0x03U)) << 1); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+//----------------------------------------------------------------------------------------------------------------------------------------------
+// Emulated messages
+//----------------------------------------------------------------------------------------------------------------------------------------------
 
-        // CM_ SG_ 2463978610 HVLM_RtmWarnLadesystem "RTM Electrical machine CAN communication fault";
-        charger_status.HVLM_RtmWarnLadesystem = ((bytes[4] >> 2) & (0x07U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+// Sorted by period, on a busy tick the messages at the top go out first.
+// Packers fill a zeroed buffer, counter and CRC are added afterwards.
+// The wake set is terminal status and locking, the charger stays awake on it
+// and reports the plug, the rest is only needed to charge.
+// Cached are the E2E protected messages whose signals rarely change; BMS_01
+// follows the pack current and is cheaper to sign per send.
+const VWMLBClass::TxMessage VWMLBClass::txTable[MLB_TX_MSG_COUNT] = {
+    { ID_BMS_01,            10,   8, TX_FULL, TX_PACK,   &VWMLBClass::msg191,      &VWMLBClass::e2e191 },
+    { 0x2B1,                40,   8, TX_FULL, TX_PACK,   &VWMLBClass::msg2B1,      nullptr },             // MSG_TME_02
+    { ID_DCDC_01,           50,   8, TX_FULL, TX_CACHED, &VWMLBClass::msg2AE,      &VWMLBClass::e2e2AE },
+    { 0x3C0,                100,  4, TX_WAKE, TX_CACHED, &VWMLBClass::msg3C0,      &VWMLBClass::e2e3C0 }, // Klemmen_Status_01
+    { ID_HVK_01,            100,  8, TX_FULL, TX_CACHED, &VWMLBClass::msg503,      &VWMLBClass::e2e503 },
+    { ID_FCU_02,            100,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg17B,      nullptr },
+    { ID_BMS_02,            100,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg1A1,      nullptr },
+    { ID_BMS_03,            100,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg39D,      nullptr },
+    { ID_BMS_10,            100,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg509,      nullptr },
+    { ID_HVEM_05,           100,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg552,      nullptr },
+    { ID_HVEM_02,           100,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg5AC,      nullptr },
+    { ID_ESP_15,            200,  8, TX_FULL, TX_CACHED, &VWMLBClass::msg1A2,      &VWMLBClass::e2e1A2 },
+    { ID_ZV_02,             200,  8, TX_WAKE, TX_PACK,   &VWMLBClass::msg583,      nullptr },
+    { ID_BMS_04,            500,  8, TX_FULL, TX_CACHED, &VWMLBClass::msg5A2,      &VWMLBClass::e2e5A2 },
+    { ID_BMS_07,            500,  8, TX_FULL, TX_CACHED, &VWMLBClass::msg5CA,      &VWMLBClass::e2e5CA },
+    { ID_DCDC_03,           500,  8, TX_FULL, TX_CACHED, &VWMLBClass::msg5CD,      &VWMLBClass::e2e5CD },
+    { ID_BMS_06,            500,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg59E,      nullptr },
+    { ID_ORU_01,            960,  8, TX_FULL, TX_PACK,   &VWMLBClass::msg1A555548, nullptr },
+    { ID_ZV_01,             1000, 8, TX_FULL, TX_CACHED, &VWMLBClass::msg184,      &VWMLBClass::e2e184 },
+    { ID_BMS_DC_01,         1000, 8, TX_FULL, TX_CACHED, &VWMLBClass::msg578,      &VWMLBClass::e2e578 },
+    { ID_NAVDATA_02,        1000, 8, TX_FULL, TX_PACK,   &VWMLBClass::msg485,      nullptr },
+    { ID_AUTHENTIC_TIME_01, 1000, 8, TX_FULL, TX_PACK,   &VWMLBClass::msg1A5555AD, nullptr },
+    { ID_BMS_09,            1000, 8, TX_FULL, TX_PACK,   &VWMLBClass::msg96A955EB, nullptr },
+    { ID_BMS_16,            1000, 8, TX_FULL, TX_PACK,   &VWMLBClass::msg9A555539, nullptr },
+    { ID_BMS_27,            1000, 8, TX_FULL, TX_PACK,   &VWMLBClass::msg9A555552, nullptr },
+    { ID_BMS_11,            2000, 8, TX_FULL, TX_PACK,   &VWMLBClass::msg96A954A6, nullptr },
+};
+
+VWMLBClass::TxState VWMLBClass::txState[MLB_TX_MSG_COUNT];
+uint32_t VWMLBClass::txTick = 0;
+bool VWMLBClass::txPhasesAssigned = false;
+VWMLBClass::TxLevel VWMLBClass::txLevel = VWMLBClass::TX_FULL;
+VWMLBClass::TxCache VWMLBClass::txCache[MLB_TX_CACHE_SLOTS];
+uint32_t VWMLBClass::txCacheRebuilds = 0;
+
+static uint32_t Gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
 
-        // CM_ SG_ 2463978610 HVLM_RtmWarnLadestatus "RTM Warning of charging status fault";
-        charger_status.HVLM_RtmWarnLadestatus = ((bytes[4] >> 5) & (0x07U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+// Greedy, shortest period first: every message gets the phase that meets the
+// already placed messages least often. Messages with the periods p and q meet
+// on every lcm(p, q) tick if their phases agree modulo gcd(p, q), that is on
+// gcd(p, q) / q of the sends of the first one.
+void VWMLBClass::AssignTxPhases()
+{
+    for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+    {
+        const uint32_t period = txTable[i].periodMs / MLB_TX_TICK_MS;
+        uint32_t bestCost = 0xFFFFFFFF;
+        uint16_t bestPhase = 0;
 
-        // CM_ SG_ 2463978610 HVLM_RtmWarnLadeKommunikation "RTM Warning of charging communction fault";
-        charger_status.HVLM_RtmWarnLadeKommunikation = (bytes[5] & (0x07U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+        for (uint32_t phase = 0; phase < period; phase++)
+        {
+            uint32_t cost = 0;
+
+            for (int j = 0; j < i; j++)
+            {
+                const uint32_t other = txTable[j].periodMs / MLB_TX_TICK_MS;
+                const uint32_t g = Gcd(period, other);
+
+                if (phase % g == txState[j].phase % g)
+                    cost += g * 1000 / other; // meetings per 1000 sends
+            }
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestPhase = phase;
+            }
+        }
+        txState[i].phase = bestPhase;
+    }
+    txPhasesAssigned = true;
+}
 
-        // CM_ SG_ 2463978610 HVLM_Ladeanzeige_Anf "Lichtmuster fuer Charge Check";
-        charger_status.HVLM_Ladeanzeige_Anf = ((bytes[5] >> 3) & (0x01U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+void VWMLBClass::AssignTxCacheSlots()
+{
+    int slots = 0;
 
-        // CM_ SG_ 2463978610 HVLM_Ladeanzeige_Status "Funktionsstatus ChargeCheck";
-        charger_status.HVLM_Ladeanzeige_Status = ((bytes[5] >> 4) & (0x03U)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+    for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+    {
+        const bool cached = txTable[i].mode == TX_CACHED && txTable[i].e2e != nullptr && slots < MLB_TX_CACHE_SLOTS;
 
-        // CM_ SG_ 2463978610 HVLM_Ladeanzeige_Rampzeit "Zeit, innerhalb der die Intensitaet erreicht werden soll";
-        charger_status.HVLM_Ladeanzeige_Rampzeit = ((((bytes[6] & (0x03U)) << 2) | ((bytes[5] >> 6) & (0x03U))) * 50); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+        txState[i].cacheSlot = cached ? slots++ : -1;
+    }
+}
 
-        // CM_ SG_ 2463978610 HVLM_Ladeanzeige_Intens_Heck "Helligkeit Heck-Fahrzeug-Lichtelemente";
-        charger_status.HVLM_Ladeanzeige_Intens_Heck = (((bytes[7] & (0x01U)) << 6) | ((bytes[6] >> 2) & (0x3FU))); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
+void VWMLBClass::InvalidateTxCache()
+{
+    for (int i = 0; i < MLB_TX_CACHE_SLOTS; i++)
+        txCache[i].valid = false;
+}
 
-        // CM_ SG_ 2463978610 HVLM_Ladeanzeige_Intens_Front "Helligkeit Front-Fahrzeug-Lichtelemente";
-        charger_status.HVLM_Ladeanzeige_Intens_Front = ((bytes[7] >> 1) & (0x7FU)); // Receiver: Gateway,Gateway_PAG,Sub_Gateway
-        break;
+// Runs after every update of mlb_state, which only changes in emulateMLB().
+// A cached message whose packed payload differs from the one its frames were
+// signed from gets all 16 counter variants signed again, otherwise sending it
+// is a copy of the frame for the next counter.
+void VWMLBClass::RefreshTxCache()
+{
+    const bool enabled = Param::GetInt(Param::mlb_tx_cache) != 0;
 
-    case 0x12DD5491: // HVLM_11 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 2463978641 HVLM_11_CRC "Berechnung siehe Lastenheft Kommunikationsabsicherung / End-to-End Kommunikationsabsicherung";
-        charger_status.HVLM_11_CRC = (bytes[0] & (0xFFU)); // Receiver: DCDC_HV_02
+    for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+    {
+        const TxMessage &msg = txTable[i];
+        const int slot = txState[i].cacheSlot;
 
-        // CM_ SG_ 2463978641 HVLM_11_BZ "4bit Botschaftszaehler, wird mit jeder Sendebotschaft inkrementiert";
-        charger_status.HVLM_11_BZ = (bytes[1] & (0x0FU)); // Receiver: DCDC_HV_02
+        if (slot < 0)
+            continue;
 
-        // CM_ SG_ 2463978641 HVLM_HVLB_SollSpannung_HVLS "Vorgabe SollSpannung Eingangsseite vom HVLM an HVLB";
-        charger_status.HVLM_HVLB_SollSpannung_HVLS =
-            ((((bytes[2] & (0xFFU)) << 4) | ((bytes[1] >> 4) & (0x0FU))) * 0.25f); // Receiver: DCDC_HV_02
+        TxCache &cache = txCache[slot];
+        uint8_t buf[8]{};
 
-        // CM_ SG_ 2463978641 HVLM_HVLB_Status "Statusuebermittlung von Ladesaeulenspezifika";
-        charger_status.HVLM_HVLB_Status = ((bytes[4] & (0x0FU)) << 8) | (bytes[3] & (0xFFU)); // Receiver: DCDC_HV_02
+        if (!enabled)
+        {
+            cache.valid = false;
+            continue;
+        }
 
-        // CM_ SG_ 2463978641 HVLM_HVLB_SollModus "Vorgabe SollModus vom HVLM an HVLB";
-        charger_status.HVLM_HVLB_SollModus = ((bytes[4] >> 4) & (0x07U)); // Receiver: DCDC_HV_02
-        break;
+        (this->*msg.pack)(buf);
+        if (cache.valid && memcmp(buf, cache.payload, msg.dlc) == 0)
+            continue;
 
-    case 0x1A55554D: // HVLM_15 Sender: Ladegeraet_Konzern
-        // CM_ SG_ 2589283661 HVLM_PlanAnfr_Leistung "Ladeplan-Anfrage fuer die Ladeplanung: Leistung";
-        charger_status.HVLM_PlanAnfr_Leistung = ((bytes[0] & (0xFFU)) | ((bytes[1] & (0x0FU)) << 8)) * 200; // Receiver: AWC,DCDC_HV_02,TME
+        memcpy(cache.payload, buf, sizeof(buf));
+        for (uint8_t counter = 0; counter < 16; counter++)
+        {
+            memcpy(cache.frames[counter], buf, sizeof(buf));
+            (this->*msg.e2e).Sign(cache.frames[counter], msg.dlc, counter);
+        }
+        cache.valid = true;
+        txCacheRebuilds++;
+    }
+}
 
-        // CM_ SG_ 2589283661 HVLM_PlanAnfr_Zaehler "Ladeplan-Anfrage fuer die Ladeplanung: Zaehler";
-        charger_status.HVLM_PlanAnfr_Zaehler = ((bytes[1] >> 4) & (0x0FU)); // Receiver: AWC,DCDC_HV_02,TME
+void VWMLBClass::ResetTxSchedule()
+{
+    txTick = 0;
+    for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+        txState[i].nextDue = txState[i].phase;
+}
 
-        // CM_ SG_ 2589283661 HVLM_PlanAnfr_Dauer "Ladeplan-Anfrage fuer die Ladeplanung: Dauer";
-        charger_status.HVLM_PlanAnfr_Dauer = ((bytes[2] & (0xFFU)) | ((bytes[3] & (0x03U)) << 8)); // Receiver: AWC,DCDC_HV_02,TME
+// Nothing in sleep, the full set only while a plug is reported and the
+// vehicle is not driving, the wake set otherwise. A stale HVLM_04 counts as
+// unplugged, the wake set brings the charger back.
+VWMLBClass::TxLevel VWMLBClass::SelectTxLevel() const
+{
+    if (vehicle_status.CANQuiet)
+        return TX_OFF;
+    if (Param::GetInt(Param::mlb_tx_policy) == 0)
+        return TX_FULL;
 
-        // CM_ SG_ 2589283661 HVLM_PlanAnfr_Ladeart "Anfrage Ladeart fuer Ladeplanerstellung";
-        charger_status.HVLM_PlanAnfr_Ladeart = ((bytes[3] >> 2) & (0x07U)); // Receiver: AWC,DCDC_HV_02,TME
+    switch (Param::GetInt(Param::LVDU_vehicle_state))
+    {
+    case STATE_SLEEP:
+    case STATE_FORCE_VCU_SHUTDOWN:
+        return TX_OFF;
+    case STATE_DRIVE:
+    case STATE_LIMP_HOME:
+        return TX_WAKE;
+    default:
+        break;
+    }
 
-        // CM_ SG_ 2589283661 HVLM_EnergieAnfr_SocStart "Energieanfrage fuer die Ladeplanung: Start-SoC";
-        charger_status.HVLM_EnergieAnfr_SocStart = ((bytes[3] >> 5) & (0x07U)) | ((bytes[4] & (0x0FU)) << 3); // Receiver: BMC_MLBevo
+    const bool plugged = hvlm04Fresh && charger_status.HVLM_Stecker_Status > 1;
+    return plugged ? TX_FULL : TX_WAKE;
+}
 
-        // CM_ SG_ 2589283661 HVLM_EnergieAnfr_SocZiel "Energieanfrage fuer die Ladeplanung: Ziel-SOC";
-        charger_status.HVLM_EnergieAnfr_SocZiel = ((bytes[4] >> 4) & (0x0FU)) | ((bytes[5] & (0x07U)) << 4); // Receiver: BMC_MLBevo
+// Messages that join on a level change are due right away instead of at
+// their next phase, the charger sees the full set within a few ticks.
+void VWMLBClass::SetTxLevel(TxLevel level)
+{
+    if (level > txLevel)
+    {
+        for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+        {
+            if (txTable[i].level > txLevel && txTable[i].level <= level)
+                txState[i].nextDue = txTick;
+        }
+    }
+    txLevel = level;
+}
 
-        // CM_ SG_ 2589283661 HVLM_EnergieAnfr_Zaehler "Fortlaufender Zaehler fuer die Anfrage Energie";
-        charger_status.HVLM_EnergieAnfr_Zaehler = ((bytes[5] >> 3) & (0x0FU)); // Receiver: BMC_MLBevo
+// Sends the due messages, no more than mlb_tx_per_tick per call. The most
+// overdue message goes first, so a limit below the average rate slows all
+// messages down instead of starving the slow ones. Messages held back by the
+// limit are counted as late.
+void VWMLBClass::SendDueMessages()
+{
+    const int maxPerTick = Param::GetInt(Param::mlb_tx_per_tick);
 
-        // CM_ SG_ 2589283661 HVLM_LadegrenzeAnfr_Leistung "Anfrage Ladeleistung mit welcher bis zu SOC geladen werden kann";
-        charger_status.HVLM_LadegrenzeAnfr_Leistung = ((bytes[6] & (0xFFU)) | ((bytes[7] & (0x0FU)) << 8)) * 200; // Receiver: BMC_MLBevo
+    for (int sent = 0; sent < maxPerTick; sent++)
+    {
+        int next = -1;
+        int32_t maxOverdue = -1;
 
-        // CM_ SG_ 2589283661 HVLM_LadegrenzeAnfr_Zaehler "Fortlaufender Zaehler fuer die Anfrage Ladegrenze";
-        charger_status.HVLM_LadegrenzeAnfr_Zaehler = ((bytes[7] >> 4) & (0x0FU)); // Receiver: BMC_MLBevo
-        break;
+        // On a tie the shorter period wins
+        for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+        {
+            if (txTable[i].level > txLevel)
+                continue;
 
-    case 0x17F00044: // KN_Ladegeraet Sender: Ladegeraet_Konzern
-        // CM_ SG_ 2549088324 LG_KompSchutz "Funktionseinschraenkung aufgrund Komponentenschutz aktiv";
-        charger_status.LG_KompSchutz = (bytes[0] & (0x01U)); // Receiver: Vector__XXX
+            const int32_t overdue = static_cast<int32_t>(txTick - txState[i].nextDue);
 
-        // CM_ SG_ 2549088324 LG_Abschaltstufe "Funktionseinschraenkung aufgrund aktiver Abschaltstufe";
-        charger_status.LG_Abschaltstufe = ((bytes[0] >> 1) & (0x01U)); // Receiver: Vector__XXX
+            if (overdue > maxOverdue)
+            {
+                maxOverdue = overdue;
+                next = i;
+            }
+        }
 
-        // CM_ SG_ 2549088324 LG_Transport_Mode "Funktionseinschraenkung aufgrund aktivem Transport Mode/Schutz";
-        charger_status.LG_Transport_Mode = ((bytes[0] >> 2) & (0x01U)); // Receiver: Vector__XXX
+        if (next < 0)
+            break;
 
-        // CM_ SG_ 2549088324 LG_Nachlauftyp "von Hardware vorgegebene Moeglichkeit, Kommunikation nach KL15=AUS aufrecht zu halten";
-        charger_status.LG_Nachlauftyp = ((bytes[0] >> 4) & (0x0FU)); // Receiver: Gateway,Gateway_PAG
+        SendTxMessage(next);
+    }
+    txTick++;
+}
 
-        // CM_ SG_ 2549088324 LG_SNI "Source Node Identifier";
-        charger_status.LG_SNI = (bytes[1] & (0xFFU)); // Receiver: Gateway,Gateway_PAG
+void VWMLBClass::SendTxMessage(int index)
+{
+    const TxMessage &msg = txTable[index];
+    TxState &state = txState[index];
+    const uint32_t period = msg.periodMs / MLB_TX_TICK_MS;
 
-        // CM_ SG_ 2549088324 KN_Ladegeraet_ECUKnockOutTimer "Ausgabe ECUKnockOut-Timer";
-        charger_status.KN_Ladegeraet_ECUKnockOutTimer = (bytes[4] & (0x3FU)); // Receiver: Gateway
+    if (state.cacheSlot >= 0 && txCache[state.cacheSlot].valid)
+    {
+        can->Send(msg.id, txCache[state.cacheSlot].frames[(this->*msg.e2e).NextCounter()], msg.dlc);
+    }
+    else
+    {
+        uint8_t buf[8]{};
 
-        // CM_ SG_ 2549088324 KN_Ladegeraet_BusKnockOut "Ausgabe BusKnockOut-Status";
-        charger_status.KN_Ladegeraet_BusKnockOut = ((bytes[4] >> 6) & (0x03U)); // Receiver: Gateway
+        (this->*msg.pack)(buf);
+        if (msg.e2e != nullptr)
+            (this->*msg.e2e).Protect(buf, msg.dlc);
+        can->Send(msg.id, buf, msg.dlc);
+    }
 
-        // CM_ SG_ 2549088324 KN_Ladegeraet_BusKnockOutTimer "Ausgabe BusKnockOut-Timer";
-        charger_status.KN_Ladegeraet_BusKnockOutTimer = (bytes[5] & (0xFFU)); // Receiver: Gateway,Gateway_PAG
+    if (txTick != state.nextDue)
+        state.late++;
+    state.sent++;
 
-        // CM_ SG_ 2549088324 NM_Ladegeraet_Wakeup "enthaelt Weckursache";
-        charger_status.NM_Ladegeraet_Wakeup = (bytes[6] & (0xFFU)); // Receiver: Vector__XXX
+    // Continue from now rather than catching up after a long hold-off
+    state.nextDue += period;
+    if (static_cast<int32_t>(txTick - state.nextDue) >= 0)
+        state.nextDue = txTick + period;
+}
 
-        // CM_ SG_ 2549088324 KN_Ladegeraet_ECUKnockOut "Ausgabe ECUKnockOut-Status";
-        charger_status.KN_Ladegeraet_ECUKnockOut = (bytes[7] & (0x03U)); // Receiver: Gateway
+bool VWMLBClass::GetTxStatus(int index, TxStatus &status)
+{
+    if (index < 0 || index >= MLB_TX_MSG_COUNT)
+        return false;
 
-        // CM_ SG_ 2549088324 NMH_Ladegeraet_Lokalaktiv "Zeigt an ob Steuergeraet lokal aktiv war";
-        charger_status.NMH_Ladegeraet_Lokalaktiv = ((bytes[7] >> 5) & (0x01U)); // Receiver: Gateway,Gateway_PAG
+    status.id = txTable[index].id;
+    status.periodMs = txTable[index].periodMs;
+    status.phaseMs = txState[index].phase * MLB_TX_TICK_MS;
+    status.sent = txState[index].sent;
+    status.late = txState[index].late;
+    return true;
+}
 
-        // CM_ SG_ 2549088324 NMH_Ladegeraet_Subsystemaktiv "Zeigt an ob ein Subsystem nach Klemme15 AUS noch aktiv war";
-        charger_status.NMH_Ladegeraet_Subsystemaktiv = ((bytes[7] >> 6) & (0x01U)); // Receiver: Vector__XXX
+uint32_t VWMLBClass::GetTxLate()
+{
+    uint32_t late = 0;
 
-        // CM_ SG_ 2549088324 LG_KD_Fehler "Bei gesetztem Bit ist mindestens ein Kundendienstfehler eingetragen";
-        charger_status.LG_KD_Fehler = ((bytes[7] >> 7) & (0x01U)); // Receiver: Gateway,Gateway_PAG
-        break;
-    }
+    for (int i = 0; i < MLB_TX_MSG_COUNT; i++)
+        late += txState[i].late;
+    return late;
 }
 
 // Msgs with CRC & Counters:
@@ -1015,292 +1138,202 @@ void VWMLBClass::msg040() // Airbag_01 - 0x40
     // if(vag_cnt040>0x0f) vag_cnt040=0x00;
 }
 
-void VWMLBClass::msg184() // ZV_01   0x184
+void VWMLBClass::msg184(uint8_t *buf) // ZV_01   0x184
 {
-    uint8_t buf[8]{};
-    buf[1] = ((0x00 & 0x0F) | ((mlb_state.ZV_FT_verriegeln & 0x01) << 4) |
-              ((mlb_state.ZV_FT_entriegeln & 0x01) << 5) | ((mlb_state.ZV_BT_verriegeln & 0x01) << 6) |
-              ((mlb_state.ZV_BT_entriegeln & 0x01) << 7)) |
-             vag_cnt184;
-    buf[7] = ((0x00 >> 5) & 0x3F) | ((mlb_state.ZV_entriegeln_Anf & 0x01) << 6);
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_ZV_01);
-    can->Send(ID_ZV_01, buf, 8);
-    vag_cnt184 = (vag_cnt184 + 1) & 0x0F;
+    mlb_dbc::ZV_01::ZV_FT_verriegeln_Encode(buf, mlb_state.ZV_FT_verriegeln);
+    mlb_dbc::ZV_01::ZV_FT_entriegeln_Encode(buf, mlb_state.ZV_FT_entriegeln);
+    mlb_dbc::ZV_01::ZV_BT_verriegeln_Encode(buf, mlb_state.ZV_BT_verriegeln);
+    mlb_dbc::ZV_01::ZV_BT_entriegeln_Encode(buf, mlb_state.ZV_BT_entriegeln);
+    mlb_dbc::ZV_01::ZV_entriegeln_Anf_Encode(buf, mlb_state.ZV_entriegeln_Anf);
 }
 
-void VWMLBClass::msg191() // BMS_01   0x191
+void VWMLBClass::msg191(uint8_t *buf) // BMS_01   0x191
 {
-    uint8_t buf[8]{};
-    buf[1] = ((mlb_state.BMS_Batt_Curr & 0x0F) << 4) | vag_cnt191;
-    buf[2] = (mlb_state.BMS_Batt_Curr >> 4) & 0xFF;
-    buf[3] = mlb_state.BMS_Batt_Volt & 0xFF;
-    buf[4] = ((mlb_state.BMS_Batt_Volt >> 8) & 0x0F) | ((mlb_state.BMS_Batt_Volt_HVterm & 0x0F) << 4);
-    buf[5] = ((mlb_state.BMS_Batt_Volt_HVterm >> 4) & 0x7F) | ((mlb_state.BMS_SOC_HiRes & 0x01) << 7);
-    buf[6] = (mlb_state.BMS_SOC_HiRes >> 1) & 0xFF;
-    buf[7] = (mlb_state.BMS_SOC_HiRes >> 9) & 0x03;
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_BMS_01);
-    can->Send(ID_BMS_01, buf, 8);
-    vag_cnt191 = (vag_cnt191 + 1) & 0x0F;
+    mlb_dbc::BMS_01::BMS_IstStrom_02_Encode(buf, mlb_state.BMS_Batt_Curr);
+    mlb_dbc::BMS_01::BMS_IstSpannung_Encode(buf, mlb_state.BMS_Batt_Volt);
+    mlb_dbc::BMS_01::BMS_Spannung_ZwKr_Encode(buf, mlb_state.BMS_Batt_Volt_HVterm);
+    mlb_dbc::BMS_01::BMS_SOC_HiRes_Encode(buf, mlb_state.BMS_SOC_HiRes);
 }
 
-void VWMLBClass::msg1A2() // ESP_15   0x1A2
+void VWMLBClass::msg1A2(uint8_t *buf) // ESP_15   0x1A2
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt1A2;
-    buf[4] = (mlb_state.HMS_Systemstatus & 0x0F) << 4;
-    buf[5] = (mlb_state.HMS_aktives_System & 0x1F) << 3;
-    buf[6] = (mlb_state.HMS_Fehlerstatus & 0x07) << 2;
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_ESP_15);
-    can->Send(ID_ESP_15, buf, 8);
-    vag_cnt1A2 = (vag_cnt1A2 + 1) & 0x0F;
+    mlb_dbc::ESP_15::HMS_Systemstatus_Encode(buf, mlb_state.HMS_Systemstatus);
+    mlb_dbc::ESP_15::HMS_aktives_System_Encode(buf, mlb_state.HMS_aktives_System);
+    mlb_dbc::ESP_15::HMS_Fehlerstatus_Encode(buf, mlb_state.HMS_Fehlerstatus);
 }
 
-void VWMLBClass::msg2AE() // DCDC_01    0x2AE
+void VWMLBClass::msg2AE(uint8_t *buf) // DCDC_01    0x2AE
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt2AE;
-    buf[7] = 0xA8; // 13.8V output
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_DCDC_01);
-    can->Send(ID_DCDC_01, buf, 8);
-    vag_cnt2AE = (vag_cnt2AE + 1) & 0x0F;
+    mlb_dbc::DCDC_01::DC_IstSpannung_NV_Encode(buf, 0xA8); // 13.8V output
 }
 
-void VWMLBClass::msg503() // HVK_01     0x503
+void VWMLBClass::msg503(uint8_t *buf) // HVK_01     0x503
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt503;
-    buf[2] = mlb_state.HVK_MO_EmSollzustand & 0xFF;
-    buf[3] = (mlb_state.HVK_BMS_Sollmodus & 0x07) | ((mlb_state.HVK_DCDC_Sollmodus & 0x07) << 3);
-    buf[4] = (mlb_state.HVK_HVLM_Sollmodus & 0x07) << 4;
-    buf[5] = (mlb_state.HV_Bordnetz_aktiv & 0x01) << 1 | ((mlb_state.HVK_Gesamtst_Spgfreiheit & 0x03) << 3);
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_HVK_01);
-    can->Send(ID_HVK_01, buf, 8);
-    vag_cnt503 = (vag_cnt503 + 1) & 0x0F;
+    mlb_dbc::HVK_01::HVK_MO_EmSollzustand_Encode(buf, mlb_state.HVK_MO_EmSollzustand);
+    mlb_dbc::HVK_01::HVK_BMS_Sollmodus_Encode(buf, mlb_state.HVK_BMS_Sollmodus);
+    mlb_dbc::HVK_01::HVK_DCDC_Sollmodus_Encode(buf, mlb_state.HVK_DCDC_Sollmodus);
+    mlb_dbc::HVK_01::HVK_HVLM_Sollmodus_Encode(buf, mlb_state.HVK_HVLM_Sollmodus);
+    mlb_dbc::HVK_01::HV_Bordnetz_aktiv_Encode(buf, mlb_state.HV_Bordnetz_aktiv);
+    mlb_dbc::HVK_01::HVK_Gesamtst_Spgfreiheit_Encode(buf, mlb_state.HVK_Gesamtst_Spgfreiheit);
 }
 
-void VWMLBClass::msg578() // BMS_DC_01    0x578
+void VWMLBClass::msg578(uint8_t *buf) // BMS_DC_01    0x578
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt578;
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_BMS_DC_01);
-    can->Send(ID_BMS_DC_01, buf, 8);
-    vag_cnt578 = (vag_cnt578 + 1) & 0x0F;
+    // All signals zero
+    (void)buf;
 }
 
-void VWMLBClass::msg5A2() // BMS_04   0x5A2
+void VWMLBClass::msg5A2(uint8_t *buf) // BMS_04   0x5A2
 {
-    uint8_t buf[8]{};
-    buf[1] = ((mlb_state.BMS_Status_ServiceDisconnect & 0x01) << 5) |
-             ((mlb_state.BMS_HV_Status & 0x03) << 6) | vag_cnt5A2;
-    buf[2] = ((mlb_state.BMS_IstModus & 0x07) << 1) | ((mlb_state.BMS_Faultstatus & 0x07) << 4) |
-             ((mlb_state.BMS_Batt_Ah & 0x01) << 7);
-    buf[3] = (mlb_state.BMS_Batt_Ah >> 1) & 0xFF;
-    buf[4] = (mlb_state.BMS_Batt_Ah >> 9) & 0x03;
-    buf[6] = (mlb_state.BMS_Target_SOC_HiRes & 0x07) << 5;
-    buf[7] = (mlb_state.BMS_Target_SOC_HiRes >> 3) & 0xFF;
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_BMS_04);
-    can->Send(ID_BMS_04, buf, 8);
-    vag_cnt5A2 = (vag_cnt5A2 + 1) & 0x0F;
+    mlb_dbc::BMS_04::BMS_Status_ServiceDisconnect_Encode(buf, mlb_state.BMS_Status_ServiceDisconnect);
+    mlb_dbc::BMS_04::BMS_Status_Spgfreiheit_Encode(buf, mlb_state.BMS_HV_Status);
+    mlb_dbc::BMS_04::BMS_IstModus_Encode(buf, mlb_state.BMS_IstModus);
+    mlb_dbc::BMS_04::BMS_Fehlerstatus_Encode(buf, mlb_state.BMS_Faultstatus);
+    mlb_dbc::BMS_04::BMS_Kapazitaet_02_Encode(buf, mlb_state.BMS_Batt_Ah);
+    mlb_dbc::BMS_04::BMS_Soll_SOC_HiRes_Encode(buf, mlb_state.BMS_Target_SOC_HiRes);
 }
 
-void VWMLBClass::msg5CA() // BMS_07   0x5CA
+void VWMLBClass::msg5CA(uint8_t *buf) // BMS_07   0x5CA
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt5CA;
-    buf[1] |= (mlb_state.BMS_Batt_Energy & 0x0F) << 4;
-    buf[2] = ((mlb_state.BMS_Batt_Energy >> 4) & 0x7F) |
-             ((mlb_state.BMS_Charger_Active & 0x01) << 7);
-    buf[3] = (mlb_state.BMS_Battdiag & 0x07) |
-             ((mlb_state.BMS_Freig_max_Perf & 0x03) << 3) |
-             ((mlb_state.BMS_Balancing_Active & 0x03) << 6);
-    buf[4] = mlb_state.BMS_Max_Wh & 0xFF;
-    buf[5] = ((mlb_state.BMS_Max_Wh >> 8) & 0x07) |
-             ((mlb_state.HVK_Gesamtst_Spgfreiheit & 0x03) << 4) |
-             ((mlb_state.BMS_RIso_Ext & 0x03) << 6);
-    buf[6] = (mlb_state.BMS_RIso_Ext >> 2) & 0xFF;
-    buf[7] = (mlb_state.BMS_RIso_Ext >> 10) & 0x03;
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_BMS_07);
-    can->Send(ID_BMS_07, buf, 8);
-    vag_cnt5CA = (vag_cnt5CA + 1) & 0x0F;
+    mlb_dbc::BMS_07::BMS_Energieinhalt_Encode(buf, mlb_state.BMS_Batt_Energy);
+    mlb_dbc::BMS_07::BMS_Ladevorgang_aktiv_Encode(buf, mlb_state.BMS_Charger_Active);
+    mlb_dbc::BMS_07::BMS_Batteriediagnose_Encode(buf, mlb_state.BMS_Battdiag);
+    mlb_dbc::BMS_07::BMS_Freig_max_Performanz_Encode(buf, mlb_state.BMS_Freig_max_Perf);
+    mlb_dbc::BMS_07::BMS_Balancing_Aktiv_Encode(buf, mlb_state.BMS_Balancing_Active);
+    mlb_dbc::BMS_07::BMS_MaxEnergieinhalt_Encode(buf, mlb_state.BMS_Max_Wh);
+    mlb_dbc::BMS_07::BMS_Gesamtst_Spgfreiheit_Encode(buf, mlb_state.HVK_Gesamtst_Spgfreiheit);
+    mlb_dbc::BMS_07::BMS_RIso_Ext_Encode(buf, mlb_state.BMS_RIso_Ext);
 }
 
-void VWMLBClass::msg5CD() // DCDC_03    0x5CD
+void VWMLBClass::msg5CD(uint8_t *buf) // DCDC_03    0x5CD
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt5CD;
-    buf[2] = (mlb_state.DC_IstModus_02 & 0x07) << 5;
-    buf[0] = vag_utils::vw_crc_calc(buf, 8, ID_DCDC_03);
-    can->Send(ID_DCDC_03, buf, 8);
-    vag_cnt5CD = (vag_cnt5CD + 1) & 0x0F;
+    mlb_dbc::DCDC_03::DC_IstModus_02_Encode(buf, mlb_state.DC_IstModus_02);
 }
 
-void VWMLBClass::msg3C0() // Klemmen_Status_01
+void VWMLBClass::msg3C0(uint8_t *buf) // Klemmen_Status_01
 {
-    uint8_t buf[8]{};
-    buf[1] = vag_cnt3C0;
-    buf[2] = (mlb_state.ZAS_Kl_S & 0x01) | ((mlb_state.ZAS_Kl_15 & 0x01) << 1) | ((mlb_state.ZAS_Kl_X & 0x01) << 2) |
-             ((mlb_state.ZAS_Kl_50_Startanforderung & 0x01) << 3);
-    buf[0] = vag_utils::vw_crc_calc(buf, 4, 0x3C0);
-    can->Send(0x3C0, buf, 4);
-    vag_cnt3C0 = (vag_cnt3C0 + 1) & 0x0F;
+    mlb_dbc::Klemmen_Status_01::ZAS_Kl_S_Encode(buf, mlb_state.ZAS_Kl_S);
+    mlb_dbc::Klemmen_Status_01::ZAS_Kl_15_Encode(buf, mlb_state.ZAS_Kl_15);
+    mlb_dbc::Klemmen_Status_01::ZAS_Kl_X_Encode(buf, mlb_state.ZAS_Kl_X);
+    mlb_dbc::Klemmen_Status_01::ZAS_Kl_50_Startanforderung_Encode(buf, mlb_state.ZAS_Kl_50_Startanforderung);
 }
 
-void VWMLBClass::msg1A1() // BMS_02 0x1A1
+void VWMLBClass::msg1A1(uint8_t *buf) // BMS_02 0x1A1
 {
-    uint8_t buf[8]{};
-    buf[1] = (mlb_state.BMS_MaxCharge_Curr_Offset & 0x0F) | ((mlb_state.BMS_MaxDischarge_Curr & 0x0F) << 4);
-    buf[2] = ((mlb_state.BMS_MaxDischarge_Curr >> 4) & 0x7F) | ((mlb_state.BMS_MaxCharge_Curr & 0x01) << 7);
-    buf[3] = (mlb_state.BMS_MaxCharge_Curr >> 1) & 0xFF;
-    buf[4] = ((mlb_state.BMS_MaxCharge_Curr >> 9) & 0x03) | ((mlb_state.BMS_Min_Batt_Volt & 0x3F) << 2);
-    buf[5] = ((mlb_state.BMS_Min_Batt_Volt >> 6) & 0x0F) | ((mlb_state.BMS_Min_Batt_Volt_Discharge & 0x0F) << 4);
-    buf[6] = ((mlb_state.BMS_Min_Batt_Volt_Discharge >> 4) & 0x3F) | ((mlb_state.BMS_Min_Batt_Volt_Charge & 0x03) << 6);
-    buf[7] = (mlb_state.BMS_Min_Batt_Volt_Charge >> 2) & 0xFF;
-    can->Send(ID_BMS_02, buf, 8);
+    mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Offset_Encode(buf, mlb_state.BMS_MaxCharge_Curr_Offset);
+    mlb_dbc::BMS_02::BMS_MaxDyn_EntladeStrom_02_Encode(buf, mlb_state.BMS_MaxDischarge_Curr);
+    mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Encode(buf, mlb_state.BMS_MaxCharge_Curr);
+    mlb_dbc::BMS_02::BMS_Min_EntladeSpannung_Encode(buf, mlb_state.BMS_Min_Batt_Volt);
+    mlb_dbc::BMS_02::BMS_MinDyn_EntladeSpannung_Encode(buf, mlb_state.BMS_Min_Batt_Volt_Discharge);
+    mlb_dbc::BMS_02::BMS_MinDyn_LadeSpannung_Encode(buf, mlb_state.BMS_Min_Batt_Volt_Charge);
 }
 
-void VWMLBClass::msg2B1() // MSG_TME_02   0x2B1
+void VWMLBClass::msg2B1(uint8_t *buf) // MSG_TME_02   0x2B1
 {
-    uint8_t buf[8]{};
-    can->Send(0x2B1, buf, 8);
+    // All signals zero
+    (void)buf;
 }
 
-void VWMLBClass::msg39D() // BMS_03 0x39D
+void VWMLBClass::msg39D(uint8_t *buf) // BMS_03 0x39D
 {
-    uint8_t buf[8]{};
-    buf[0] = mlb_state.BMS_OpenCircuit_Volts & 0xFF;
-    buf[1] = ((mlb_state.BMS_OpenCircuit_Volts >> 8) & 0x03) | ((mlb_state.BMS_Batt_Max_Volt & 0x0F) << 4);
-    buf[2] = ((mlb_state.BMS_Batt_Max_Volt >> 4) & 0x3F) | ((mlb_state.BMS_MaxDischarge_Curr & 0x03) << 6);
-    buf[3] = (mlb_state.BMS_MaxDischarge_Curr >> 2) & 0xFF;
-    buf[4] = ((mlb_state.BMS_MaxDischarge_Curr >> 10) & 0x01) | ((mlb_state.BMS_MaxCharge_Curr & 0x7F) << 1);
-    buf[5] = ((mlb_state.BMS_MaxCharge_Curr >> 7) & 0x0F) | ((mlb_state.BMS_Min_Batt_Volt_Discharge & 0x0F) << 4);
-    buf[6] = ((mlb_state.BMS_Min_Batt_Volt_Discharge >> 4) & 0x3F) | ((mlb_state.BMS_Min_Batt_Volt_Charge & 0x03) << 6);
-    buf[7] = (mlb_state.BMS_Min_Batt_Volt_Charge >> 2) & 0xFF;
-    can->Send(ID_BMS_03, buf, 8);
+    mlb_dbc::BMS_03::BMS_Leerlaufspannung_Encode(buf, mlb_state.BMS_OpenCircuit_Volts);
+    mlb_dbc::BMS_03::BMS_Max_LadeSpannung_Encode(buf, mlb_state.BMS_Batt_Max_Volt);
+    mlb_dbc::BMS_03::BMS_MaxPred_EntladeStrom_02_Encode(buf, mlb_state.BMS_MaxDischarge_Curr);
+    mlb_dbc::BMS_03::BMS_MaxPred_LadeStrom_02_Encode(buf, mlb_state.BMS_MaxCharge_Curr);
+    mlb_dbc::BMS_03::BMS_MinPred_EntladeSpannung_Encode(buf, mlb_state.BMS_Min_Batt_Volt_Discharge);
+    mlb_dbc::BMS_03::BMS_MinPred_LadeSpannung_Encode(buf, mlb_state.BMS_Min_Batt_Volt_Charge);
 }
 
-void VWMLBClass::msg509() // BMS_10 0x509
+void VWMLBClass::msg509(uint8_t *buf) // BMS_10 0x509
 {
-    uint8_t buf[8]{};
-    buf[0] = mlb_state.BMS_BattEnergy_Wh_HiRes & 0xFF;
-    buf[1] = ((mlb_state.BMS_BattEnergy_Wh_HiRes >> 8) & 0x7F) | ((mlb_state.BMS_MaxBattEnergy_Wh_HiRes & 0x01) << 7);
-    buf[2] = (mlb_state.BMS_MaxBattEnergy_Wh_HiRes >> 1) & 0xFF;
-    buf[3] = ((mlb_state.BMS_MaxBattEnergy_Wh_HiRes >> 9) & 0x3F) | ((mlb_state.BMS_SOC & 0x03) << 6);
-    buf[4] = ((mlb_state.BMS_SOC >> 2) & 0x3F) | ((mlb_state.BMS_ResidualEnergy_Wh & 0x03) << 6);
-    buf[5] = (mlb_state.BMS_ResidualEnergy_Wh >> 2) & 0xFF;
-    buf[6] = ((mlb_state.BMS_ResidualEnergy_Wh >> 10) & 0x03) | ((0x64 & 0x3F) << 2);
-    buf[7] = ((0x64 >> 6) & 0x01) | ((0x64 & 0x7F) << 1);
-    can->Send(ID_BMS_10, buf, 8);
+    mlb_dbc::BMS_10::BMS_Energieinhalt_HiRes_Encode(buf, mlb_state.BMS_BattEnergy_Wh_HiRes);
+    mlb_dbc::BMS_10::BMS_MaxEnergieinhalt_HiRes_Encode(buf, mlb_state.BMS_MaxBattEnergy_Wh_HiRes);
+    mlb_dbc::BMS_10::BMS_NutzbarerSOC_Encode(buf, mlb_state.BMS_SOC);
+    mlb_dbc::BMS_10::BMS_NutzbarerEnergieinhalt_Encode(buf, mlb_state.BMS_ResidualEnergy_Wh);
+    mlb_dbc::BMS_10::BMS_Pred_Entladeperformance_Encode(buf, 0x64);
+    mlb_dbc::BMS_10::BMS_Pred_Ladeperformance_Encode(buf, 0x64);
 }
 
-void VWMLBClass::msg552() // HVEM_05 0x552
+void VWMLBClass::msg552(uint8_t *buf) // HVEM_05 0x552
 {
-    uint8_t buf[8]{};
-    buf[0] = 0;
-    buf[1] = (mlb_state.HVEM_NVNachladen_Energie & 0x0F) << 4;
-    buf[2] = (mlb_state.HVEM_NVNachladen_Energie >> 4) & 0x0F;
-    buf[4] = (mlb_state.HVEM_Nachladen_Anf & 0x01) | ((mlb_state.HVEM_SollStrom_HV & 0x7F) << 1);
-    buf[5] = ((mlb_state.HVEM_SollStrom_HV >> 7) & 0x0F) | ((mlb_state.HVEM_MaxSpannung_HV & 0x0F) << 4);
-    buf[6] = (mlb_state.HVEM_MaxSpannung_HV >> 4) & 0x3F;
-    can->Send(ID_HVEM_05, buf, 8);
+    mlb_dbc::HVEM_05::HVEM_NVNachladen_Energie_Encode(buf, mlb_state.HVEM_NVNachladen_Energie);
+    mlb_dbc::HVEM_05::HVEM_Nachladen_Anf_Encode(buf, mlb_state.HVEM_Nachladen_Anf);
+    mlb_dbc::HVEM_05::HVEM_SollStrom_HV_Encode(buf, mlb_state.HVEM_SollStrom_HV);
+    mlb_dbc::HVEM_05::HVEM_MaxSpannung_HV_Encode(buf, mlb_state.HVEM_MaxSpannung_HV);
 }
 
-void VWMLBClass::msg5AC() // HVEM_02 0x5AC
+void VWMLBClass::msg5AC(uint8_t *buf) // HVEM_02 0x5AC
 {
-    uint8_t buf[8] = {0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    can->Send(ID_HVEM_02, buf, 8);
+    mlb_dbc::HVEM_02::HVEM_IstStrom_HVVerbraucher_Encode(buf, 0x7FF);
 }
 
-void VWMLBClass::msg583() // ZV_02 0x583
+void VWMLBClass::msg583(uint8_t *buf) // ZV_02 0x583
 {
-    uint8_t buf[8]{};
-    buf[2] = (mlb_state.ZV_verriegelt_intern_ist & 0x01) |
-             ((mlb_state.ZV_verriegelt_extern_ist & 0x01) << 1) |
-             ((mlb_state.ZV_verriegelt_intern_soll & 0x01) << 2) |
-             ((mlb_state.ZV_verriegelt_extern_soll & 0x01) << 3);
-    buf[7] = (mlb_state.ZV_verriegelt_soll & 0x03) << 6;
-    can->Send(ID_ZV_02, buf, 8);
+    mlb_dbc::ZV_02::ZV_verriegelt_intern_ist_Encode(buf, mlb_state.ZV_verriegelt_intern_ist);
+    mlb_dbc::ZV_02::ZV_verriegelt_extern_ist_Encode(buf, mlb_state.ZV_verriegelt_extern_ist);
+    mlb_dbc::ZV_02::ZV_verriegelt_intern_soll_Encode(buf, mlb_state.ZV_verriegelt_intern_soll);
+    mlb_dbc::ZV_02::ZV_verriegelt_extern_soll_Encode(buf, mlb_state.ZV_verriegelt_extern_soll);
+    mlb_dbc::ZV_02::ZV_verriegelt_soll_Encode(buf, mlb_state.ZV_verriegelt_soll);
 }
 
-void VWMLBClass::msg17B() // FCU_02 0x17B
+void VWMLBClass::msg17B(uint8_t *buf) // FCU_02 0x17B
 {
-    uint8_t buf[8]{};
-    buf[5] = (mlb_state.FCU_TK_Betankung_Anforderung & 0x01) << 3; // DBC SG_ FCU_TK_Betankung_Anforderung : 43|1@1+
-    buf[7] = mlb_state.FCU_TK_Freigabe_Tankklappe & 0x03; // DBC SG_ FCU_TK_Freigabe_Tankklappe : 56|2@1+
-    can->Send(ID_FCU_02, buf, 8);
+    mlb_dbc::FCU_02::FCU_TK_Betankung_Anforderung_Encode(buf, mlb_state.FCU_TK_Betankung_Anforderung);
+    mlb_dbc::FCU_02::FCU_TK_Freigabe_Tankklappe_Encode(buf, mlb_state.FCU_TK_Freigabe_Tankklappe);
 }
 
-void VWMLBClass::msg59E() // BMS_06 0x59E
+void VWMLBClass::msg59E(uint8_t *buf) // BMS_06 0x59E
 {
-    uint8_t buf[8]{};
-    buf[2] = mlb_state.BMS_Batt_Temp & 0xFF;
-    buf[3] = mlb_state.BMS_CurrBatt_Temp & 0xFF;
-    buf[7] = mlb_state.BMS_CoolantTemp_Act & 0xFF;
-    can->Send(ID_BMS_06, buf, 8);
+    mlb_dbc::BMS_06::BMS_Temperatur_Encode(buf, mlb_state.BMS_Batt_Temp);
+    mlb_dbc::BMS_06::BMS_IstVorlaufTemperatur_Encode(buf, mlb_state.BMS_CurrBatt_Temp);
+    mlb_dbc::BMS_06::BMS_IstRuecklaufTemperatur_02_Encode(buf, mlb_state.BMS_CoolantTemp_Act);
 }
 
-void VWMLBClass::msg485() // NavData_02 0x485
+void VWMLBClass::msg485(uint8_t *buf) // NavData_02 0x485
 {
-    uint8_t buf[8]{};
-    buf[4] = mlb_state.UnixTime & 0xFF;
-    buf[5] = (mlb_state.UnixTime >> 8) & 0xFF;
-    buf[6] = (mlb_state.UnixTime >> 16) & 0xFF;
-    buf[7] = (mlb_state.UnixTime >> 24) & 0xFF;
-    can->Send(ID_NAVDATA_02, buf, 8);
+    mlb_dbc::NavData_02::ND_UTC_Encode(buf, mlb_state.UnixTime);
 }
 
-void VWMLBClass::msg1A555548() // ORU_01 0x1A555548
+void VWMLBClass::msg1A555548(uint8_t *buf) // ORU_01 0x1A555548
 {
-    uint8_t buf[8]{};
-    can->Send(ID_ORU_01, buf, 8);
+    // All signals zero
+    (void)buf;
 }
 
-void VWMLBClass::msg1A5555AD() // Authentic_Time_01 0x1A5555AD
+void VWMLBClass::msg1A5555AD(uint8_t *buf) // Authentic_Time_01 0x1A5555AD
 {
-    uint8_t buf[8]{};
-    buf[4] = mlb_state.UnixTime & 0xFF;
-    buf[5] = (mlb_state.UnixTime >> 8) & 0xFF;
-    buf[6] = (mlb_state.UnixTime >> 16) & 0xFF;
-    buf[7] = (mlb_state.UnixTime >> 24) & 0xFF;
-    can->Send(ID_AUTHENTIC_TIME_01, buf, 8);
+    mlb_dbc::Authentic_Time_01::AT_VALID_TIME_Encode(buf, mlb_state.UnixTime);
 }
 
-void VWMLBClass::msg96A955EB() // BMS_09 0x96A955EB
+void VWMLBClass::msg96A955EB(uint8_t *buf) // BMS_09 0x96A955EB
 {
-    uint8_t buf[8]{};
-    buf[2] = ((mlb_state.BMS_HV_Auszeit_Status & 0x03) << 5) | ((mlb_state.BMS_HV_Auszeit & 0x01) << 7);
-    buf[3] = (mlb_state.BMS_HV_Auszeit >> 1) & 0xFF;
-    buf[4] = mlb_state.BMS_Kapazitaet & 0xFF;
-    buf[5] = ((mlb_state.BMS_Kapazitaet >> 8) & 0x07) | ((mlb_state.BMS_SOC_Kaltstart & 0x1F) << 3);
-    buf[6] = ((mlb_state.BMS_SOC_Kaltstart >> 5) & 0x3F) | ((mlb_state.BMS_max_Grenz_SOC & 0x03) << 6);
-    buf[7] = ((mlb_state.BMS_max_Grenz_SOC >> 2) & 0x07) | ((mlb_state.BMS_min_Grenz_SOC & 0x1F) << 3);
-    can->Send(ID_BMS_09, buf, 8);
+    mlb_dbc::BMS_09::BMS_HV_Auszeit_Status_Encode(buf, mlb_state.BMS_HV_Auszeit_Status);
+    mlb_dbc::BMS_09::BMS_HV_Auszeit_Encode(buf, mlb_state.BMS_HV_Auszeit);
+    mlb_dbc::BMS_09::BMS_Kapazitaet_Encode(buf, mlb_state.BMS_Kapazitaet);
+    mlb_dbc::BMS_09::BMS_SOC_Kaltstart_Encode(buf, mlb_state.BMS_SOC_Kaltstart);
+    mlb_dbc::BMS_09::BMS_max_Grenz_SOC_Encode(buf, mlb_state.BMS_max_Grenz_SOC);
+    mlb_dbc::BMS_09::BMS_min_Grenz_SOC_Encode(buf, mlb_state.BMS_min_Grenz_SOC);
 }
 
-void VWMLBClass::msg96A954A6() // BMS_11 0x96A954A6
+void VWMLBClass::msg96A954A6(uint8_t *buf) // BMS_11 0x96A954A6
 {
-    uint8_t buf[8]{};
-    buf[3] = mlb_state.BMS_BattCell_Temp_Max & 0xFF;
-    buf[4] = mlb_state.BMS_BattCell_Temp_Min & 0xFF;
-    buf[5] = mlb_state.BMS_BattCell_MV_Max & 0xFF;
-    buf[6] = ((mlb_state.BMS_BattCell_MV_Max >> 8) & 0x0F) | ((mlb_state.BMS_BattCell_MV_Min & 0x0F) << 4);
-    buf[7] = (mlb_state.BMS_BattCell_MV_Min >> 4) & 0xFF;
-    can->Send(ID_BMS_11, buf, 8);
+    mlb_dbc::BMS_11::BMS_IstTemperatur_hoechste_Encode(buf, mlb_state.BMS_BattCell_Temp_Max);
+    mlb_dbc::BMS_11::BMS_IstTemperatur_niedrigste_Encode(buf, mlb_state.BMS_BattCell_Temp_Min);
+    mlb_dbc::BMS_11::BMS_IstZellspannung_hoechste_Encode(buf, mlb_state.BMS_BattCell_MV_Max);
+    mlb_dbc::BMS_11::BMS_IstZellspannung_niedrigste_Encode(buf, mlb_state.BMS_BattCell_MV_Min);
 }
 
-void VWMLBClass::msg9A555539() // BMS_16 0x9A555539
+void VWMLBClass::msg9A555539(uint8_t *buf) // BMS_16 0x9A555539
 {
-    uint8_t buf[8]{};
-    can->Send(ID_BMS_16, buf, 8);
+    // All signals zero
+    (void)buf;
 }
 
-void VWMLBClass::msg9A555552() // BMS_27 0x9A555552
+void VWMLBClass::msg9A555552(uint8_t *buf) // BMS_27 0x9A555552
 {
-    uint8_t buf[8]{};
-    buf[3] = (mlb_state.BMS_SOC_ChargeLim & 0x3F) << 2;
-    buf[4] = ((mlb_state.BMS_SOC_ChargeLim >> 6) & 0x01) | ((mlb_state.BMS_EnergyCount & 0x0F) << 1) |
-             ((mlb_state.BMS_EnergyReq_Full & 0x07) << 5);
-    buf[5] = (mlb_state.BMS_EnergyReq_Full >> 3) & 0xFF;
-    buf[6] = mlb_state.BMS_ChargePowerMax & 0xFF;
-    buf[7] = ((mlb_state.BMS_ChargePowerMax >> 8) & 0x0F) | ((mlb_state.BMS_ChargeEnergyCount & 0x0F) << 4);
-    can->Send(ID_BMS_27, buf, 8);
+    mlb_dbc::BMS_27::BMS_LadegrenzeAntw_SOC_Encode(buf, mlb_state.BMS_SOC_ChargeLim);
+    mlb_dbc::BMS_27::BMS_EnergieAntw_Zaehler_Encode(buf, mlb_state.BMS_EnergyCount);
+    mlb_dbc::BMS_27::BMS_EnergieAntw_Energie_Encode(buf, mlb_state.BMS_EnergyReq_Full);
+    mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Leistung_Encode(buf, mlb_state.BMS_ChargePowerMax);
+    mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Zaehler_Encode(buf, mlb_state.BMS_ChargeEnergyCount);
 }
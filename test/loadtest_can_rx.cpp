@@ -0,0 +1,242 @@
+#include "can_rx.h"
+#include "can_dispatch.h"
+#include "can_rx_stats.h"
+#include "can_rate_limit.h"
+#include "can_gateway.h"
+#include "rx_supervisor.h"
+#include "teensyBMS.h"
+#include "TeslaDCDC.h"
+#include "vw_mlb_charger.h"
+#include "mVCUIntegration.h"
+#include "params.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Replays CAN2 at 100% bus load at 500 kbit/s through the receive path of
+// the firmware (CanRx, CanRateLimit, CanDispatch, CanRxStats and the four decoders) and
+// projects the cost onto the Cortex-M3 at 72 MHz.
+//
+// Host timings are scaled by a fixed slowdown factor (host ns -> M3 ns) to get
+// the projection, calibrate it against can_rx_stats_cyc on the target.
+// Usage: loadtest_can_rx [max projected load %] [slowdown factor]
+
+#define BITRATE 500000
+#define M3_MHZ 72
+// Data frames with 8 bytes including the interframe space, without stuff bits
+#define STD_FRAME_BITS 111
+#define EXT_FRAME_BITS 131
+#define REPLAY_ROUNDS 32 // multiple of 16 keeps the E2E counters consecutive
+#define REPEAT 5
+
+struct Source {
+    uint32_t id;
+    int weight;               // frames per round
+    E2EProtection* e2e;       // signs the payload like the real sender, or nullptr
+};
+
+struct Frame {
+    uint32_t id;
+    uint32_t data[2];
+};
+
+static TeensyBMS bms;
+static TeslaDCDC dcdc;
+static VWMLBClass mlb;
+static mVCUIntegration mvcu;
+static CanHardware can;
+
+static E2EProtection bmsTx[BMS_MSG_COUNT] = {
+    { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x41A },
+    { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x41B },
+    { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x41C },
+    { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x41D },
+    { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x41E }
+};
+static E2EProtection mvcuTx { E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x43A };
+
+static const uint32_t mlbIds[] = {
+    0x488, 0x53C, 0x564, 0x565, 0x67E,
+    0x1A55549D, 0x1A555515, 0x12DD5472, 0x12DD5491, 0x1A55554D, 0x17F00044
+};
+
+// Same order as SetCanFilters() in main.cpp
+static void SetupModules()
+{
+    CanDispatch::BeginUpdate();
+    CanRxStats::Reset();
+    CanRateLimit::SetBudget(Param::GetInt(Param::can_rx_limit), Param::GetInt(Param::can_rx_burst));
+    CanRateLimit::Reset();
+    RxSupervisor::BeginUpdate();
+    dcdc.SetCanInterface(&can);
+    bms.SetCanInterface(&can);
+    mlb.SetCanInterface(&can);
+    mvcu.SetCanInterface(&can);
+    CanDispatch::EndUpdate();
+}
+
+static std::vector<Frame> BuildMix(const std::vector<Source>& sources)
+{
+    std::vector<Frame> frames;
+    uint32_t seed = 12345;
+
+    for (int round = 0; round < REPLAY_ROUNDS; round++) {
+        for (const Source& s : sources) {
+            for (int n = 0; n < s.weight; n++) {
+                Frame f;
+                uint8_t bytes[8];
+
+                for (int i = 0; i < 8; i++) {
+                    seed = seed * 1103515245 + 12345;
+                    bytes[i] = seed >> 16;
+                }
+                if (s.e2e)
+                    s.e2e->Protect(bytes, 8);
+                f.id = s.id;
+                memcpy(f.data, bytes, 8);
+                frames.push_back(f);
+            }
+        }
+    }
+    return frames;
+}
+
+// Best of REPEAT runs, the 10 ms task drains the queue in deferred mode
+static double Replay(const std::vector<Frame>& frames, bool deferred, double fps)
+{
+    double best = 1e30;
+
+    Param::SetInt(Param::can_rx_deferred, deferred);
+
+    for (int r = 0; r < REPEAT; r++) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < frames.size(); i++) {
+            uint32_t data[2] = { frames[i].data[0], frames[i].data[1] };
+            const uint32_t time = (uint32_t)(i * 1000 / fps);
+
+            CanRx::Receive(1, frames[i].id, data, 8, time); // CAN2
+            if (deferred && (i & 15) == 15)
+                CanRx::ProcessQueue();
+        }
+        CanRx::ProcessQueue();
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / frames.size();
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    const double maxLoad = argc > 1 ? atof(argv[1]) : 5.0;
+    const double factor = argc > 2 ? atof(argv[2]) : 30.0;
+    bool failed = false;
+
+    Param::SetInt(Param::can_rx_stats, 1);
+    SetupModules();
+
+    std::vector<Source> bmsMix, dcdcMix, mlbMix, mvcuMix, foreignMix, allMix;
+    for (uint32_t i = 0; i < BMS_MSG_COUNT; i++)
+        bmsMix.push_back({ BMS_MSG_FIRST_ID + i, 1, &bmsTx[i] });
+    dcdcMix.push_back({ 0x210, 1, nullptr });
+    for (uint32_t id : mlbIds)
+        mlbMix.push_back({ id, 1, nullptr });
+    mvcuMix.push_back({ 0x43A, 1, &mvcuTx });
+    // Admitted by a widened filter mask but registered by nobody
+    for (uint32_t id = 0x418; id < 0x420; id++) {
+        if (id < BMS_MSG_FIRST_ID || id >= BMS_MSG_FIRST_ID + BMS_MSG_COUNT)
+            foreignMix.push_back({ id, 1, nullptr });
+    }
+    // Everything at once, the BMS at twice the rate of the others
+    for (uint32_t i = 0; i < BMS_MSG_COUNT; i++)
+        allMix.push_back({ BMS_MSG_FIRST_ID + i, 2, &bmsTx[i] });
+    allMix.insert(allMix.end(), dcdcMix.begin(), dcdcMix.end());
+    allMix.insert(allMix.end(), mlbMix.begin(), mlbMix.end());
+    allMix.insert(allMix.end(), mvcuMix.begin(), mvcuMix.end());
+    allMix.insert(allMix.end(), foreignMix.begin(), foreignMix.end());
+    // A single BMS ID at the full bus rate, the limiter drops nearly all of it
+    std::vector<Source> babblerMix;
+    babblerMix.push_back({ BMS_MSG_FIRST_ID, 1, &bmsTx[0] });
+
+    struct Case {
+        const char* name;
+        const std::vector<Source>* mix;
+        bool deferred;
+        int limit; // can_rx_limit
+    } cases[] = {
+        { "TeensyBMS", &bmsMix, false, 0 },
+        { "TeslaDCDC", &dcdcMix, false, 0 },
+        { "VWMLB", &mlbMix, false, 0 },
+        { "mVCU", &mvcuMix, false, 0 },
+        { "unmatched", &foreignMix, false, 0 },
+        { "mixed", &allMix, false, 0 },
+        { "mixed deferred", &allMix, true, 0 },
+        { "babbler limited", &babblerMix, false, 500 },
+    };
+
+    printf("CAN2 %d kbit/s 100%% load, M3 %d MHz, host->M3 factor %.0f, limit %.0f%%\n",
+           BITRATE / 1000, M3_MHZ, factor, maxLoad);
+    printf("%-16s %8s %10s %10s %10s %8s\n", "mix", "host ns", "frames/s", "budget us", "M3 cyc", "M3 load");
+
+    for (const Case& c : cases) {
+        // E2E and dispatch state is rebuilt, so every mix starts from the same point
+        Param::SetInt(Param::can_rx_limit, c.limit);
+        Param::SetInt(Param::can_rx_burst, 10);
+        SetupModules();
+        for (int i = 0; i < BMS_MSG_COUNT; i++)
+            bmsTx[i].Reset();
+        mvcuTx.Reset();
+
+        const std::vector<Frame> frames = BuildMix(*c.mix);
+        int ext = 0;
+        for (const Frame& f : frames)
+            ext += f.id > 0x7FF;
+
+        const double bits = STD_FRAME_BITS + (double)ext / frames.size() * (EXT_FRAME_BITS - STD_FRAME_BITS);
+        const double fps = BITRATE / bits;
+        const double budgetNs = 1e9 / fps;
+        const double ns = Replay(frames, c.deferred, fps);
+        const double m3Ns = ns * factor;
+        const double load = 100.0 * m3Ns / budgetNs;
+        const bool over = load > maxLoad;
+
+        printf("%-16s %8.1f %10.0f %10.1f %10.0f %7.1f%%%s\n", c.name, ns, fps, budgetNs / 1000,
+               m3Ns * M3_MHZ / 1000, load, over ? "  FAIL" : "");
+        failed |= over;
+    }
+
+    // The limiter runs ahead of the gateway, a babbler is forwarded within its budget only
+    CanHardware* interfaces[CAN_GATEWAY_IFACES] = { &can, &can, nullptr };
+    Param::SetInt(Param::can_rx_limit, 500);
+    SetupModules();
+    bmsTx[0].Reset();
+    CanGateway::SetInterfaces(interfaces);
+    CanGateway::BeginUpdate();
+    CanGateway::AddRoute(1, BMS_MSG_FIRST_ID, 0, 0, 0, false);
+    CanGateway::EndUpdate();
+
+    const std::vector<Frame> babble = BuildMix(babblerMix);
+    for (const Frame& f : babble) {
+        uint32_t data[2] = { f.data[0], f.data[1] };
+        CanRx::Receive(1, f.id, data, 8, 0);
+    }
+
+    const uint32_t admitted = babble.size() - CanRateLimit::GetDropped();
+    if (admitted == babble.size() || CanGateway::GetForwarded() != admitted) {
+        printf("Gateway forwarded %u frames, %u admitted\n", CanGateway::GetForwarded(), admitted);
+        failed = true;
+    }
+
+    // Frames failing E2E would skip the decoders and make the numbers meaningless
+    for (E2EProtection* link = E2EProtection::First(); link; link = link->GetNext()) {
+        if (link->GetDirection() == E2EProtection::DIR_RX && link->GetStats().crcErrors > 0) {
+            printf("E2E errors on %x, synthetic frames are invalid\n", link->GetId());
+            failed = true;
+        }
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,1543 @@
+// Generated by tools/dbc_codegen from MLBevo_Gen2_MLBevo_HCAN_KMatrix_V8.18.01F_20190718_SE.dbc
+// DBC layout of every signal in mlb_dbc.h, used by the host tests
+#ifndef MLB_DBC_LAYOUT_H
+#define MLB_DBC_LAYOUT_H
+
+#include "mlb_dbc.h"
+
+struct MlbDbcSignal
+{
+    uint32_t id;
+    const char* name;
+    uint8_t startBit;
+    uint8_t length;
+    bool intel;
+    bool isSigned;
+    double factor;
+    double offset;
+    uint64_t (*raw)(const uint8_t*);
+    double (*phys)(const uint8_t*);
+    void (*encode)(uint8_t*, uint64_t);
+};
+
+static const MlbDbcSignal mlbDbcSignals[] =
+{
+    { 0x488, "HVLM_MaxLadeLeistung", 12, 10, true, false, 250, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_06::HVLM_MaxLadeLeistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_06::HVLM_MaxLadeLeistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_06::HVLM_MaxLadeLeistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x488, "HVLM_MaxSpannung_DCLS", 22, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_06::HVLM_MaxSpannung_DCLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_06::HVLM_MaxSpannung_DCLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_06::HVLM_MaxSpannung_DCLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x488, "HVLM_IstStrom_DCLS", 32, 9, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_06::HVLM_IstStrom_DCLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_06::HVLM_IstStrom_DCLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_06::HVLM_IstStrom_DCLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x488, "HVLM_MaxStrom_DCLS", 41, 9, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_06::HVLM_MaxStrom_DCLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_06::HVLM_MaxStrom_DCLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_06::HVLM_MaxStrom_DCLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x488, "HVLM_MinSpannung_DCLS", 50, 9, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_06::HVLM_MinSpannung_DCLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_06::HVLM_MinSpannung_DCLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_06::HVLM_MinSpannung_DCLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x488, "HVLM_MinStrom_DCLS", 59, 5, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_06::HVLM_MinStrom_DCLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_06::HVLM_MinStrom_DCLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_06::HVLM_MinStrom_DCLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_04_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_04_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_04_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_04_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_04_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_04_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_04_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_04_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_STH_Betriebsmodus", 12, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_STH_Betriebsmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_STH_Betriebsmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_STH_Betriebsmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Standklima_Timer_Status", 15, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Standklima_Timer_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Standklima_Timer_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Standklima_Timer_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_HVEM_MaxLeistung", 16, 9, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_HVEM_MaxLeistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_HVEM_MaxLeistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_HVEM_MaxLeistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Status_Netz", 25, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Status_Netz_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Status_Netz(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Status_Netz_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Anf_Ladescreen", 26, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Anf_Ladescreen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Anf_Ladescreen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Anf_Ladescreen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Ladeart", 27, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Ladeart_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Ladeart(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Ladeart_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_VK_STH_Einsatz", 29, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_VK_STH_Einsatz_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_VK_STH_Einsatz(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_VK_STH_Einsatz_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_VK_Modus", 32, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_VK_Modus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_VK_Modus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_VK_Modus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_IstModus_02", 34, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_IstModus_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_IstModus_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_IstModus_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_HV_Anf", 36, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_HV_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_HV_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_HV_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Fehlerstatus", 38, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Fehlerstatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Fehlerstatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Fehlerstatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Anforderung_HMS", 41, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Anforderung_HMS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Anforderung_HMS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Anforderung_HMS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Parken_beibehalten_HMS", 44, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Parken_beibehalten_HMS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Parken_beibehalten_HMS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Parken_beibehalten_HMS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_AWC_Sollmodus", 48, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_AWC_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_AWC_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_AWC_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_Stecker_Status", 51, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_Stecker_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_Stecker_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_Stecker_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_LadeAnforderung", 53, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_LadeAnforderung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_LadeAnforderung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_LadeAnforderung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x53C, "HVLM_MaxBatLadestromHV", 56, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_04::HVLM_MaxBatLadestromHV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_04::HVLM_MaxBatLadestromHV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_04::HVLM_MaxBatLadestromHV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_01_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_01_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_01_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_01_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_01_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_01_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_01_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_01_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_IstModus", 12, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_IstModus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_IstModus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_IstModus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_AC_Istspannung", 15, 9, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_AC_Istspannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_AC_Istspannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_AC_Istspannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_IstSpannung_HV", 24, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_IstSpannung_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_IstSpannung_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_IstSpannung_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_IstStrom_HV", 34, 10, true, false, 0.20000000000000001, -102,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_IstStrom_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_IstStrom_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_IstStrom_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_Status_Spgfreiheit", 44, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_Status_Spgfreiheit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_Status_Spgfreiheit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_Status_Spgfreiheit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_Temperatur", 48, 8, true, false, 1, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_Temperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_Temperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_Temperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x564, "LAD_Verlustleistung", 56, 8, true, false, 20, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_01::LAD_Verlustleistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_01::LAD_Verlustleistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_01::LAD_Verlustleistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_HV_Abstellzeit", 0, 8, true, false, 4, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_HV_Abstellzeit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_HV_Abstellzeit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_HV_Abstellzeit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_Ladesystemhinweise", 8, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_Ladesystemhinweise_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_Ladesystemhinweise(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_Ladesystemhinweise_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_Schluessel_Anfrage", 10, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_Schluessel_Anfrage_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_Schluessel_Anfrage(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_Schluessel_Anfrage_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_Zustand_LED", 12, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_Zustand_LED_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_Zustand_LED(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_Zustand_LED_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_MaxStrom_Netz", 24, 7, true, false, 0.5, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_MaxStrom_Netz_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_MaxStrom_Netz(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_MaxStrom_Netz_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_LG_Sollmodus", 31, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_LG_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_LG_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_LG_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_FreigabeTankdeckel", 32, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_FreigabeTankdeckel_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_FreigabeTankdeckel(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_FreigabeTankdeckel_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_Stecker_Verriegeln", 34, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_Stecker_Verriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_Stecker_Verriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_Stecker_Verriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_Start_Spannungsmessung_DCLS", 36, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_Start_Spannungsmessung_DCLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_Start_Spannungsmessung_DCLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_Start_Spannungsmessung_DCLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "PnC_Trigger_OBC_cGW", 38, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::PnC_Trigger_OBC_cGW_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::PnC_Trigger_OBC_cGW(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::PnC_Trigger_OBC_cGW_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_FreigabeKlimatisierung", 42, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_FreigabeKlimatisierung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_FreigabeKlimatisierung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_FreigabeKlimatisierung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_Ladetexte", 49, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_Ladetexte_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_Ladetexte(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_Ladetexte_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_IsoMessung_Anf", 53, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_IsoMessung_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_IsoMessung_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_IsoMessung_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x565, "HVLM_IstSpannung_HV", 54, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_03::HVLM_IstSpannung_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_03::HVLM_IstSpannung_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_03::HVLM_IstSpannung_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_02_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_02_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_02_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_02_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_02_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_02_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_02_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_02_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Abregelung_Temperatur", 12, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Abregelung_Temperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Abregelung_Temperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Abregelung_Temperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Abregelung_IU_Ein_Aus", 13, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Abregelung_IU_Ein_Aus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Abregelung_IU_Ein_Aus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Abregelung_IU_Ein_Aus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Abregelung_BuchseTemp", 14, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Abregelung_BuchseTemp_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Abregelung_BuchseTemp(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Abregelung_BuchseTemp_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_MaxLadLeistung_HV", 16, 9, true, false, 100, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_PRX_Stromlimit", 32, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_PRX_Stromlimit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_PRX_Stromlimit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_PRX_Stromlimit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_CP_Erkennung", 35, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_CP_Erkennung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_CP_Erkennung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_CP_Erkennung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Stecker_Verriegelt", 36, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Stecker_Verriegelt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Stecker_Verriegelt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Stecker_Verriegelt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Kuehlbedarf", 38, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Kuehlbedarf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Kuehlbedarf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Kuehlbedarf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_MaxLadLeistung_HV_Offset", 57, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV_Offset_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV_Offset(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_MaxLadLeistung_HV_Offset_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Warnzustand", 62, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Warnzustand_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Warnzustand(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Warnzustand_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x67E, "LAD_Fehlerzustand", 63, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::LAD_02::LAD_Fehlerzustand_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::LAD_02::LAD_Fehlerzustand(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::LAD_02::LAD_Fehlerzustand_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55549D, "HVLM_Funktion_Dauer_BattKond", 54, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_08::HVLM_Funktion_Dauer_BattKond_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_08::HVLM_Funktion_Dauer_BattKond(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_08::HVLM_Funktion_Dauer_BattKond_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55549D, "HVLM_BattKond_Anf", 55, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_08::HVLM_BattKond_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_08::HVLM_BattKond_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_08::HVLM_BattKond_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55549D, "HVLM_Dauer_Klima_02", 58, 6, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_08::HVLM_Dauer_Klima_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_08::HVLM_Dauer_Klima_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_08::HVLM_Dauer_Klima_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A555515, "HVLM_AWC_Sollstrom", 55, 9, true, false, 0.10000000000000001, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_09::HVLM_AWC_Sollstrom_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_09::HVLM_AWC_Sollstrom(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_09::HVLM_AWC_Sollstrom_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_RtmWarnLadeverbindung", 31, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_RtmWarnLadeverbindung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_RtmWarnLadeverbindung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_RtmWarnLadeverbindung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_RtmWarnLadesystem", 34, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_RtmWarnLadesystem_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_RtmWarnLadesystem(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_RtmWarnLadesystem_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_RtmWarnLadestatus", 37, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_RtmWarnLadestatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_RtmWarnLadestatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_RtmWarnLadestatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_RtmWarnLadeKommunikation", 40, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_RtmWarnLadeKommunikation_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_RtmWarnLadeKommunikation(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_RtmWarnLadeKommunikation_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_Ladeanzeige_Anf", 43, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_Ladeanzeige_Status", 44, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_Ladeanzeige_Rampzeit", 46, 4, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Rampzeit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Rampzeit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Rampzeit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_Ladeanzeige_Intens_Heck", 50, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Heck_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Heck(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Heck_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5472, "HVLM_Ladeanzeige_Intens_Front", 57, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Front_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Front(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_10::HVLM_Ladeanzeige_Intens_Front_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5491, "HVLM_11_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_11::HVLM_11_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_11::HVLM_11_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_11::HVLM_11_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5491, "HVLM_11_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_11::HVLM_11_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_11::HVLM_11_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_11::HVLM_11_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5491, "HVLM_HVLB_SollSpannung_HVLS", 12, 12, true, false, 0.25, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_11::HVLM_HVLB_SollSpannung_HVLS_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_11::HVLM_HVLB_SollSpannung_HVLS(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_11::HVLM_HVLB_SollSpannung_HVLS_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5491, "HVLM_HVLB_Status", 24, 12, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_11::HVLM_HVLB_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_11::HVLM_HVLB_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_11::HVLM_HVLB_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x12DD5491, "HVLM_HVLB_SollModus", 36, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_11::HVLM_HVLB_SollModus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_11::HVLM_HVLB_SollModus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_11::HVLM_HVLB_SollModus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_PlanAnfr_Leistung", 0, 12, true, false, 200, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_PlanAnfr_Leistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_PlanAnfr_Leistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_PlanAnfr_Leistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_PlanAnfr_Zaehler", 12, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_PlanAnfr_Zaehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_PlanAnfr_Zaehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_PlanAnfr_Zaehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_PlanAnfr_Dauer", 16, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_PlanAnfr_Dauer_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_PlanAnfr_Dauer(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_PlanAnfr_Dauer_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_PlanAnfr_Ladeart", 26, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_PlanAnfr_Ladeart_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_PlanAnfr_Ladeart(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_PlanAnfr_Ladeart_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_EnergieAnfr_SocStart", 29, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocStart_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocStart(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocStart_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_EnergieAnfr_SocZiel", 36, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocZiel_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocZiel(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_EnergieAnfr_SocZiel_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_EnergieAnfr_Zaehler", 43, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_EnergieAnfr_Zaehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_EnergieAnfr_Zaehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_EnergieAnfr_Zaehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_LadegrenzeAnfr_Leistung", 48, 12, true, false, 200, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Leistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Leistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Leistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A55554D, "HVLM_LadegrenzeAnfr_Zaehler", 60, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Zaehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Zaehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVLM_15::HVLM_LadegrenzeAnfr_Zaehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "LG_KompSchutz", 0, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::LG_KompSchutz_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::LG_KompSchutz(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::LG_KompSchutz_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "LG_Abschaltstufe", 1, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::LG_Abschaltstufe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::LG_Abschaltstufe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::LG_Abschaltstufe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "LG_Transport_Mode", 2, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::LG_Transport_Mode_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::LG_Transport_Mode(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::LG_Transport_Mode_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "LG_Nachlauftyp", 4, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::LG_Nachlauftyp_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::LG_Nachlauftyp(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::LG_Nachlauftyp_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "LG_SNI", 8, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::LG_SNI_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::LG_SNI(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::LG_SNI_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "KN_Ladegeraet_ECUKnockOutTimer", 32, 6, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOutTimer_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOutTimer(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOutTimer_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "KN_Ladegeraet_BusKnockOut", 38, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOut_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOut(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOut_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "KN_Ladegeraet_BusKnockOutTimer", 40, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOutTimer_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOutTimer(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_BusKnockOutTimer_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "NM_Ladegeraet_Wakeup", 48, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::NM_Ladegeraet_Wakeup_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::NM_Ladegeraet_Wakeup(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::NM_Ladegeraet_Wakeup_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "KN_Ladegeraet_ECUKnockOut", 56, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOut_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOut(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::KN_Ladegeraet_ECUKnockOut_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "NMH_Ladegeraet_Lokalaktiv", 61, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Lokalaktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Lokalaktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Lokalaktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "NMH_Ladegeraet_Subsystemaktiv", 62, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Subsystemaktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Subsystemaktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::NMH_Ladegeraet_Subsystemaktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17F00044, "LG_KD_Fehler", 63, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::KN_Ladegeraet::LG_KD_Fehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::KN_Ladegeraet::LG_KD_Fehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::KN_Ladegeraet::LG_KD_Fehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_01_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_01_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_01_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_01_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_01_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_01_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_01_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_01_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_FT_verriegeln", 12, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_FT_verriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_FT_verriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_FT_verriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_FT_entriegeln", 13, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_FT_entriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_FT_entriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_FT_entriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_BT_verriegeln", 14, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_BT_verriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_BT_verriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_BT_verriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_BT_entriegeln", 15, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_BT_entriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_BT_entriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_BT_entriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_HFS_verriegeln", 16, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_HFS_verriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_HFS_verriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_HFS_verriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_HFS_entriegeln", 17, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_HFS_entriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_HFS_entriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_HFS_entriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_HBFS_verriegeln", 18, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_HBFS_verriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_HBFS_verriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_HBFS_verriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_HBFS_entriegeln", 19, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_HBFS_entriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_HBFS_entriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_HBFS_entriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zentral_safen", 20, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zentral_safen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zentral_safen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zentral_safen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zentral_entsafen", 21, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zentral_entsafen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zentral_entsafen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zentral_entsafen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_Spg_Anklappen", 22, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_Spg_Anklappen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_Spg_Anklappen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_Spg_Anklappen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_Softtouch_betaetigt", 23, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_Softtouch_betaetigt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_Softtouch_betaetigt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_Softtouch_betaetigt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_LED_Steuerung", 24, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_LED_Steuerung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_LED_Steuerung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_LED_Steuerung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_LED_Uebernahme", 25, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_LED_Uebernahme_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_LED_Uebernahme(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_LED_Uebernahme_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_auf_FT", 26, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_auf_FT_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_auf_FT(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_auf_FT_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zu_FT", 27, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zu_FT_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zu_FT(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zu_FT_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_auf_BT", 28, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_auf_BT_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_auf_BT(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_auf_BT_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zu_BT", 29, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zu_BT_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zu_BT(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zu_BT_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_auf_Kessy", 30, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_auf_Kessy_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_auf_Kessy(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_auf_Kessy_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zu_Kessy", 31, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zu_Kessy_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zu_Kessy(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zu_Kessy_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_auf_Funk", 32, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_auf_Funk_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_auf_Funk(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_auf_Funk_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zu_Funk", 33, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zu_Funk_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zu_Funk(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zu_Funk_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "VIP_Sensor_betaetigt", 34, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::VIP_Sensor_betaetigt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::VIP_Sensor_betaetigt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::VIP_Sensor_betaetigt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "VIP_Freigabe", 35, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::VIP_Freigabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::VIP_Freigabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::VIP_Freigabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_zu_Zeitl_Nachverr", 36, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_zu_Zeitl_Nachverr_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_zu_Zeitl_Nachverr(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_zu_Zeitl_Nachverr_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_HSK_entriegeln", 37, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_HSK_entriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_HSK_entriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_HSK_entriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_HSK_verriegeln", 38, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_HSK_verriegeln_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_HSK_verriegeln(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_HSK_verriegeln_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_Verdeck_zu", 39, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_Verdeck_zu_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_Verdeck_zu(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_Verdeck_zu_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_Verdeck_auf", 40, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_Verdeck_auf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_Verdeck_auf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_Verdeck_auf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_FT_hoch", 41, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_FT_hoch_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_FT_hoch(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_FT_hoch_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_FT_tief", 42, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_FT_tief_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_FT_tief(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_FT_tief_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_BT_hoch", 43, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_BT_hoch_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_BT_hoch(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_BT_hoch_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_BT_tief", 44, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_BT_tief_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_BT_tief(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_BT_tief_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_HFS_hoch", 45, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_HFS_hoch_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_HFS_hoch(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_HFS_hoch_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_HFS_tief", 46, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_HFS_tief_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_HFS_tief(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_HFS_tief_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_HBFS_hoch", 47, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_HBFS_hoch_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_HBFS_hoch(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_HBFS_hoch_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "FH_HBFS_tief", 48, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::FH_HBFS_tief_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::FH_HBFS_tief(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::FH_HBFS_tief_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "BCM_Spg_Synchron", 49, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::BCM_Spg_Synchron_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::BCM_Spg_Synchron(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::BCM_Spg_Synchron_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "BCM_BF_Spg_Absenkung", 50, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::BCM_BF_Spg_Absenkung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::BCM_BF_Spg_Absenkung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::BCM_BF_Spg_Absenkung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_Signatur", 51, 11, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_Signatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_Signatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_Signatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_entriegeln_Anf", 62, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_entriegeln_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_entriegeln_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_entriegeln_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x184, "ZV_auto_Ansteuerung", 63, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_01::ZV_auto_Ansteuerung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_01::ZV_auto_Ansteuerung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_01::ZV_auto_Ansteuerung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_01_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_01_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_01_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_01_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_01_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_01_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_01_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_01_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_IstStrom_02", 12, 12, true, false, 1, -2047,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_IstStrom_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_IstStrom_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_IstStrom_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_IstSpannung", 24, 12, true, false, 0.25, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_IstSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_IstSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_IstSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_Spannung_ZwKr", 36, 11, true, false, 0.5, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_Spannung_ZwKr_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_Spannung_ZwKr(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_Spannung_ZwKr_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_SOC_HiRes", 47, 11, true, false, 0.050000000000000003, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_SOC_HiRes_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_SOC_HiRes(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_SOC_HiRes_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_IstStrom_02_OffsetVZ", 58, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_IstStrom_02_OffsetVZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_IstStrom_02_OffsetVZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_IstStrom_02_OffsetVZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x191, "BMS_IstStrom_02_Offset", 60, 4, true, false, 0.0625, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_01::BMS_IstStrom_02_Offset_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_01::BMS_IstStrom_02_Offset(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_01::BMS_IstStrom_02_Offset_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "Klemmen_Status_01_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::Klemmen_Status_01_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::Klemmen_Status_01_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::Klemmen_Status_01_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "Klemmen_Status_01_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::Klemmen_Status_01_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::Klemmen_Status_01_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::Klemmen_Status_01_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "RSt_Fahrerhinweise", 12, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::RSt_Fahrerhinweise_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::RSt_Fahrerhinweise(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::RSt_Fahrerhinweise_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "ZAS_Kl_S", 16, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::ZAS_Kl_S_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::ZAS_Kl_S(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::ZAS_Kl_S_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "ZAS_Kl_15", 17, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::ZAS_Kl_15_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::ZAS_Kl_15(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::ZAS_Kl_15_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "ZAS_Kl_X", 18, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::ZAS_Kl_X_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::ZAS_Kl_X(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::ZAS_Kl_X_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "ZAS_Kl_50_Startanforderung", 19, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::ZAS_Kl_50_Startanforderung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::ZAS_Kl_50_Startanforderung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::ZAS_Kl_50_Startanforderung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "BCM_Remotestart_Betrieb", 20, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::BCM_Remotestart_Betrieb_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::BCM_Remotestart_Betrieb(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::BCM_Remotestart_Betrieb_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "ZAS_Kl_Infotainment", 21, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::ZAS_Kl_Infotainment_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::ZAS_Kl_Infotainment(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::ZAS_Kl_Infotainment_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "BCM_Remotestart_KL15_Anf", 22, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::BCM_Remotestart_KL15_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::BCM_Remotestart_KL15_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::BCM_Remotestart_KL15_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "BCM_Remotestart_MO_Start", 23, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::BCM_Remotestart_MO_Start_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::BCM_Remotestart_MO_Start(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::BCM_Remotestart_MO_Start_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Warn_P1_ZST_def", 24, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Warn_P1_ZST_def_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Warn_P1_ZST_def(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Warn_P1_ZST_def_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Warn_P2_ZST_def", 25, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Warn_P2_ZST_def_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Warn_P2_ZST_def(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Warn_P2_ZST_def_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Fahrerhinweis_1", 26, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_1_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_1(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_1_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Fahrerhinweis_2", 27, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_2_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_2(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_2_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "BCM_Ausparken_Betrieb", 28, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::BCM_Ausparken_Betrieb_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::BCM_Ausparken_Betrieb(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::BCM_Ausparken_Betrieb_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Fahrerhinweis_4", 29, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_4_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_4(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_4_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Fahrerhinweis_5", 30, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_5_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_5(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_5_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x3C0, "KST_Fahrerhinweis_6", 31, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_6_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_6(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Klemmen_Status_01::KST_Fahrerhinweis_6_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "ESP_15_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::ESP_15_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::ESP_15_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::ESP_15_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "ESP_15_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::ESP_15_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::ESP_15_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::ESP_15_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_P_beibehalten_GE", 12, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_P_beibehalten_GE_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_P_beibehalten_GE(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_P_beibehalten_GE_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Konsistenz_GE", 14, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Konsistenz_GE_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Konsistenz_GE(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Konsistenz_GE_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Konsistenz_IPA", 15, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Konsistenz_IPA_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Konsistenz_IPA(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Konsistenz_IPA_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Konsistenz_STA", 18, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Konsistenz_STA_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Konsistenz_STA(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Konsistenz_STA_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Konsistenz_MO", 19, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Konsistenz_MO_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Konsistenz_MO(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Konsistenz_MO_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_halten_nicht_verfuegbar", 20, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_halten_nicht_verfuegbar_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_halten_nicht_verfuegbar(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_halten_nicht_verfuegbar_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "NL_PRIM_STP_01_Status", 21, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::NL_PRIM_STP_01_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::NL_PRIM_STP_01_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::NL_PRIM_STP_01_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "VMM_Warnblinken", 24, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::VMM_Warnblinken_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::VMM_Warnblinken(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::VMM_Warnblinken_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "VZM_Status", 26, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::VZM_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::VZM_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::VZM_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Notstopp_Status", 29, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Notstopp_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Notstopp_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Notstopp_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_parken_nicht_verfuegbar", 32, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_parken_nicht_verfuegbar_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_parken_nicht_verfuegbar(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_parken_nicht_verfuegbar_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Anforderung_GE", 33, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Anforderung_GE_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Anforderung_GE(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Anforderung_GE_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Systemstatus", 36, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Systemstatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Systemstatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Systemstatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Stillstand", 40, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Stillstand_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Stillstand(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Stillstand_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_aktives_System", 43, 5, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_aktives_System_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_aktives_System(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_aktives_System_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Konsistenz_HVLM", 48, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Konsistenz_HVLM_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Konsistenz_HVLM(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Konsistenz_HVLM_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Konsistenz_ACC", 49, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Konsistenz_ACC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Konsistenz_ACC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Konsistenz_ACC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "HMS_Fehlerstatus", 50, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::HMS_Fehlerstatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::HMS_Fehlerstatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::HMS_Fehlerstatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "ESP_Index_Haltemoment", 53, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::ESP_Index_Haltemoment_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::ESP_Index_Haltemoment(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::ESP_Index_Haltemoment_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A2, "ESP_Haltemoment", 54, 10, true, false, 10, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ESP_15::ESP_Haltemoment_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ESP_15::ESP_Haltemoment(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ESP_15::ESP_Haltemoment_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x2AE, "DCDC_01_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_01::DCDC_01_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_01::DCDC_01_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_01::DCDC_01_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x2AE, "DCDC_01_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_01::DCDC_01_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_01::DCDC_01_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_01::DCDC_01_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x2AE, "DC_IstSpannung_HV", 12, 12, true, false, 0.25, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_01::DC_IstSpannung_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_01::DC_IstSpannung_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_01::DC_IstSpannung_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x2AE, "DC_IstStrom_HV_02", 24, 10, true, false, 0.40000000000000002, -204,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_01::DC_IstStrom_HV_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_01::DC_IstStrom_HV_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_01::DC_IstStrom_HV_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x2AE, "DC_IstStrom_NV", 34, 10, true, false, 1, -511,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_01::DC_IstStrom_NV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_01::DC_IstStrom_NV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_01::DC_IstStrom_NV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x2AE, "DC_IstSpannung_NV", 56, 8, true, false, 0.10000000000000001, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_01::DC_IstSpannung_NV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_01::DC_IstSpannung_NV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_01::DC_IstSpannung_NV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_01_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_01_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_01_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_01_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_01_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_01_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_01_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_01_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_Istmodus_Anf", 12, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_Istmodus_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_Istmodus_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_Istmodus_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_TN1_Sollmodus", 13, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_TN1_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_TN1_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_TN1_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_MO_EmSollzustand", 16, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_MO_EmSollzustand_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_MO_EmSollzustand(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_MO_EmSollzustand_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_BMS_Sollmodus", 24, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_BMS_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_BMS_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_BMS_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_DCDC_Sollmodus", 27, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_DCDC_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_DCDC_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_DCDC_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_EKK_Sollmodus", 30, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_EKK_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_EKK_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_EKK_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_HVPTC_Sollmodus", 33, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_HVPTC_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_HVPTC_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_HVPTC_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_HVLM_Sollmodus", 36, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_HVLM_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_HVLM_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_HVLM_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_HV_Netz_Warnungen", 39, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_HV_Netz_Warnungen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_HV_Netz_Warnungen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_HV_Netz_Warnungen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HV_Bordnetz_aktiv", 41, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HV_Bordnetz_aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HV_Bordnetz_aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HV_Bordnetz_aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HV_Bordnetz_Fehler", 42, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HV_Bordnetz_Fehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HV_Bordnetz_Fehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HV_Bordnetz_Fehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_Gesamtst_Spgfreiheit", 43, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_Gesamtst_Spgfreiheit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_Gesamtst_Spgfreiheit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_Gesamtst_Spgfreiheit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_AktiveEntladung_Anf", 45, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_AktiveEntladung_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_AktiveEntladung_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_AktiveEntladung_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_Iso_Messung_Start", 50, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_Iso_Messung_Start_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_Iso_Messung_Start(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_Iso_Messung_Start_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x503, "HVK_DCDC_EKK_Sollmodus", 62, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVK_01::HVK_DCDC_EKK_Sollmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVK_01::HVK_DCDC_EKK_Sollmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVK_01::HVK_DCDC_EKK_Sollmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_04_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_04_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_04_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_04_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_04_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_04_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_04_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_04_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_Status_ServiceDisconnect", 13, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_Status_ServiceDisconnect_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_Status_ServiceDisconnect(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_Status_ServiceDisconnect_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_Status_Spgfreiheit", 14, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_Status_Spgfreiheit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_Status_Spgfreiheit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_Status_Spgfreiheit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_OBD_Lampe_Anf", 16, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_OBD_Lampe_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_OBD_Lampe_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_OBD_Lampe_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_IstModus", 17, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_IstModus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_IstModus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_IstModus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_Fehlerstatus", 20, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_Fehlerstatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_Fehlerstatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_Fehlerstatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_Kapazitaet_02", 23, 11, true, false, 0.20000000000000001, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_Kapazitaet_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_Kapazitaet_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_Kapazitaet_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5A2, "BMS_Soll_SOC_HiRes", 53, 11, true, false, 0.050000000000000003, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_04::BMS_Soll_SOC_HiRes_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_04::BMS_Soll_SOC_HiRes(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_04::BMS_Soll_SOC_HiRes_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_07_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_07_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_07_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_07_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_07_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_07_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_07_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_07_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Energieinhalt", 12, 11, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Energieinhalt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Energieinhalt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Energieinhalt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Ladevorgang_aktiv", 23, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Ladevorgang_aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Ladevorgang_aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Ladevorgang_aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Batteriediagnose", 24, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Batteriediagnose_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Batteriediagnose(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Batteriediagnose_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Freig_max_Performanz", 27, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Freig_max_Performanz_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Freig_max_Performanz(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Freig_max_Performanz_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Balancing_Aktiv", 30, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Balancing_Aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Balancing_Aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Balancing_Aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_MaxEnergieinhalt", 32, 11, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_MaxEnergieinhalt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_MaxEnergieinhalt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_MaxEnergieinhalt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Ausgleichsladung_Anf", 43, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Ausgleichsladung_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Ausgleichsladung_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Ausgleichsladung_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Gesamtst_Spgfreiheit", 44, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Gesamtst_Spgfreiheit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Gesamtst_Spgfreiheit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Gesamtst_Spgfreiheit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_RIso_Ext", 46, 12, true, false, 5, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_RIso_Ext_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_RIso_Ext(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_RIso_Ext_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_KundenWarnung", 58, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_KundenWarnung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_KundenWarnung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_KundenWarnung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CA, "BMS_Fehler_KuehlkreislaufLeckage", 60, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_07::BMS_Fehler_KuehlkreislaufLeckage_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_07::BMS_Fehler_KuehlkreislaufLeckage(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_07::BMS_Fehler_KuehlkreislaufLeckage_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DCDC_03_CRC", 0, 8, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DCDC_03_CRC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DCDC_03_CRC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DCDC_03_CRC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DCDC_03_BZ", 8, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DCDC_03_BZ_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DCDC_03_BZ(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DCDC_03_BZ_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_Fehlerstatus", 16, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_Fehlerstatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_Fehlerstatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_Fehlerstatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_Peakstrom_verfuegbar", 19, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_Peakstrom_verfuegbar_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_Peakstrom_verfuegbar(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_Peakstrom_verfuegbar_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_Abregelung_Temperatur", 20, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_Abregelung_Temperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_Abregelung_Temperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_Abregelung_Temperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_IstModus_02", 21, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_IstModus_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_IstModus_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_IstModus_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_HV_EKK_IstModus", 28, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_HV_EKK_IstModus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_HV_EKK_IstModus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_HV_EKK_IstModus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_Status_Spgfreiheit_HV", 46, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_Status_Spgfreiheit_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_Status_Spgfreiheit_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_Status_Spgfreiheit_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_IstSpannung_EKK_HV", 48, 8, true, false, 2, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_IstSpannung_EKK_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_IstSpannung_EKK_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_IstSpannung_EKK_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5CD, "DC_Temperatur", 56, 8, true, false, 1, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::DCDC_03::DC_Temperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::DCDC_03::DC_Temperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::DCDC_03::DC_Temperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A1, "BMS_MaxDyn_LadeStrom_02_Offset", 8, 4, true, false, 0.0625, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Offset_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Offset(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Offset_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A1, "BMS_MaxDyn_EntladeStrom_02", 12, 11, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_02::BMS_MaxDyn_EntladeStrom_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_02::BMS_MaxDyn_EntladeStrom_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_02::BMS_MaxDyn_EntladeStrom_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A1, "BMS_MaxDyn_LadeStrom_02", 23, 11, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_02::BMS_MaxDyn_LadeStrom_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A1, "BMS_Min_EntladeSpannung", 34, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_02::BMS_Min_EntladeSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_02::BMS_Min_EntladeSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_02::BMS_Min_EntladeSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A1, "BMS_MinDyn_EntladeSpannung", 44, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_02::BMS_MinDyn_EntladeSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_02::BMS_MinDyn_EntladeSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_02::BMS_MinDyn_EntladeSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A1, "BMS_MinDyn_LadeSpannung", 54, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_02::BMS_MinDyn_LadeSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_02::BMS_MinDyn_LadeSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_02::BMS_MinDyn_LadeSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x39D, "BMS_Leerlaufspannung", 0, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_03::BMS_Leerlaufspannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_03::BMS_Leerlaufspannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_03::BMS_Leerlaufspannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x39D, "BMS_Max_LadeSpannung", 12, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_03::BMS_Max_LadeSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_03::BMS_Max_LadeSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_03::BMS_Max_LadeSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x39D, "BMS_MaxPred_EntladeStrom_02", 22, 11, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_03::BMS_MaxPred_EntladeStrom_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_03::BMS_MaxPred_EntladeStrom_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_03::BMS_MaxPred_EntladeStrom_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x39D, "BMS_MaxPred_LadeStrom_02", 33, 11, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_03::BMS_MaxPred_LadeStrom_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_03::BMS_MaxPred_LadeStrom_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_03::BMS_MaxPred_LadeStrom_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x39D, "BMS_MinPred_EntladeSpannung", 44, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_03::BMS_MinPred_EntladeSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_03::BMS_MinPred_EntladeSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_03::BMS_MinPred_EntladeSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x39D, "BMS_MinPred_LadeSpannung", 54, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_03::BMS_MinPred_LadeSpannung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_03::BMS_MinPred_LadeSpannung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_03::BMS_MinPred_LadeSpannung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x509, "BMS_Energieinhalt_HiRes", 0, 15, true, false, 4, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_10::BMS_Energieinhalt_HiRes_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_10::BMS_Energieinhalt_HiRes(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_10::BMS_Energieinhalt_HiRes_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x509, "BMS_MaxEnergieinhalt_HiRes", 15, 15, true, false, 4, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_10::BMS_MaxEnergieinhalt_HiRes_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_10::BMS_MaxEnergieinhalt_HiRes(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_10::BMS_MaxEnergieinhalt_HiRes_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x509, "BMS_NutzbarerSOC", 30, 8, true, false, 0.5, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_10::BMS_NutzbarerSOC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_10::BMS_NutzbarerSOC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_10::BMS_NutzbarerSOC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x509, "BMS_NutzbarerEnergieinhalt", 38, 12, true, false, 25, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_10::BMS_NutzbarerEnergieinhalt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_10::BMS_NutzbarerEnergieinhalt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_10::BMS_NutzbarerEnergieinhalt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x509, "BMS_Pred_Entladeperformance", 50, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_10::BMS_Pred_Entladeperformance_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_10::BMS_Pred_Entladeperformance(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_10::BMS_Pred_Entladeperformance_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x509, "BMS_Pred_Ladeperformance", 57, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_10::BMS_Pred_Ladeperformance_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_10::BMS_Pred_Ladeperformance(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_10::BMS_Pred_Ladeperformance_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_NVNachladen_Energie", 12, 8, true, false, 25, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_NVNachladen_Energie_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_NVNachladen_Energie(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_NVNachladen_Energie_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_Max_VK_Betriebsdauer", 26, 6, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_Max_VK_Betriebsdauer_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_Max_VK_Betriebsdauer(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_Max_VK_Betriebsdauer_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_Nachladen_Anf", 32, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_Nachladen_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_Nachladen_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_Nachladen_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_SollStrom_HV", 33, 11, true, false, 0.20000000000000001, -204.40000000000001,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_SollStrom_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_SollStrom_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_SollStrom_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_MaxSpannung_HV", 44, 10, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_MaxSpannung_HV_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_MaxSpannung_HV(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_MaxSpannung_HV_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_Abschaltstatus", 54, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_Abschaltstatus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_Abschaltstatus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_Abschaltstatus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_DCDC_Freigabe", 57, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_DCDC_Freigabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_DCDC_Freigabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_DCDC_Freigabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x552, "HVEM_FreigabeKlimatisierung", 58, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_05::HVEM_FreigabeKlimatisierung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_05::HVEM_FreigabeKlimatisierung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_05::HVEM_FreigabeKlimatisierung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_IstStrom_HVVerbraucher", 0, 12, true, false, 0.10000000000000001, -204.69999999999999,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_IstStrom_HVVerbraucher_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_IstStrom_HVVerbraucher(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_IstStrom_HVVerbraucher_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_Energie_Klima_Vorgabe_HighR", 12, 3, true, false, 10, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_Energie_Klima_Vorgabe_HighR_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_Energie_Klima_Vorgabe_HighR(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_Energie_Klima_Vorgabe_HighR_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_IstLeistungNA", 15, 9, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_IstLeistungNA_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_IstLeistungNA(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_IstLeistungNA_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_Leistung_Klima_Vorgabe", 24, 8, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_Leistung_Klima_Vorgabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_Leistung_Klima_Vorgabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_Leistung_Klima_Vorgabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_Nutzbare_Energie", 32, 11, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_Nutzbare_Energie_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_Nutzbare_Energie(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_Nutzbare_Energie_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_Energie_Klima_Vorgabe", 43, 8, true, false, 50, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_Energie_Klima_Vorgabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_Energie_Klima_Vorgabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_Energie_Klima_Vorgabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x5AC, "HVEM_MO_MaxLeistungIgnoriert", 63, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::HVEM_02::HVEM_MO_MaxLeistungIgnoriert_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::HVEM_02::HVEM_MO_MaxLeistungIgnoriert(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::HVEM_02::HVEM_MO_MaxLeistungIgnoriert_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "BCM_FH_Freigabe", 12, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::BCM_FH_Freigabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::BCM_FH_Freigabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::BCM_FH_Freigabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "BCM_Komfortfkt_Freigabe", 13, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::BCM_Komfortfkt_Freigabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::BCM_Komfortfkt_Freigabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::BCM_Komfortfkt_Freigabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "BCM_HSK_Freigabe", 14, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::BCM_HSK_Freigabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::BCM_HSK_Freigabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::BCM_HSK_Freigabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "BCM_Verdeck_Freigabe", 15, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::BCM_Verdeck_Freigabe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::BCM_Verdeck_Freigabe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::BCM_Verdeck_Freigabe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_verriegelt_intern_ist", 16, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_verriegelt_intern_ist_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_verriegelt_intern_ist(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_verriegelt_intern_ist_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_verriegelt_extern_ist", 17, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_verriegelt_extern_ist_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_verriegelt_extern_ist(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_verriegelt_extern_ist_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_verriegelt_intern_soll", 18, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_verriegelt_intern_soll_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_verriegelt_intern_soll(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_verriegelt_intern_soll_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_verriegelt_extern_soll", 19, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_verriegelt_extern_soll_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_verriegelt_extern_soll(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_verriegelt_extern_soll_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_gesafet_extern_ist", 20, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_gesafet_extern_ist_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_gesafet_extern_ist(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_gesafet_extern_ist_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_gesafet_extern_soll", 21, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_gesafet_extern_soll_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_gesafet_extern_soll(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_gesafet_extern_soll_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Einzeltuerentriegelung", 22, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Einzeltuerentriegelung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Einzeltuerentriegelung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Einzeltuerentriegelung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Heckeinzelentriegelung", 23, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Heckeinzelentriegelung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Heckeinzelentriegelung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Heckeinzelentriegelung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_FT_offen", 24, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_FT_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_FT_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_FT_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_BT_offen", 25, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_BT_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_BT_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_BT_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_HFS_offen", 26, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_HFS_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_HFS_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_HFS_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_HBFS_offen", 27, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_HBFS_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_HBFS_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_HBFS_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_HD_offen", 28, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_HD_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_HD_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_HD_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_HS_offen", 29, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_HS_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_HS_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_HS_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "IRUE_aktiv", 30, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::IRUE_aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::IRUE_aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::IRUE_aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "DWA_aktiv", 31, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::DWA_aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::DWA_aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::DWA_aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "HD_Hauptraste", 32, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::HD_Hauptraste_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::HD_Hauptraste(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::HD_Hauptraste_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "HD_Vorraste", 33, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::HD_Vorraste_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::HD_Vorraste(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::HD_Vorraste_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "FFB_CarFinder", 38, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::FFB_CarFinder_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::FFB_CarFinder(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::FFB_CarFinder_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "FFB_Komfortoeffnen", 39, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::FFB_Komfortoeffnen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::FFB_Komfortoeffnen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::FFB_Komfortoeffnen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "FFB_Komfortschliessen", 40, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::FFB_Komfortschliessen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::FFB_Komfortschliessen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::FFB_Komfortschliessen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Schluessel_Zugang", 42, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Schluessel_Zugang_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Schluessel_Zugang(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Schluessel_Zugang_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_SafeFunktion_aktiv", 46, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_SafeFunktion_aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_SafeFunktion_aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_SafeFunktion_aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "FBS_Warn_Schluessel_Batt", 47, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::FBS_Warn_Schluessel_Batt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::FBS_Warn_Schluessel_Batt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::FBS_Warn_Schluessel_Batt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Oeffnungsmodus", 48, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Oeffnungsmodus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Oeffnungsmodus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Oeffnungsmodus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "HFS_verriegelt", 50, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::HFS_verriegelt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::HFS_verriegelt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::HFS_verriegelt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "HFS_gesafet", 51, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::HFS_gesafet_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::HFS_gesafet(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::HFS_gesafet_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "HBFS_verriegelt", 52, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::HBFS_verriegelt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::HBFS_verriegelt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::HBFS_verriegelt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "HBFS_gesafet", 53, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::HBFS_gesafet_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::HBFS_gesafet(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::HBFS_gesafet_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_ist_Zustand_verfuegbar", 54, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_ist_Zustand_verfuegbar_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_ist_Zustand_verfuegbar(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_ist_Zustand_verfuegbar_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "IRUE_Taster_Fkts_LED", 55, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::IRUE_Taster_Fkts_LED_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::IRUE_Taster_Fkts_LED(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::IRUE_Taster_Fkts_LED_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Tankklappe_offen", 56, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Tankklappe_offen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Tankklappe_offen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Tankklappe_offen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Rollo_auf", 57, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Rollo_auf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Rollo_auf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Rollo_auf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_Rollo_zu", 58, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_Rollo_zu_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_Rollo_zu(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_Rollo_zu_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_SAD_auf", 59, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_SAD_auf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_SAD_auf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_SAD_auf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_SAD_zu", 60, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_SAD_zu_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_SAD_zu(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_SAD_zu_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "BCM_Tankklappensteller_Fehler", 61, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::BCM_Tankklappensteller_Fehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::BCM_Tankklappensteller_Fehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::BCM_Tankklappensteller_Fehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x583, "ZV_verriegelt_soll", 62, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::ZV_02::ZV_verriegelt_soll_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::ZV_02::ZV_verriegelt_soll(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::ZV_02::ZV_verriegelt_soll_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Warn_H2_Konzentrat_Motorraum", 12, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Warn_H2_Konzentrat_Motorraum_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Warn_H2_Konzentrat_Motorraum(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Warn_H2_Konzentrat_Motorraum_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_nicht_verfuegbar", 15, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_nicht_verfuegbar_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_nicht_verfuegbar(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_nicht_verfuegbar_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Startstopp_Anforderung", 16, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Startstopp_Anforderung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Startstopp_Anforderung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Startstopp_Anforderung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_HV_Anf", 20, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_HV_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_HV_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_HV_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Klima_Eingr", 22, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Klima_Eingr_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Klima_Eingr(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Klima_Eingr_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_IstModus", 24, 5, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_IstModus_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_IstModus(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_IstModus_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Status_Spgfreiheit", 29, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Status_Spgfreiheit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Status_Spgfreiheit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Status_Spgfreiheit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Fehler_Leistungsreduzierung", 31, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Fehler_Leistungsreduzierung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Fehler_Leistungsreduzierung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Fehler_Leistungsreduzierung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Fehler_Abschaltanforderung", 32, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Fehler_Abschaltanforderung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Fehler_Abschaltanforderung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Fehler_Abschaltanforderung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Fehler_Notabschaltung", 33, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Fehler_Notabschaltung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Fehler_Notabschaltung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Fehler_Notabschaltung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Fehler_Entladung_defekt", 34, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Fehler_Entladung_defekt_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Fehler_Entladung_defekt(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Fehler_Entladung_defekt_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Fehler_Isofehler_I", 36, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Fehler_Isofehler_I_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Fehler_Isofehler_I(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Fehler_Isofehler_I_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Fehler_Isofehler_II", 38, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Fehler_Isofehler_II_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Fehler_Isofehler_II(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Fehler_Isofehler_II_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_OBD_Lampe_Anf", 40, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_OBD_Lampe_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_OBD_Lampe_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_OBD_Lampe_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Absperrventil_schliessen", 41, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Absperrventil_schliessen_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Absperrventil_schliessen(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Absperrventil_schliessen_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_TK_Betankung_Anforderung", 43, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_TK_Betankung_Anforderung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_TK_Betankung_Anforderung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_TK_Betankung_Anforderung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_MinAbs_Leistung", 44, 10, true, false, 0.10000000000000001, -50,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_MinAbs_Leistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_MinAbs_Leistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_MinAbs_Leistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_Ionenspuelung_aktiv", 54, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_Ionenspuelung_aktiv_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_Ionenspuelung_aktiv(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_Ionenspuelung_aktiv_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x17B, "FCU_TK_Freigabe_Tankklappe", 56, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::FCU_02::FCU_TK_Freigabe_Tankklappe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::FCU_02::FCU_TK_Freigabe_Tankklappe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::FCU_02::FCU_TK_Freigabe_Tankklappe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Temperierung_Anf", 0, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Temperierung_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Temperierung_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Temperierung_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Status_Ventil", 3, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Status_Ventil_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Status_Ventil(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Status_Ventil_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Temp_Epsilon", 8, 4, true, false, 1, -15,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Temp_Epsilon_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Temp_Epsilon(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Temp_Epsilon_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Soll_PWM_Pumpe", 12, 4, true, false, 10, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Soll_PWM_Pumpe_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Soll_PWM_Pumpe(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Soll_PWM_Pumpe_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Temperatur", 16, 8, true, false, 0.5, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Temperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Temperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Temperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_IstVorlaufTemperatur", 24, 8, true, false, 0.5, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_IstVorlaufTemperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_IstVorlaufTemperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_IstVorlaufTemperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Fehler_NTKreis", 36, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Fehler_NTKreis_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Fehler_NTKreis(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Fehler_NTKreis_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Fehlerstatus_EWP_02", 37, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Fehlerstatus_EWP_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Fehlerstatus_EWP_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Fehlerstatus_EWP_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_SollVolumenstrom", 40, 6, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_SollVolumenstrom_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_SollVolumenstrom(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_SollVolumenstrom_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_Batterie_Voko_Anf", 46, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_Batterie_Voko_Anf_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_Batterie_Voko_Anf(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_Batterie_Voko_Anf_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_SollVorlauftemperatur", 48, 8, true, false, 0.5, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_SollVorlauftemperatur_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_SollVorlauftemperatur(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_SollVorlauftemperatur_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x59E, "BMS_IstRuecklaufTemperatur_02", 56, 8, true, false, 0.5, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_06::BMS_IstRuecklaufTemperatur_02_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_06::BMS_IstRuecklaufTemperatur_02(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_06::BMS_IstRuecklaufTemperatur_02_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x485, "ND_SatInUse", 0, 5, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::NavData_02::ND_SatInUse_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::NavData_02::ND_SatInUse(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::NavData_02::ND_SatInUse_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x485, "POS_Guete_horizontal_verfuegbar", 5, 1, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::NavData_02::POS_Guete_horizontal_verfuegbar_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::NavData_02::POS_Guete_horizontal_verfuegbar(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::NavData_02::POS_Guete_horizontal_verfuegbar_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x485, "ND_SatInView", 8, 5, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::NavData_02::ND_SatInView_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::NavData_02::ND_SatInView(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::NavData_02::ND_SatInView_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x485, "POS_Guete_horizontal", 13, 7, true, false, 2, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::NavData_02::POS_Guete_horizontal_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::NavData_02::POS_Guete_horizontal(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::NavData_02::POS_Guete_horizontal_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x485, "NP_Altitude", 20, 12, true, false, 2, -500,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::NavData_02::NP_Altitude_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::NavData_02::NP_Altitude(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::NavData_02::NP_Altitude_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x485, "ND_UTC", 32, 32, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::NavData_02::ND_UTC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::NavData_02::ND_UTC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::NavData_02::ND_UTC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A5555AD, "AT_VALID_TIME", 32, 32, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::Authentic_Time_01::AT_VALID_TIME_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::Authentic_Time_01::AT_VALID_TIME(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::Authentic_Time_01::AT_VALID_TIME_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A955EB, "BMS_HV_Auszeit_Status", 21, 2, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_09::BMS_HV_Auszeit_Status_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_09::BMS_HV_Auszeit_Status(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_09::BMS_HV_Auszeit_Status_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A955EB, "BMS_HV_Auszeit", 23, 9, true, false, 4, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_09::BMS_HV_Auszeit_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_09::BMS_HV_Auszeit(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_09::BMS_HV_Auszeit_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A955EB, "BMS_Kapazitaet", 32, 11, true, false, 0.10000000000000001, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_09::BMS_Kapazitaet_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_09::BMS_Kapazitaet(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_09::BMS_Kapazitaet_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A955EB, "BMS_SOC_Kaltstart", 43, 11, true, false, 0.050000000000000003, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_09::BMS_SOC_Kaltstart_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_09::BMS_SOC_Kaltstart(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_09::BMS_SOC_Kaltstart_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A955EB, "BMS_max_Grenz_SOC", 54, 5, true, false, 1, 70,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_09::BMS_max_Grenz_SOC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_09::BMS_max_Grenz_SOC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_09::BMS_max_Grenz_SOC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A955EB, "BMS_min_Grenz_SOC", 59, 5, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_09::BMS_min_Grenz_SOC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_09::BMS_min_Grenz_SOC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_09::BMS_min_Grenz_SOC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A954A6, "BMS_IsoZustand", 17, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_11::BMS_IsoZustand_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_11::BMS_IsoZustand(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_11::BMS_IsoZustand_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A954A6, "BMS_IsoFehler", 21, 3, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_11::BMS_IsoFehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_11::BMS_IsoFehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_11::BMS_IsoFehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A954A6, "BMS_IstTemperatur_hoechste", 24, 8, true, false, 0.5, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_11::BMS_IstTemperatur_hoechste_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_11::BMS_IstTemperatur_hoechste(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_11::BMS_IstTemperatur_hoechste_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A954A6, "BMS_IstTemperatur_niedrigste", 32, 8, true, false, 0.5, -40,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_11::BMS_IstTemperatur_niedrigste_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_11::BMS_IstTemperatur_niedrigste(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_11::BMS_IstTemperatur_niedrigste_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A954A6, "BMS_IstZellspannung_hoechste", 40, 12, true, false, 1, 1000,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_11::BMS_IstZellspannung_hoechste_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_11::BMS_IstZellspannung_hoechste(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_11::BMS_IstZellspannung_hoechste_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x16A954A6, "BMS_IstZellspannung_niedrigste", 52, 12, true, false, 1, 1000,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_11::BMS_IstZellspannung_niedrigste_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_11::BMS_IstZellspannung_niedrigste(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_11::BMS_IstZellspannung_niedrigste_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A555552, "BMS_LadegrenzeAntw_SOC", 26, 7, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_27::BMS_LadegrenzeAntw_SOC_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_27::BMS_LadegrenzeAntw_SOC(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_27::BMS_LadegrenzeAntw_SOC_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A555552, "BMS_EnergieAntw_Zaehler", 33, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_27::BMS_EnergieAntw_Zaehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_27::BMS_EnergieAntw_Zaehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_27::BMS_EnergieAntw_Zaehler_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A555552, "BMS_EnergieAntw_Energie", 37, 11, true, false, 250, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_27::BMS_EnergieAntw_Energie_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_27::BMS_EnergieAntw_Energie(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_27::BMS_EnergieAntw_Energie_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A555552, "BMS_LadegrenzeAntw_Leistung", 48, 12, true, false, 200, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Leistung_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Leistung(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Leistung_Encode(d, static_cast<uint32_t>(raw)); } },
+    { 0x1A555552, "BMS_LadegrenzeAntw_Zaehler", 60, 4, true, false, 1, 0,
+      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Zaehler_Raw(d)); },
+      [](const uint8_t* d) -> double { return mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Zaehler(d); },
+      [](uint8_t* d, uint64_t raw) { mlb_dbc::BMS_27::BMS_LadegrenzeAntw_Zaehler_Encode(d, static_cast<uint32_t>(raw)); } },
+};
+
+#endif // MLB_DBC_LAYOUT_H
@@ -1,5 +1,6 @@
 #ifndef CANHARDWARE_H
 #define CANHARDWARE_H
+#include <stdint.h>
 class CanHardware {
 public:
     virtual ~CanHardware() = default;
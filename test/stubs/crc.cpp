@@ -0,0 +1,29 @@
+#include <libopencm3/stm32/crc.h>
+
+void (*crc_stub_preempt_hook)(void) = nullptr;
+
+static uint32_t crcDr = 0xFFFFFFFF;
+
+void crc_reset(void)
+{
+    crcDr = 0xFFFFFFFF;
+}
+
+uint32_t crc_calculate(uint32_t data)
+{
+    if (crc_stub_preempt_hook)
+        crc_stub_preempt_hook();
+
+    crcDr ^= data;
+    for (int i = 0; i < 32; i++)
+        crcDr = (crcDr & 0x80000000) ? (crcDr << 1) ^ 0x04C11DB7 : (crcDr << 1);
+    return crcDr;
+}
+
+uint32_t crc_calculate_block(const uint32_t *buf, uint32_t len)
+{
+    uint32_t crc = crcDr;
+    for (uint32_t i = 0; i < len; i++)
+        crc = crc_calculate(buf[i]);
+    return crc;
+}
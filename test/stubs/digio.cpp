@@ -5,3 +5,4 @@ StubDigIoPin DigIo::ready_safety_in;
 StubDigIoPin DigIo::ready_out;
 StubDigIoPin DigIo::condition_out;
 StubDigIoPin DigIo::vcu_out;
+StubDigIoPin DigIo::mcp_cs;
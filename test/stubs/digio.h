@@ -3,12 +3,14 @@
 
 class StubDigIoPin {
 public:
-    void Set() { state = true; }
-    void Clear() { state = false; }
+    void Set() { edges += !state; state = true; }
+    void Clear() { edges += state; state = false; }
     bool Get() const { return state; }
+    int GetEdges() const { return edges; }
 
 private:
     bool state = false;
+    int edges = 0;
 };
 
 struct DigIo {
@@ -17,6 +19,7 @@ struct DigIo {
     static StubDigIoPin ready_out;
     static StubDigIoPin condition_out;
     static StubDigIoPin vcu_out;
+    static StubDigIoPin mcp_cs;
 };
 
 #endif
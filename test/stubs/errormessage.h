@@ -2,7 +2,9 @@
 #define ERRORMESSAGE_H
 class ErrorMessage {
 public:
-    static void Post(int) {}
+    static void Post(int err) { Count(err)++; }
+    // Number of posts per error, for the host tests
+    static int& Count(int err) { static int counts[64]; return counts[err]; }
     static void PrintAllErrors() {}
     static void SetTime(int) {}
 };
@@ -28,11 +30,13 @@ enum {
     ERR_DCDC_THERMAL_LIMIT,
     ERR_DCDC_VOLTAGE_REG_FAULT,
     ERR_DCDC_CALIBRATION_FAULT,
+    ERR_CHARGER_TIMEOUT,
     ERR_HV_CONTACTOR_TIMEOUT_CLOSING,
     ERR_HV_CONTACTOR_TIMEOUT_STOP_CONSUMERS,
     ERR_HV_CONTACTOR_TIMEOUT_OPENING,
     ERR_READY_NOT_SET_ON_IGNITION,
     ERR_READY_DROPPED_DURING_DIAGNOSE,
-    ERR_READY_STUCK_ON_IGNITION_OFF
+    ERR_READY_STUCK_ON_IGNITION_OFF,
+    ERR_CAN_FILTER_OVERFLOW
 };
 #endif
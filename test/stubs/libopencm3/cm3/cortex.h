@@ -0,0 +1,5 @@
+#ifndef LIBOPENCM3_CM3_CORTEX_H
+#define LIBOPENCM3_CM3_CORTEX_H
+#include <stdint.h>
+static inline uint32_t cm_mask_interrupts(uint32_t mask) { (void)mask; return 0; }
+#endif
@@ -0,0 +1,6 @@
+#ifndef LIBOPENCM3_CM3_DWT_H
+#define LIBOPENCM3_CM3_DWT_H
+#include <stdint.h>
+static inline bool dwt_enable_cycle_counter(void) { return true; }
+static inline uint32_t dwt_read_cycle_counter(void) { return 0; }
+#endif
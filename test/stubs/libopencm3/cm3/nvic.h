@@ -0,0 +1,6 @@
+#ifndef LIBOPENCM3_CM3_NVIC_H
+#define LIBOPENCM3_CM3_NVIC_H
+#include <stdint.h>
+#define NVIC_DMA1_CHANNEL4_IRQ 14
+static inline void nvic_enable_irq(uint8_t irqn) { (void)irqn; }
+#endif
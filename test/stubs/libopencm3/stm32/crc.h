@@ -1,9 +1,22 @@
 #ifndef LIBOPENCM3_STM32_CRC_H
 #define LIBOPENCM3_STM32_CRC_H
 #include <stdint.h>
+#ifdef CRC_STUB_EMULATE
+// Bit exact model of the CRC peripheral, see stubs/crc.cpp
+void crc_reset(void);
+uint32_t crc_calculate(uint32_t data);
+uint32_t crc_calculate_block(const uint32_t *buf, uint32_t len);
+// Called before every word written to the model, used to simulate an interrupt
+extern void (*crc_stub_preempt_hook)(void);
+#else
 static inline void crc_reset(void) {}
+static inline uint32_t crc_calculate(uint32_t data)
+{
+    (void)data; return 0;
+}
 static inline uint32_t crc_calculate_block(const uint32_t *buf, uint32_t len)
 {
     (void)buf; (void)len; return 0;
 }
 #endif
+#endif
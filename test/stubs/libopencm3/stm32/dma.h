@@ -0,0 +1,25 @@
+#ifndef LIBOPENCM3_STM32_DMA_H
+#define LIBOPENCM3_STM32_DMA_H
+#include <stdint.h>
+// DMA1 channels 4 and 5 serving SPI2, see stubs/spi.cpp
+#define DMA1 0x40020000U
+#define DMA_CHANNEL4 4
+#define DMA_CHANNEL5 5
+#define DMA_TCIF (1 << 1)
+#define DMA_CCR_PSIZE_8BIT 0
+#define DMA_CCR_MSIZE_8BIT 0
+void dma_channel_reset(uint32_t dma, uint8_t channel);
+void dma_set_peripheral_address(uint32_t dma, uint8_t channel, uint32_t address);
+void dma_set_memory_address(uint32_t dma, uint8_t channel, uint32_t address);
+void dma_set_number_of_data(uint32_t dma, uint8_t channel, uint16_t number);
+void dma_set_read_from_peripheral(uint32_t dma, uint8_t channel);
+void dma_set_read_from_memory(uint32_t dma, uint8_t channel);
+void dma_enable_memory_increment_mode(uint32_t dma, uint8_t channel);
+void dma_set_peripheral_size(uint32_t dma, uint8_t channel, uint32_t peripheral_size);
+void dma_set_memory_size(uint32_t dma, uint8_t channel, uint32_t mem_size);
+void dma_enable_transfer_complete_interrupt(uint32_t dma, uint8_t channel);
+void dma_enable_channel(uint32_t dma, uint8_t channel);
+void dma_disable_channel(uint32_t dma, uint8_t channel);
+void dma_clear_interrupt_flags(uint32_t dma, uint8_t channel, uint32_t interrupts);
+bool dma_get_interrupt_flag(uint32_t dma, uint8_t channel, uint32_t interrupts);
+#endif
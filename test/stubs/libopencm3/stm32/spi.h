@@ -0,0 +1,21 @@
+#ifndef LIBOPENCM3_STM32_SPI_H
+#define LIBOPENCM3_STM32_SPI_H
+#include <stdint.h>
+// Model of SPI2 with an MCP2515 on the bus, see stubs/spi.cpp. The CPU
+// cycles spent on register accesses, on waiting for bytes and on entering
+// interrupts are added up in spi_stub_cpu_cycles.
+#define SPI2 0x40003800U
+#define SPI_DR(spi_base) spi_stub_dr
+extern volatile uint32_t spi_stub_dr;
+extern uint32_t spi_stub_cpu_cycles;
+void spi_enable(uint32_t spi);
+uint16_t spi_xfer(uint32_t spi, uint16_t data);
+void spi_enable_rx_dma(uint32_t spi);
+void spi_enable_tx_dma(uint32_t spi);
+// Raises a pending DMA1 channel 4 interrupt, false if there is none
+bool spi_stub_irq(void);
+// Register file of the MCP2515 and bytes clocked while it was not selected
+uint8_t spi_stub_mcp_reg(uint8_t addr);
+void spi_stub_mcp_set_reg(uint8_t addr, uint8_t value);
+int spi_stub_errors(void);
+#endif
@@ -0,0 +1,12 @@
+#ifndef MY_FP_H
+#define MY_FP_H
+#include <stdint.h>
+
+typedef int32_t s32fp;
+
+#define FRAC_DIGITS 5
+#define FP_FROMINT(a) ((s32fp)((a) << FRAC_DIGITS))
+#define FP_TOINT(a) ((a) >> FRAC_DIGITS)
+#define FP_MUL(a, b) (((a) * (b)) >> FRAC_DIGITS)
+#define FP_DIV(a, b) (((a) << FRAC_DIGITS) / (b))
+#endif
@@ -0,0 +1,9 @@
+#ifndef MY_MATH_H
+#define MY_MATH_H
+
+#define ABS(a) ((a) < 0 ? -(a) : (a))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define RAMPUP(current, target, rate) ((target) < (current) || ((current) + (rate)) > (target) ? (target) : (current) + (rate))
+#define RAMPDOWN(current, target, rate) ((target) > (current) || ((current) - (rate)) < (target) ? (target) : (current) - (rate))
+#endif
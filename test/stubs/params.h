@@ -64,7 +64,8 @@ public:
         HVCM_state,
         dcdc_input_power_off_confirmed,
         heater_off_confirmed,
-        hv_comfort_functions_allowed
+        hv_comfort_functions_allowed,
+        can_tx_heartbeat
     };
     static void SetFloat(int idx, float val) { floatValues[idx] = val; }
     static float GetFloat(int idx) { return floatValues[idx]; }
@@ -0,0 +1,3 @@
+#include "params.h"
+int Param::values[Param::PARAM_LAST] = {0};
+float Param::floatValues[Param::PARAM_LAST] = {0.0f};
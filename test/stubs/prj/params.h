@@ -0,0 +1,28 @@
+#ifndef PARAMS_H
+#define PARAMS_H
+#include <stdint.h>
+#include "param_prj.h"
+
+// Parameter stub with the complete list of param_prj.h, for host builds
+// that link several modules at once (make loadtest).
+class Param {
+public:
+#define PARAM_ENTRY(category, name, unit, min, max, def, id) name,
+#define TESTP_ENTRY(category, name, unit, min, max, def, id) name,
+#define VALUE_ENTRY(name, unit, id) name,
+    enum PARAM_NUM { PARAM_LIST PARAM_LAST };
+#undef PARAM_ENTRY
+#undef TESTP_ENTRY
+#undef VALUE_ENTRY
+
+    static void SetFloat(PARAM_NUM idx, float val) { floatValues[idx] = val; }
+    static float GetFloat(PARAM_NUM idx) { return floatValues[idx]; }
+    static void SetInt(PARAM_NUM idx, int val) { values[idx] = val; }
+    static int  GetInt(PARAM_NUM idx) { return values[idx]; }
+
+private:
+    static int values[PARAM_LAST];
+    static float floatValues[PARAM_LAST];
+};
+
+#endif
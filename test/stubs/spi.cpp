@@ -0,0 +1,244 @@
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/spi.h>
+#include <string.h>
+#include "digio.h"
+
+// 72 MHz core, SPI2 at APB1 (36 MHz) / 8 = 4.5 MHz
+#define BYTE_CYCLES 128   // the CPU spins in spi_xfer() for the whole byte
+#define ACCESS_CYCLES 2   // peripheral register access over APB
+#define IRQ_CYCLES 24     // exception entry and exit
+
+#define CANSTAT 0x0E
+#define CANCTRL 0x0F
+#define CANINTF 0x2C
+
+extern "C" void dma1_channel4_isr(void);
+
+volatile uint32_t spi_stub_dr;
+uint32_t spi_stub_cpu_cycles = 0;
+
+struct Channel {
+    uint32_t memory;
+    uint16_t number;
+    bool enabled;
+    bool tcie;
+    bool tcif;
+};
+
+static Channel channels[8];
+static bool rxDma, txDma;
+
+// MCP2515, a new command starts with every chip select edge
+static uint8_t regs[128];
+static int lastEdges = -1;
+static int pos;
+static uint8_t cmd, addr, bitMask;
+static uint8_t clearFlags; // RXnIF cleared when the RX buffer read ends
+static int errors;
+
+// The DMA addresses are 32 bit, the upper half comes from our own data segment
+static uint8_t* Memory(uint32_t address)
+{
+    return (uint8_t*)(((uintptr_t)regs & ~(uintptr_t)0xFFFFFFFF) | address);
+}
+
+static void EndCommand()
+{
+    regs[CANINTF] &= ~clearFlags;
+    clearFlags = 0;
+}
+
+static void WriteReg(uint8_t a, uint8_t value)
+{
+    regs[a & 0x7F] = value;
+    if ((a & 0x7F) == CANCTRL)
+        regs[CANSTAT] = (regs[CANSTAT] & 0x1F) | (value & 0xE0); // mode changes at once
+}
+
+static uint8_t Status()
+{
+    const uint8_t intf = regs[CANINTF];
+
+    return (intf & 0x03) | ((regs[0x30] & 0x08) >> 1) | ((intf & 0x04) << 1) |
+           ((regs[0x40] & 0x08) << 1) | ((intf & 0x08) << 2) | ((regs[0x50] & 0x08) << 3) | ((intf & 0x10) << 3);
+}
+
+static uint8_t RxStatus()
+{
+    const uint8_t intf = regs[CANINTF];
+    const uint8_t sidl = (intf & 0x01) ? regs[0x62] : regs[0x72];
+    uint8_t status = ((intf & 0x01) << 6) | ((intf & 0x02) << 6);
+
+    if ((intf & 0x03) && (sidl & 0x08))
+        status |= 0x10;
+    return status;
+}
+
+static uint8_t Exchange(uint8_t mosi)
+{
+    static const uint8_t rxStart[] = { 0x61, 0x66, 0x71, 0x76 };
+    static const uint8_t txStart[] = { 0x31, 0x36, 0x41, 0x46, 0x51, 0x56 };
+    uint8_t miso = 0;
+
+    if (DigIo::mcp_cs.GetEdges() != lastEdges) {
+        EndCommand();
+        lastEdges = DigIo::mcp_cs.GetEdges();
+        pos = 0;
+    }
+    if (DigIo::mcp_cs.Get()) {
+        errors++;
+        return 0xFF;
+    }
+
+    if (pos == 0) {
+        cmd = mosi;
+        if ((cmd & 0xF9) == 0x90) {
+            addr = rxStart[(cmd >> 1) & 3];
+            clearFlags = (cmd & 0x04) ? 0x02 : 0x01;
+        } else if ((cmd & 0xF8) == 0x40 && (cmd & 7) < 6) {
+            addr = txStart[cmd & 7];
+        } else if ((cmd & 0xF8) == 0x80) {
+            for (int b = 0; b < 3; b++)
+                if (cmd & (1 << b))
+                    regs[0x30 + b * 0x10] |= 0x08;
+        } else if (cmd == 0xC0) {
+            memset(regs, 0, sizeof(regs));
+            regs[CANSTAT] = 0x80;
+            regs[CANCTRL] = 0x87;
+        }
+    } else if (cmd == 0x03) {
+        if (pos == 1)
+            addr = mosi;
+        else
+            miso = regs[addr++ & 0x7F];
+    } else if (cmd == 0x02) {
+        if (pos == 1)
+            addr = mosi;
+        else
+            WriteReg(addr++, mosi);
+    } else if (cmd == 0x05) {
+        if (pos == 1)
+            addr = mosi;
+        else if (pos == 2)
+            bitMask = mosi;
+        else if (pos == 3)
+            WriteReg(addr, (regs[addr & 0x7F] & ~bitMask) | (mosi & bitMask));
+    } else if ((cmd & 0xF9) == 0x90) {
+        miso = regs[addr++ & 0x7F];
+    } else if ((cmd & 0xF8) == 0x40) {
+        regs[addr++ & 0x7F] = mosi;
+    } else if (cmd == 0xA0) {
+        miso = Status();
+    } else if (cmd == 0xB0) {
+        miso = RxStatus();
+    }
+    pos++;
+    return miso;
+}
+
+void spi_enable(uint32_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+void spi_enable_rx_dma(uint32_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; rxDma = true; }
+void spi_enable_tx_dma(uint32_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; txDma = true; }
+
+uint16_t spi_xfer(uint32_t, uint16_t data)
+{
+    spi_stub_cpu_cycles += 2 * ACCESS_CYCLES + BYTE_CYCLES;
+    return Exchange(data);
+}
+
+// The peripheral address, direction and sizes are taken for granted: RX is
+// channel 4, TX channel 5, both 8 bit on SPI2_DR
+void dma_channel_reset(uint32_t, uint8_t channel)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    memset(&channels[channel], 0, sizeof(Channel));
+}
+
+void dma_set_peripheral_address(uint32_t, uint8_t, uint32_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+void dma_set_read_from_peripheral(uint32_t, uint8_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+void dma_set_read_from_memory(uint32_t, uint8_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+void dma_enable_memory_increment_mode(uint32_t, uint8_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+void dma_set_peripheral_size(uint32_t, uint8_t, uint32_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+void dma_set_memory_size(uint32_t, uint8_t, uint32_t) { spi_stub_cpu_cycles += ACCESS_CYCLES; }
+
+void dma_set_memory_address(uint32_t, uint8_t channel, uint32_t address)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    channels[channel].memory = address;
+}
+
+void dma_set_number_of_data(uint32_t, uint8_t channel, uint16_t number)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    channels[channel].number = number;
+}
+
+void dma_enable_transfer_complete_interrupt(uint32_t, uint8_t channel)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    channels[channel].tcie = true;
+}
+
+// The bus runs as soon as both channels are enabled, the CPU is not involved
+void dma_enable_channel(uint32_t, uint8_t channel)
+{
+    Channel& rx = channels[DMA_CHANNEL4];
+    Channel& tx = channels[DMA_CHANNEL5];
+
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    channels[channel].enabled = true;
+
+    if (!rx.enabled || !tx.enabled || !rxDma || !txDma || rx.number != tx.number)
+        return;
+
+    for (int i = 0; i < tx.number; i++)
+        Memory(rx.memory)[i] = Exchange(Memory(tx.memory)[i]);
+
+    rx.tcif = tx.tcif = true;
+}
+
+void dma_disable_channel(uint32_t, uint8_t channel)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    channels[channel].enabled = false;
+}
+
+void dma_clear_interrupt_flags(uint32_t, uint8_t channel, uint32_t interrupts)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    if (interrupts & DMA_TCIF)
+        channels[channel].tcif = false;
+}
+
+bool dma_get_interrupt_flag(uint32_t, uint8_t channel, uint32_t interrupts)
+{
+    spi_stub_cpu_cycles += ACCESS_CYCLES;
+    return (interrupts & DMA_TCIF) && channels[channel].tcif;
+}
+
+bool spi_stub_irq(void)
+{
+    if (!channels[DMA_CHANNEL4].tcie || !channels[DMA_CHANNEL4].tcif)
+        return false;
+
+    spi_stub_cpu_cycles += IRQ_CYCLES;
+    dma1_channel4_isr();
+    return true;
+}
+
+uint8_t spi_stub_mcp_reg(uint8_t a)
+{
+    if (DigIo::mcp_cs.Get())
+        EndCommand();
+    return regs[a & 0x7F];
+}
+
+void spi_stub_mcp_set_reg(uint8_t a, uint8_t value)
+{
+    regs[a & 0x7F] = value;
+}
+
+int spi_stub_errors(void)
+{
+    return errors;
+}
@@ -0,0 +1,4 @@
+#ifndef STM32_CAN_H
+#define STM32_CAN_H
+#include "canhardware.h"
+#endif
@@ -0,0 +1,51 @@
+#include "can_bus_load.h"
+#include <cassert>
+#include <cstdio>
+
+int main() {
+    // Worst case stuffing: 8 byte frames are 135 and 160 bits long
+    assert(CanBusLoad::FrameBits(false, 8) == 135);
+    assert(CanBusLoad::FrameBits(true, 8) == 160);
+    assert(CanBusLoad::FrameBits(false, 0) == 55);
+    assert(CanBusLoad::FrameBits(true, 0) == 80);
+
+    CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN1, 500000);
+    CanBusLoad::SetBitrate(CAN_BUS_LOAD_CAN2, 250000);
+
+    // 100 ms at 500 kbit/s hold 50000 bits, 370 standard 8 byte frames are 49950
+    for (int i = 0; i < 370; i++)
+        CanBusLoad::Record(CAN_BUS_LOAD_CAN1, 0x210U, 8);
+    // Extended by value and by legacy flag
+    CanBusLoad::Record(CAN_BUS_LOAD_CAN2, 0x1A55549DU, 8);
+    CanBusLoad::Record(CAN_BUS_LOAD_CAN2, 0x80000123U, 8);
+    CanBusLoad::Record(CAN_BUS_LOAD_CAN2, 0x123U, 12); // DLC is capped
+    CanBusLoad::Update();
+    assert(CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN1) == 999);
+    assert(CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN1) == 99);
+    assert(CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN1) == 999);
+    assert(CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN2) == (160 + 160 + 135) * 10000 / 250000);
+    // No bitrate, no load
+    CanBusLoad::Record(CAN_BUS_LOAD_CAN3, 0x100U, 8);
+    assert(CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN3) == 0);
+
+    // 25% for the rest of the second: 92 frames are 12420 of 50000 bits
+    for (int w = 1; w < CAN_BUS_LOAD_WINDOWS; w++) {
+        for (int i = 0; i < 92; i++)
+            CanBusLoad::Record(CAN_BUS_LOAD_CAN1, 0x210U, 8);
+        CanBusLoad::Update();
+        assert(CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN1) == 248);
+    }
+    assert(CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN1) == (49950 + 9 * 12420) * 1000 / 500000);
+    assert(CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN1) == 999);
+
+    // The busy window leaves the 1 s average, the peak stays until reset
+    CanBusLoad::Update();
+    assert(CanBusLoad::GetLoad(CAN_BUS_LOAD_CAN1) == 0);
+    assert(CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN1) == 9 * 12420 * 1000 / 500000);
+    assert(CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN1) == 999);
+    CanBusLoad::ResetPeak();
+    assert(CanBusLoad::GetPeak(CAN_BUS_LOAD_CAN1) == 0);
+
+    printf("CAN1 1 s load %u.%u%%\n", CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN1) / 10, CanBusLoad::GetLoad1s(CAN_BUS_LOAD_CAN1) % 10);
+    return 0;
+}
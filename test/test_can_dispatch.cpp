@@ -0,0 +1,91 @@
+#include "can_dispatch.h"
+#include <cassert>
+
+struct Module {
+    int calls = 0;
+    uint32_t lastId = 0;
+    uint8_t lastDlc = 0;
+    bool lastExt = false;
+    const uint32_t* lastWords = nullptr;
+};
+
+static void Handler(void* ctx, const CanFrame& frame)
+{
+    Module* m = static_cast<Module*>(ctx);
+    m->calls++;
+    m->lastId = frame.GetId();
+    m->lastDlc = frame.GetDlc();
+    m->lastExt = frame.IsExtended();
+    m->lastWords = frame.Words();
+}
+
+static void OtherHandler(void* ctx, const CanFrame& frame)
+{
+    Handler(ctx, frame);
+}
+
+int main() {
+    Module a, b;
+    uint32_t data[2] = {0, 0};
+
+    CanDispatch::BeginUpdate();
+    assert(CanDispatch::Register(0x565, Handler, &a));
+    assert(CanDispatch::Register(0x41A, Handler, &b));
+    assert(CanDispatch::Register(0x1A55549D, Handler, &a));
+    // Legacy flag-encoded ID collapses onto the raw 29-bit entry
+    assert(CanDispatch::Register(0x9A55549D, Handler, &a));
+    // Same ID claimed by a different handler is refused
+    assert(!CanDispatch::Register(0x41A, OtherHandler, &a));
+
+    // Not ready while the table is rebuilt: nothing dispatched, nothing counted
+    assert(CanDispatch::Dispatch(0x565, data, 8) == -1);
+    assert(a.calls == 0);
+    assert(CanDispatch::GetUnmatched() == 0);
+    CanDispatch::EndUpdate();
+
+    assert(CanDispatch::GetNumEntries() == 3);
+    // Sorted by ID
+    assert(CanDispatch::GetId(0) == 0x41A);
+    assert(CanDispatch::GetId(1) == 0x565);
+    assert(CanDispatch::GetId(2) == 0x1A55549D);
+
+    assert(CanDispatch::Dispatch(0x565, data, 8) == 1);
+    assert(a.calls == 1 && a.lastId == 0x565 && a.lastDlc == 8 && !a.lastExt);
+    // The handler sees the caller's buffer, not a copy
+    assert(a.lastWords == data);
+    assert(CanDispatch::Dispatch(0x41A, data, 6) == 0);
+    assert(b.calls == 1 && b.lastDlc == 6);
+    assert(CanDispatch::Dispatch(0x9A55549D, data, 8) == 2);
+    assert(a.calls == 2 && a.lastId == 0x1A55549D && a.lastExt);
+
+    assert(CanDispatch::Dispatch(0x123, data, 8) == -1);
+    assert(CanDispatch::Dispatch(0x7FF, data, 8) == -1);
+    // Extended frame with the number of a registered standard ID
+    assert(CanDispatch::Dispatch(0x80000565, data, 8) == -1);
+    assert(CanDispatch::GetUnmatched() == 3);
+    assert(a.calls == 2 && b.calls == 1);
+    assert(!CanDispatch::IsExtended(1) && CanDispatch::IsExtended(2));
+
+    // Standard and extended ID with the same number get their own entries
+    CanDispatch::BeginUpdate();
+    assert(CanDispatch::Register(0x123, Handler, &a));
+    assert(CanDispatch::Register(0x80000123, Handler, &b));
+    CanDispatch::EndUpdate();
+    assert(CanDispatch::GetNumEntries() == 2);
+    assert(CanDispatch::Dispatch(0x80000123, data, 8) >= 0);
+    assert(b.calls == 2 && b.lastId == 0x123 && b.lastExt);
+    assert(CanDispatch::Dispatch(0x123, data, 8) >= 0);
+    assert(a.calls == 3 && !a.lastExt);
+
+    // Table is full at CAN_DISPATCH_MAX_ENTRIES
+    CanDispatch::BeginUpdate();
+    for (uint32_t id = 0; id < CAN_DISPATCH_MAX_ENTRIES; id++)
+        assert(CanDispatch::Register(0x700 - id, Handler, &a));
+    assert(!CanDispatch::Register(0x701, Handler, &a));
+    CanDispatch::EndUpdate();
+    for (int i = 1; i < CanDispatch::GetNumEntries(); i++)
+        assert(CanDispatch::GetId(i - 1) < CanDispatch::GetId(i));
+    assert(CanDispatch::Dispatch(0x6F0, data, 8) >= 0);
+
+    return 0;
+}
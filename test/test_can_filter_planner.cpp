@@ -0,0 +1,139 @@
+#include "can_filter_planner.h"
+#include <cassert>
+#include <cstdio>
+
+// Evaluates the planned banks of an interface the way the bxCAN does
+static bool Accepts(int iface, uint32_t id, bool ext)
+{
+    const uint32_t std16 = id << 5;
+    const uint32_t ext32 = (id << 3) | 0x4;
+
+    for (int i = 0; i < CanFilterPlanner::GetNumBanks(); i++) {
+        const CanFilterPlanner::Bank& b = CanFilterPlanner::GetBank(i);
+        if (b.iface != iface)
+            continue;
+
+        switch (b.mode) {
+        case CanFilterPlanner::LIST16:
+            if (!ext && (std16 == (b.fr1 & 0xFFFF) || std16 == (b.fr1 >> 16) ||
+                         std16 == (b.fr2 & 0xFFFF) || std16 == (b.fr2 >> 16)))
+                return true;
+            break;
+        case CanFilterPlanner::MASK16:
+            if (!ext && ((std16 & (b.fr1 >> 16)) == (b.fr1 & (b.fr1 >> 16) & 0xFFFF) ||
+                         (std16 & (b.fr2 >> 16)) == (b.fr2 & (b.fr2 >> 16) & 0xFFFF)))
+                return true;
+            break;
+        case CanFilterPlanner::LIST32:
+            if (ext && (ext32 == b.fr1 || ext32 == b.fr2))
+                return true;
+            break;
+        case CanFilterPlanner::MASK32:
+            if (ext && (ext32 & b.fr2) == (b.fr1 & b.fr2))
+                return true;
+            break;
+        }
+    }
+    return false;
+}
+
+static uint32_t CountAccepted(int iface, bool ext, uint32_t first, uint32_t last)
+{
+    uint32_t n = 0;
+    for (uint32_t id = first; id <= last; ++id)
+        n += Accepts(iface, id, ext);
+    return n;
+}
+
+int main() {
+    // Registrations of this firmware: CAN1 DCDC, SDO; CAN2 BMS, MLB charger, mVCU, SDO
+    CanFilterPlanner::Begin();
+    assert(CanFilterPlanner::Add(0, 0x210));
+    assert(CanFilterPlanner::Add(0, 0x601));
+    const uint32_t can2[] = {
+        0x41A, 0x41B, 0x41C, 0x41D, 0x41E,
+        0x488, 0x53C, 0x564, 0x565, 0x67E,
+        0x1A55549D, 0x9A55549D, 0x1A555515, 0x9A555515, 0x12DD5472, 0x92DD5472,
+        0x12DD5491, 0x92DD5491, 0x1A55554D, 0x9A55554D, 0x17F00044, 0x97F00044,
+        0x43A, 0x601, 0x601
+    };
+    for (uint32_t id : can2)
+        assert(CanFilterPlanner::Add(1, id));
+    assert(CanFilterPlanner::GetIds(0) == 2);
+    assert(CanFilterPlanner::GetIds(1) == 18); // legacy duplicates folded
+
+    // Fits easily: exact lists only, CAN2 starts right after CAN1
+    assert(CanFilterPlanner::Plan() == 1 + 3 + 3);
+    assert(CanFilterPlanner::GetFirstBank(1) == 1);
+    assert(CanFilterPlanner::GetExtra() == 0);
+    for (uint32_t id : can2)
+        assert(Accepts(1, id & 0x1FFFFFFF, id > 0x7FF));
+    assert(Accepts(0, 0x210, false) && !Accepts(1, 0x210, false));
+    assert(CountAccepted(1, false, 0, 0x7FF) == 12);
+    assert(!Accepts(1, 0, false)); // padding must not admit ID 0
+    assert(!Accepts(1, 0x41A, true));
+
+    // An aligned block is folded into a mask for free
+    CanFilterPlanner::Begin();
+    for (uint32_t id = 0x418; id <= 0x41F; ++id)
+        CanFilterPlanner::Add(0, id);
+    assert(CanFilterPlanner::Plan() == 1);
+    assert(CanFilterPlanner::GetBank(0).mode == CanFilterPlanner::MASK16);
+    assert(CanFilterPlanner::GetExtra() == 0);
+    assert(CountAccepted(0, false, 0, 0x7FF) == 8);
+
+    // An interface without IDs still takes up the CAN2 start bank
+    CanFilterPlanner::Begin();
+    CanFilterPlanner::Add(1, 0x100);
+    assert(CanFilterPlanner::Plan() == 1);
+    assert(CanFilterPlanner::GetFirstBank(1) == 1);
+    assert(CanFilterPlanner::GetBank(0).iface == CAN_FILTER_UNUSED);
+    assert(Accepts(1, 0x100, false) && !Accepts(0, 0x100, false));
+
+    // Out of banks: neighbouring IDs share masks, nothing registered is lost
+    CanFilterPlanner::Begin();
+    for (uint32_t i = 0; i < 48; ++i) {
+        CanFilterPlanner::Add(0, 0x100 + i * 3);
+        CanFilterPlanner::Add(1, 0x18DA0000 + i * 5);
+    }
+    const int used = CanFilterPlanner::Plan(10);
+    assert(used > 0 && used <= 10);
+    assert(CanFilterPlanner::GetNumBanks() <= 10);
+    for (uint32_t i = 0; i < 48; ++i) {
+        assert(Accepts(0, 0x100 + i * 3, false));
+        assert(Accepts(1, 0x18DA0000 + i * 5, true));
+    }
+    const uint32_t accepted = CountAccepted(0, false, 0, 0x7FF);
+    assert(accepted - 48 == CanFilterPlanner::GetExtra(0));
+    printf("48+48 IDs in 10 banks: %d banks, %u extra IDs admitted\n", used, CanFilterPlanner::GetExtra());
+
+    // Even a single bank per interface works, at the cost of accepting more
+    assert(CanFilterPlanner::Plan(2) == 2);
+    assert(Accepts(0, 0x100, false) && Accepts(1, 0x18DA0000 + 47 * 5, true));
+
+    // Full
+    CanFilterPlanner::Begin();
+    for (uint32_t i = 0; i < CAN_FILTER_MAX_IDS; ++i)
+        assert(CanFilterPlanner::Add(0, i));
+    assert(!CanFilterPlanner::Add(0, 0x700));
+    assert(CanFilterPlanner::Add(0, 0x10)); // already there
+    assert(!CanFilterPlanner::Add(2, 0x10));
+    // The IDs that did not fit still get through, the standard filter is open
+    assert(CanFilterPlanner::Plan() > 0);
+    assert(CanFilterPlanner::IsOverflowed(0) && !CanFilterPlanner::IsOverflowed(1));
+    assert(CountAccepted(0, false, 0, 0x7FF) == 0x800);
+    assert(!Accepts(0, 0x10, true));
+
+    // A full table of extended IDs and one standard ID too many
+    CanFilterPlanner::Begin();
+    for (uint32_t i = 0; i < CAN_FILTER_MAX_IDS; ++i)
+        assert(CanFilterPlanner::Add(1, 0x18DA0000 + i * 5));
+    assert(!CanFilterPlanner::Add(1, 0x123));
+    assert(CanFilterPlanner::Plan() > 0);
+    assert(CountAccepted(1, false, 0, 0x7FF) == 0x800);
+    for (uint32_t i = 0; i < CAN_FILTER_MAX_IDS; ++i)
+        assert(Accepts(1, 0x18DA0000 + i * 5, true));
+    assert(!Accepts(1, 0x18DA0001, true));
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include "can_frame.h"
+#include <cassert>
+#include <cstring>
+
+int main() {
+    // Bytes 0..7 as they arrive, the driver stores them little endian in two words
+    const uint8_t bytes[8] = {0x88, 0x13, 0x34, 0x12, 0xFE, 0x7F, 0x0A, 0xC5};
+    uint32_t words[2];
+    memcpy(words, bytes, 8);
+
+    const CanFrame f(0x41A, words, 8);
+    assert(f.GetId() == 0x41A && !f.IsExtended() && f.GetDlc() == 8);
+    assert(f.Words() == words);
+    for (int i = 0; i < 8; ++i) {
+        assert(f.Byte(i) == bytes[i]);
+        assert(f.Bytes()[i] == bytes[i]);
+    }
+    assert(f.Word(0) == 0x12341388 && f.Word(1) == 0xC50A7FFE);
+    assert(f.Le16(0) == 5000 && f.Le16(2) == 0x1234 && f.Le16(4) == 0x7FFE);
+    assert(f.Le16(3) == 0xFE12); // crosses the word boundary
+    assert(f.Field(0, 4) == 0x8 && f.Field(4, 4) == 0x8);
+    assert(f.Field(48, 4) == 0xA); // counter nibble of byte 6
+    assert(f.Field(28, 12) == 0xFE1);
+    assert(f.Field(32, 32) == 0xC50A7FFE);
+    assert(f.Raw() == 0xC50A7FFE12341388ULL);
+
+    // Extended IDs, raw and legacy flag-encoded
+    assert(CanFrame(0x1A55549D, words, 8).IsExtended());
+    assert(CanFrame(0x9A55549D, words, 8).GetId() == 0x1A55549D);
+    assert(CanFrame(0x80000100, words, 8).IsExtended());
+    assert(CanFrame(0x80000100, words, 8).GetId() == 0x100);
+    assert(!CanFrame(0x7FF, words, 8).IsExtended());
+
+    // DLC is clamped to the classic CAN payload
+    assert(CanFrame(0x100, words, 15).GetDlc() == 8);
+    assert(CanFrame(0x100, words, 3).GetDlc() == 3);
+
+    // The getters are usable in constant expressions
+    static constexpr uint32_t constWords[2] = {0x00000201, 0x04000000};
+    static_assert(CanFrame(0x123, constWords, 8).Le16(0) == 0x0201, "Le16");
+    static_assert(CanFrame(0x123, constWords, 8).Byte(7) == 0x04, "Byte");
+    static_assert(CanFrame(0x123, constWords, 8).Field(58, 1) == 1, "Field");
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "can_gateway.h"
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+class MockCanHardware : public CanHardware {
+public:
+    std::vector<int> registered;
+    std::vector<int> sentIds;
+    uint8_t* lastData = nullptr;
+    int lastLen = 0;
+
+    void RegisterUserMessage(int id) override { registered.push_back(id); }
+    void Send(int id, uint8_t* data, int len) override {
+        sentIds.push_back(id);
+        lastData = data;
+        lastLen = len;
+    }
+};
+
+int main() {
+    MockCanHardware can1, can2;
+    CanHardware* interfaces[CAN_GATEWAY_IFACES] = { &can1, &can2, nullptr };
+    uint32_t data[2] = { 0x04030201, 0x08070605 };
+
+    CanGateway::SetInterfaces(interfaces);
+    CanGateway::BeginUpdate();
+    // BMS CAN2 -> charger CAN1 unchanged, the VCU status moved to 0x51A
+    assert(CanGateway::AddRoute(1, 0x41A, 0x3, 0, 0, false));
+    assert(CanGateway::AddRoute(1, 0x41E, 0, 0, 0x51A, false));
+    // Range moved as a block, to a missing interface
+    assert(CanGateway::AddRoute(0, 0x210, 0x1, 2, 0x310, false));
+    assert(!CanGateway::AddRoute(0, 0x100, 0, 0, 0, false));     // loop
+    assert(!CanGateway::AddRoute(0, 0x100, 0x1F, 1, 0, false));  // too many IDs
+    assert(CanGateway::AddRoute(1, 0x43A, 0, 0, 0, false));
+    assert(!CanGateway::AddRoute(1, 0x43B, 0, 0, 0, false));     // full
+    CanGateway::EndUpdate();
+
+    CanGateway::RegisterIds();
+    assert(can2.registered.size() == 4 + 1 + 1);
+    assert(can2.registered[0] == 0x418 && can2.registered[3] == 0x41B);
+    assert(can1.registered.size() == 2 && can1.registered[1] == 0x211);
+
+    // The driver's buffer goes to Send() as is
+    CanGateway::Forward(1, 0x419, data, 8);
+    assert(can1.sentIds.size() == 1 && can1.sentIds[0] == 0x419);
+    assert(can1.lastData == reinterpret_cast<uint8_t*>(data) && can1.lastLen == 8);
+    CanGateway::Forward(1, 0x41E, data, 4);
+    assert(can1.sentIds[1] == 0x51A && can1.lastLen == 4);
+    // Wrong source, unrouted ID
+    CanGateway::Forward(0, 0x419, data, 8);
+    CanGateway::Forward(1, 0x41C, data, 8);
+    assert(can1.sentIds.size() == 2 && can2.sentIds.empty());
+
+    CanGateway::Forward(0, 0x211, data, 8);
+    assert(CanGateway::GetRoute(2).dropped == 1);
+    assert(CanGateway::GetForwarded() == 2);
+    assert(CanGateway::GetDropped() == 1);
+
+    // Extended routes match both encodings and send with the IDE flag
+    CanGateway::BeginUpdate();
+    assert(CanGateway::AddRoute(1, 0x17F00044, 0, 0, 0x17F00045, true));
+    assert(!CanGateway::AddRoute(1, 0x17F00044, 0, 0, 0, false)); // beyond 11 bits
+    CanGateway::EndUpdate();
+    CanGateway::Forward(1, 0x97F00044, data, 8);
+    assert(can1.sentIds.back() == (int)0x97F00045);
+    CanGateway::Forward(1, 0x17F00044, data, 8); // unflagged, as Stm32Can delivers it
+    assert(can1.sentIds.size() == 4 && can1.sentIds.back() == (int)0x97F00045);
+
+    // Same 11 bit value, the IDE bit tells the routes apart. Only the MCP2515
+    // (CAN3) flags it, Stm32Can delivers the extended 0x123 as plain 0x123.
+    MockCanHardware can3;
+    interfaces[CAN_GATEWAY_CAN3] = &can3;
+    can1.sentIds.clear();
+    can2.registered.clear();
+    CanGateway::BeginUpdate();
+    assert(CanGateway::AddRoute(1, 0x123, 0, 0, 0, false));
+    assert(CanGateway::AddRoute(CAN_GATEWAY_CAN3, 0x123, 0, 1, 0x124, true));
+    assert(!CanGateway::AddRoute(1, 0x123, 0, 0, 0, true));       // never matches on CAN2
+    assert(!CanGateway::AddRoute(0, 0x1000, 0x1000, 1, 0, true)); // 0x000 is in the range
+    CanGateway::EndUpdate();
+    CanGateway::RegisterIds();
+    assert(can2.registered.size() == 1 && can2.registered[0] == 0x123);
+    assert(can3.registered.size() == 1 && can3.registered[0] == (int)0x80000123);
+    CanGateway::Forward(CAN_GATEWAY_CAN3, 0x123, data, 8); // standard, no route
+    assert(can1.sentIds.empty() && can2.sentIds.empty());
+    CanGateway::Forward(1, 0x123, data, 8);
+    CanGateway::Forward(CAN_GATEWAY_CAN3, 0x80000123, data, 8);
+    assert(can1.sentIds.size() == 1 && can1.sentIds[0] == 0x123);
+    assert(can2.sentIds.size() == 1 && can2.sentIds[0] == (int)0x80000124);
+
+    // Nothing is forwarded while the routes are rebuilt
+    CanGateway::BeginUpdate();
+    CanGateway::Forward(1, 0x123, data, 8);
+    assert(can1.sentIds.size() == 1);
+
+    return 0;
+}
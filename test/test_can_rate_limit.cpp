@@ -0,0 +1,70 @@
+#include "can_rate_limit.h"
+#include <cassert>
+
+static void Handler(void*, const CanFrame&) {}
+
+int main() {
+    CanDispatch::BeginUpdate();
+    CanDispatch::Register(0x41A, Handler, nullptr);
+    CanDispatch::Register(0x12DD5472, Handler, nullptr);
+    CanDispatch::EndUpdate();
+    const int bms = CanDispatch::Find(0x41A);
+    const int mlb = CanDispatch::Find(0x12DD5472);
+
+    // Off: everything passes
+    CanRateLimit::SetBudget(0, 10);
+    CanRateLimit::Reset();
+    for (int i = 0; i < 1000; i++)
+        assert(CanRateLimit::Admit(bms, 0));
+    assert(CanRateLimit::GetDropped() == 0);
+
+    // 100 frames/s, burst of 5
+    CanRateLimit::SetBudget(100, 5);
+    CanRateLimit::Reset();
+    uint32_t t = 1000000;
+    int passed = 0;
+    for (int i = 0; i < 20; i++)
+        passed += CanRateLimit::Admit(bms, t);
+    assert(passed == 5);
+    assert(CanRateLimit::GetDropped() == 15 && CanRateLimit::GetDropped(bms) == 15);
+
+    // Flooding at 1 frame per 100 us for one second, 100 pass
+    passed = 0;
+    for (int i = 0; i < 10000; i++) {
+        t += 100;
+        passed += CanRateLimit::Admit(bms, t);
+    }
+    assert(passed == 100);
+    CanRateLimit::Update();
+    assert(CanRateLimit::GetOffender() == 0x41A);
+
+    // A well behaved ID at its budget is never limited, the other one is independent
+    for (int i = 0; i < 1000; i++) {
+        t += 10000;
+        assert(CanRateLimit::Admit(mlb, t));
+    }
+    assert(CanRateLimit::GetDropped(mlb) == 0);
+
+    // The offender sticks, the ID with the most new drops takes over
+    CanRateLimit::Update();
+    assert(CanRateLimit::GetOffender() == 0x41A);
+    for (int i = 0; i < 20; i++)
+        CanRateLimit::Admit(mlb, t);
+    CanRateLimit::Admit(bms, t);
+    CanRateLimit::Update();
+    assert(CanRateLimit::GetOffender() == 0x12DD5472);
+
+    // Idle time refills up to the burst only, also across the us wrap
+    t = 0xFFFFFFF0;
+    CanRateLimit::Admit(bms, t);
+    t += 60 * 1000000;
+    passed = 0;
+    for (int i = 0; i < 20; i++)
+        passed += CanRateLimit::Admit(bms, t);
+    assert(passed == 5);
+
+    CanRateLimit::Reset();
+    assert(CanRateLimit::GetDropped() == 0 && CanRateLimit::GetOffender() == 0);
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include "can_rx_queue.h"
+#include <cassert>
+
+int main() {
+    CanRxFrame frame;
+    uint32_t data[2] = {0, 0};
+
+    assert(!CanRxQueue::Pop(frame));
+    assert(CanRxQueue::Count() == 0);
+
+    // FIFO order, payload and timestamp are kept
+    for (uint32_t i = 0; i < 5; ++i) {
+        data[0] = i;
+        data[1] = ~i;
+        assert(CanRxQueue::Push(0x400 + i, data, 8, 100 + i));
+    }
+    assert(CanRxQueue::Count() == 5);
+    for (uint32_t i = 0; i < 5; ++i) {
+        assert(CanRxQueue::Pop(frame));
+        assert(frame.id == 0x400 + i);
+        assert(frame.data[0] == i && frame.data[1] == ~i);
+        assert(frame.dlc == 8);
+        assert(frame.timestamp == 100 + i);
+    }
+    assert(!CanRxQueue::Pop(frame));
+    assert(CanRxQueue::GetHighWaterMark() == 5);
+
+    // Overflow drops the newest frames and counts them
+    for (uint32_t i = 0; i < CAN_RX_QUEUE_SIZE + 3; ++i)
+        CanRxQueue::Push(i, data, 8, i);
+    assert(CanRxQueue::Count() == CAN_RX_QUEUE_SIZE);
+    assert(CanRxQueue::GetOverflows() == 3);
+    assert(CanRxQueue::GetHighWaterMark() == CAN_RX_QUEUE_SIZE);
+    for (uint32_t i = 0; i < CAN_RX_QUEUE_SIZE; ++i) {
+        assert(CanRxQueue::Pop(frame));
+        assert(frame.id == i);
+    }
+
+    // Interleaved use across the wrap of the index
+    for (uint32_t i = 0; i < 10 * CAN_RX_QUEUE_SIZE; ++i) {
+        assert(CanRxQueue::Push(i, data, 4, i));
+        assert(CanRxQueue::Push(i + 1, data, 4, i));
+        assert(CanRxQueue::Pop(frame) && frame.id == i);
+        assert(CanRxQueue::Pop(frame) && frame.id == i + 1);
+    }
+    assert(CanRxQueue::Count() == 0);
+    assert(CanRxQueue::GetOverflows() == 3);
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "can_sniffer.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Everything the UART would send so far
+static std::vector<uint8_t> Drain()
+{
+    std::vector<uint8_t> out;
+    const uint8_t* data;
+    int len;
+
+    while ((len = CanSniffer::Peek(data)) > 0) {
+        out.insert(out.end(), data, data + len);
+        CanSniffer::Consume();
+    }
+    return out;
+}
+
+int main() {
+    const uint8_t payload[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    // Not started, nothing is captured
+    CanSniffer::Capture(0, false, 0x100, payload, 8, 0);
+    assert(Drain().empty());
+
+    CanSniffer::Select(0x3, true, true);
+    assert(CanSniffer::AddFilter(0x418, 0x7F8));
+    assert(CanSniffer::AddFilter(0x17F00044, 0x1FFFFFFF));
+    CanSniffer::Start(1000);
+
+    CanSniffer::Capture(1, false, 0x41A, payload, 8, 1005);
+    CanSniffer::Capture(1, false, 0x43A, payload, 8, 1006); // filtered
+    CanSniffer::Capture(2, false, 0x41A, payload, 8, 1007); // interface not selected
+    CanSniffer::Capture(0, true, 0x97F00044, payload, 2, 1305);
+
+    const std::vector<uint8_t> s = Drain();
+    const uint8_t expected[] = {
+        'Z', 'S', 'N', 'F', CAN_SNIFFER_VERSION,
+        CAN_SNIFFER_SYNC, 12, 0x48, 5, 0x1A, 0x04, 1, 2, 3, 4, 5, 6, 7, 8,    // CAN2 RX, 5 us
+        CAN_SNIFFER_SYNC, 9, 0x32, 0xAC, 0x02, 0x44, 0x00, 0xF0, 0x17, 1, 2, // CAN1 TX extended, 300 us
+    };
+    assert(s.size() == sizeof(expected));
+    assert(memcmp(s.data(), expected, sizeof(expected)) == 0);
+
+    // Direction filter
+    CanSniffer::Select(0x1, false, true);
+    CanSniffer::Start(0);
+    CanSniffer::Capture(0, false, 0x210, payload, 3, 1);
+    assert(Drain().size() == 5);
+
+    // Deltas are us, gaps beyond the cycle counter wrap (59 s) stay exact
+    CanSniffer::Select(0x1, true, true);
+    CanSniffer::Start(0);
+    CanSniffer::Capture(0, false, 0x210, payload, 0, 100000000);
+    const std::vector<uint8_t> gap = Drain();
+    assert(gap.size() == 5 + 3 + 4 + 2 && gap[6] == 7);
+    assert(gap[8] == 0x80 && gap[9] == 0xC2 && gap[10] == 0xD7 && gap[11] == 0x2F);
+
+    // Without a consumer the buffer fills up, the writer drops and counts
+    CanSniffer::Select(0x1, true, true);
+    CanSniffer::Start(0);
+    const int records = 150; // fewer than 128 lost, one byte count
+    for (int i = 0; i < records; i++)
+        CanSniffer::Capture(0, false, 0x210, payload, 8, i);
+    const uint32_t lost = CanSniffer::GetOverflows();
+    assert(lost > 0);
+
+    // The next frame that fits reports the loss first
+    std::vector<uint8_t> full = Drain();
+    CanSniffer::Capture(0, false, 0x211, payload, 0, records);
+    std::vector<uint8_t> tail = Drain();
+    const size_t n = tail.size();
+    assert(tail[0] == CAN_SNIFFER_SYNC && tail[1] == 3 && tail[2] == CAN_SNIFFER_OVERFLOW && tail[3] == 0 && tail[4] == lost);
+    assert(tail[5] == CAN_SNIFFER_SYNC && tail[6] == n - 7 && tail[7] == 0x00);
+    assert(tail[n - 2] == 0x11 && tail[n - 1] == 0x02);
+    assert(full.size() == 5 + (records - lost) * 14);
+
+    // The ring wraps, contents stay in order
+    for (int i = 0; i < 500; i++) {
+        CanSniffer::Capture(0, false, 0x210 + (i & 0xF), payload, 8, records + 1 + i);
+        std::vector<uint8_t> r = Drain();
+        assert(r.size() == 14 && r[0] == CAN_SNIFFER_SYNC && r[4] == 0x10 + (i & 0xF));
+    }
+    assert(CanSniffer::GetOverflows() == lost);
+
+    printf("%d of %d frames lost without a consumer\n", lost, records);
+    return 0;
+}
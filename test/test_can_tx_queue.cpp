@@ -0,0 +1,65 @@
+#include "can_tx_queue.h"
+#include <cassert>
+
+int main() {
+    CanTxQueue queue;
+    CanTxFrame frame;
+    uint32_t data[2] = {0, 0};
+
+    assert(!queue.Pop(frame, 0));
+
+    // Lowest ID first, same ID in FIFO order
+    data[0] = 1;
+    assert(queue.Push(0x5A2, data, 8, 10));
+    data[0] = 2;
+    assert(queue.Push(0x191, data, 8, 11));
+    data[0] = 3;
+    assert(queue.Push(0x5A2, data, 4, 12));
+    data[0] = 4;
+    assert(queue.Push(0x1A555548, data, 8, 13));
+    assert(queue.Count() == 4 && queue.GetMaxDepth() == 4);
+
+    assert(queue.Pop(frame, 20) && frame.id == 0x191 && frame.data[0] == 2);
+    assert(queue.Pop(frame, 21) && frame.id == 0x5A2 && frame.data[0] == 1 && frame.len == 8);
+    assert(queue.Pop(frame, 22) && frame.id == 0x5A2 && frame.data[0] == 3 && frame.len == 4);
+    assert(queue.Pop(frame, 40) && frame.id == 0x1A555548);
+    assert(queue.GetMaxLatency() == 27);
+    assert(!queue.Pop(frame, 41));
+
+    // Urgent IDs overtake bulk traffic with lower IDs
+    assert(CanTxQueue::SetUrgent(0x437));
+    assert(CanTxQueue::SetUrgent(0x437));
+    assert(CanTxQueue::IsUrgent(0x437) && !CanTxQueue::IsUrgent(0x191));
+    assert(queue.Push(0x191, data, 8, 0));
+    assert(queue.Push(0x17B, data, 8, 0));
+    assert(queue.Push(0x437, data, 8, 0));
+    assert(queue.Pop(frame, 0) && frame.id == 0x437);
+    assert(queue.Pop(frame, 0) && frame.id == 0x17B);
+    assert(queue.Pop(frame, 0) && frame.id == 0x191);
+
+    // Full of bulk frames: more bulk is refused, an urgent frame evicts the lowest priority one
+    for (uint32_t i = 0; i < CAN_TX_QUEUE_DEPTH; i++)
+        assert(queue.Push(0x500 + i, data, 8, 0));
+    assert(!queue.Push(0x600, data, 8, 0));
+    assert(queue.GetFailures() == 1);
+    assert(queue.Push(0x437, data, 8, 0));
+    assert(queue.GetFailures() == 2);
+    assert(queue.Count() == CAN_TX_QUEUE_DEPTH);
+    assert(queue.Pop(frame, 0) && frame.id == 0x437);
+    for (uint32_t i = 0; i < CAN_TX_QUEUE_DEPTH - 1; i++)
+        assert(queue.Pop(frame, 0) && frame.id == 0x500 + i); // 0x50F was evicted
+    assert(queue.Count() == 0);
+
+    // Sustained bulk traffic cannot starve an urgent frame
+    for (int round = 0; round < 100; round++) {
+        for (uint32_t i = 0; i < 4; i++)
+            queue.Push(0x100 + i, data, 8, round);
+        if (round % 10 == 0)
+            assert(queue.Push(0x437, data, 8, round));
+        assert(queue.Pop(frame, round));
+        if (round % 10 == 0)
+            assert(frame.id == 0x437);
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "can_tx_timing.h"
+#include <cassert>
+
+int main() {
+    // Timestamps in 1/10 us
+    CanTxTiming::SetTicksPerUs(10);
+    assert(CanTxTiming::Declare(0x191, 10));
+    assert(CanTxTiming::Declare(0x96A955EB, 1000)); // legacy flag-encoded
+    assert(CanTxTiming::GetNumEntries() == 2);
+
+    // 10 ms +-500 us, tolerance 10% is met
+    uint32_t t = 0xFFFF0000; // wraps during the test
+    const int offsets[] = { 0, 500, -500, 200, 0 };
+    for (int i = 0; i < 5; ++i, t += 100000)
+        CanTxTiming::Record(0x191, t + offsets[i] * 10);
+
+    const CanTxTiming::Entry& bms = CanTxTiming::Get(0);
+    assert(bms.count == 4);
+    assert(bms.minUs == 9000 && bms.maxUs == 10700);
+    assert(CanTxTiming::GetMeanUs(bms) == 10000);
+    assert(CanTxTiming::GetJitterUs(bms) == 1700);
+    assert(!CanTxTiming::IsViolation(bms, 10));
+    assert(CanTxTiming::IsViolation(bms, 5));
+
+    // Undeclared IDs are tracked without a reference
+    CanTxTiming::Record(0x555, t);
+    CanTxTiming::Record(0x555, t + 30000);
+    assert(CanTxTiming::GetNumEntries() == 3);
+    assert(CanTxTiming::Get(2).periodMs == 0 && CanTxTiming::Get(2).minUs == 3000);
+    assert(!CanTxTiming::IsViolation(CanTxTiming::Get(2), 1));
+
+    // The extended ID is found with either encoding
+    CanTxTiming::Record(0x16A955EB, t);
+    CanTxTiming::Record(0x96A955EB, t + 12000000);
+    const CanTxTiming::Entry& ext = CanTxTiming::Get(1);
+    assert(ext.count == 1 && ext.maxUs == 1200000);
+    CanTxTiming::Update(t + 12000000, 10);
+    assert(CanTxTiming::GetViolations() == 1);
+
+    // A pause ends the measurement, found by Update() before the timestamps wrap
+    assert(!CanTxTiming::Get(0).running && CanTxTiming::Get(0).pauses == 1);
+    t += 12000000;
+    CanTxTiming::Record(0x191, t);
+    CanTxTiming::Update(t + 390000, 10);
+    assert(CanTxTiming::Get(0).running);
+    CanTxTiming::Update(t + 410000, 10);
+    assert(!CanTxTiming::Get(0).running && CanTxTiming::Get(0).pauses == 2);
+    CanTxTiming::Record(0x191, t + 0x80000000);
+    assert(CanTxTiming::Get(0).count == 4);
+
+    // Reset keeps the declarations
+    CanTxTiming::Reset();
+    assert(CanTxTiming::GetNumEntries() == 3 && CanTxTiming::Get(0).periodMs == 10);
+    assert(CanTxTiming::Get(0).count == 0 && CanTxTiming::GetViolations() == 0);
+
+    // Full
+    for (uint32_t id = 0x600; CanTxTiming::GetNumEntries() < CAN_TX_TIMING_MAX_IDS; ++id)
+        assert(CanTxTiming::Declare(id, 100));
+    assert(!CanTxTiming::Declare(0x7FF, 100));
+    CanTxTiming::Record(0x7FF, 0);
+    assert(CanTxTiming::GetNumEntries() == CAN_TX_TIMING_MAX_IDS);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "canmap_schedule.h"
+#include <cassert>
+#include <cstdio>
+
+int main() {
+    CanMapSchedule::Begin();
+    assert(CanMapSchedule::Add(0x100, 10));
+    assert(CanMapSchedule::Add(0x101, 100));
+    assert(CanMapSchedule::Add(0x102, 100));
+    assert(CanMapSchedule::Add(0x103, 1000));
+    assert(CanMapSchedule::Add(0x104, 5)); // rounded up to one tick
+
+    // Equal periods are staggered
+    assert(CanMapSchedule::Get(1).phaseMs == 0);
+    assert(CanMapSchedule::Get(2).phaseMs == 10);
+    assert(CanMapSchedule::Get(4).periodMs == 10 && CanMapSchedule::Get(4).phaseMs == 0);
+
+    // Over one second every message is sent 1000 / period times
+    int ticksWithTx = 0;
+    for (int t = 0; t < 100; t++) {
+        if (!CanMapSchedule::Advance())
+            continue;
+        ticksWithTx++;
+        // The 10 ms message always passes, the 100 ms ones never together
+        assert(CanMapSchedule::Pass(0x100));
+        assert(!(CanMapSchedule::Pass(0x101) && CanMapSchedule::Pass(0x102)));
+        // Frames that are not mapped are not held back
+        assert(CanMapSchedule::Pass(0x5A1));
+    }
+    assert(ticksWithTx == 100);
+    assert(CanMapSchedule::Get(0).sent == 100);
+    assert(CanMapSchedule::Get(1).sent == 10);
+    assert(CanMapSchedule::Get(2).sent == 10);
+    assert(CanMapSchedule::Get(3).sent == 1);
+
+    // The periodic rebuild keeps the counters of unchanged messages
+    CanMapSchedule::Begin();
+    CanMapSchedule::Add(0x100, 10);
+    CanMapSchedule::Add(0x101, 100);
+    assert(CanMapSchedule::Get(1).sent == 10);
+
+    // Slow messages alone leave most ticks without SendAll()
+    CanMapSchedule::Begin();
+    CanMapSchedule::Add(0x101, 100);
+    CanMapSchedule::Add(0x102, 100);
+    CanMapSchedule::Add(0x200, 500);
+    assert(CanMapSchedule::Get(0).sent == 0); // moved, counted anew
+    ticksWithTx = 0;
+    for (int t = 0; t < 100; t++)
+        ticksWithTx += CanMapSchedule::Advance();
+    assert(ticksWithTx == 20);
+    assert(CanMapSchedule::Get(2).sent == 2);
+
+    // Full
+    CanMapSchedule::Begin();
+    for (int i = 0; i < CANMAP_SCHEDULE_MAX; i++)
+        assert(CanMapSchedule::Add(0x300 + i, 100));
+    assert(!CanMapSchedule::Add(0x400, 100));
+    assert(CanMapSchedule::Get(CANMAP_SCHEDULE_MAX - 1).phaseMs == 90);
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "crc_service.h"
+#include <libopencm3/stm32/crc.h>
+#include <cassert>
+
+static uint32_t rng = 0xCAFEBABE;
+
+static uint32_t NextRandom()
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t Reference(const uint32_t* words, uint32_t count)
+{
+    crc_reset();
+    return crc_calculate_block(words, count);
+}
+
+// Simulated CAN RX interrupt: a full CRC calculation on another frame
+static uint32_t isrWords[2];
+static uint32_t isrResult;
+static int isrPending;
+
+static void IsrHook()
+{
+    if (isrPending <= 0)
+        return;
+    isrPending--;
+    crc_stub_preempt_hook = nullptr; // an ISR is not preempted by the task
+    isrResult = CrcService::Calculate(isrWords, 2);
+    crc_stub_preempt_hook = IsrHook;
+}
+
+int main() {
+    {
+        // Known answer of the STM32 CRC unit
+        const uint32_t word = 0x12345678;
+        assert(CrcService::Calculate(&word, 1) == 0xDF8A8A2B);
+        assert(CrcService::CalculateSoftware(&word, 1) == 0xDF8A8A2B);
+    }
+    {
+        // Software table matches the peripheral bit for bit
+        for (int n = 0; n < 1000; ++n) {
+            uint32_t words[4];
+            for (int i = 0; i < 4; ++i)
+                words[i] = NextRandom();
+            uint32_t count = 1 + n % 4;
+            uint32_t expected = Reference(words, count);
+            assert(CrcService::CalculateSoftware(words, count) == expected);
+            assert(CrcService::Calculate(words, count) == expected);
+        }
+        assert(CrcService::GetRetries() == 0);
+        assert(CrcService::GetFallbacks() == 0);
+    }
+    {
+        // One interrupt in the middle of a task calculation: retried in hardware
+        for (int n = 0; n < 100; ++n) {
+            uint32_t taskWords[2] = { NextRandom(), NextRandom() & 0x00FFFFFF };
+            isrWords[0] = NextRandom();
+            isrWords[1] = NextRandom() & 0x00FFFFFF;
+            uint32_t taskExpected = Reference(taskWords, 2);
+            uint32_t isrExpected = Reference(isrWords, 2);
+
+            const uint32_t retriesBefore = CrcService::GetRetries();
+            isrPending = 1;
+            crc_stub_preempt_hook = IsrHook;
+            uint32_t taskResult = CrcService::Calculate(taskWords, 2);
+            crc_stub_preempt_hook = nullptr;
+
+            assert(taskResult == taskExpected);
+            assert(isrResult == isrExpected);
+            assert(CrcService::GetRetries() == retriesBefore + 1);
+        }
+        assert(CrcService::GetFallbacks() == 0);
+    }
+    {
+        // Interrupts on every attempt: falls back to the software CRC
+        uint32_t taskWords[2] = { 0x01020304, 0x00070605 };
+        uint32_t taskExpected = Reference(taskWords, 2);
+        isrWords[0] = 0xDEADBEEF;
+        isrWords[1] = 0x00112233;
+        uint32_t isrExpected = Reference(isrWords, 2);
+
+        isrPending = 100;
+        crc_stub_preempt_hook = IsrHook;
+        uint32_t taskResult = CrcService::Calculate(taskWords, 2);
+        crc_stub_preempt_hook = nullptr;
+
+        assert(taskResult == taskExpected);
+        assert(isrResult == isrExpected);
+        assert(CrcService::GetFallbacks() == 1);
+    }
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include "e2e_protection.h"
+#include "vag_utils.h"
+#include <cassert>
+#include <cstring>
+
+int main() {
+    {
+        // TX: counter goes into the low nibble of byte 1, VAG CRC into byte 0
+        E2EProtection tx(E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, 0x191);
+        for (int i = 0; i < 20; ++i) {
+            uint8_t buf[8] = {0, 0xA0, 1, 2, 3, 4, 5, 6};
+            tx.Protect(buf, 8);
+            assert((buf[1] & 0x0F) == (i & 0x0F));
+            assert((buf[1] & 0xF0) == 0xA0);
+            uint8_t ref[8];
+            memcpy(ref, buf, 8);
+            assert(vag_utils::vw_crc_calc(ref, 8, 0x191) == buf[0]);
+        }
+        assert(tx.GetStats().ok == 20);
+    }
+    {
+        // RX: valid sequence, CRC error, lost frames and a repeated counter
+        E2EProtection tx(E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, 0x5A2);
+        E2EProtection rx(E2EProtection::PROFILE_VAG, E2EProtection::DIR_RX, 0x5A2);
+        uint8_t buf[8] = {0};
+
+        for (int i = 0; i < 3; ++i) {
+            tx.Protect(buf, 8);
+            assert(rx.Check(buf, 8));
+        }
+        assert(rx.GetStats().ok == 3);
+        assert(rx.GetStats().counterJumps == 0);
+
+        buf[0] ^= 0x01;
+        assert(!rx.Check(buf, 8));
+        assert(rx.GetStats().crcErrors == 1);
+
+        // Skip three frames
+        for (int i = 0; i < 4; ++i)
+            tx.Protect(buf, 8);
+        assert(rx.Check(buf, 8));
+        assert(rx.GetStats().counterJumps == 1);
+        assert(rx.GetStats().lost == 3);
+
+        // Same counter again
+        assert(rx.Check(buf, 8));
+        assert(rx.GetStats().counterJumps == 2);
+        assert(rx.GetStats().lost == 3);
+    }
+    {
+        // Strict counter check rejects jumps and keeps waiting for the successor
+        E2EProtection rx(E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x43A, true);
+        uint8_t buf[8] = {0};
+        buf[6] = 5;
+        assert(rx.Check(buf, 8));
+        buf[6] = 7;
+        assert(!rx.Check(buf, 8));
+        buf[6] = 6;
+        assert(rx.Check(buf, 8));
+        assert(!rx.Check(buf, 7)); // too short to carry the CRC
+        assert(rx.GetStats().crcErrors == 1);
+        assert(rx.GetStats().counterJumps == 1);
+        assert(rx.GetStats().lost == 1);
+        assert(rx.GetStats().ok == 2);
+    }
+    {
+        // The frame view on the driver's words gives the same result as the byte path
+        E2EProtection tx(E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, 0x5A2);
+        E2EProtection rxBytes(E2EProtection::PROFILE_VAG, E2EProtection::DIR_RX, 0x5A2);
+        E2EProtection rxFrame(E2EProtection::PROFILE_VAG, E2EProtection::DIR_RX, 0x5A2);
+        E2EProtection txCrc(E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_TX, 0x41A);
+        E2EProtection rxCrc(E2EProtection::PROFILE_CRC32_BYTE7, E2EProtection::DIR_RX, 0x41A);
+        uint32_t words[2];
+
+        for (int i = 0; i < 20; ++i) {
+            uint8_t buf[8] = {0, 0x30, 1, 2, 3, 4, 5, 6};
+            buf[2] = i;
+            tx.Protect(buf, 8);
+            if (i == 7)
+                buf[3] ^= 0x10;
+            memcpy(words, buf, 8);
+            assert(rxBytes.Check(buf, 8) == rxFrame.Check(CanFrame(0x5A2, words, 8)));
+
+            uint8_t crcBuf[8] = {1, 2, 3, 4, 5, 6, 0, 0};
+            crcBuf[0] = i;
+            txCrc.Protect(crcBuf, 8);
+            memcpy(words, crcBuf, 8);
+            assert(rxCrc.Check(CanFrame(0x41A, words, 8)));
+        }
+        assert(rxFrame.GetStats().crcErrors == 1);
+        assert(rxFrame.GetStats().ok == rxBytes.GetStats().ok);
+        assert(rxCrc.GetStats().ok == 20 && rxCrc.GetStats().counterJumps == 0);
+        words[0] = words[1] = 0;
+        assert(!rxCrc.Check(CanFrame(0x41A, words, 7))); // too short to carry the CRC
+    }
+    {
+        // Links chain themselves into the list and leave it on destruction
+        E2EProtection a(E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, 0x184);
+        {
+            E2EProtection b(E2EProtection::PROFILE_VAG, E2EProtection::DIR_TX, 0x191);
+            assert(E2EProtection::First() == &b);
+            assert(b.GetNext() == &a);
+        }
+        assert(E2EProtection::First() == &a);
+        assert(a.GetNext() == nullptr);
+    }
+    return 0;
+}
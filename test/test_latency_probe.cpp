@@ -0,0 +1,87 @@
+#include "latency_probe.h"
+#include "timebase.h"
+#include <cassert>
+
+static int Find(const char* name)
+{
+    for (int i = 0; i < LatencyProbe::GetNumProbes(); i++) {
+        const char* n = LatencyProbe::GetName(i);
+        int c = 0;
+        while (n[c] && n[c] == name[c])
+            c++;
+        if (n[c] == 0 && name[c] == 0)
+            return i;
+    }
+    return -1;
+}
+
+int main() {
+    const int hvClose = Find("hv_close");
+    const int hvOpen = Find("hv_open");
+    assert(hvClose >= 0 && hvOpen >= 0 && Find("heater_on") >= 0);
+
+    // Start, stop, histogram
+    LatencyProbe::Reset();
+    LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, 500); // not armed, ignored
+    assert(LatencyProbe::Get(hvClose).count == 0);
+    LatencyProbe::Signal(LatencyProbe::EVT_HV_REQUEST_ON, 1000);
+    LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, 1000 + 150000);
+    LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, 1000 + 170000); // disarmed
+    const LatencyProbe::Probe& p = LatencyProbe::Get(hvClose);
+    assert(p.count == 1 && !p.armed);
+    assert(p.lastUs == 150000 && p.minUs == 150000 && p.maxUs == 150000);
+    assert(p.histogram[7] == 1); // 100..200 ms
+    assert(LatencyProbe::GetBucketLimitMs(7) == 200);
+    assert(LatencyProbe::GetBucketLimitMs(LATENCY_PROBE_BUCKETS - 1) == 0);
+    assert(LatencyProbe::Get(hvOpen).count == 0);
+
+    // Restart counts as aborted, the measurement survives the us wrap
+    LatencyProbe::Signal(LatencyProbe::EVT_HV_REQUEST_ON, 0xFFFFFF00);
+    LatencyProbe::Signal(LatencyProbe::EVT_HV_REQUEST_ON, 0xFFFFFFF0);
+    LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, 0x310);
+    assert(p.aborted == 1 && p.count == 2);
+    assert(p.lastUs == 0x320 && p.minUs == 0x320 && p.maxUs == 150000);
+    assert(p.histogram[0] == 1);
+    assert(LatencyProbe::GetMeanUs(p) == (150000 + 0x320) / 2);
+
+    // Beyond the last limit
+    LatencyProbe::Signal(LatencyProbe::EVT_HV_REQUEST_ON, 0);
+    LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, 6000000);
+    assert(p.histogram[LATENCY_PROBE_BUCKETS - 1] == 1);
+
+    // Deferred to the mailbox hand-over of the frame
+    LatencyProbe::Reset();
+    assert(!LatencyProbe::TxPending());
+    LatencyProbe::SignalOnTx(LatencyProbe::EVT_HV_REQUEST_ON, 0x437);
+    assert(LatencyProbe::TxPending());
+    LatencyProbe::OnTx(0x210, 100);
+    assert(LatencyProbe::TxPending());
+    LatencyProbe::OnTx(0x437, 200);
+    assert(!LatencyProbe::TxPending());
+    LatencyProbe::Signal(LatencyProbe::EVT_CONTACTOR_CLOSED, 1200);
+    assert(p.count == 1 && p.lastUs == 1000);
+
+    // OFF queued before ON went out replaces it
+    LatencyProbe::SignalOnTx(LatencyProbe::EVT_HV_REQUEST_ON, 0x437);
+    LatencyProbe::SignalOnTx(LatencyProbe::EVT_HV_REQUEST_OFF, 0x437);
+    LatencyProbe::OnTx(0x437, 5000);
+    assert(!LatencyProbe::TxPending());
+    assert(!p.armed && LatencyProbe::Get(hvOpen).armed);
+
+    // Timebase carries the cycle counter over into us
+    Timebase::SetTicksPerUs(72);
+    assert(Timebase::Extend(0) == 0);
+    assert(Timebase::Extend(72 * 1000 + 71) == 1000);
+    assert(Timebase::Extend(72 * 2000) == 2000);
+    assert(Timebase::Extend(72 * 1500) == 1500); // taken before the last reading
+    assert(Timebase::Extend(72 * 2000 + 5) == 2000);
+    uint32_t cycles = 72 * 2000;
+    uint32_t us = 2000;
+    for (int i = 0; i < 200; i++) { // 100 s, the cycle counter wraps
+        cycles += 72 * 500000;
+        us += 500000;
+        assert(Timebase::Extend(cycles) == us);
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "mlb_dbc_layout.h"
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+// Bit position in the frame of raw bit k, straight from the DBC definition
+static int BitPos(const MlbDbcSignal& s, int k)
+{
+    if (s.intel)
+        return s.startBit + k;
+
+    int p = s.startBit;
+    for (int i = s.length - 1; i > k; i--)
+        p = (p % 8 == 0) ? p + 15 : p - 1;
+    return p;
+}
+
+static uint64_t Extract(const MlbDbcSignal& s, const uint8_t* d)
+{
+    uint64_t raw = 0;
+
+    for (int k = 0; k < s.length; k++)
+    {
+        int p = BitPos(s, k);
+        raw |= static_cast<uint64_t>((d[p / 8] >> (p % 8)) & 1) << k;
+    }
+    if (s.isSigned && s.length < 64 && (raw >> (s.length - 1)) & 1)
+        raw |= ~0ULL << s.length;
+    return raw;
+}
+
+static uint64_t Mask(const MlbDbcSignal& s)
+{
+    return s.length == 64 ? ~0ULL : (1ULL << s.length) - 1;
+}
+
+static void RandomFrame(uint8_t* d)
+{
+    for (int i = 0; i < 8; i++)
+        d[i] = rand() & 0xFF;
+}
+
+// Decoders are usable in constant expressions
+static constexpr uint8_t lad01[8] = { 0x5A, 0xD3, 0x73, 0xF4, 0x51, 0x12, 0x41, 0x0A };
+static_assert(mlb_dbc::LAD_01::LAD_01_BZ_Raw(lad01) == 3, "LAD_01_BZ");
+static_assert(mlb_dbc::LAD_01::LAD_IstModus(lad01) == 5, "LAD_IstModus");
+static_assert(mlb_dbc::LAD_01::LAD_AC_Istspannung(lad01) == 231, "LAD_AC_Istspannung");
+static_assert(mlb_dbc::LAD_01::LAD_Temperatur(lad01) == 25, "LAD_Temperatur");
+
+int main() {
+    const size_t count = sizeof(mlbDbcSignals) / sizeof(mlbDbcSignals[0]);
+
+    srand(1);
+
+    // Every generated decoder agrees with a bit by bit walk of the DBC layout
+    for (int iter = 0; iter < 2000; iter++) {
+        uint8_t d[8];
+        RandomFrame(d);
+
+        for (size_t i = 0; i < count; i++) {
+            const MlbDbcSignal& s = mlbDbcSignals[i];
+            const uint64_t raw = Extract(s, d);
+            const double raw_value = s.isSigned ? static_cast<double>(static_cast<int64_t>(raw))
+                                                : static_cast<double>(raw);
+            const double phys = raw_value * s.factor + s.offset;
+
+            // Physical values are float, so the error scales with the terms rather than the result
+            const double scale = std::fabs(raw_value * s.factor) + std::fabs(s.offset) + 1;
+
+            assert(s.raw(d) == raw);
+            assert(std::fabs(s.phys(d) - phys) <= 1e-5 * scale);
+        }
+    }
+
+    // Encoders write exactly the signal bits and round trip through the decoders
+    for (int iter = 0; iter < 2000; iter++) {
+        for (size_t i = 0; i < count; i++) {
+            const MlbDbcSignal& s = mlbDbcSignals[i];
+            uint8_t before[8], d[8];
+            RandomFrame(before);
+            memcpy(d, before, 8);
+
+            const uint64_t value = ((static_cast<uint64_t>(rand()) << 32) | rand()) & Mask(s);
+            s.encode(d, value);
+
+            assert((Extract(s, d) & Mask(s)) == value);
+            assert((s.raw(d) & Mask(s)) == value);
+
+            uint8_t touched[8] = {};
+            for (int k = 0; k < s.length; k++) {
+                int p = BitPos(s, k);
+                touched[p / 8] |= 1 << (p % 8);
+            }
+            for (int b = 0; b < 8; b++)
+                assert(((d[b] ^ before[b]) & ~touched[b]) == 0);
+        }
+    }
+
+    // Spot checks against the hand written decoders that were replaced
+    {
+        uint8_t d[8] = { 0x5A, 0xD3, 0x73, 0xF4, 0x51, 0x12, 0x41, 0x0A };
+        const float current = ((((d[5] & 0x0F) << 6) | ((d[4] >> 2) & 0x3F)) * 0.2f) - 102.0f;
+        assert(mlb_dbc::LAD_01::LAD_IstStrom_HV(d) == current);
+        assert(mlb_dbc::LAD_01::LAD_IstSpannung_HV(d) == static_cast<uint32_t>(((d[4] & 0x03) << 8) | d[3]));
+        assert(mlb_dbc::LAD_01::LAD_Verlustleistung(d) == d[7] * 20);
+        assert(mlb_dbc::HVLM_08::HVLM_BattKond_Anf(d) == static_cast<uint32_t>(((d[6] >> 7) & 1) | ((d[7] & 3) << 1)));
+        assert(mlb_dbc::HVLM_06::HVLM_MaxLadeLeistung(d) == (((d[2] & 0x3F) << 4) | (d[1] >> 4)) * 250);
+    }
+
+    // Frames worked out by hand from the SG_ lines of the DBC, independent of the generator
+    {
+        // BMS_01: BMS_IstStrom_02 12|12 (1,-2047) = -10A -> 0x7F5, BMS_IstSpannung 24|12 (0.25,0) = 400V -> 0x640,
+        // BMS_SOC_HiRes 47|11 (0.05,0) = 50% -> 0x3E8
+        const uint8_t expected[8] = { 0x00, 0x50, 0x7F, 0x40, 0x06, 0x00, 0xF4, 0x01 };
+        uint8_t d[8] = {};
+        mlb_dbc::BMS_01::BMS_IstStrom_02_Encode(d, 0x7F5);
+        mlb_dbc::BMS_01::BMS_IstSpannung_Encode(d, 0x640);
+        mlb_dbc::BMS_01::BMS_SOC_HiRes_Encode(d, 0x3E8);
+        assert(memcmp(d, expected, 8) == 0);
+        assert(mlb_dbc::BMS_01::BMS_IstStrom_02(d) == -10);
+        assert(mlb_dbc::BMS_01::BMS_IstSpannung(d) == 400);
+        assert(std::fabs(mlb_dbc::BMS_01::BMS_SOC_HiRes(d) - 50) < 1e-3);
+    }
+    {
+        // HVLM_04: HVLM_Stecker_Status 51|2 = 3, HVLM_LadeAnforderung 53|3 = 1, HVLM_MaxBatLadestromHV 56|8 = 125A
+        const uint8_t d[8] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7D };
+        assert(mlb_dbc::HVLM_04::HVLM_Stecker_Status(d) == 3);
+        assert(mlb_dbc::HVLM_04::HVLM_LadeAnforderung(d) == 1);
+        assert(mlb_dbc::HVLM_04::HVLM_MaxBatLadestromHV(d) == 125);
+        assert(mlb_dbc::HVLM_04::HVLM_HV_Anf(d) == 0);
+    }
+    {
+        // LAD_01: LAD_IstModus 12|3 = 1, LAD_AC_Istspannung 15|9 = 230V, LAD_IstSpannung_HV 24|10 = 400V,
+        // LAD_IstStrom_HV 34|10 (0.2,-102) = 16A -> 590, LAD_Temperatur 48|8 (1,-40) = 25 degC -> 65
+        const uint8_t d[8] = { 0x00, 0x10, 0x73, 0x90, 0x39, 0x09, 0x41, 0x00 };
+        assert(mlb_dbc::LAD_01::LAD_IstModus(d) == 1);
+        assert(mlb_dbc::LAD_01::LAD_AC_Istspannung(d) == 230);
+        assert(mlb_dbc::LAD_01::LAD_IstSpannung_HV(d) == 400);
+        assert(std::fabs(mlb_dbc::LAD_01::LAD_IstStrom_HV(d) - 16) < 1e-3);
+        assert(mlb_dbc::LAD_01::LAD_Temperatur(d) == 25);
+    }
+
+    // IDs carry no DBC extended frame flag
+    assert(mlb_dbc::KN_Ladegeraet::ID == 0x17F00044);
+    assert(mlb_dbc::HVLM_04::ID == 0x53C);
+
+    return 0;
+}
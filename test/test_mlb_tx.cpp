@@ -0,0 +1,200 @@
+#include "vw_mlb_charger.h"
+#include "params.h"
+#include "rx_supervisor.h"
+#include "lvdu.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Counts the frames the MLB emulation sends per 10 ms tick
+class TickCan : public CanHardware {
+public:
+    void Send(int id, uint8_t* data, int len) override {
+        perTick++;
+        perId[id]++;
+        if (log) {
+            uint64_t payload = 0;
+            memcpy(&payload, data, len);
+            log->push_back(std::make_pair((uint32_t)id, payload));
+        }
+    }
+    int perTick = 0;
+    std::map<uint32_t, int> perId;
+    std::vector<std::pair<uint32_t, uint64_t> >* log = nullptr;
+};
+
+// Runs the schedule for the given number of ticks, returns the busiest tick
+static int Run(VWMLBClass& mlb, TickCan& can, int ticks)
+{
+    int busiest = 0;
+
+    for (int t = 0; t < ticks; t++) {
+        can.perTick = 0;
+        mlb.Task10Ms();
+        if (can.perTick > busiest)
+            busiest = can.perTick;
+    }
+    return busiest;
+}
+
+int main() {
+    const int ticks = 2400; // 24 s, a common multiple of all periods
+    VWMLBClass::TxStatus status;
+
+    // The mailboxes hold three frames, which is the default limit
+    {
+        Param::SetInt(Param::mlb_tx_per_tick, 3);
+        VWMLBClass mlb;
+        TickCan can;
+        mlb.SetCanInterface(&can);
+
+        assert(Run(mlb, can, ticks) <= 3);
+
+        uint32_t sent = 0, late = 0;
+        for (int i = 0; VWMLBClass::GetTxStatus(i, status); i++) {
+            assert(status.phaseMs < status.periodMs);
+            // Every message keeps its rate
+            assert(status.sent == (uint32_t)(ticks * 10 / status.periodMs));
+            assert(can.perId[status.id] == (int)status.sent);
+            sent += status.sent;
+            late += status.late;
+        }
+        assert(!VWMLBClass::GetTxStatus(MLB_TX_MSG_COUNT, status));
+        assert(late == VWMLBClass::GetTxLate());
+        // The phases keep almost every tick within the limit
+        assert(late * 100 < sent);
+        printf("limit 3: %u frames, %u late\n", sent, late);
+    }
+
+    // Below the average rate of 2.5 frames per tick everything is slowed down, nothing starves
+    {
+        Param::SetInt(Param::mlb_tx_per_tick, 2);
+        VWMLBClass mlb;
+        TickCan can;
+        mlb.SetCanInterface(&can);
+
+        assert(Run(mlb, can, ticks) <= 2);
+        for (int i = 0; VWMLBClass::GetTxStatus(i, status); i++)
+            assert(can.perId[status.id] > 0);
+        printf("limit 2: %u late\n", VWMLBClass::GetTxLate());
+    }
+
+    // Traffic follows the vehicle state and the plug
+    {
+        Param::SetInt(Param::mlb_tx_per_tick, 3);
+        Param::SetInt(Param::mlb_tx_policy, 1);
+        RxSupervisor::BeginUpdate();
+        VWMLBClass mlb;
+        TickCan can;
+        mlb.SetCanInterface(&can);
+
+        Param::SetInt(Param::LVDU_vehicle_state, STATE_SLEEP);
+        Run(mlb, can, 100);
+        assert(can.perId.empty());
+        assert(VWMLBClass::GetTxLevel() == VWMLBClass::TX_OFF);
+
+        // Unplugged: terminal status and locking only, from the first tick on
+        Param::SetInt(Param::LVDU_vehicle_state, STATE_STANDBY);
+        mlb.Task10Ms();
+        assert(can.perId.size() == 2 && can.perId[0x3C0] == 1 && can.perId[0x583] == 1);
+        Run(mlb, can, 199);
+        assert(can.perId.size() == 2 && can.perId[0x3C0] == 20 && can.perId[0x583] == 10);
+        assert(VWMLBClass::GetTxLevel() == VWMLBClass::TX_WAKE);
+
+        // Plug locked: every message is out within the ticks the per tick limit needs
+        uint8_t hvlm04[8] = {};
+        uint32_t words[2];
+        mlb_dbc::HVLM_04::HVLM_Stecker_Status_Encode(hvlm04, HVLM_STECKER_STATUS_ERKANNT_VERRIEGELT);
+        memcpy(words, hvlm04, 8);
+        mlb.DecodeCAN(CanFrame(mlb_dbc::HVLM_04::ID, words, 8));
+        RxSupervisor::Tick(2000);
+        // No 100 ms task in between, the 10 ms task decodes the plug status itself
+        can.perId.clear();
+        Run(mlb, can, (MLB_TX_MSG_COUNT + 2) / 3);
+        assert(VWMLBClass::GetTxLevel() == VWMLBClass::TX_FULL);
+        assert(can.perId.size() == MLB_TX_MSG_COUNT);
+
+        // Driving needs no charger, plugged or not
+        Param::SetInt(Param::LVDU_vehicle_state, STATE_DRIVE);
+        can.perId.clear();
+        Run(mlb, can, 200);
+        assert(can.perId.size() == 2);
+
+        // Always on
+        Param::SetInt(Param::mlb_tx_policy, 0);
+        Param::SetInt(Param::LVDU_vehicle_state, STATE_SLEEP);
+        can.perId.clear();
+        Run(mlb, can, 200);
+        assert(can.perId.size() == MLB_TX_MSG_COUNT);
+    }
+
+    // Cached frames are identical to packed ones, also across a change of mlb_state
+    {
+        std::vector<std::pair<uint32_t, uint64_t> > frames[2];
+        uint32_t rebuilds[2];
+
+        Param::SetInt(Param::mlb_tx_policy, 0);
+        for (int cached = 0; cached < 2; cached++) {
+            Param::SetInt(Param::mlb_tx_cache, cached);
+            Param::SetInt(Param::mlb_chr_sim_Lock, 0);
+            VWMLBClass mlb;
+            TickCan can;
+            can.log = &frames[cached];
+            mlb.SetCanInterface(&can);
+
+            const uint32_t before = VWMLBClass::GetTxCacheRebuilds();
+            for (int t = 0; t < 600; t++) {
+                if (t == 300)
+                    Param::SetInt(Param::mlb_chr_sim_Lock, 1);
+                if (t % 10 == 0)
+                    mlb.Task100Ms();
+                mlb.Task10Ms();
+            }
+            rebuilds[cached] = VWMLBClass::GetTxCacheRebuilds() - before;
+        }
+        assert(frames[0].size() > 1000);
+        assert(frames[0] == frames[1]);
+        assert(rebuilds[0] == 0);
+        assert(rebuilds[1] == 9 + 1); // every cached message once, ZV_01 again on locking
+        Param::SetInt(Param::mlb_chr_sim_Lock, 0);
+    }
+
+    // A silent charger is only a fault while it is in use
+    {
+        Param::SetInt(Param::mlb_tx_policy, 1);
+        Param::SetInt(Param::LVDU_vehicle_state, STATE_STANDBY);
+        Param::SetInt(Param::mlb_chr_sim_Activation_Crg, 1);
+        RxSupervisor::BeginUpdate();
+        VWMLBClass mlb;
+        TickCan can;
+        mlb.SetCanInterface(&can);
+        const int before = ErrorMessage::Count(ERR_CHARGER_TIMEOUT);
+
+        // Never heard from: no charge request and no error
+        mlb.Task10Ms();
+        assert(VWMLBClass::GetTxLevel() == VWMLBClass::TX_WAKE);
+        RxSupervisor::Tick(10000);
+        assert(!mlb.ControlCharge(true, true));
+        RxSupervisor::Tick(11000);
+        assert(ErrorMessage::Count(ERR_CHARGER_TIMEOUT) == before);
+
+        // Plugged and charging, then silent
+        uint8_t hvlm04[8] = {};
+        uint32_t words[2];
+        mlb_dbc::HVLM_04::HVLM_Stecker_Status_Encode(hvlm04, HVLM_STECKER_STATUS_ERKANNT_VERRIEGELT);
+        memcpy(words, hvlm04, 8);
+        mlb.DecodeCAN(CanFrame(mlb_dbc::HVLM_04::ID, words, 8));
+        RxSupervisor::Tick(11100);
+        assert(mlb.ControlCharge(true, true));
+        RxSupervisor::Tick(12000);
+        assert(ErrorMessage::Count(ERR_CHARGER_TIMEOUT) == before + 1);
+        assert(!mlb.ControlCharge(true, true));
+        Param::SetInt(Param::mlb_chr_sim_Activation_Crg, 0);
+    }
+
+    Param::SetInt(Param::mlb_tx_per_tick, 3);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "rx_supervisor.h"
+#include <cassert>
+
+struct Changes {
+    int fresh = 0;
+    int stale = 0;
+    uint32_t lastId = 0;
+};
+
+static void Handler(void* ctx, uint32_t id, bool fresh)
+{
+    Changes* c = static_cast<Changes*>(ctx);
+    if (fresh)
+        c->fresh++;
+    else
+        c->stale++;
+    c->lastId = id;
+}
+
+int main() {
+    Changes a, b;
+
+    RxSupervisor::BeginUpdate();
+    RxSupervisor::Tick(1000);
+    const int ha = RxSupervisor::Register(0x41A, 100, 200, Handler, &a);
+    const int hb = RxSupervisor::Register(0x565, 1000, 1000, Handler, &b);
+    assert(ha == 0 && hb == 1);
+    assert(RxSupervisor::GetNumEntries() == 2);
+    assert(RxSupervisor::GetId(hb) == 0x565);
+    assert(RxSupervisor::GetState(ha) == RxSupervisor::RX_NEVER);
+
+    // Invalid handles are ignored and read as stale
+    RxSupervisor::Refresh(-1);
+    RxSupervisor::Refresh(5);
+    assert(RxSupervisor::GetState(-1) == RxSupervisor::RX_STALE);
+
+    // First frame turns the message fresh, the handler only fires on changes
+    RxSupervisor::Refresh(ha);
+    RxSupervisor::Tick(1010);
+    assert(RxSupervisor::GetState(ha) == RxSupervisor::RX_FRESH);
+    assert(a.fresh == 1 && a.lastId == 0x41A);
+    for (uint32_t t = 1020; t <= 1300; t += 10) {
+        if (t % 100 == 0)
+            RxSupervisor::Refresh(ha);
+        RxSupervisor::Tick(t);
+    }
+    assert(a.fresh == 1 && a.stale == 0);
+
+    // Silent for longer than period + tolerance
+    for (uint32_t t = 1310; t <= 1600; t += 10)
+        RxSupervisor::Tick(t);
+    assert(RxSupervisor::GetState(ha) == RxSupervisor::RX_STALE);
+    assert(a.stale == 1);
+    assert(RxSupervisor::GetStale() == 1);
+    RxSupervisor::Tick(1700);
+    assert(a.stale == 1);
+
+    // Never received: stale once the timeout has passed since registration
+    assert(RxSupervisor::GetState(hb) == RxSupervisor::RX_NEVER);
+    RxSupervisor::Tick(3001);
+    assert(RxSupervisor::GetState(hb) == RxSupervisor::RX_STALE);
+    assert(b.stale == 1 && b.fresh == 0);
+    assert(RxSupervisor::GetStale() == 2);
+
+    // Recovery
+    RxSupervisor::Refresh(ha);
+    RxSupervisor::Refresh(hb);
+    RxSupervisor::Tick(3010);
+    assert(a.fresh == 2 && b.fresh == 1);
+    assert(RxSupervisor::GetStale() == 0);
+
+    // Table full
+    RxSupervisor::BeginUpdate();
+    for (int i = 0; i < RX_SUPERVISOR_MAX_ENTRIES; ++i)
+        assert(RxSupervisor::Register(i, 10, 10, nullptr, nullptr) == i);
+    assert(RxSupervisor::Register(0x100, 10, 10, nullptr, nullptr) == -1);
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include "MCP2515.h"
+#include "spi_dma.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+struct Result {
+    int calls;
+    uint8_t rx[SPI_DMA_MAX_LEN];
+    uint8_t len;
+};
+
+static void Done(void* ctx, const uint8_t* rx, uint8_t len)
+{
+    Result* r = (Result*)ctx;
+    r->calls++;
+    memcpy(r->rx, rx, len);
+    r->len = len;
+}
+
+static void RunInterrupts()
+{
+    while (spi_stub_irq())
+        ;
+}
+
+static void LoadRxBuffer(uint8_t first, const uint8_t* regs, uint8_t flag)
+{
+    for (int i = 0; i < 13; i++)
+        spi_stub_mcp_set_reg(first + i, regs[i]);
+    spi_stub_mcp_set_reg(MCP2515_CANINTF, spi_stub_mcp_reg(MCP2515_CANINTF) | flag);
+}
+
+// RX status in the first callback, the buffer it points to in the second
+static Result chained;
+
+static void StatusDone(void*, const uint8_t* rx, uint8_t)
+{
+    const uint8_t inst = (rx[1] & 0x80) ? MCP2515_READ_RXB1SIDH : MCP2515_READ_RXB0SIDH;
+    assert(MCP2515_Read_RxbSequence_Dma(inst, 13, Done, &chained));
+}
+
+int main() {
+    // RXB0: 0x123, 8 bytes
+    const uint8_t frame[13] = { 0x24, 0x60, 0, 0, 8, 1, 2, 3, 4, 5, 6, 7, 8 };
+    // RXB1: extended 0x12DD5472
+    const uint8_t extFrame[13] = { 0x96, 0xEB, 0x54, 0x72, 8, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+    uint8_t idReg[4] = { 0x24, 0x60, 0, 0 };
+    uint8_t data[8] = { 9, 8, 7, 6, 5, 4, 3, 2 };
+    uint8_t buf[13];
+    Result r = {};
+
+    MCP2515_Initialize();
+    MCP2515_Reset();
+    assert(MCP2515_Read_Byte(MCP2515_CANSTAT) == 0x80);
+
+    // Full RX buffer read, blocking
+    LoadRxBuffer(MCP2515_RXB0SIDH, frame, 0x01);
+    uint32_t start = spi_stub_cpu_cycles;
+    MCP2515_Read_RxbSequence(MCP2515_READ_RXB0SIDH, 13, buf);
+    const uint32_t rxBlocking = spi_stub_cpu_cycles - start;
+    assert(memcmp(buf, frame, 13) == 0);
+    assert((spi_stub_mcp_reg(MCP2515_CANINTF) & 0x01) == 0);
+
+    // Same on DMA, the chip select is released in the interrupt
+    LoadRxBuffer(MCP2515_RXB0SIDH, frame, 0x01);
+    start = spi_stub_cpu_cycles;
+    assert(MCP2515_Read_RxbSequence_Dma(MCP2515_READ_RXB0SIDH, 13, Done, &r));
+    assert(!DigIo::mcp_cs.Get() && SpiDma::IsBusy());
+    RunInterrupts();
+    const uint32_t rxDma = spi_stub_cpu_cycles - start;
+    assert(r.calls == 1 && r.len == 14);
+    assert(memcmp(r.rx + 1, frame, 13) == 0);
+    assert(DigIo::mcp_cs.Get() && !SpiDma::IsBusy());
+    assert((spi_stub_mcp_reg(MCP2515_CANINTF) & 0x01) == 0);
+
+    // TX load and request to send, blocking into TXB0
+    start = spi_stub_cpu_cycles;
+    MCP2515_Load_TxSequence(MCP2515_LOAD_TXB0SIDH, idReg, 8, data);
+    MCP2515_RequestToSend(MCP2515_RTS_TX0);
+    const uint32_t txBlocking = spi_stub_cpu_cycles - start;
+    assert(spi_stub_mcp_reg(MCP2515_TXB0CTRL) & 0x08);
+    assert(spi_stub_mcp_reg(0x35) == 8 && spi_stub_mcp_reg(0x3D) == 2);
+
+    // On DMA into TXB1, done comes after the RTS
+    r.calls = 0;
+    start = spi_stub_cpu_cycles;
+    assert(MCP2515_Load_TxSequence_Dma(MCP2515_LOAD_TXB1SIDH, idReg, 8, data, MCP2515_RTS_TX1, Done, &r));
+    RunInterrupts();
+    const uint32_t txDma = spi_stub_cpu_cycles - start;
+    assert(r.calls == 1 && r.len == 1);
+    assert(spi_stub_mcp_reg(MCP2515_TXB1CTRL) & 0x08);
+    for (int i = 0; i < 4; i++)
+        assert(spi_stub_mcp_reg(0x41 + i) == idReg[i]);
+    for (int i = 0; i < 8; i++)
+        assert(spi_stub_mcp_reg(0x46 + i) == data[i]);
+    assert((MCP2515_Read_Status() & 0x14) == 0x14); // TXB0REQ, TXB1REQ
+
+    printf("MCP2515 RX buffer read: blocking %u cycles, DMA %u cycles\n", rxBlocking, rxDma);
+    printf("MCP2515 TX load + RTS:  blocking %u cycles, DMA %u cycles\n", txBlocking, txDma);
+    assert(rxDma * 10 < rxBlocking && txDma * 10 < txBlocking);
+
+    // Chained from the callback: RX status, then the buffer holding the frame
+    LoadRxBuffer(MCP2515_RXB1SIDH, extFrame, 0x02);
+    assert(MCP2515_Get_RxStatus_Dma(StatusDone, nullptr));
+    RunInterrupts();
+    assert(chained.calls == 1);
+    assert(memcmp(chained.rx + 1, extFrame, 13) == 0);
+    assert(spi_stub_mcp_reg(MCP2515_CANINTF) == 0);
+
+    // Queue full, a blocking call completes the queue by polling
+    r.calls = 0;
+    for (int i = 0; i < SPI_DMA_QUEUE_SIZE; i++)
+        assert(MCP2515_Read_Status_Dma(Done, &r));
+    assert(SpiDma::GetFree() == 0);
+    assert(!MCP2515_Read_Status_Dma(Done, &r));
+    assert(!MCP2515_Load_TxSequence_Dma(MCP2515_LOAD_TXB2SIDH, idReg, 8, data, MCP2515_RTS_TX2, Done, &r));
+    assert(SpiDma::GetOverflows() == 1);
+    assert(SpiDma::GetMaxDepth() == SPI_DMA_QUEUE_SIZE);
+    assert(MCP2515_Read_Byte(MCP2515_CANSTAT) == 0x80);
+    assert(r.calls == SPI_DMA_QUEUE_SIZE && !SpiDma::IsBusy());
+    assert(!spi_stub_irq());
+
+    assert(spi_stub_errors() == 0);
+    return 0;
+}
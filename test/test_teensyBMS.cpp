@@ -1,4 +1,5 @@
 #include "teensyBMS.h"
+#include "rx_supervisor.h"
 #include <cassert>
 
 class MockCanHardware : public CanHardware {
@@ -53,8 +54,35 @@ int main() {
         assert(can.lastData[7] == 0); // CRC from stub
 
         // Test DecodeCAN runs without errors
-        uint8_t data[8] = {0};
-        bms.DecodeCAN(0x41A, data);
+        uint32_t data[2] = {0, 0};
+        bms.DecodeCAN(CanFrame(0x41A, data, 8));
+    }
+    {
+        // Heartbeat mode: the status goes out on change, otherwise every 200 ms
+        TestTeensyBMS bms;
+        MockCanHardware can;
+        bms.SetCanInterface(&can);
+        Param::SetInt(Param::can_tx_heartbeat, 200);
+        Param::SetInt(Param::LVDU_vehicle_state, 3);
+        Param::SetInt(Param::LVDU_forceVCUsShutdown, 0);
+        Param::SetInt(Param::HVCM_to_bms_hv_request, 0);
+
+        for (int t = 0; t < 1000; t += 10) {
+            bms.Task10Ms();
+            if (t % 100 == 0)
+                bms.Task100Ms();
+        }
+        assert(can.sendCount == 5);
+        assert(can.lastData[6] == 4); // the counter only counts frames sent
+
+        Param::SetInt(Param::HVCM_to_bms_hv_request, 1);
+        bms.Task10Ms();
+        assert(can.sendCount == 6);
+        assert(can.lastData[2] == 1);
+        assert(can.lastData[6] == 5);
+        bms.Task10Ms();
+        assert(can.sendCount == 6);
+        Param::SetInt(Param::can_tx_heartbeat, 0);
     }
     {
         struct Msg3Case {
@@ -72,16 +100,48 @@ int main() {
         for (const auto& tc : cases) {
             TestTeensyBMS bms;
             bms.SetCanInterface(nullptr);
-            uint8_t msg3[8] = {0};
-            msg3[5] = tc.d5;
-            msg3[7] = 0; // stub CRC result
+            uint32_t msg3[2] = {0, 0};
+            msg3[1] = static_cast<uint32_t>(tc.d5) << 8; // byte 5, byte 7 is the stub CRC result 0
 
-            bms.DecodeCAN(0x41C, msg3);
+            bms.DecodeCAN(CanFrame(0x41C, msg3, 8));
             bms.Task100Ms();
 
             assert(Param::GetInt(Param::BMS_DTC) == tc.expectedBmsDtc);
             assert(Param::GetInt(Param::BMS_CONT_DTC) == 0);
         }
     }
+    {
+        // Every BMS message is supervised on its own
+        RxSupervisor::BeginUpdate();
+        TestTeensyBMS bms;
+        MockCanHardware can;
+        bms.SetCanInterface(&can);
+        assert(RxSupervisor::GetNumEntries() == BMS_MSG_COUNT);
+
+        uint32_t msg[2] = {0, 0};
+        uint32_t t = 0;
+        for (int i = 0; i < 5; ++i, t += 100) {
+            for (uint32_t id = BMS_MSG_FIRST_ID; id < BMS_MSG_FIRST_ID + BMS_MSG_COUNT; ++id)
+                bms.DecodeCAN(CanFrame(id, msg, 8));
+            RxSupervisor::Tick(t);
+            bms.Task100Ms();
+        }
+        assert(Param::GetInt(Param::BMS_TimeoutFault) == 0);
+
+        // MSG1 alone is not enough
+        for (int i = 0; i < 4; ++i, t += 100) {
+            bms.DecodeCAN(CanFrame(BMS_MSG_FIRST_ID, msg, 8));
+            RxSupervisor::Tick(t);
+            bms.Task100Ms();
+        }
+        assert(Param::GetInt(Param::BMS_TimeoutFault) == 1);
+        assert(RxSupervisor::GetStale() == BMS_MSG_COUNT - 1);
+
+        for (uint32_t id = BMS_MSG_FIRST_ID; id < BMS_MSG_FIRST_ID + BMS_MSG_COUNT; ++id)
+            bms.DecodeCAN(CanFrame(id, msg, 8));
+        RxSupervisor::Tick(t);
+        bms.Task100Ms();
+        assert(Param::GetInt(Param::BMS_TimeoutFault) == 0);
+    }
     return 0;
 }
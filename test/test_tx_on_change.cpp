@@ -0,0 +1,48 @@
+#include "tx_on_change.h"
+#include <cassert>
+
+// Calls Due() every 10 ms for the given time and returns the frames sent
+static int Run(TxOnChange& tx, const uint8_t* payload, int ms, uint32_t heartbeat)
+{
+    int sent = 0;
+    for (int t = 0; t < ms; t += 10)
+        sent += tx.Due(payload, 8, 10, heartbeat);
+    return sent;
+}
+
+int main() {
+    uint8_t payload[8] = {3, 1, 0, 0, 0, 0, 0, 0};
+
+    // Heartbeat 0 is the fixed cycle, every call is due
+    {
+        TxOnChange tx;
+        assert(Run(tx, payload, 1000, 0) == 100);
+        assert(TxOnChange::GetSuppressed() == 0);
+    }
+
+    {
+        TxOnChange tx;
+
+        // First call always sends, then only the heartbeat
+        assert(Run(tx, payload, 1000, 200) == 5);
+        assert(TxOnChange::GetSuppressed() == 95);
+
+        // A change goes out on the next call and restarts the heartbeat
+        payload[0] = 4;
+        assert(tx.Due(payload, 8, 10, 200));
+        assert(!tx.Due(payload, 8, 10, 200));
+        assert(Run(tx, payload, 180, 200) == 0);
+        assert(tx.Due(payload, 8, 10, 200));
+
+        // Toggling back and forth sends every edge
+        for (int i = 0; i < 4; ++i) {
+            payload[1] ^= 1;
+            assert(tx.Due(payload, 8, 10, 200));
+        }
+
+        // After Reset() the first frame is due again
+        tx.Reset();
+        assert(tx.Due(payload, 8, 10, 200));
+    }
+    return 0;
+}
@@ -0,0 +1,675 @@
+/*
+ * Host tool: generates signal decoders/encoders and value tables from a DBC file.
+ *
+ * Usage: dbc_codegen [-k <keep.h>] <file.dbc> <header.h> <layout.h> <message> [<message> ...]
+ *
+ * For every selected message the header gets a struct in namespace mlb_dbc holding
+ * the ID, DLC and per signal
+ *   <Signal>_Raw(d)         raw value, built only from the bytes the signal covers
+ *   <Signal>(d)             physical value (raw * factor + offset)
+ *   <Signal>_Encode(d, raw) read-modify-write of the covered bytes
+ * plus a SIGNAL_ENUM string and a Signal_Enum for every VAL_ table.
+ * Value tables that keep.h already defines (#define SIGNAL_ENUM) are not generated,
+ * so hand maintained names and parameter strings stay as they are.
+ * The layout file lists the DBC bit layout of every generated signal so the host
+ * tests can check the generated code against a generic bit walker.
+ */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct ValueEntry
+{
+    long long value;
+    std::string text;
+};
+
+struct Signal
+{
+    std::string name;
+    int startBit;
+    int length;
+    bool intel;
+    bool isSigned;
+    bool multiplexed;
+    double factor;
+    double offset;
+    std::string minMax;
+    std::string unit;
+    std::string receivers;
+    std::string comment;
+    std::vector<ValueEntry> values;
+};
+
+struct Message
+{
+    uint32_t dbcId;
+    std::string name;
+    int dlc;
+    std::string sender;
+    std::vector<Signal> signals;
+};
+
+// Part of a signal that lies in one byte: bits lo..lo+width-1 of d[byte] hold
+// raw bits outPos..outPos+width-1
+struct Run
+{
+    int byte;
+    int lo;
+    int width;
+    int outPos;
+};
+
+static void Fail(const std::string& msg)
+{
+    fprintf(stderr, "dbc_codegen: %s\n", msg.c_str());
+    exit(1);
+}
+
+// The DBC is Latin-1 encoded, keep the generated sources plain ASCII
+static std::string Transliterate(const std::string& in)
+{
+    std::string out;
+
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        unsigned char c = in[i];
+
+        switch (c)
+        {
+        case 0xE4: out += "ae"; break;
+        case 0xF6: out += "oe"; break;
+        case 0xFC: out += "ue"; break;
+        case 0xC4: out += "Ae"; break;
+        case 0xD6: out += "Oe"; break;
+        case 0xDC: out += "Ue"; break;
+        case 0xDF: out += "ss"; break;
+        case 0xB0: out += "deg"; break;
+        case 0xB5: out += "u"; break;
+        default:
+            if (c == '\r' || c == '\n' || c == '\t')
+                out += ' ';
+            else if (c >= 0x20 && c < 0x7F)
+                out += static_cast<char>(c);
+            break;
+        }
+    }
+    return out;
+}
+
+static std::string CollapseSpaces(const std::string& in)
+{
+    std::string out;
+
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        if (in[i] == ' ' && (out.empty() || out[out.size() - 1] == ' '))
+            continue;
+        out += in[i];
+    }
+    while (!out.empty() && out[out.size() - 1] == ' ')
+        out.erase(out.size() - 1);
+    return out;
+}
+
+static std::string Upper(const std::string& in)
+{
+    std::string out = in;
+
+    for (size_t i = 0; i < out.size(); i++)
+        out[i] = toupper(static_cast<unsigned char>(out[i]));
+    return out;
+}
+
+// Reads one quoted string starting at pos, continuing on following lines
+// until the closing quote. Returns false at end of file.
+static bool ReadQuoted(std::istream& in, std::string& line, size_t& pos, std::string& text)
+{
+    text.clear();
+    pos = line.find('"', pos);
+    if (pos == std::string::npos)
+        return false;
+    pos++;
+
+    while (true)
+    {
+        size_t end = line.find('"', pos);
+
+        if (end != std::string::npos)
+        {
+            text += line.substr(pos, end - pos);
+            pos = end + 1;
+            return true;
+        }
+        text += line.substr(pos) + " ";
+        if (!std::getline(in, line))
+            return false;
+        pos = 0;
+    }
+}
+
+static void ParseSignal(const std::string& line, Message& msg)
+{
+    Signal sig = Signal();
+    std::istringstream ss(line);
+    std::string tag, token;
+
+    ss >> tag >> sig.name >> token;
+    if (token != ":")
+    {
+        sig.multiplexed = true;
+        ss >> token;
+    }
+
+    char order, sign, c;
+    ss >> sig.startBit >> c >> sig.length >> c >> order >> sign;
+    sig.intel = order == '1';
+    sig.isSigned = sign == '-';
+    ss >> c >> sig.factor >> c >> sig.offset >> c;
+    ss >> sig.minMax;
+
+    size_t q1 = line.find('"');
+    size_t q2 = line.find('"', q1 + 1);
+    sig.unit = line.substr(q1 + 1, q2 - q1 - 1);
+    sig.receivers = CollapseSpaces(line.substr(q2 + 1));
+    if (!sig.receivers.empty() && sig.receivers[0] == ' ')
+        sig.receivers.erase(0, 1);
+
+    if (sig.length < 1 || sig.length > 64)
+        Fail("bad length for signal " + sig.name);
+    msg.signals.push_back(sig);
+}
+
+static Signal* FindSignal(std::map<uint32_t, Message>& msgs, uint32_t id, const std::string& name)
+{
+    std::map<uint32_t, Message>::iterator it = msgs.find(id);
+
+    if (it == msgs.end())
+        return nullptr;
+    for (size_t i = 0; i < it->second.signals.size(); i++)
+    {
+        if (it->second.signals[i].name == name)
+            return &it->second.signals[i];
+    }
+    return nullptr;
+}
+
+static void ParseDbc(const char* path, std::map<uint32_t, Message>& msgs)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::string line;
+    Message* current = nullptr;
+
+    if (!in)
+        Fail(std::string("cannot open ") + path);
+
+    while (std::getline(in, line))
+    {
+        if (!line.empty() && line[line.size() - 1] == '\r')
+            line.erase(line.size() - 1);
+
+        if (line.compare(0, 4, "BO_ ") == 0)
+        {
+            std::istringstream ss(line);
+            std::string tag, name;
+            Message msg;
+
+            ss >> tag >> msg.dbcId >> name >> msg.dlc >> msg.sender;
+            msg.name = name.substr(0, name.size() - 1);
+            current = &(msgs[msg.dbcId] = msg);
+        }
+        else if (line.compare(0, 5, " SG_ ") == 0 && current)
+        {
+            ParseSignal(line, *current);
+        }
+        else if (line.compare(0, 8, "CM_ SG_ ") == 0)
+        {
+            std::istringstream ss(line.substr(8));
+            uint32_t id;
+            std::string name, text;
+            size_t pos = 0;
+
+            ss >> id >> name;
+            if (!ReadQuoted(in, line, pos, text))
+                Fail("unterminated comment for " + name);
+            Signal* sig = FindSignal(msgs, id, name);
+            if (sig)
+                sig->comment = CollapseSpaces(Transliterate(text));
+        }
+        else if (line.compare(0, 5, "VAL_ ") == 0)
+        {
+            std::istringstream ss(line.substr(5));
+            uint32_t id;
+            std::string name;
+
+            ss >> id >> name;
+            Signal* sig = FindSignal(msgs, id, name);
+            size_t pos = line.find(name) + name.size();
+
+            while (sig)
+            {
+                size_t q = line.find('"', pos);
+                if (q == std::string::npos)
+                    break;
+
+                ValueEntry entry;
+                entry.value = strtoll(line.c_str() + pos, nullptr, 10);
+                std::string text;
+                pos = q;
+                if (!ReadQuoted(in, line, pos, text))
+                    Fail("unterminated value table for " + name);
+                entry.text = CollapseSpaces(Transliterate(text));
+                sig->values.push_back(entry);
+            }
+        }
+        else if (line.compare(0, 1, " ") != 0)
+        {
+            current = nullptr;
+        }
+    }
+}
+
+// Maps every raw bit (LSB first) to its bit position in the frame and groups
+// neighbouring bits that share a byte.
+static std::vector<Run> BuildRuns(const Signal& sig)
+{
+    std::vector<int> pos(sig.length);
+    std::vector<Run> runs;
+
+    if (sig.intel)
+    {
+        for (int k = 0; k < sig.length; k++)
+            pos[k] = sig.startBit + k;
+    }
+    else
+    {
+        // Motorola: start bit is the MSB, continuing into the next byte from bit 7
+        int p = sig.startBit;
+        for (int i = 0; i < sig.length; i++)
+        {
+            pos[sig.length - 1 - i] = p;
+            p = (p % 8 == 0) ? p + 15 : p - 1;
+        }
+    }
+
+    for (int k = 0; k < sig.length; k++)
+    {
+        if (pos[k] < 0 || pos[k] >= 64)
+            Fail("signal " + sig.name + " exceeds 8 bytes");
+
+        if (!runs.empty())
+        {
+            Run& r = runs.back();
+            if (pos[k] / 8 == r.byte && pos[k] % 8 == r.lo + r.width && k == r.outPos + r.width)
+            {
+                r.width++;
+                continue;
+            }
+        }
+        Run r = { pos[k] / 8, pos[k] % 8, 1, k };
+        runs.push_back(r);
+    }
+    return runs;
+}
+
+static std::string Hex(unsigned long long v)
+{
+    char buf[24];
+    snprintf(buf, sizeof(buf), "0x%llX", v);
+    return buf;
+}
+
+static bool IsInteger(double v)
+{
+    return v == std::floor(v) && std::fabs(v) < 2147483648.0;
+}
+
+static std::string FloatLiteral(double v)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.9g", v);
+    std::string s = buf;
+    if (s.find_first_of(".e") == std::string::npos)
+        s += ".0";
+    return s + "f";
+}
+
+static std::string RawType(const Signal& sig)
+{
+    if (sig.length > 32)
+        return sig.isSigned ? "int64_t" : "uint64_t";
+    return sig.isSigned ? "int32_t" : "uint32_t";
+}
+
+static std::string UnsignedType(const Signal& sig)
+{
+    return sig.length > 32 ? "uint64_t" : "uint32_t";
+}
+
+static std::string PhysType(const Signal& sig)
+{
+    if (sig.factor == 1 && sig.offset == 0)
+        return RawType(sig);
+    if (IsInteger(sig.factor) && IsInteger(sig.offset))
+        return sig.length > 31 ? "int64_t" : "int32_t";
+    return "float";
+}
+
+static std::string DecodeExpr(const Signal& sig, const std::vector<Run>& runs)
+{
+    const std::string ut = UnsignedType(sig);
+    std::string expr;
+
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        const Run& r = runs[i];
+        std::string term = "d[" + std::to_string(r.byte) + "]";
+
+        if (r.lo > 0)
+            term = "(" + term + " >> " + std::to_string(r.lo) + ")";
+        if (r.lo + r.width < 8)
+            term = "(" + term + " & " + Hex((1u << r.width) - 1) + ")";
+        term = "static_cast<" + ut + ">" + (term[0] == '(' ? term : "(" + term + ")");
+        if (r.outPos > 0)
+            term = "(" + term + " << " + std::to_string(r.outPos) + ")";
+
+        expr += (i ? " |\n               " : "") + term;
+    }
+
+    if (sig.isSigned)
+    {
+        // Branch-free sign extension: (x ^ m) - m with m the sign bit
+        const std::string m = Hex(1ULL << (sig.length - 1)) + (sig.length > 32 ? "ULL" : "U");
+        expr = "static_cast<" + RawType(sig) + ">(((" + expr + ") ^ " + m + ") - " + m + ")";
+    }
+    return expr;
+}
+
+static void EmitEncode(std::ostream& out, const Signal& sig, const std::vector<Run>& runs)
+{
+    out << "    static inline void " << sig.name << "_Encode(uint8_t* d, " << UnsignedType(sig) << " raw)\n";
+    out << "    {\n";
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        const Run& r = runs[i];
+        const unsigned mask = ((1u << r.width) - 1) << r.lo;
+        std::string val = "raw";
+
+        if (r.outPos > 0)
+            val = "(" + val + " >> " + std::to_string(r.outPos) + ")";
+        if (r.lo > 0)
+            val = "(" + val + " << " + std::to_string(r.lo) + ")";
+
+        out << "        d[" << r.byte << "] = static_cast<uint8_t>(";
+        if (mask == 0xFF)
+            out << val << ");\n";
+        else
+            out << "(d[" << r.byte << "] & " << Hex(~mask & 0xFF) << ") | (" << val << " & " << Hex(mask) << "));\n";
+    }
+    out << "    }\n";
+}
+
+static std::string Identifier(const std::string& in)
+{
+    std::string out;
+
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        char c = in[i];
+        if (isalnum(static_cast<unsigned char>(c)))
+            out += toupper(static_cast<unsigned char>(c));
+        else if (!out.empty() && out[out.size() - 1] != '_')
+            out += '_';
+    }
+    while (!out.empty() && out[out.size() - 1] == '_')
+        out.erase(out.size() - 1);
+    return out;
+}
+
+// Value texts often repeat the signal name ("LAD_MaxLadLeistung_HV +0W"), drop it
+static std::string StripSignalName(const Signal& sig, const std::string& text)
+{
+    size_t space = text.find(' ');
+
+    if (space != std::string::npos && space + 1 < text.size() && sig.name.compare(0, space, text, 0, space) == 0)
+        return text.substr(space + 1);
+    return text;
+}
+
+static void EmitValueTable(std::ostream& out, const Signal& sig)
+{
+    const std::string upper = Upper(sig.name);
+    std::string list;
+    std::set<std::string> used;
+
+    for (size_t i = 0; i < sig.values.size(); i++)
+    {
+        std::string text = StripSignalName(sig, sig.values[i].text);
+        std::string item;
+
+        for (size_t j = 0; j < text.size(); j++)
+        {
+            char c = (text[j] == ' ' || text[j] == '-') ? '_' : text[j];
+            if (c == '_' && !item.empty() && item[item.size() - 1] == '_')
+                continue;
+            if (c != ',' && c != '=' && c != '"' && c != '\\')
+                item += c;
+        }
+        list += (i ? ", " : "") + std::to_string(sig.values[i].value) + "=" + item;
+    }
+
+    out << "#define " << upper << "_ENUM \"" << list << "\"\n";
+    out << "enum " << sig.name << "_Enum\n{\n";
+    for (size_t i = 0; i < sig.values.size(); i++)
+    {
+        std::string name = Identifier(StripSignalName(sig, sig.values[i].text));
+
+        if (name.empty())
+            name = "VALUE";
+        if (isdigit(static_cast<unsigned char>(name[0])))
+            name = "V" + name;
+        name = upper + "_" + name;
+        if (!used.insert(name).second)
+        {
+            name += "_" + std::to_string(sig.values[i].value);
+            used.insert(name);
+        }
+        out << "    " << name << " = " << sig.values[i].value << (i + 1 < sig.values.size() ? "," : "") << "\n";
+    }
+    out << "};\n\n";
+}
+
+static void EmitSignal(std::ostream& out, const Signal& sig)
+{
+    const std::vector<Run> runs = BuildRuns(sig);
+    const std::string phys = PhysType(sig);
+
+    out << "\n";
+    if (!sig.comment.empty())
+        out << "    // " << sig.comment << "\n";
+    out << "    // " << sig.startBit << "|" << sig.length << "@" << (sig.intel ? 1 : 0) << (sig.isSigned ? "-" : "+")
+        << " (" << sig.factor << "," << sig.offset << ") " << sig.minMax << " \"" << sig.unit
+        << "\" Receiver: " << sig.receivers << "\n";
+
+    out << "    static constexpr " << RawType(sig) << " " << sig.name << "_Raw(const uint8_t* d)\n";
+    out << "    {\n        return " << DecodeExpr(sig, runs) << ";\n    }\n";
+
+    out << "    static constexpr " << phys << " " << sig.name << "(const uint8_t* d)\n    {\n        return ";
+    if (phys == RawType(sig))
+        out << sig.name << "_Raw(d)";
+    else if (phys == "float")
+    {
+        out << sig.name << "_Raw(d)";
+        if (sig.factor != 1)
+            out << " * " << FloatLiteral(sig.factor);
+        if (sig.offset != 0)
+            out << " + " << FloatLiteral(sig.offset);
+    }
+    else
+    {
+        out << "static_cast<" << phys << ">(" << sig.name << "_Raw(d))";
+        if (sig.factor != 1)
+            out << " * " << static_cast<long long>(sig.factor);
+        if (sig.offset != 0)
+            out << " + " << static_cast<long long>(sig.offset);
+    }
+    out << ";\n    }\n";
+
+    EmitEncode(out, sig, runs);
+}
+
+// Collects SIGNAL from every "#define SIGNAL_ENUM" line of a header
+static std::set<std::string> ReadKeptTables(const char* path)
+{
+    std::ifstream in(path);
+    std::set<std::string> kept;
+    std::string line;
+
+    if (!in)
+        Fail(std::string("cannot open ") + path);
+
+    while (std::getline(in, line))
+    {
+        std::istringstream ls(line);
+        std::string define, name;
+
+        ls >> define >> name;
+        if (define == "#define" && name.size() > 5 && name.compare(name.size() - 5, 5, "_ENUM") == 0)
+            kept.insert(name.substr(0, name.size() - 5));
+    }
+    return kept;
+}
+
+static void EmitHeader(const char* path, const char* dbcName, const std::vector<const Message*>& sel,
+                       const std::set<std::string>& kept)
+{
+    std::ofstream out(path);
+    std::set<std::string> tables;
+
+    out << "// Generated by tools/dbc_codegen from " << dbcName << "\n";
+    out << "// Do not edit, change the message list in the Makefile and run \"make dbc\"\n";
+    out << "#ifndef MLB_DBC_H\n#define MLB_DBC_H\n\n#include <stdint.h>\n\n";
+
+    for (size_t m = 0; m < sel.size(); m++)
+    {
+        for (size_t s = 0; s < sel[m]->signals.size(); s++)
+        {
+            const Signal& sig = sel[m]->signals[s];
+            if (!sig.values.empty() && !kept.count(Upper(sig.name)) && tables.insert(sig.name).second)
+                EmitValueTable(out, sig);
+        }
+    }
+
+    out << "namespace mlb_dbc\n{\n";
+    for (size_t m = 0; m < sel.size(); m++)
+    {
+        const Message& msg = *sel[m];
+
+        out << "\n// " << msg.name << " Sender: " << msg.sender << "\n";
+        out << "struct " << msg.name << "\n{\n";
+        out << "    enum : uint32_t\n    {\n        ID = " << Hex(msg.dbcId & 0x1FFFFFFF) << ",\n        DLC = "
+            << msg.dlc << "\n    };\n";
+        for (size_t s = 0; s < msg.signals.size(); s++)
+            EmitSignal(out, msg.signals[s]);
+        out << "};\n";
+    }
+    out << "\n} // namespace mlb_dbc\n\n#endif // MLB_DBC_H\n";
+}
+
+static void EmitLayout(const char* path, const char* dbcName, const std::vector<const Message*>& sel)
+{
+    std::ofstream out(path);
+
+    out << "// Generated by tools/dbc_codegen from " << dbcName << "\n";
+    out << "// DBC layout of every signal in mlb_dbc.h, used by the host tests\n";
+    out << "#ifndef MLB_DBC_LAYOUT_H\n#define MLB_DBC_LAYOUT_H\n\n#include \"mlb_dbc.h\"\n\n";
+    out << "struct MlbDbcSignal\n{\n"
+           "    uint32_t id;\n"
+           "    const char* name;\n"
+           "    uint8_t startBit;\n"
+           "    uint8_t length;\n"
+           "    bool intel;\n"
+           "    bool isSigned;\n"
+           "    double factor;\n"
+           "    double offset;\n"
+           "    uint64_t (*raw)(const uint8_t*);\n"
+           "    double (*phys)(const uint8_t*);\n"
+           "    void (*encode)(uint8_t*, uint64_t);\n"
+           "};\n\n";
+    out << "static const MlbDbcSignal mlbDbcSignals[] =\n{\n";
+
+    for (size_t m = 0; m < sel.size(); m++)
+    {
+        const Message& msg = *sel[m];
+
+        for (size_t s = 0; s < msg.signals.size(); s++)
+        {
+            const Signal& sig = msg.signals[s];
+            const std::string fn = "mlb_dbc::" + msg.name + "::" + sig.name;
+            char num[64];
+
+            snprintf(num, sizeof(num), "%.17g, %.17g", sig.factor, sig.offset);
+            out << "    { " << Hex(msg.dbcId & 0x1FFFFFFF) << ", \"" << sig.name << "\", " << sig.startBit << ", "
+                << sig.length << ", " << (sig.intel ? "true" : "false") << ", " << (sig.isSigned ? "true" : "false")
+                << ", " << num << ",\n"
+                << "      [](const uint8_t* d) -> uint64_t { return static_cast<uint64_t>(" << fn << "_Raw(d)); },\n"
+                << "      [](const uint8_t* d) -> double { return " << fn << "(d); },\n"
+                << "      [](uint8_t* d, uint64_t raw) { " << fn << "_Encode(d, static_cast<" << UnsignedType(sig)
+                << ">(raw)); } },\n";
+        }
+    }
+    out << "};\n\n#endif // MLB_DBC_LAYOUT_H\n";
+}
+
+int main(int argc, char** argv)
+{
+    std::set<std::string> kept;
+
+    if (argc > 2 && strcmp(argv[1], "-k") == 0)
+    {
+        kept = ReadKeptTables(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc < 5)
+    {
+        fprintf(stderr, "usage: %s [-k <keep.h>] <file.dbc> <header.h> <layout.h> <message>...\n", argv[0]);
+        return 1;
+    }
+
+    std::map<uint32_t, Message> msgs;
+    std::vector<const Message*> sel;
+
+    ParseDbc(argv[1], msgs);
+
+    for (int i = 4; i < argc; i++)
+    {
+        const Message* found = nullptr;
+
+        for (std::map<uint32_t, Message>::const_iterator it = msgs.begin(); it != msgs.end(); ++it)
+        {
+            if (it->second.name == argv[i])
+                found = &it->second;
+        }
+        if (!found)
+            Fail(std::string("message not found: ") + argv[i]);
+        for (size_t s = 0; s < found->signals.size(); s++)
+        {
+            if (found->signals[s].multiplexed)
+                Fail("multiplexed messages are not supported: " + found->name);
+        }
+        sel.push_back(found);
+    }
+
+    const char* dbcName = strrchr(argv[1], '/') ? strrchr(argv[1], '/') + 1 : argv[1];
+    EmitHeader(argv[2], dbcName, sel, kept);
+    EmitLayout(argv[3], dbcName, sel);
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Host tool: converts a binary capture of the "sniff" terminal command into
+ * candump log format, e.g. "(1700000000.123456) can2 41A#0102030405060708".
+ *
+ * Usage: sniff2candump <capture.bin> [start time in s]
+ *
+ * The capture is the raw byte stream of USART3, anything before the first
+ * "ZSNF" header (the echo of the command) is skipped, so are bytes between
+ * records that do not form a valid record. Timestamps add up the
+ * deltas of the records from the start time, 0 by default. Lost frames are
+ * reported on stderr, so the output stays readable by canplayer.
+ * The record format is documented in include/can_sniffer.h.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define MAGIC "ZSNF"
+#define VERSION 2
+#define SYNC 0xA5
+#define OVERFLOW 0x0F
+
+static bool ReadVarint(const std::vector<unsigned char>& in, size_t& pos, unsigned long long& value)
+{
+    value = 0;
+
+    for (int shift = 0; pos < in.size() && shift < 35; shift += 7)
+    {
+        const unsigned char b = in[pos++];
+
+        value |= (unsigned long long)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <capture.bin> [start time in s]\n", argv[0]);
+        return 1;
+    }
+
+    FILE* f = fopen(argv[1], "rb");
+    if (!f)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<unsigned char> in;
+    unsigned char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        in.insert(in.end(), chunk, chunk + n);
+    fclose(f);
+
+    size_t pos = 0;
+    const size_t magicLen = strlen(MAGIC);
+    while (pos + magicLen < in.size() && memcmp(&in[pos], MAGIC, magicLen) != 0)
+        pos++;
+
+    if (pos + magicLen >= in.size())
+    {
+        fprintf(stderr, "No capture header found\n");
+        return 1;
+    }
+    pos += magicLen;
+    if (in[pos++] != VERSION)
+    {
+        fprintf(stderr, "Unsupported capture version %d\n", in[pos - 1]);
+        return 1;
+    }
+
+    unsigned long long timeUs = (unsigned long long)(argc > 2 ? atof(argv[2]) * 1e6 : 0);
+    unsigned long frames = 0, lost = 0, skipped = 0;
+
+    while (pos < in.size())
+    {
+        if (in[pos] != SYNC || pos + 2 > in.size())
+        {
+            pos++;
+            skipped++;
+            continue;
+        }
+
+        const size_t start = pos;
+        const size_t end = pos + 2 + in[pos + 1];
+
+        if (end > in.size())
+        {
+            fprintf(stderr, "Truncated record at offset %zu\n", start);
+            break;
+        }
+
+        // Parse within the record only, a record that does not add up is
+        // taken for noise and the search for the next sync byte goes on
+        const std::vector<unsigned char> rec(in.begin() + start + 2, in.begin() + end);
+        size_t rpos = 0;
+
+        if (rec.empty())
+        {
+            pos++;
+            skipped++;
+            continue;
+        }
+
+        const unsigned char header = rec[rpos++];
+        const int iface = header >> 6;
+        const bool ext = (header & 0x10) != 0;
+        const int dlc = header & 0x0F;
+        unsigned long long delta, count;
+        bool valid = ReadVarint(rec, rpos, delta);
+
+        if (valid && dlc == OVERFLOW)
+            valid = ReadVarint(rec, rpos, count) && rpos == rec.size();
+        else if (valid)
+            valid = dlc <= 8 && rpos + (ext ? 4 : 2) + dlc == rec.size();
+
+        if (!valid)
+        {
+            pos++;
+            skipped++;
+            continue;
+        }
+
+        pos = end;
+        timeUs += delta;
+
+        if (dlc == OVERFLOW)
+        {
+            fprintf(stderr, "(%llu.%06llu) %llu frames lost\n", timeUs / 1000000, timeUs % 1000000, count);
+            lost += count;
+            continue;
+        }
+
+        const int idBytes = ext ? 4 : 2;
+        unsigned long id = 0;
+        for (int i = 0; i < idBytes; i++)
+            id |= (unsigned long)rec[rpos++] << (8 * i);
+
+        printf("(%llu.%06llu) can%d %0*lX#", timeUs / 1000000, timeUs % 1000000, iface + 1, ext ? 8 : 3, id);
+        for (int i = 0; i < dlc; i++)
+            printf("%02X", rec[rpos++]);
+        printf("\n");
+        frames++;
+    }
+
+    if (skipped > 0)
+        fprintf(stderr, "%lu bytes outside of records skipped\n", skipped);
+    fprintf(stderr, "%lu frames, %lu lost\n", frames, lost);
+    return 0;
+}